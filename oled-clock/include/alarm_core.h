@@ -0,0 +1,31 @@
+/**
+ * @file alarm_core.h
+ * @brief 闹钟下次响铃时刻计算（纯逻辑，可在主机编译）
+ *
+ * 闹钟按本地墙钟时间定义（时:分 + 星期掩码），换算 UTC 用 tz_engine 的偏移表：
+ * - 夏令时开始跳过的时间（如 02:30 不存在）：按跳变前的偏移换算，即顺延跳过的时长；
+ * - 夏令时结束重复的时间：只在第一次出现时响。
+ */
+#ifndef ALARM_CORE_H
+#define ALARM_CORE_H
+
+#include <stdint.h>
+
+#define ALARM_MAX        8
+#define ALARM_EVERY_DAY  0x7F
+
+struct Alarm {
+    uint8_t enabled;
+    uint8_t hour;
+    uint8_t minute;
+    uint8_t weekdays;       /* bit0 = 周日 … bit6 = 周六；0 表示只响一次 */
+};
+
+/** 本地秒数（自 1970-01-01 00:00 本地时间起）→ UTC */
+int64_t alarmLocalToUtc(int zone, int64_t localSec);
+/** 单个闹钟在 nowUtc 之后（不含）的下一次响铃时刻；未启用返回 -1 */
+int64_t alarmNextFireOne(const Alarm* a, int zone, int64_t nowUtc);
+/** 所有闹钟中最早的下一次响铃时刻，没有返回 -1；outIndex 可为 NULL */
+int64_t alarmNextFire(const Alarm* alarms, int count, int zone, int64_t nowUtc, int* outIndex);
+
+#endif
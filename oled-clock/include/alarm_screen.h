@@ -0,0 +1,15 @@
+/**
+ * @file alarm_screen.h
+ * @brief 闹钟页：闹钟列表（开关）、时间与重复星期编辑
+ */
+#ifndef ALARM_SCREEN_H
+#define ALARM_SCREEN_H
+
+#include "buttons.h"
+
+/** 进入闹钟页时调用 */
+void alarmScreenEnter(void);
+void alarmScreenHandleButtons(ButtonEvent left, ButtonEvent center, ButtonEvent right);
+void alarmScreenDraw(void);
+
+#endif
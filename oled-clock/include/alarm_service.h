@@ -0,0 +1,37 @@
+/**
+ * @file alarm_service.h
+ * @brief 闹钟服务：存在设置块中、只维护一个「下次响铃」时刻，用单次 esp_timer 触发
+ *
+ * 下次响铃时刻只在闹钟增删改、时区切换、NTP 对时和每次响铃后重算，每帧不扫描闹钟列表。
+ * 睡眠模式可用 alarmServiceNextFire() 设置定时唤醒。
+ */
+#ifndef ALARM_SERVICE_H
+#define ALARM_SERVICE_H
+
+#include <Arduino.h>
+#include "alarm_core.h"
+
+#define ALARM_RING_MS   60000
+
+/** setup() 中、恢复系统时间之后调用：从设置存储读闹钟并安排下次响铃 */
+void alarmServiceBegin(void);
+/** 墙钟或时区变化后调用 */
+void alarmServiceReschedule(void);
+/** 每帧调用：响铃后的收尾（单次闹钟关闭并保存、重算下次） */
+void alarmServiceLoop(void);
+/** 按「index 号闹钟在 utc 已到点」处理（深睡期间到点、唤醒后补响） */
+void alarmServiceFireMissed(int index, int64_t utc);
+/** 取走「刚响铃」的闹钟下标，没有返回 -1 */
+int alarmServiceTakeFired(void);
+
+int alarmServiceCount(void);
+bool alarmServiceGet(int index, Alarm* out);
+/** 修改 / 新增（index == count）/ 删除；成功后保存并重算 */
+bool alarmServiceSet(int index, const Alarm* a);
+bool alarmServiceRemove(int index);
+/** 下次响铃的 UTC 秒数；没有返回 false */
+bool alarmServiceNextFire(int64_t* outUtc, int* outIndex);
+
+void alarmServiceWriteJson(Print& out);
+
+#endif
@@ -1,12 +1,25 @@
 /**
  * @file app_state.h
  * @brief 应用状态与各页面共享的全局变量
+ *
+ * 会被多处读写的多字节状态按领域分块（天气、配置、日历、倒计时页、秒表），每块是一个 SeqBlock：
+ * 写者发布整块或在 SeqWrite 作用域内原地修改，读者用 read / get 取一致快照，不会读到写了一半的字符串。
+ * 同一块的 SeqWrite 不可嵌套。只在 loop 任务中使用的导航状态（当前页、菜单、闹钟页）仍是普通变量。
  */
 #ifndef APP_STATE_H
 #define APP_STATE_H
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "stopwatch_core.h"
+#include "alarm_core.h"
+#include "arena.h"
+#include "seqlock.h"
+#include "stall_core.h"
+
+/* loop 任务的临时区域：天气拉取与 HTTP 请求各在自己的 ARENA_SCOPE 内使用，互不嵌套；
+ * 最大的是圈速导出：秒表快照约 1.6KB + 分块发送缓冲 512B */
+#define SCRATCH_ARENA_BYTES  2560
 
 enum AppState {
     STATE_MENU,
@@ -14,35 +27,72 @@ enum AppState {
     STATE_CALENDAR,
     STATE_WEATHER,
     STATE_TIMER,
-    STATE_STOPWATCH
+    STATE_STOPWATCH,
+    STATE_ALARM
+};
+
+#define WEATHER_LOCATION_MAX  32
+
+/* 天气显示缓存：拉取完成时整块发布 */
+struct WeatherState {
+    char cityName[16];
+    char temp[8];
+    char text[8];
+    int iconCode;
+    uint32_t lastFetchMs;       /* 0 表示需要重新拉取 */
+};
+
+/* 用户配置（Web 页写、天气拉取读） */
+struct ConfigState {
+    char weatherLocation[WEATHER_LOCATION_MAX];   /* 心知天气城市 ID */
+};
+
+/* 日历页显示的年月 */
+struct CalendarState {
+    int year;
+    int month;
 };
 
-// 主菜单与日历
+/* 倒计时页：选中的一路与编辑缓冲（各路状态在 timer_engine） */
+struct TimerPageState {
+    int sel;
+    bool editing;
+    uint8_t digits[4];
+    int digitPos;
+};
+
+/* 秒表（页面与 /api/laps 共用） */
+struct StopwatchState {
+    StopwatchCore core;
+    bool showLaps;              /* 页面显示圈速列表 */
+};
+
+// 主菜单
 extern AppState g_state;
 extern int g_menuIndex;
-extern int g_calYear;
-extern int g_calMonth;
 
-// 秒表
-extern uint32_t g_stopwatchAccumulatedMs;
-extern uint32_t g_stopwatchRunStartMillis;
+extern SeqBlock<CalendarState> g_calendar;
+extern SeqBlock<StopwatchState> g_stopwatch;
 
 // NTP
 extern bool g_ntpSynced;
 
-// 倒计时
-extern uint8_t g_timerDigits[4];
-extern int g_timerDigitPos;
-extern bool g_timerRunning;
-extern uint32_t g_timerEndMillis;
-
-// 天气（城市 ID、显示缓存）
-extern char g_weatherLocation[32];
-extern char g_weatherCityName[16];
-extern char g_weatherTemp[8];
-extern char g_weatherText[8];
-extern int g_weatherIconCode;
-extern uint32_t g_weatherLastFetch;
+extern SeqBlock<TimerPageState> g_timerPage;
+
+// 闹钟页（列表选中项；编辑时的草稿与光标所在字段）
+extern int g_alarmSel;
+extern bool g_alarmEditing;
+extern int g_alarmField;
+extern Alarm g_alarmDraft;
+
+extern SeqBlock<WeatherState> g_weather;
+extern SeqBlock<ConfigState> g_config;
+
+// 临时内存（只在 loop 任务中使用）
+extern Arena g_scratchArena;
+
+// loop 的心跳与当前阶段（loop 写，卡顿监测任务读）
+extern LoopBeat g_loopBeat;
 
 void appStateInit(void);
 
@@ -0,0 +1,52 @@
+/**
+ * @file arena.h
+ * @brief 区域分配器（纯逻辑，可在主机编译）：在固定缓冲区上顺序分配，按作用域一次性归还
+ *
+ * 一次天气拉取、一个 HTTP 请求的临时内存都从同一块区域里按指针递增分配，
+ * 作用域结束时退回到进入时的位置，不逐个释放，也不在全局堆上留下空洞。
+ * 超出容量时 arenaAlloc 返回 NULL 并计数，不向堆借用，调用方按失败处理。
+ * 没有锁：一个 Arena 只在一个任务中使用。
+ */
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* 分配对齐（字节），满足 double / int64_t */
+#define ARENA_ALIGN  8
+
+struct Arena {
+    uint8_t* base;
+    size_t capacity;
+    size_t used;
+    size_t highWater;       /* 开机以来 used 的最大值 */
+    uint32_t allocs;        /* 成功分配次数 */
+    uint32_t failures;      /* 超出容量的次数 */
+};
+
+void arenaInit(Arena* a, void* buf, size_t capacity);
+/** 按 ARENA_ALIGN 对齐分配 size 字节（不清零）；超出容量返回 NULL */
+void* arenaAlloc(Arena* a, size_t size);
+/** 当前位置，交给 arenaRelease 退回 */
+size_t arenaMark(const Arena* a);
+/** 退回到 mark，其后分配的内存全部作废 */
+void arenaRelease(Arena* a, size_t mark);
+size_t arenaRemaining(const Arena* a);
+
+class ArenaScope {
+public:
+    explicit ArenaScope(Arena* a) : m_arena(a), m_mark(arenaMark(a)) {}
+    ~ArenaScope() { arenaRelease(m_arena, m_mark); }
+private:
+    ArenaScope(const ArenaScope&);
+    ArenaScope& operator=(const ArenaScope&);
+    Arena* m_arena;
+    size_t m_mark;
+};
+
+#define ARENA_CONCAT_(a, b) a##b
+#define ARENA_CONCAT(a, b)  ARENA_CONCAT_(a, b)
+#define ARENA_SCOPE(arena)  ArenaScope ARENA_CONCAT(arenaScope_, __LINE__)(arena)
+
+#endif
@@ -0,0 +1,22 @@
+/**
+ * @file buzzer.h
+ * @brief 蜂鸣器：非阻塞节奏提醒（esp_timer 驱动，不占用 loop）
+ */
+#ifndef BUZZER_H
+#define BUZZER_H
+
+#include <stdint.h>
+
+#define BUZZER_PIN          23
+#define BUZZER_LEDC_CHANNEL 0
+#define BUZZER_FREQ_HZ      2000
+#define BUZZER_ALARM_MS     10000
+
+/** setup() 中调用：配置引脚与 LEDC 通道 */
+void buzzerBegin(void);
+/** 开始「嘀嘀——」节奏提醒，持续 durationMs；已在响则重新计时 */
+void buzzerAlarm(uint32_t durationMs);
+void buzzerStop(void);
+bool buzzerIsActive(void);
+
+#endif
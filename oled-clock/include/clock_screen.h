@@ -1,11 +1,12 @@
 /**
  * @file clock_screen.h
- * @brief 时钟页与 NTP 同步
+ * @brief 时钟页
  */
 #ifndef CLOCK_SCREEN_H
 #define CLOCK_SCREEN_H
 
-bool clockScreenSyncNtp(void (*drawNtp)(const char*, int), int maxTries, int intervalMs);
+/** 右键：底部切换显示对时详情（偏差 / 延迟 / 漂移 / 对时时长） */
+void clockScreenToggleDetail(void);
 void clockScreenDraw(void);
 
 #endif
@@ -0,0 +1,77 @@
+/**
+ * @file config_blob.h
+ * @brief 设置的版本化二进制格式（纯逻辑，可在主机编译）：字段表驱动的 TLV 编解码、CRC、版本迁移
+ *
+ * 布局：16 字节头（魔数、格式版本、负载长度、累计写入次数、CRC-32）+ 负载。
+ * 负载是一串记录「标签 1B + 长度 1B + 数据」，由 CONFIG_FIELDS 字段表描述：
+ * - 解码时不认识的标签跳过（新固件写的设置降级后仍能读出其余字段）；
+ * - 缺少的标签保持默认值（旧版本没有的字段取默认，无须为新增字段写迁移）；
+ * - 只有字段含义改变时才升版本号，并在 configMigrate 中补一步转换。
+ * 字符串字段存名字而非下标（时区、档位表重排后设置不会错位），空串表示用固件默认值。
+ */
+#ifndef CONFIG_BLOB_H
+#define CONFIG_BLOB_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "alarm_core.h"
+
+#define CONFIG_BLOB_MAGIC     0x47464356u   /* "VCFG" */
+#define CONFIG_SCHEMA_VERSION 1
+#define CONFIG_HEADER_BYTES   16
+/* 全部字段取最大长度时的编码长度（当前 150 字节），留出新增字段的余量 */
+#define CONFIG_BLOB_MAX       256
+
+#define CONFIG_STR_MAX        32
+#define CONFIG_NAME_MAX       16
+
+struct ConfigData {
+    char weatherLocation[CONFIG_STR_MAX];   /* 心知天气城市 ID */
+    char tzName[CONFIG_STR_MAX];            /* 时区名，见 tz_engine */
+    char netPolicy[CONFIG_NAME_MAX];        /* 联网策略名 */
+    char powerProfile[CONFIG_NAME_MAX];     /* 功耗档位名，"auto" 为自动 */
+    uint8_t alarmCount;
+    Alarm alarms[ALARM_MAX];
+};
+
+enum ConfigLoadResult {
+    CONFIG_LOAD_OK = 0,
+    CONFIG_LOAD_MIGRATED,       /* 旧版本格式，已迁移到当前版本 */
+    CONFIG_LOAD_BAD_MAGIC,      /* 不是设置数据 */
+    CONFIG_LOAD_BAD_LENGTH,     /* 截断或长度字段不符 */
+    CONFIG_LOAD_BAD_CRC,
+    CONFIG_LOAD_BAD_RECORD      /* 记录越界 */
+};
+
+/** 改用设置块之前逐键保存的旧设置（第 0 版），没有的键为 NULL / 0 */
+struct ConfigLegacy {
+    const char* weatherLocation;    /* "wloc" */
+    const char* tzName;             /* "tz" */
+    const char* netPolicy;          /* "netpol" */
+    const char* powerProfile;       /* "pprof" */
+    const uint8_t* alarms;          /* "alarms"：Alarm 数组的原始字节 */
+    size_t alarmsLen;
+};
+
+/** 全部字段清为默认（空串、无闹钟） */
+void configDefaults(ConfigData* c);
+/** 第 0 版 → 当前版本：放不下的字符串取默认，闹钟字节数不整齐整体丢弃、越界字段丢弃该条 */
+void configFromLegacy(const ConfigLegacy* legacy, ConfigData* out);
+/** 按字段表编码，返回写入字节数；cap 不够返回 0。writes 写进头部 */
+size_t configEncode(const ConfigData* c, uint32_t writes, uint8_t* out, size_t cap);
+/**
+ * 解码并校验；失败时 out 为默认值。outWrites 为头部记录的累计写入次数（可为 NULL），
+ * 魔数与长度正确时即给出（CRC 或记录出错也一样），否则不改动；
+ * 旧版本的数据经 configMigrate 转换后返回 CONFIG_LOAD_MIGRATED
+ */
+ConfigLoadResult configDecode(const uint8_t* data, size_t len, ConfigData* out, uint32_t* outWrites);
+/** 把 fromVersion 版本解出的字段逐步转换到 CONFIG_SCHEMA_VERSION */
+void configMigrate(ConfigData* c, uint16_t fromVersion);
+
+/** 两份编码的负载（不含头部的写入次数与 CRC）是否相同，用于跳过无变化的写入 */
+bool configSamePayload(const uint8_t* a, size_t aLen, const uint8_t* b, size_t bLen);
+
+uint32_t configCrc32(const uint8_t* data, size_t len);
+const char* configLoadResultName(ConfigLoadResult r);
+
+#endif
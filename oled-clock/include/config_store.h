@@ -0,0 +1,37 @@
+/**
+ * @file config_store.h
+ * @brief 设置存储：开机一次 NVS 读入内存，在内存中修改，防抖合并后整块写回
+ *
+ * 多项设置连续修改（配置页一次提交城市、时区、档位，或连着改几个闹钟）只写一次 Flash；
+ * 写前与上次写入的编码比较，没变化就跳过。头部的累计写入次数随设置块保存，用于估算磨损。
+ * 修改后 CONFIG_STORE_DEBOUNCE_MS 内断电会丢失这次修改；重启、深睡前调用 configStoreFlush。
+ * 只在 loop 任务中使用（Web 处理函数也在 loop 中运行），不加锁。
+ */
+#ifndef CONFIG_STORE_H
+#define CONFIG_STORE_H
+
+#include <Arduino.h>
+#include "config_blob.h"
+
+/* 最后一次修改之后静默这么久才写 */
+#define CONFIG_STORE_DEBOUNCE_MS   5000
+/* 持续修改时，距第一次未保存的修改最多这么久也要写 */
+#define CONFIG_STORE_MAX_DELAY_MS  30000
+
+/** setup() 中最先调用：读设置块；没有则从旧的逐键设置迁移 */
+void configStoreBegin(void);
+/** 每帧调用：防抖到期时写回 */
+void configStoreLoop(void);
+/** 有未保存的修改立即写回（重启、深睡前） */
+void configStoreFlush(void);
+
+/** 当前设置（内存副本） */
+const ConfigData* configStoreGet(void);
+/** 取可写副本并标记为待写；改完即可，不需要提交 */
+ConfigData* configStoreEdit(void);
+
+/** 设置块累计写入 Flash 的次数（随设置块保存，跨重启累计） */
+uint32_t configStoreWrites(void);
+void configStoreWritePrometheus(Print& out);
+
+#endif
@@ -22,6 +22,8 @@
 #define BATTERY_ICON_H  10
 #define BATTERY_ICON_X  (SCREEN_W - BATTERY_ICON_W - 2)
 #define BATTERY_ICON_Y  3
+#define PROFILE_MARK_X  (BATTERY_ICON_X - 6)
+#define PROFILE_MARK_Y  9
 
 #define BIG_W      24
 #define BIG_H      32
@@ -33,11 +35,17 @@
 extern U8G2_SH1106_128X64_NONAME_F_HW_I2C u8g2;
 
 void displayInit(void);
+/** 把缓冲区刷到屏幕，并交给画面镜像（/live）；各页面统一调用此函数而非 u8g2.sendBuffer() */
+void displaySendBuffer(void);
 void displayTopBarBackground(void);
 void displayWiFiIcon(int x, int y, bool connected);
 void displayBatteryIcon(int x, int y, int percent);
+/** 顶栏右侧：电池图标（电源调节平滑后的电量）与当前电源档位标记 */
+void displayPowerStatus(void);
+/** 直接读 ADC（约 24ms）；页面用 displayPowerStatus，由电源调节定时调用本函数 */
 int displayGetBatteryPercent(void);
 
+/** second 为负时不显示秒、冒号常亮 */
 void displayDrawTime(int hour, int minute, int second);
 void displayDrawBigDigit(int x, int y, int d);
 void displayDrawMiniDigit(int x, int y, int d);
@@ -0,0 +1,44 @@
+/**
+ * @file drift_estimator.h
+ * @brief 本地时钟漂移估计（纯逻辑，可在主机编译）
+ *
+ * 每次对时得到「距上次对时的间隔」与「测得的偏差」，单个样本的漂移
+ *   ppm = offsetMs × 1000 / intervalS
+ * 按样本误差的倒数平方加权、带指数遗忘地平均；偏离当前估计过多的样本视为异常丢弃。
+ */
+#ifndef DRIFT_ESTIMATOR_H
+#define DRIFT_ESTIMATOR_H
+
+#include <stdint.h>
+
+#define DRIFT_MIN_INTERVAL_S   60       /* 间隔太短时偏差被测量误差淹没，不作为样本 */
+#define DRIFT_FORGET           0.8f     /* 每个新样本到来时旧样本权重的衰减 */
+#define DRIFT_OUTLIER_SIGMA    5.0f
+#define DRIFT_MIN_SAMPLES_FOR_OUTLIER  3
+
+struct DriftEstimator {
+    float sumW;         /* Σ λ^k · w */
+    float sumWX;        /* Σ λ^k · w · x */
+    float sumWXX;       /* Σ λ^k · w · x²，用于估计离散程度 */
+    uint32_t samples;
+    uint32_t rejected;
+};
+
+void driftEstimatorReset(DriftEstimator* d);
+/**
+ * 加入一个样本。offsetErrMs 为该次偏差测量的误差（含往返延迟的一半等）。
+ * 返回 true 表示样本被采纳。
+ */
+bool driftEstimatorAdd(DriftEstimator* d, float intervalS, float offsetMs, float offsetErrMs);
+/** 当前漂移估计（ppm，正值表示本地时钟偏慢）；无样本时返回 0 */
+float driftEstimatorPpm(const DriftEstimator* d);
+/** 当前估计的标准差（ppm）；样本不足时返回负值 */
+float driftEstimatorSigmaPpm(const DriftEstimator* d);
+/**
+ * 按漂移估计安排下次对时间隔：让累计误差约等于 targetErrMs，并限制在 [minS, maxS]。
+ * 没有样本时返回 defaultS。
+ */
+uint32_t driftNextIntervalS(const DriftEstimator* d, uint32_t targetErrMs,
+                            uint32_t minS, uint32_t maxS, uint32_t defaultS);
+
+#endif
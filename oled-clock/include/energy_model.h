@@ -0,0 +1,113 @@
+/**
+ * @file energy_model.h
+ * @brief 能耗核算（纯逻辑）：活动计数 × 每项电流常数 → 各子系统 mAh 与平均电流
+ *
+ * 计数由固件（energy_service）或主机模拟（tools/energy_sim.cpp）提供，两边用同一套常数和算法，
+ * 改动固件后可以先在主机上模拟一天，按子系统比较 mAh 的变化。常数是按手册 / 典型值取的估算，不是实测。
+ */
+#ifndef ENERGY_MODEL_H
+#define ENERGY_MODEL_H
+
+#include <stdint.h>
+
+/* sendBuffer 一帧的 I2C 字节数：8 页 × (128 数据 + 3 条页 / 列地址命令)，另加每次传输的地址与控制字节 */
+#define ENERGY_SH1106_FRAME_BYTES   (8 * (128 + 3) + 8 * 4)
+/* 电量 ADC 每次读取的采样数（displayGetBatteryPercent） */
+#define ENERGY_ADC_SAMPLES_PER_READ 8
+
+/*
+ * 默认常数（ESP32-WROOM-32E + SH1106，按手册 / 典型值估算），可在 platformio.ini 的 build_flags
+ * 中用 -D 覆盖；主机模拟用同一组默认值。
+ */
+#ifndef ENERGY_ACTIVE_MA
+#define ENERGY_ACTIVE_MA        50.0f    /* 240MHz 双核运行 */
+#endif
+#ifndef ENERGY_IDLE_MA
+#define ENERGY_IDLE_MA          20.0f    /* 80MHz 空闲 waiti */
+#endif
+#ifndef ENERGY_LIGHT_SLEEP_MA
+#define ENERGY_LIGHT_SLEEP_MA   0.8f
+#endif
+#ifndef ENERGY_RADIO_MA
+#define ENERGY_RADIO_MA         25.0f    /* 连接状态 modem sleep（DTIM1）的平均额外电流 */
+#endif
+#ifndef ENERGY_TLS_MAS
+#define ENERGY_TLS_MAS          60.0f    /* 约 1s 的 RSA / ECDHE 运算与收发突发 */
+#endif
+#ifndef ENERGY_I2C_US_PER_BYTE
+#define ENERGY_I2C_US_PER_BYTE  22.5f    /* 400kHz，9 位 / 字节 */
+#endif
+#ifndef ENERGY_I2C_BUS_MA
+#define ENERGY_I2C_BUS_MA       1.0f     /* 4.7k 上拉约一半占空 + 控制器接收 */
+#endif
+#ifndef ENERGY_DISPLAY_MA
+#define ENERGY_DISPLAY_MA       12.0f    /* 对比度 255、约 25% 像素点亮 */
+#endif
+#ifndef ENERGY_ADC_MAS
+#define ENERGY_ADC_MAS          0.003f   /* 每次采样约 1mA × 3ms */
+#endif
+#ifndef ENERGY_BUZZER_MA
+#define ENERGY_BUZZER_MA        30.0f    /* 无源蜂鸣器经三极管驱动，发声时 */
+#endif
+#ifndef ENERGY_BATTERY_MAH
+#define ENERGY_BATTERY_MAH      1000.0f
+#endif
+
+enum EnergyItem {
+    ENERGY_CPU_ACTIVE,       /* 帧工作（满频，不含 I2C 传输时间） */
+    ENERGY_CPU_IDLE,         /* 帧间阻塞等待（降频；自动浅睡模式下含自动浅睡） */
+    ENERGY_CPU_LIGHT_SLEEP,  /* 手动浅睡 */
+    ENERGY_RADIO,            /* 射频开启期间在 CPU 之外多出的电流 */
+    ENERGY_TLS,              /* TLS 握手的加解密突发 */
+    ENERGY_I2C,              /* sendBuffer：传输期间的 CPU 满频 + 总线上拉 */
+    ENERGY_DISPLAY,          /* 屏幕面板，按亮度加权 */
+    ENERGY_ADC,
+    ENERGY_BUZZER,
+    ENERGY_ITEM_COUNT
+};
+
+/* 累计计数；两次快照相减即一段时间内的计数 */
+struct EnergyCounters {
+    uint64_t elapsedUs;
+    uint64_t activeUs;
+    uint64_t idleUs;
+    uint64_t lightSleepUs;
+    uint64_t radioOnUs;
+    uint64_t panelUs;        /* 屏幕点亮时间 × 对比度 / 255 */
+    uint64_t buzzerOnUs;
+    uint64_t i2cBytes;
+    uint32_t tlsHandshakes;
+    uint32_t adcSamples;
+};
+
+struct EnergyModel {
+    float activeMa;          /* 240MHz 运行、无射频 */
+    float idleMa;            /* 80MHz 阻塞等待 */
+    float lightSleepMa;
+    float radioMa;           /* 射频开启（含 modem sleep 的平均）额外电流 */
+    float tlsMas;            /* 每次 TLS 握手额外电荷，mA·s */
+    float i2cUsPerByte;      /* 400kHz 下每字节 9 位 */
+    float i2cBusMa;          /* 传输期间上拉与屏幕控制器的额外电流 */
+    float displayMa;         /* 对比度 255 时的面板电流 */
+    float adcMas;            /* 每次采样（含 3ms 间隔内的 ADC 偏置），mA·s */
+    float buzzerMa;
+};
+
+struct EnergyReport {
+    float hours;                         /* 覆盖的时长 */
+    float mah[ENERGY_ITEM_COUNT];
+    float totalMah;
+};
+
+/** 用上面的默认常数填充 */
+void energyModelDefaults(EnergyModel* m);
+const char* energyItemName(EnergyItem item);
+/** out = a - b */
+void energyCountersDelta(const EnergyCounters* a, const EnergyCounters* b, EnergyCounters* out);
+void energyModelCompute(const EnergyModel* m, const EnergyCounters* c, EnergyReport* out);
+/** 该项的平均电流（mA，即每小时 mAh），item 为 -1 时为合计；时长为 0 时返回 0 */
+float energyReportMa(const EnergyReport* r, int item);
+/** 按当前平均电流，batteryMah 可用的小时数 */
+float energyReportHours(const EnergyReport* r, float batteryMah);
+
+#endif
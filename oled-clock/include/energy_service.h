@@ -0,0 +1,37 @@
+/**
+ * @file energy_service.h
+ * @brief 能耗核算服务：收集各子系统的活动计数，按 energy_model 估算 mAh，输出到串口 / Web / /metrics
+ *
+ * CPU 驻留、射频开启、屏幕亮度时间取自 power_service / net_service / power_governor 已有的统计；
+ * TLS 握手、I2C 字节、ADC 采样、蜂鸣器发声由各模块调用下面的计数接口。
+ * 除开机以来的累计外，每 ENERGY_WINDOW_MS 结算一个窗口，便于改了设置后看近期电流。
+ */
+#ifndef ENERGY_SERVICE_H
+#define ENERGY_SERVICE_H
+
+#include <Arduino.h>
+#include "energy_model.h"
+
+#define ENERGY_WINDOW_MS   (15UL * 60 * 1000)
+
+/** 计数接口：可在任意任务中调用 */
+void energyCountTls(void);
+void energyCountI2c(uint32_t bytes);
+void energyCountAdc(uint32_t samples);
+/** 蜂鸣器开始 / 停止发声 */
+void energyBuzzer(bool on);
+
+/** 每帧调用（loop 任务）：到时结算窗口 */
+void energyServiceLoop(void);
+/** 开机以来的累计计数（loop 任务中调用） */
+void energyServiceSnapshot(EnergyCounters* out);
+/** window 为 true 时返回上一个完整窗口（还没有时返回 false），否则为开机以来 */
+bool energyServiceReport(bool window, EnergyReport* out);
+
+/** 串口表格：各子系统 mAh 与平均电流（串口命令 'e'） */
+void energyServiceDump(Print& out);
+/** GET /api/energy 的 JSON */
+void energyServiceWriteJson(Print& out);
+void energyServiceWritePrometheus(Print& out);
+
+#endif
@@ -0,0 +1,64 @@
+/**
+ * @file fixed_string.h
+ * @brief 定长字符串（纯逻辑，可在主机编译）：在栈上或静态缓冲区里拼接，不分配堆内存
+ *
+ * Arduino String 每次拼接都可能 realloc，长时间运行后把没有 PSRAM 的堆切碎，
+ * 直到 TLS 申请不到连续的大块。StrBuilder 包装调用方给的缓冲区，FixedString<N> 自带缓冲区；
+ * 超出容量时截断并记下 truncated()，不会越界，调用方据此决定丢弃还是将就使用。
+ */
+#ifndef FIXED_STRING_H
+#define FIXED_STRING_H
+
+#include <stddef.h>
+#include <stdarg.h>
+
+class StrBuilder {
+public:
+    /** buf 至少 1 字节，末尾总留一个 '\0' */
+    StrBuilder(char* buf, size_t cap);
+
+    StrBuilder& append(const char* s);
+    StrBuilder& append(const char* s, size_t n);
+    StrBuilder& append(char c);
+    StrBuilder& appendf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+    StrBuilder& vappendf(const char* fmt, va_list ap);
+    /** 去掉首尾空白（空格、制表、换行） */
+    void trim(void);
+    void clear(void);
+
+    const char* c_str(void) const { return m_buf; }
+    size_t length(void) const { return m_len; }
+    size_t capacity(void) const { return m_cap - 1; }
+    bool empty(void) const { return m_len == 0; }
+    /** 有内容因容量不足被丢掉（clear 后复位） */
+    bool truncated(void) const { return m_truncated; }
+
+protected:
+    /* 子类复制时换成自己的缓冲区 */
+    void assign(const StrBuilder& other);
+
+private:
+    StrBuilder(const StrBuilder&);
+    StrBuilder& operator=(const StrBuilder&);
+    char* m_buf;
+    size_t m_cap;
+    size_t m_len;
+    bool m_truncated;
+};
+
+/** 自带 N 字节缓冲区（含结尾 '\0'），可按值复制 */
+template <size_t N>
+class FixedString : public StrBuilder {
+public:
+    FixedString() : StrBuilder(m_data, N) {}
+    explicit FixedString(const char* s) : StrBuilder(m_data, N) { append(s); }
+    FixedString(const FixedString& other) : StrBuilder(m_data, N) { assign(other); }
+    FixedString& operator=(const FixedString& other) {
+        if (this != &other) assign(other);
+        return *this;
+    }
+private:
+    char m_data[N];
+};
+
+#endif
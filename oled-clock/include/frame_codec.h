@@ -0,0 +1,37 @@
+/**
+ * @file frame_codec.h
+ * @brief 帧缓冲编解码：整帧 / 按页 XOR 差分 + 游程编码（纯逻辑，可在主机编译）
+ *
+ * 消息格式：
+ *   [0]   类型：FRAME_MSG_KEY（相对全 0 帧）或 FRAME_MSG_DELTA（相对上一帧）
+ *   [1]   页掩码：bit p = 第 p 页（8 像素行 × 128 列）有变化，其后按页序排列
+ *   每页：游程流，解出恰好 FRAME_W 个 XOR 字节
+ *     c < 0x80  → 其后 c+1 个原样字节
+ *     c >= 0x80 → 下一字节重复 (c & 0x7f) + 2 次
+ */
+#ifndef FRAME_CODEC_H
+#define FRAME_CODEC_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define FRAME_W       128
+#define FRAME_PAGES   8
+#define FRAME_BYTES   (FRAME_W * FRAME_PAGES)
+
+#define FRAME_MSG_KEY    0x01
+#define FRAME_MSG_DELTA  0x02
+
+/* 最坏情况：每页全为原样字节 */
+#define FRAME_CODEC_MAX_OUT  (2 + FRAME_PAGES * (FRAME_W + FRAME_W / 128))
+
+/**
+ * 编码一帧。prev 为 NULL 时生成关键帧。
+ * 返回消息长度；差分帧无变化时返回 0（无需发送）；cap 不足返回 0。
+ */
+size_t frameEncode(const uint8_t* cur, const uint8_t* prev, uint8_t* out, size_t cap);
+
+/** 把一条消息应用到 fb（关键帧先清零）。格式错误返回 false，fb 内容不保证。 */
+bool frameDecode(const uint8_t* msg, size_t len, uint8_t* fb);
+
+#endif
@@ -0,0 +1,32 @@
+/**
+ * @file heap_monitor.h
+ * @brief 堆碎片监测：定时采样最大空闲块，记录开机以来与每小时的最低值，低于 TLS 所需连续块时告警
+ *
+ * mbedTLS 握手要一次申请约 16KB 的接收记录缓冲区，空闲总量够而最大空闲块不够时拉取天气就会失败。
+ * 每小时最低值保留最近 HEAP_MON_HISTORY_HOURS 小时，两个固件各跑三天后比较 /api/heap 即得浸泡对比。
+ */
+#ifndef HEAP_MONITOR_H
+#define HEAP_MONITOR_H
+
+#include <Arduino.h>
+
+#define HEAP_MON_SAMPLE_MS       5000
+#define HEAP_MON_HISTORY_HOURS   72
+/* TLS 工作集中最大的单块：16KB 接收记录缓冲区 + 记录头与分配器开销，留 1KB 余量 */
+#define HEAP_MON_TLS_BLOCK       (16 * 1024 + 1024)
+/* 告警后最大空闲块回到阈值以上这么多才解除，采样抖动不会反复告警 */
+#define HEAP_MON_REARM_BYTES     2048
+
+/** 每帧调用：到时采样 */
+void heapMonitorLoop(void);
+/** 立即采样（tag 为调用方，用于告警日志），返回最大空闲块是否够一次 TLS 握手 */
+bool heapMonitorCheck(const char* tag);
+
+/** 开机以来最大空闲块的最低值 */
+uint32_t heapMonitorMinLargestBlock(void);
+
+/** GET /api/heap：当前值、开机以来最低值、告警次数、每小时最低值（旧到新）、loop 临时区域用量 */
+void heapMonitorWriteJson(Print& out);
+void heapMonitorWritePrometheus(Print& out);
+
+#endif
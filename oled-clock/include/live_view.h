@@ -0,0 +1,15 @@
+/**
+ * @file live_view.h
+ * @brief 画面镜像：WebSocket 推送帧缓冲到浏览器 /live 页面
+ */
+#ifndef LIVE_VIEW_H
+#define LIVE_VIEW_H
+
+#include <stdint.h>
+
+/** 启动 WebSocket 服务与镜像任务（握手、编码、发送都在该任务中） */
+void liveViewBegin(void);
+/** 每次 sendBuffer 后调用；无客户端时立即返回，有客户端时按限速把帧缓冲交给镜像任务 */
+void liveViewOnFrame(const uint8_t* fb);
+
+#endif
@@ -0,0 +1,88 @@
+/**
+ * @file log_ring.h
+ * @brief 二进制日志环形缓冲（纯逻辑，可在主机编译）：调用处只记录格式串指针与参数，格式化推迟到取出时
+ *
+ * 每条记录定长：时间戳、级别、格式串指针、最多 LOG_MAX_ARGS 个 64 位参数槽（整数符号扩展，
+ * 浮点按 double 位模式，指针按地址）。多个任务可同时写、一个任务取：
+ * - 写者用 CAS 认领槽位（head 加一），写完把槽位的 seq 置为「槽号 + 1」发布；
+ * - 取者只在 seq 对上时取走并推进 tail，写了一半的槽位留到下次；
+ * - 满时丢弃新记录并计数，写者从不等待。
+ * %s 参数只存指针，取出时才读：只能传字符串字面量或静态表里的名字，不能传栈上或 String 的缓冲区。
+ */
+#ifndef LOG_RING_H
+#define LOG_RING_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+/* 槽位数，须为 2 的幂 */
+#define LOG_RING_SIZE   32
+#define LOG_MAX_ARGS    6
+
+enum LogLevel {
+    LOG_ERROR = 0,
+    LOG_WARN,
+    LOG_INFO,
+    LOG_DEBUG,
+    LOG_LEVEL_COUNT
+};
+
+struct LogEntry {
+    uint32_t seq;           /* 发布标记：槽号 + 1，写完后才置上 */
+    uint8_t level;
+    uint8_t argc;
+    int64_t timeUs;
+    const char* fmt;
+    uint64_t args[LOG_MAX_ARGS];
+};
+
+struct LogRing {
+    uint32_t head;          /* 已认领的记录数 */
+    uint32_t tail;          /* 已取走的记录数 */
+    uint32_t dropped;       /* 满时丢弃的记录数 */
+    LogEntry slots[LOG_RING_SIZE];
+};
+
+void logRingInit(LogRing* r);
+/** 写入一条；满时丢弃并返回 false。wasEmpty 可为 NULL，返回写入前是否没有待取记录（用于唤醒取者） */
+bool logRingPush(LogRing* r, LogLevel level, int64_t timeUs, const char* fmt, const uint64_t* args, int argc,
+                 bool* wasEmpty);
+/** 取出最早的一条；没有（或最早一条尚未写完）返回 false。只能在一个任务中调用 */
+bool logRingPop(LogRing* r, LogEntry* out);
+/** 待取记录数（含正在写入的） */
+uint32_t logRingPending(const LogRing* r);
+
+/**
+ * 按格式串和参数槽格式化正文（不含时间、级别），返回写入长度，超长截断。
+ * 支持 printf 的 d i u x X o c s p f F e E g G a A 与 % 转义、标志、宽度、精度和 hh h l ll z j t 长度修饰；
+ * 宽度或精度为 * 时各占一个参数槽
+ */
+size_t logFormat(const LogEntry* e, char* out, size_t cap);
+char logLevelChar(LogLevel level);
+
+/* 参数装入 64 位槽；按类型重载，调用处由模板展开，不经过 va_list */
+inline uint64_t logArg(bool v) { return v ? 1 : 0; }
+inline uint64_t logArg(char v) { return (uint64_t)(int64_t)v; }
+inline uint64_t logArg(signed char v) { return (uint64_t)(int64_t)v; }
+inline uint64_t logArg(unsigned char v) { return v; }
+inline uint64_t logArg(short v) { return (uint64_t)(int64_t)v; }
+inline uint64_t logArg(unsigned short v) { return v; }
+inline uint64_t logArg(int v) { return (uint64_t)(int64_t)v; }
+inline uint64_t logArg(unsigned int v) { return v; }
+inline uint64_t logArg(long v) { return (uint64_t)(int64_t)v; }
+inline uint64_t logArg(unsigned long v) { return v; }
+inline uint64_t logArg(long long v) { return (uint64_t)v; }
+inline uint64_t logArg(unsigned long long v) { return v; }
+inline uint64_t logArg(double v) {
+    uint64_t u;
+    memcpy(&u, &v, sizeof(u));
+    return u;
+}
+inline uint64_t logArg(const void* p) { return (uint64_t)(uintptr_t)p; }
+
+/** 检查格式串与参数（只用于编译期 format 检查，不会被调用） */
+static inline void logFormatCheck(const char* fmt, ...) __attribute__((format(printf, 1, 2)));
+static inline void logFormatCheck(const char* fmt, ...) { (void)fmt; }
+
+#endif
@@ -0,0 +1,61 @@
+/**
+ * @file log_service.h
+ * @brief 日志：调用处只写二进制记录（不格式化、不碰串口），低优先级任务取出格式化后输出到串口
+ *
+ * 用法：LOG_I("SNTP: %s timed out", SNTP_SERVERS[i]);  行尾不用写 \n。
+ * - 写入只是认领一个槽位并复制参数，串口发送缓冲满时也不会阻塞调用处；环满时丢弃并计数。
+ * - %s 参数必须是字面量或静态表中的字符串（取出时才读），见 log_ring.h。
+ * - 不能在中断中调用。
+ * 格式化后的最近 LOG_RTC_LINES 行同时写进 RTC 内存，崩溃、看门狗复位后仍在，
+ * 开机后由 GET /api/log 与本次的日志一起下载；上次因异常复位结束时开机后先在串口重放。
+ */
+#ifndef LOG_SERVICE_H
+#define LOG_SERVICE_H
+
+#include <Arduino.h>
+#include "log_ring.h"
+
+#define LOG_LINE_MAX        96
+#define LOG_RTC_LINES       16
+/* 取日志任务：与 loop 同为最低的应用优先级，放在 core 0，不与 loop（core 1）争 CPU */
+#define LOG_TASK_STACK      3072
+#define LOG_TASK_PRIO       1
+#define LOG_TASK_CORE       0
+/* 没有被唤醒时也每隔这么久取一次（唤醒只在环由空变非空、或有警告以上的记录时发出） */
+#define LOG_DRAIN_IDLE_MS   1000
+#define LOG_FLUSH_TIMEOUT_MS 500
+
+/** setup() 中最先调用：恢复上次的 RTC 日志、启动取日志任务；之前写入的记录也会输出 */
+void logServiceBegin(void);
+/** 等待已写入的记录全部输出到串口（重启、深睡前） */
+void logServiceFlush(void);
+/** 低于该级别（数值更大）的记录在写入时直接丢弃，默认 LOG_INFO */
+void logServiceSetLevel(LogLevel level);
+LogLevel logServiceLevel(void);
+
+void logServiceRecord(LogLevel level, const char* fmt, const uint64_t* args, int argc);
+
+template <typename... A>
+inline void logServiceWrite(LogLevel level, const char* fmt, A... args) {
+    static_assert(sizeof...(A) <= LOG_MAX_ARGS, "too many log arguments");
+    const uint64_t slots[sizeof...(A) + 1] = { logArg(args)... };
+    logServiceRecord(level, fmt, slots, (int)sizeof...(A));
+}
+
+/* if (0) 分支只为让编译器按 printf 检查格式串与参数 */
+#define LOG_AT(level, ...) do {                     \
+        if (0) logFormatCheck(__VA_ARGS__);         \
+        logServiceWrite(level, __VA_ARGS__);        \
+    } while (0)
+#define LOG_E(...)  LOG_AT(LOG_ERROR, __VA_ARGS__)
+#define LOG_W(...)  LOG_AT(LOG_WARN, __VA_ARGS__)
+#define LOG_I(...)  LOG_AT(LOG_INFO, __VA_ARGS__)
+#define LOG_D(...)  LOG_AT(LOG_DEBUG, __VA_ARGS__)
+
+/** GET /api/log：上次开机（RTC 中保留的）与本次最近的日志，纯文本 */
+void logServiceWriteText(Print& out);
+void logServiceWritePrometheus(Print& out);
+/** 串口命令 'l'：比较 LOG_I 与 Serial.printf 每次调用的耗时 */
+void logServiceBenchmark(Print& out);
+
+#endif
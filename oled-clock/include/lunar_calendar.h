@@ -0,0 +1,38 @@
+/**
+ * @file lunar_calendar.h
+ * @brief 农历与节气（纯逻辑，可在主机编译）
+ *
+ * 数据来自 src/lunar_table.h（tools/gen_lunar_table.py 生成）：农历每年 3 字节，
+ * 节气每年 6 字节，共约 1.8KB Flash。公历 → 农历为常数时间（查表 + 位计数），
+ * 支持公历 1900-01-01 .. 2100-12-31。
+ */
+#ifndef LUNAR_CALENDAR_H
+#define LUNAR_CALENDAR_H
+
+#include <stdint.h>
+
+#define SOLAR_TERM_COUNT 24
+
+struct LunarDate {
+    int16_t year;       /* 农历年（正月初一所在的公历年） */
+    int8_t month;       /* 1..12 */
+    int8_t day;         /* 1..30 */
+    bool leap;          /* 闰月 */
+};
+
+/** 公历转农历；超出表范围返回 false */
+bool lunarFromSolar(int year, int month, int day, LunarDate* out);
+/**
+ * 节气 term（0 = 小寒，按公历顺序，23 = 冬至）在 year 年的日期；
+ * 节气 term 总在 term / 2 + 1 月。超出表范围返回 0。
+ */
+int solarTermDay(int year, int term);
+
+/** "正月" .. "腊月"（UTF-8，静态字符串；闰月由调用方加「闰」） */
+const char* lunarMonthName(int month);
+/** "初一" .. "三十" */
+const char* lunarDayName(int day);
+/** "小寒" .. "冬至" */
+const char* solarTermName(int term);
+
+#endif
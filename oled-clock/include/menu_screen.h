@@ -5,6 +5,8 @@
 #ifndef MENU_SCREEN_H
 #define MENU_SCREEN_H
 
+#define MENU_ITEM_COUNT  6
+
 void menuScreenDraw(void);
 
 #endif
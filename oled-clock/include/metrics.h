@@ -0,0 +1,66 @@
+/**
+ * @file metrics.h
+ * @brief 轻量性能计量：周期计数作用域计时 → 分阶段固定桶延迟直方图，堆/任务栈量表
+ *
+ * 用法：在要计时的代码块开头写 METRICS_SCOPE(MET_xxx);，离开作用域时自动计入直方图。
+ * 只在 loop 任务中记录（HTTP 处理也在 loop 中），无需加锁。
+ */
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+
+enum MetricStage {
+    MET_FRAME,          /* loop 一帧的工作部分（不含帧间等待） */
+    MET_BUTTONS,
+    MET_BATTERY,
+    MET_DRAW_MENU,
+    MET_DRAW_CLOCK,
+    MET_DRAW_CALENDAR,
+    MET_DRAW_WEATHER,
+    MET_DRAW_TIMER,
+    MET_DRAW_STOPWATCH,
+    MET_DRAW_ALARM,
+    MET_SEND_BUFFER,
+    MET_HTTP,
+    MET_WEATHER_FETCH,
+    MET_STAGE_COUNT
+};
+
+/* 开机里程碑（自应用启动起的毫秒数，只记第一次） */
+enum BootMark {
+    BOOT_FIRST_FRAME,   /* 第一帧画面送出 */
+    BOOT_INTERACTIVE,   /* 按键可用、进入主循环 */
+    BOOT_WIFI,          /* WiFi 连上 */
+    BOOT_TIME_SYNC,     /* 首次 NTP 对时完成 */
+    BOOT_MARK_COUNT
+};
+
+void metricsInit(void);
+void metricsBootMark(BootMark mark);
+void metricsRecord(MetricStage stage, uint32_t cycles);
+/** 登记需要报告栈水位的任务（loop 任务在 metricsInit 中自动登记） */
+void metricsRegisterTask(const char* name, TaskHandle_t task);
+/** 每帧调用：处理串口命令（'m' 性能摘要、'e' 能耗表、'l' 日志基准、'd' 调试日志开关）与定期串口摘要 */
+void metricsService(void);
+/** 输出 Prometheus 文本格式 */
+void metricsWritePrometheus(Print& out);
+/** 输出紧凑摘要（每阶段一行） */
+void metricsDumpCompact(Print& out);
+
+class MetricsScope {
+public:
+    explicit MetricsScope(MetricStage stage) : m_stage(stage), m_start(ESP.getCycleCount()) {}
+    ~MetricsScope() { metricsRecord(m_stage, ESP.getCycleCount() - m_start); }
+private:
+    MetricsScope(const MetricsScope&);
+    MetricsScope& operator=(const MetricsScope&);
+    MetricStage m_stage;
+    uint32_t m_start;
+};
+
+#define METRICS_CONCAT_(a, b) a##b
+#define METRICS_CONCAT(a, b)  METRICS_CONCAT_(a, b)
+#define METRICS_SCOPE(stage)  MetricsScope METRICS_CONCAT(metricsScope_, __LINE__)(stage)
+
+#endif
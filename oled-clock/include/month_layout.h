@@ -0,0 +1,33 @@
+/**
+ * @file month_layout.h
+ * @brief 月历排版（纯逻辑）：首日星期、天数、行数（4~6 行）与日期所在格
+ */
+#ifndef MONTH_LAYOUT_H
+#define MONTH_LAYOUT_H
+
+#include <stdint.h>
+#include "time_service.h"
+
+struct MonthLayout {
+    int16_t year;
+    int8_t month;       /* 1..12 */
+    int8_t firstWday;   /* 1 日是星期几，0 = 周日，即第一行的起始列 */
+    int8_t days;
+    int8_t rows;        /* 需要的行数：4（平年 2 月恰好从周日开始）~ 6 */
+};
+
+/** 编译期可用：某月需要的行数 */
+constexpr int monthLayoutRows(int year, int month) {
+    return (timeDayOfWeek(year, month, 1) + timeDaysInMonth(year, month) + 6) / 7;
+}
+
+static_assert(monthLayoutRows(2026, 2) == 4, "Feb 2026 starts on Sunday");
+static_assert(monthLayoutRows(2026, 8) == 6, "Aug 2026 needs six rows");
+
+MonthLayout monthLayoutCompute(int year, int month);
+/** 日期 day 所在的行、列 */
+void monthLayoutCell(const MonthLayout* l, int day, int* row, int* col);
+/** 相邻月份（delta = ±1） */
+void monthLayoutStep(int* year, int* month, int delta);
+
+#endif
@@ -0,0 +1,85 @@
+/**
+ * @file net_lease.h
+ * @brief 联网租约（纯逻辑）：各网络任务引用计数地申请射频，最后一个租约释放后按策略关闭
+ *
+ * 不直接操作 WiFi：每个接口返回一个要执行的动作，由调用者在锁外交给驱动执行，
+ * 连接状态由调用者每帧经 netLeaseTick 告知。主机上可以用假驱动回放一天的网络任务。
+ */
+#ifndef NET_LEASE_H
+#define NET_LEASE_H
+
+#include <stdint.h>
+
+enum NetPolicy {
+    NET_POLICY_ALWAYS_ON,    /* 一直连着，默认省电等级（与旧行为一致） */
+    NET_POLICY_MODEM_SLEEP,  /* 一直连着，任务之间切到最深的 modem sleep */
+    NET_POLICY_RADIO_OFF,    /* 任务之间关闭射频，有租约时重新连接 */
+    NET_POLICY_COUNT
+};
+
+enum NetJob {
+    NET_JOB_SETUP,           /* 开机连接 / 配网 */
+    NET_JOB_SNTP,
+    NET_JOB_WEATHER,
+    NET_JOB_WEB,             /* Web 配置页唤醒、画面镜像客户端 */
+    NET_JOB_COUNT
+};
+
+enum NetRadio {
+    NET_RADIO_OFF,
+    NET_RADIO_CONNECTING,
+    NET_RADIO_UP
+};
+
+enum NetAction {
+    NET_ACT_NONE,
+    NET_ACT_RADIO_ON,        /* 打开 STA 并用已保存的配置连接 */
+    NET_ACT_RADIO_OFF,
+    NET_ACT_SLEEP_LIGHT,     /* 有任务：恢复默认 modem sleep，降低延迟 */
+    NET_ACT_SLEEP_DEEP       /* 无任务：最深 modem sleep，保持连接 */
+};
+
+struct NetJobStats {
+    uint32_t leases;         /* 申请次数 */
+    uint32_t expired;        /* 超时未释放、被收回的次数 */
+    uint32_t waits;          /* 申请时未连接、等到了连接的次数 */
+    uint32_t lastConnectMs;  /* 最近一次从申请到连上的时间 */
+    uint32_t maxConnectMs;
+    uint64_t sumConnectMs;
+    uint64_t heldUs;         /* 持有租约的总时长（即该任务占用射频的时间） */
+};
+
+struct NetLeaseCore {
+    uint8_t policy;
+    uint8_t radio;                      /* NetRadio */
+    bool connected;
+    bool deepSleep;                     /* 已切到最深 modem sleep */
+    uint8_t held[NET_JOB_COUNT];
+    uint8_t total;
+    uint32_t tailMs;
+    int64_t tailUntilUs;                /* 无租约后射频至少保持到此刻 */
+    int64_t heldSinceUs[NET_JOB_COUNT];
+    int64_t waitSinceUs[NET_JOB_COUNT]; /* 0 表示没有在等连接 */
+    int64_t expireUs[NET_JOB_COUNT];    /* 0 表示不会超时 */
+    int64_t radioOnSinceUs;
+    uint64_t radioOnUs;                 /* 不含当前这一段 */
+    uint32_t radioOnCount;
+    NetJobStats jobs[NET_JOB_COUNT];
+};
+
+/** radioOn：初始化时射频是否已在连接中（开机连接由别处发起） */
+void netLeaseInit(NetLeaseCore* c, NetPolicy policy, uint32_t tailMs, bool radioOn, int64_t nowUs);
+/** 申请一个租约；holdMs 为 0 表示直到释放，否则到时自动收回（防止忘记释放） */
+NetAction netLeaseAcquire(NetLeaseCore* c, NetJob job, uint32_t holdMs, int64_t nowUs);
+/** 释放一个租约；该任务未持有时忽略 */
+void netLeaseRelease(NetLeaseCore* c, NetJob job, int64_t nowUs);
+/** 网络活动（如 HTTP 请求）：射频开着时把空闲尾巴延长到 now + tail */
+void netLeaseTouch(NetLeaseCore* c, int64_t nowUs);
+void netLeaseSetPolicy(NetLeaseCore* c, NetPolicy policy);
+/** 每帧调用：更新连接状态、收回超时租约、按策略决定关射频 / 深度 modem sleep */
+NetAction netLeaseTick(NetLeaseCore* c, bool connected, int64_t nowUs);
+uint64_t netLeaseRadioOnUs(const NetLeaseCore* c, int64_t nowUs);
+/** 含当前正在持有的一段 */
+uint64_t netLeaseHeldUs(const NetLeaseCore* c, NetJob job, int64_t nowUs);
+
+#endif
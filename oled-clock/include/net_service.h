@@ -0,0 +1,56 @@
+/**
+ * @file net_service.h
+ * @brief 联网服务：开机在独立任务中自动连接 / 配网，之后按租约按需开关射频
+ *
+ * 需要网络的任务先 netServiceAcquire，等 netServiceIsConnected 后工作，完成后 netServiceRelease；
+ * 最后一个租约释放后再保持 NET_IDLE_TAIL_MS（期间 Web 配置页可访问，每个 HTTP 请求顺延），
+ * 然后按策略：保持连接 / 切深度 modem sleep / 关闭射频。
+ */
+#ifndef NET_SERVICE_H
+#define NET_SERVICE_H
+
+#include <Arduino.h>
+#include "net_lease.h"
+
+#define NET_IDLE_TAIL_MS   60000
+/* 按缓存 BSSID 定向连接的超时，超过则清除缓存、退回全信道扫描 */
+#define NET_FAST_TIMEOUT_MS 3000
+
+enum NetConnectPath {
+    NET_PATH_FAST,     /* 缓存的 BSSID + 信道（+ 地址） */
+    NET_PATH_SLOW,     /* 全信道扫描 + DHCP / WiFiManager */
+    NET_PATH_COUNT
+};
+
+/** 启动后台联网任务（立即返回）；开机连接期间持有 SETUP 租约 */
+void netServiceBegin(void);
+/** 已拿到 IP；由 WiFi 事件回调缓存，每帧调用不访问驱动 */
+bool netServiceIsConnected(void);
+/** 缓存的本机地址，未连接时为 0.0.0.0 */
+IPAddress netServiceLocalIp(void);
+/** holdMs 为 0 表示直到释放，否则到时自动收回；任何任务都可调用，射频动作由下一次 netServiceLoop 执行 */
+void netServiceAcquire(NetJob job, uint32_t holdMs);
+void netServiceRelease(NetJob job);
+/** 网络活动：顺延空闲尾巴 */
+void netServiceTouch(void);
+/** 本地唤醒：射频关着则打开并保持一个空闲尾巴（关射频策略下用来访问 Web 配置页） */
+void netServiceWake(void);
+/** 每帧调用：执行租约状态机的开关动作（开机联网之后，开关射频、切换省电都只在这里调用 WiFi 驱动） */
+void netServiceLoop(void);
+
+void netServiceSetPolicy(NetPolicy policy);
+/** 策略下限（电源档位设置）：生效策略取配置与下限中更省电的一档 */
+void netServiceSetPolicyFloor(NetPolicy floor);
+/** 用户配置的策略（不含下限） */
+NetPolicy netServicePolicy(void);
+const char* netServicePolicyName(NetPolicy policy);
+/** 按名称查找策略，找不到返回 -1 */
+int netServiceFindPolicy(const char* name);
+
+/** 射频累计开启时间（含当前这一段） */
+uint64_t netServiceRadioOnUs(void);
+
+/** 输出 Prometheus 文本格式：射频开启时间、各任务租约次数 / 持有时间 / 连接延迟、快慢路径连接耗时 */
+void netServiceWritePrometheus(Print& out);
+
+#endif
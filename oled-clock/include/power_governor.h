@@ -0,0 +1,40 @@
+/**
+ * @file power_governor.h
+ * @brief 电源调节：定时采样电量、记录按键活动，按 power_profile 选档并应用到显示与联网
+ *
+ * 亮度与联网策略下限在切换档位时直接设置；帧间隔、秒显示、天气刷新间隔由各处按当前档位读取。
+ * 电量每 GOVERNOR_SAMPLE_MS 采样一次并平滑，顶栏不再每帧读 ADC。
+ */
+#ifndef POWER_GOVERNOR_H
+#define POWER_GOVERNOR_H
+
+#include <Arduino.h>
+#include "power_profile.h"
+
+#define GOVERNOR_SAMPLE_MS   10000
+
+/** 在 displayInit 之后调用：首次采样电量并应用初始档位 */
+void powerGovernorBegin(void);
+/** 有按键事件时调用 */
+void powerGovernorNoteInput(void);
+/** 每帧调用：到时采样电量，重新选档，档位变化时应用 */
+void powerGovernorLoop(void);
+
+PowerProfile powerGovernorProfile(void);
+const PowerProfileSpec* powerGovernorSpec(void);
+/** 平滑后的电量百分比 */
+int powerGovernorBatteryPercent(void);
+/** 页面希望的帧间隔与当前档位下限中取较大者 */
+uint32_t powerGovernorFrameMs(uint32_t screenMs);
+
+/** 屏幕按对比度加权的点亮时间（各档位驻留时间 × 对比度 / 255），供能耗核算 */
+uint64_t powerGovernorPanelUs(void);
+
+/** 固定档位，-1 表示自动 */
+void powerGovernorSetForced(int profile);
+int powerGovernorForced(void);
+
+/** 输出 Prometheus 文本格式：当前档位、电量、各档位驻留时间与切换次数 */
+void powerGovernorWritePrometheus(Print& out);
+
+#endif
@@ -0,0 +1,69 @@
+/**
+ * @file power_profile.h
+ * @brief 电源档位（纯逻辑）：按电量与用户活动选择档位，档位决定帧间隔、秒显示、亮度、天气刷新与联网策略
+ *
+ * 电量分高 / 低 / 极低三级，进入与退出阈值不同（滞回），ADC 噪声不会让档位来回跳；
+ * 用户活动（最近一次按键）把档位提高一级，空闲后回落。不读 ADC、不碰驱动，
+ * 主机上可以把放电曲线与按键记录回放进 powerGovernorSelect 检查切换点。
+ */
+#ifndef POWER_PROFILE_H
+#define POWER_PROFILE_H
+
+#include <stdint.h>
+
+/* 电量滞回阈值（%）：低于 ENTER 进入该级，回到 EXIT 及以上才退出 */
+#define GOVERNOR_LOW_ENTER_PCT    30
+#define GOVERNOR_LOW_EXIT_PCT     35
+#define GOVERNOR_CRIT_ENTER_PCT   10
+#define GOVERNOR_CRIT_EXIT_PCT    15
+/* 最近一次按键后这么久内视为正在使用 */
+#define GOVERNOR_ACTIVE_MS        30000
+
+enum PowerProfile {
+    POWER_PROFILE_PERFORMANCE,   /* 与旧行为一致：各页面自己的帧节奏 */
+    POWER_PROFILE_BALANCED,
+    POWER_PROFILE_SAVER,
+    POWER_PROFILE_CRITICAL,
+    POWER_PROFILE_COUNT
+};
+
+enum BatteryLevel {
+    BATTERY_LEVEL_HIGH,
+    BATTERY_LEVEL_LOW,
+    BATTERY_LEVEL_CRITICAL
+};
+
+struct PowerProfileSpec {
+    const char* name;
+    char mark;                   /* 顶栏标记字母 */
+    uint16_t frameMinMs;         /* 帧间隔下限；页面自己的节奏更慢时取页面的 */
+    bool showSeconds;            /* 时钟页是否显示秒 */
+    uint8_t contrast;            /* SH1106 对比度（亮度） */
+    uint32_t weatherRefreshMs;   /* 天气缓存有效期 */
+    int8_t netPolicyFloor;       /* 联网策略至少省电到这一档（NetPolicy），-1 表示沿用配置 */
+};
+
+struct PowerGovernorCore {
+    uint8_t level;               /* BatteryLevel */
+    uint8_t profile;             /* PowerProfile */
+    int8_t forced;               /* 固定档位，-1 表示自动 */
+    uint32_t switches;           /* 档位切换次数 */
+};
+
+const PowerProfileSpec* powerProfileSpec(PowerProfile profile);
+/** 按名称查找档位，找不到返回 -1 */
+int powerProfileFind(const char* name);
+
+/** batteryPct 为负表示电量未知，按高电量处理 */
+void powerGovernorInit(PowerGovernorCore* g, int batteryPct);
+/** 电量级别的滞回判断；batteryPct 为负时保持原级别 */
+BatteryLevel powerGovernorLevel(BatteryLevel level, int batteryPct);
+/** 输入当前电量与距上次按键的时间，更新并返回档位 */
+PowerProfile powerGovernorSelect(PowerGovernorCore* g, int batteryPct, uint32_t idleMs);
+/**
+ * 当前应用的联网策略下限（NetPolicy，-1 表示沿用配置）：取本电量级别下空闲档位的值，
+ * 按键临时升档不放宽下限，否则每次按键都会把关掉的射频重新打开
+ */
+int powerGovernorNetFloor(const PowerGovernorCore* g);
+
+#endif
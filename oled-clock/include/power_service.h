@@ -0,0 +1,67 @@
+/**
+ * @file power_service.h
+ * @brief 帧间空闲省电：动态调频、按键 GPIO 唤醒的浅睡、忙锁与驻留时间统计
+ *
+ * 主循环每帧的工作期间持有「忙」锁（CPU 满频、禁止浅睡），帧间等待时释放：
+ * 无按键动作时阻塞等待按键中断或超时，FreeRTOS 在此期间可抑制 tick、降频或自动浅睡；
+ * 框架未启用自动浅睡时，在 WiFi 关闭等安全条件下由本模块手动进入浅睡。
+ * 其他任务做 I2C 刷屏、联网等不能被降频 / 浅睡打断的工作时用 POWER_BUSY_SCOPE()。
+ */
+#ifndef POWER_SERVICE_H
+#define POWER_SERVICE_H
+
+#include <Arduino.h>
+
+#define POWER_MAX_MHZ          240
+/* 不低于 80MHz：APB 保持 80MHz，UART / I2C / LEDC 的分频不受调频影响 */
+#define POWER_MIN_MHZ          80
+/* 有按键按下或处于双击窗口时按此间隔轮询（与原 delayWithButtonPoll 一致） */
+#define POWER_BUTTON_POLL_MS   14
+/* 剩余等待不足此值时不值得浅睡（进出浅睡约 1~2ms） */
+#define POWER_SLEEP_MIN_MS     10
+
+/* 框架支持到的省电方式 */
+enum PowerMode {
+    POWER_MODE_NONE,         /* 未启用电源管理：等待期间仅由空闲任务 waiti */
+    POWER_MODE_DFS,          /* 动态调频 + 本模块手动浅睡 */
+    POWER_MODE_AUTO_SLEEP    /* 动态调频 + tickless 自动浅睡 */
+};
+
+/* 不能手动浅睡的原因（计数用） */
+enum PowerSleepBlock {
+    POWER_BLOCK_SHORT,       /* 剩余等待太短或马上有 esp_timer 到期 */
+    POWER_BLOCK_BUSY,        /* 有任务持有忙锁（I2C、联网、蜂鸣器等） */
+    POWER_BLOCK_WIFI,        /* WiFi 开着：手动浅睡会断开连接 */
+    POWER_BLOCK_COUNT
+};
+
+/** setup() 中尽早调用：配置调频 / 自动浅睡、按键 GPIO 唤醒；调用者（loop 任务）随即持有忙锁 */
+void powerServiceBegin(void);
+/** 取代帧间 delay：释放 loop 的忙锁，等待 waitMs（有按键事件时提前返回），再重新持有 */
+void powerServiceIdle(uint32_t waitMs);
+PowerMode powerServiceMode(void);
+
+/** 忙锁：可嵌套，可在任意任务中调用（不可在中断中调用） */
+void powerBusyAcquire(void);
+void powerBusyRelease(void);
+
+/** loop 任务的累计驻留时间（含当前这一段 active），在 loop 任务中调用 */
+void powerServiceResidency(uint64_t* activeUs, uint64_t* idleUs, uint64_t* lightSleepUs);
+
+/** 输出 Prometheus 文本格式：active / idle / light_sleep 驻留时间与浅睡计数 */
+void powerServiceWritePrometheus(Print& out);
+
+class PowerBusyScope {
+public:
+    PowerBusyScope() { powerBusyAcquire(); }
+    ~PowerBusyScope() { powerBusyRelease(); }
+private:
+    PowerBusyScope(const PowerBusyScope&);
+    PowerBusyScope& operator=(const PowerBusyScope&);
+};
+
+#define POWER_CONCAT_(a, b) a##b
+#define POWER_CONCAT(a, b)  POWER_CONCAT_(a, b)
+#define POWER_BUSY_SCOPE()  PowerBusyScope POWER_CONCAT(powerBusy_, __LINE__)
+
+#endif
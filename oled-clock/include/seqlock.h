@@ -0,0 +1,108 @@
+/**
+ * @file seqlock.h
+ * @brief 顺序锁状态块（纯逻辑，可在主机编译）：写者发布、读者无锁取一致快照
+ *
+ * 采用双副本的「锁存」顺序锁：序号为偶数时读者读副本 0、写者改副本 1，奇数时反过来。
+ * 写者：序号加一（读者转去另一份）→ 改副本 0 → 序号再加一 → 把副本 0 复制到副本 1。
+ * 读者：记下序号 → 复制对应副本 → 序号没变即为一致快照，变了（期间有写者完成一步）就重读。
+ * 读者从不等待进行到一半的写者：即使读者在同一核上抢占了写者，读到的也是另一份完整副本，
+ * 因此高优先级的读者不会自旋饿死低优先级的写者；写者也从不等待读者。
+ * 多个写者之间用一个标志自旋互斥（各块的写入都只有几十字节的拷贝）。
+ *
+ * 用法：
+ *   WeatherState w; g_weather.read(&w);             // 读
+ *   { SeqWrite<WeatherState> w(g_weather); w->iconCode = 65; }   // 原地改，离开作用域发布
+ *   g_weather.publish(newState);                    // 整块替换
+ */
+#ifndef SEQLOCK_H
+#define SEQLOCK_H
+
+#include <stdint.h>
+#include <string.h>
+
+template <typename T>
+class SeqBlock {
+public:
+    SeqBlock() : m_seq(0), m_writer(0) { memset(m_data, 0, sizeof(m_data)); }
+    explicit SeqBlock(const T& init) : m_seq(0), m_writer(0) {
+        m_data[0] = init;
+        m_data[1] = init;
+    }
+
+    /** 一致快照；期间有写者完成一步时重读，不加锁 */
+    void read(T* out) const {
+        for (;;) {
+            uint32_t seq = __atomic_load_n(&m_seq, __ATOMIC_ACQUIRE);
+            memcpy(out, &m_data[seq & 1], sizeof(T));
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+            if (__atomic_load_n(&m_seq, __ATOMIC_RELAXED) == seq) return;
+        }
+    }
+    T get(void) const {
+        T v;
+        read(&v);
+        return v;
+    }
+    /**
+     * 不复制整块，直接在稳定副本上取值（大块只要一两个字段时用）；
+     * fn 可能看到写了一半的数据、结果随后被丢弃重取，因此只能读值，不能按读到的值做下标或跟指针
+     */
+    template <typename R, typename Fn>
+    R view(Fn fn) const {
+        for (;;) {
+            uint32_t seq = __atomic_load_n(&m_seq, __ATOMIC_ACQUIRE);
+            R v = fn(m_data[seq & 1]);
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+            if (__atomic_load_n(&m_seq, __ATOMIC_RELAXED) == seq) return v;
+        }
+    }
+
+    /** 开始原地修改：返回当前值的可写副本，必须与 endWrite 成对（用 SeqWrite 更方便） */
+    T* beginWrite(void) {
+        uint8_t idle = 0;
+        while (!__atomic_compare_exchange_n(&m_writer, &idle, 1, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+            idle = 0;
+        uint32_t seq = __atomic_load_n(&m_seq, __ATOMIC_RELAXED);
+        __atomic_store_n(&m_seq, seq + 1, __ATOMIC_RELAXED);     /* 读者转去副本 1 */
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+        return &m_data[0];
+    }
+    void endWrite(void) {
+        uint32_t seq = __atomic_load_n(&m_seq, __ATOMIC_RELAXED);
+        __atomic_store_n(&m_seq, seq + 1, __ATOMIC_RELEASE);     /* 读者回到副本 0 */
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        memcpy(&m_data[1], &m_data[0], sizeof(T));
+        __atomic_store_n(&m_writer, 0, __ATOMIC_RELEASE);
+    }
+    void publish(const T& v) {
+        *beginWrite() = v;
+        endWrite();
+    }
+
+    /** 已完成的写入次数 */
+    uint32_t version(void) const { return __atomic_load_n(&m_seq, __ATOMIC_ACQUIRE) / 2; }
+
+private:
+    SeqBlock(const SeqBlock&);
+    SeqBlock& operator=(const SeqBlock&);
+    uint32_t m_seq;
+    uint8_t m_writer;
+    T m_data[2];
+};
+
+/** 作用域写入：构造时 beginWrite，析构时 endWrite 发布 */
+template <typename T>
+class SeqWrite {
+public:
+    explicit SeqWrite(SeqBlock<T>& block) : m_block(block), m_data(block.beginWrite()) {}
+    ~SeqWrite() { m_block.endWrite(); }
+    T* operator->() { return m_data; }
+    T& operator*() { return *m_data; }
+private:
+    SeqWrite(const SeqWrite&);
+    SeqWrite& operator=(const SeqWrite&);
+    SeqBlock<T>& m_block;
+    T* m_data;
+};
+
+#endif
@@ -0,0 +1,30 @@
+/**
+ * @file sleep_clock.h
+ * @brief 深睡时钟模式：屏幕只显示 HH:MM，ESP32 每到整分由 RTC 定时器唤醒，
+ *        只重画变化的数字块后立即再次深睡
+ *
+ * SH1106 在 MCU 深睡期间保持画面；每次唤醒从 setup() 开头直接走精简路径，
+ * 不初始化 WiFi、Web 与完整界面。退出：按键（EXT1，见 SLEEP_CLOCK_EXT1_MASK）、
+ * 唤醒时按住中键，或闹钟到点。
+ */
+#ifndef SLEEP_CLOCK_H
+#define SLEEP_CLOCK_H
+
+#include <Arduino.h>
+
+/*
+ * EXT1 唤醒只支持 RTC GPIO（0、2、4、12–15、25–27、32–39）。板上三键（5 / 18 / 19）都不是，
+ * 默认为 0：只能在每分钟唤醒时检测中键是否按住。把某个键改接到 RTC GPIO 后在此填入
+ * 对应位（如 1ULL << 33），即可按键立即唤醒。
+ */
+#define SLEEP_CLOCK_EXT1_MASK  0ULL
+
+/** setup() 最开始调用：深睡时钟的定时唤醒在此更新屏幕并再次深睡（不返回） */
+void sleepClockOnBoot(void);
+/** 进入深睡时钟模式（不返回）；有倒计时 / 秒表在运行或时间无效时返回 false */
+bool sleepClockEnter(void);
+/** 若因闹钟到点退出了深睡时钟模式，通知闹钟服务（setup() 中在闹钟服务之后调用） */
+void sleepClockHandleExit(void);
+void sleepClockWritePrometheus(Print& out);
+
+#endif
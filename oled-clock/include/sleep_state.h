@@ -0,0 +1,67 @@
+/**
+ * @file sleep_state.h
+ * @brief 深睡时钟模式的 RTC 内存状态与每次唤醒的计算（纯逻辑，可在主机编译）
+ *
+ * 状态放在 RTC 慢速内存（深睡保留、上电清零），带魔数与校验，上电后的随机内容或
+ * 旧固件的布局不会被误认为有效。屏幕上已显示的四位数字也记在这里，唤醒后只重画变化的位。
+ */
+#ifndef SLEEP_STATE_H
+#define SLEEP_STATE_H
+
+#include <stdint.h>
+
+#define SLEEP_STATE_MAGIC    0x534C4550u   /* "SLEP" */
+#define SLEEP_DIGIT_UNKNOWN  0xFF
+
+struct SleepState {
+    uint32_t magic;
+    uint8_t active;             /* 处于深睡时钟模式 */
+    uint8_t zone;               /* 时区（唤醒时不读 NVS） */
+    uint8_t shown[4];           /* 屏幕上的 H H M M，未知为 SLEEP_DIGIT_UNKNOWN */
+    uint8_t wakeReason;         /* 退出原因，见 SleepExitReason */
+    int64_t enteredUs;          /* 进入时的墙钟 */
+    int64_t alarmUtc;           /* 下一个闹钟（UTC 秒），没有为 -1 */
+    int8_t alarmIndex;
+    uint32_t wakes;             /* 定时唤醒次数 */
+    uint32_t lastAwakeUs;       /* 上次唤醒中应用部分的耗时 */
+    uint32_t maxAwakeUs;
+    uint32_t overBudget;        /* 超出预算的次数 */
+    uint64_t totalAwakeUs;
+    uint32_t check;
+};
+
+enum SleepExitReason {
+    SLEEP_EXIT_NONE,
+    SLEEP_EXIT_BUTTON,
+    SLEEP_EXIT_ALARM,
+    SLEEP_EXIT_INVALID_TIME
+};
+
+/** 估算续航用的功耗模型 */
+struct SleepPowerModel {
+    float batteryMah;
+    float sleepUa;              /* 深睡时 ESP32 电流（RTC 定时器 + RTC 内存） */
+    float displayUa;            /* 屏幕常亮电流 */
+    float awakeMa;              /* 唤醒期间电流 */
+    float bootUs;               /* 每次唤醒中应用之前的启动耗时（ROM + 二级引导） */
+};
+
+void sleepStateBegin(SleepState* s, int zone, int64_t wallUs, int64_t alarmUtc, int alarmIndex);
+bool sleepStateValid(const SleepState* s);
+/** 修改后重新计算校验 */
+void sleepStateSeal(SleepState* s);
+void sleepStateEnd(SleepState* s, SleepExitReason reason);
+
+/** 本地时、分 → 四位数字 */
+void sleepStateDigits(int hour, int minute, uint8_t out[4]);
+/** 需要重画的位（bit i 对应第 i 位） */
+uint8_t sleepStateDirtyMask(const SleepState* s, const uint8_t want[4]);
+void sleepStateCommit(SleepState* s, const uint8_t digits[4]);
+void sleepStateRecordWake(SleepState* s, uint32_t awakeUs, uint32_t budgetUs);
+/** 到下一个整分（再加 marginUs）的微秒数；时区偏移都是 15 分钟的倍数，UTC 整分即本地整分 */
+uint64_t sleepUsToNextMinute(int64_t wallUs, uint32_t marginUs);
+/** 平均电流（微安）与预计续航（小时）；avgAwakeUs 为每次唤醒中应用部分的平均耗时 */
+float sleepAverageCurrentUa(const SleepPowerModel* m, float avgAwakeUs, float wakesPerHour);
+float sleepProjectedHours(const SleepPowerModel* m, float avgAwakeUs, float wakesPerHour);
+
+#endif
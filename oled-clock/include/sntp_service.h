@@ -0,0 +1,34 @@
+/**
+ * @file sntp_service.h
+ * @brief SNTP 对时服务：多服务器轮换、按漂移估计安排再对时、对时后平滑校正
+ *
+ * IDF 的对时回调只记录结果，测偏差、估漂移、排下次对时都在 loop 中完成。
+ * 首次对时直接设置时间（IMMED），之后改为 adjtime 平滑调整（SMOOTH）。
+ */
+#ifndef SNTP_SERVICE_H
+#define SNTP_SERVICE_H
+
+#include <Arduino.h>
+
+struct SntpStatus {
+    bool synced;            /* 本次上电是否已对时 */
+    int32_t offsetMs;       /* 最近一次测得的偏差（服务器 - 本地，正值表示本地偏慢） */
+    uint32_t delayMs;       /* 最近一次请求到回调的耗时（含 DNS，近似往返延迟） */
+    float driftPpm;         /* 漂移估计，无样本时为 0 */
+    float driftSigmaPpm;    /* 估计标准差，样本不足时为负 */
+    uint32_t driftSamples;
+    uint32_t ageS;          /* 距上次对时的秒数 */
+    uint32_t nextInS;       /* 距下次计划对时的秒数 */
+    const char* server;     /* 当前使用的服务器 */
+    uint32_t syncCount;
+    uint32_t failCount;
+};
+
+/** setup() 中调用：注册回调（联网后由 sntpServiceLoop 发起首次对时） */
+void sntpServiceBegin(void);
+/** 每帧调用：处理对时结果、超时换服务器、到期再对时 */
+void sntpServiceLoop(void);
+void sntpServiceGetStatus(SntpStatus* out);
+void sntpServiceWritePrometheus(Print& out);
+
+#endif
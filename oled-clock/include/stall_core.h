@@ -0,0 +1,108 @@
+/**
+ * @file stall_core.h
+ * @brief loop 卡顿判定与卡顿记录环（纯逻辑，可在主机编译）
+ *
+ * loop 每帧开头把心跳计数加一，进入各段工作前写下当前阶段（只是两次内存写，健康帧上没有其他开销）。
+ * 监测任务定时采样：心跳不变且阶段不是帧间等待，持续超过阈值即为一次卡顿；
+ * 同一次卡顿只记一条，持续期间更新时长，心跳恢复时结束。
+ * 记录环放在 RTC 内存中，卡死后被看门狗复位时仍在，结束时未恢复的记录标为「随复位结束」。
+ */
+#ifndef STALL_CORE_H
+#define STALL_CORE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define STALL_HISTORY       8
+#define STALL_BT_DEPTH      8
+#define STALL_DETAIL_MAX    16
+
+/* loop 的阶段标记；名称见 stallStageName */
+enum StallStage {
+    STALL_SETUP,
+    STALL_IDLE,             /* 帧间等待，不算卡顿 */
+    STALL_TIME,
+    STALL_HTTP,
+    STALL_INPUT,            /* 按键与页面状态机 */
+    STALL_DRAW,
+    STALL_WEATHER_FETCH,
+    STALL_METRICS,
+    STALL_ENERGY,
+    STALL_HEAP,
+    STALL_CONFIG,
+    STALL_TIME_PERSIST,
+    STALL_SNTP,
+    STALL_ALARM,
+    STALL_POWER,
+    STALL_NET,
+    STALL_STAGE_COUNT
+};
+
+/* loop 写、监测任务读；detail 只能指向字面量（如 HTTP 路由路径） */
+struct LoopBeat {
+    volatile uint32_t beat;
+    volatile uint8_t stage;
+    const char* volatile detail;
+};
+
+enum StallEnd {
+    STALL_END_ONGOING = 0,  /* 仍在卡顿中 */
+    STALL_END_RECOVERED,
+    STALL_END_RESET         /* 开机时发现未结束：卡顿以复位告终 */
+};
+
+struct StallRecord {
+    uint32_t uptimeMs;      /* 卡顿开始时的开机时长 */
+    uint32_t durationMs;
+    uint16_t boot;          /* 发生在第几次开机（见 StallHistory.boots） */
+    uint8_t stage;
+    uint8_t end;            /* StallEnd */
+    uint8_t page;           /* 当时的 AppState */
+    uint8_t depth;          /* pcs 中的有效帧数，取不到回溯时为 0 */
+    char detail[STALL_DETAIL_MAX];
+    uint32_t pcs[STALL_BT_DEPTH];
+};
+
+/* 与日志的 RTC 文本环相同：复位时可能写到一半，只校验魔数与下标范围 */
+struct StallHistory {
+    uint32_t magic;
+    uint16_t boots;         /* 开机次数（上电清零） */
+    uint8_t next;
+    uint8_t count;
+    uint32_t total;         /* 开机以来（跨软件复位）记录的卡顿次数 */
+    StallRecord records[STALL_HISTORY];
+};
+
+enum StallEvent {
+    STALL_EVENT_NONE,
+    STALL_EVENT_BEGIN,      /* 刚超过阈值 */
+    STALL_EVENT_CONTINUE,
+    STALL_EVENT_END
+};
+
+struct StallDetector {
+    uint32_t lastBeat;
+    int64_t lastProgressUs; /* 最近一次看到心跳变化或帧间等待的时间 */
+    bool active;
+};
+
+void stallDetectorInit(StallDetector* d, uint32_t beat, int64_t nowUs);
+/**
+ * 采样一次；stalledMs 返回当前（或刚结束的）卡顿时长。
+ * 结束时长按「最后一次进展到发现恢复」计，比实际多出不到一个采样周期
+ */
+StallEvent stallDetectorSample(StallDetector* d, uint32_t beat, uint8_t stage, int64_t nowUs,
+                               uint32_t thresholdMs, uint32_t* stalledMs);
+
+/** 开机时调用：RTC 内容无效（上电或损坏）时清空；开机计数加一，把未结束的记录标为随复位结束 */
+void stallHistoryBoot(StallHistory* h, uint32_t magic);
+/** 占用下一条记录（满时覆盖最早一条），返回清零后的记录，boot 已填好 */
+StallRecord* stallHistoryAdd(StallHistory* h);
+/** 第 i 条（0 为最早）；越界返回 NULL */
+const StallRecord* stallHistoryAt(const StallHistory* h, int i);
+
+const char* stallStageName(uint8_t stage);
+const char* stallEndName(uint8_t end);
+
+#endif
@@ -0,0 +1,69 @@
+/**
+ * @file stall_watch.h
+ * @brief loop 卡顿监测：心跳与阶段标记、高优先级监测任务、RTC 内存中的卡顿记录
+ *
+ * 用法：loop 每帧开头 stallWatchBeat()，各段工作前 stallWatchStage(STALL_xxx)；
+ * 嵌套在某段里、结束后要回到外层阶段的工作用 STALL_STAGE(STALL_xxx) 作用域。
+ * 心跳超过 STALL_THRESHOLD_MS 没有变化（且不在帧间等待）时，监测任务记下阶段、当前页、
+ * HTTP 路由与 loop 任务的调用回溯，恢复后补上时长；记录见 GET /api/stalls。
+ */
+#ifndef STALL_WATCH_H
+#define STALL_WATCH_H
+
+#include <Arduino.h>
+#include "stall_core.h"
+#include "app_state.h"
+
+/* 界面停顿超过这么久算一次卡顿（正常一帧几十毫秒；网络差时一次天气拉取就会超过） */
+#define STALL_THRESHOLD_MS      2000
+/* 采样周期：发现卡顿最多晚这么久，恢复后的时长最多多算这么久 */
+#define STALL_CHECK_MS          500
+/* 监测任务：高于 loop、联网、日志任务，低于 WiFi / lwIP；放在 core 0，loop（core 1）卡死也能运行 */
+#define STALL_TASK_STACK        2560
+#define STALL_TASK_PRIO         10
+#define STALL_TASK_CORE         0
+/* 挂起运行中的 loop 任务后，等它在 core 1 上让出并保存现场的最长时间 */
+#define STALL_SUSPEND_WAIT_US   200
+
+/** setup() 末尾在 loop 任务中调用：记下 loop 任务、整理 RTC 中的记录、启动监测任务 */
+void stallWatchBegin(void);
+
+/* 健康帧上的全部开销：一次加一、几次单字节写 */
+static inline void stallWatchBeat(void) {
+    g_loopBeat.beat = g_loopBeat.beat + 1;
+}
+
+static inline void stallWatchStage(StallStage stage) {
+    g_loopBeat.stage = (uint8_t)stage;
+}
+
+/* 进入时设置阶段（detail 非 NULL 时一并设置），离开时恢复外层 */
+class StallStageScope {
+public:
+    explicit StallStageScope(StallStage stage, const char* detail = NULL)
+        : m_stage(g_loopBeat.stage), m_detail(g_loopBeat.detail) {
+        g_loopBeat.stage = (uint8_t)stage;
+        if (detail) g_loopBeat.detail = detail;
+    }
+    ~StallStageScope() {
+        g_loopBeat.detail = m_detail;
+        g_loopBeat.stage = m_stage;
+    }
+private:
+    StallStageScope(const StallStageScope&);
+    StallStageScope& operator=(const StallStageScope&);
+    uint8_t m_stage;
+    const char* m_detail;
+};
+
+#define STALL_CONCAT_(a, b)  a##b
+#define STALL_CONCAT(a, b)   STALL_CONCAT_(a, b)
+#define STALL_STAGE(...)     StallStageScope STALL_CONCAT(stallStage_, __LINE__)(__VA_ARGS__)
+
+/** 本次开机记录的卡顿次数 */
+uint32_t stallWatchCount(void);
+/** GET /api/stalls：阈值、开机次数、最近 STALL_HISTORY 条记录（旧到新，含上次开机） */
+void stallWatchWriteJson(Print& out);
+void stallWatchWritePrometheus(Print& out);
+
+#endif
@@ -0,0 +1,52 @@
+/**
+ * @file stopwatch_core.h
+ * @brief 秒表核心（纯逻辑，可在主机编译）：64 位微秒计时 + 固定容量圈速环形缓冲
+ *
+ * 所有时刻由调用方传入（设备上是按键中断记录的 esp_timer_get_time()），
+ * 核心本身不读时钟。记圈为 O(1)、不分配内存；超出容量时覆盖最早的一圈，
+ * 圈号继续递增。
+ */
+#ifndef STOPWATCH_CORE_H
+#define STOPWATCH_CORE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define STOPWATCH_LAP_CAPACITY  64
+
+struct StopwatchLap {
+    uint32_t number;        /* 圈号，从 1 开始 */
+    int64_t lapUs;          /* 本圈用时 */
+    int64_t splitUs;        /* 到本圈结束的累计用时 */
+};
+
+struct StopwatchCore {
+    bool running;
+    int64_t startUs;        /* 本次开始的时刻（running 时有效） */
+    int64_t accumUs;        /* 之前各段累计 */
+    int64_t lastSplitUs;    /* 上一圈结束时的累计用时 */
+    uint32_t lapCount;      /* 总圈数（含已被覆盖的） */
+    StopwatchLap laps[STOPWATCH_LAP_CAPACITY];
+};
+
+void stopwatchCoreReset(StopwatchCore* c);
+/** 开始 / 继续；已在运行返回 false */
+bool stopwatchCoreStart(StopwatchCore* c, int64_t nowUs);
+/** 暂停；未运行返回 false */
+bool stopwatchCoreStop(StopwatchCore* c, int64_t nowUs);
+/** 累计用时；nowUs 早于开始时刻时按开始时刻计 */
+int64_t stopwatchCoreElapsedUs(const StopwatchCore* c, int64_t nowUs);
+/** 记一圈（仅运行中）；返回该圈，未运行返回 NULL */
+const StopwatchLap* stopwatchCoreLap(StopwatchCore* c, int64_t nowUs);
+/** 缓冲区中保留的圈数 */
+uint32_t stopwatchCoreLapsStored(const StopwatchCore* c);
+/** 保留的第 i 圈（0 = 最早保留的一圈） */
+const StopwatchLap* stopwatchCoreLapAt(const StopwatchCore* c, uint32_t i);
+
+/**
+ * 格式化用时："M:SS.mmm"（不足 1 小时）或 "H:MM:SS.mmm"；负值按 0。
+ * 返回写入长度（不含结尾 0）。
+ */
+int stopwatchFormat(int64_t us, char* buf, size_t cap);
+
+#endif
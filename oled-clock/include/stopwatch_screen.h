@@ -1,6 +1,6 @@
 /**
  * @file stopwatch_screen.h
- * @brief 秒表页：大数字秒 + 小数字毫秒
+ * @brief 秒表页：大数字时间 + 小数字毫秒 / 秒、最近一圈、圈速列表
  */
 #ifndef STOPWATCH_SCREEN_H
 #define STOPWATCH_SCREEN_H
@@ -0,0 +1,34 @@
+/**
+ * @file time_persist.h
+ * @brief 墙钟时间持久化：RTC 内存快照（软复位 / 深睡保留）+ NVS 低频检查点（冷启动）
+ *
+ * 开机时先恢复一个估计时间并标记为「未同步」，下一次 SNTP 对时后校正。
+ * 误差上界按漂移累计：恢复时的误差 + 经过时间 × 时钟源 ppm。
+ */
+#ifndef TIME_PERSIST_H
+#define TIME_PERSIST_H
+
+#include <stdint.h>
+
+enum TimeSource {
+    TIME_SRC_NONE,      /* 无可用时间 */
+    TIME_SRC_NVS,       /* 冷启动：NVS 检查点，断电时长未知，误差无上界 */
+    TIME_SRC_RTC,       /* 复位 / 深睡后由 RTC 快照恢复，误差有界 */
+    TIME_SRC_NTP        /* 本次上电已 NTP 对时 */
+};
+
+/** setup() 早期调用：恢复估计时间并写入系统时钟 */
+void timePersistRestore(void);
+/** 对时完成时调用（可在 SNTP 回调中调用，只置标志，实际处理在 timePersistService） */
+void timePersistMarkSynced(void);
+/** 每帧调用：每秒刷新 RTC 快照，按需写 NVS 检查点 */
+void timePersistService(void);
+
+TimeSource timePersistSource(void);
+/** 当前时间的误差上界（毫秒）；无上界时返回 false */
+bool timePersistErrorBoundMs(uint32_t* outMs);
+
+/** 纯函数：起点误差 + 经过时间 × ppm，得到误差上界（毫秒） */
+uint32_t timeErrorBoundMs(uint32_t baseErrMs, uint64_t elapsedUs, uint32_t ppm);
+
+#endif
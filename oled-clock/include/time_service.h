@@ -0,0 +1,46 @@
+/**
+ * @file time_service.h
+ * @brief 统一的本地时间：每帧读一次系统时间，增量推进缓存的 struct tm
+ *
+ * 同一天内秒数变化只做秒 → 分 → 时的进位，不经过 newlib 的时区换算；
+ * 跨过本地零点或夏令时切换、时间回退 / 大跳变、对时或改时区后（timeServiceInvalidate）
+ * 才完整换算一次（tz_engine，不经过 newlib 的 TZ 解析）。
+ * 只在 loop 任务中读写，各页面在同一帧内拿到的是同一份快照。
+ */
+#ifndef TIME_SERVICE_H
+#define TIME_SERVICE_H
+
+#include <stdint.h>
+#include <time.h>
+
+/** 每帧开头调用一次 */
+void timeServiceTick(void);
+/** 系统时间被整体修改（对时、恢复、改时区）后调用，下一次 tick 完整重算 */
+void timeServiceInvalidate(void);
+/** 复制本帧的本地时间；系统时间尚未有效（从未对时 / 恢复）时返回 false */
+bool timeServiceNow(struct tm* out);
+/** 本帧的 Unix 时间（秒） */
+time_t timeServiceEpoch(void);
+
+/* Sakamoto 算法的年项；1、2 月按上一年计 */
+constexpr int timeDowYearTerm(int y) {
+    return y + y / 4 - y / 100 + y / 400;
+}
+/** 纯函数（编译期可用）：公历某日是星期几（0 = 周日） */
+constexpr int timeDayOfWeek(int year, int month, int day) {
+    return (timeDowYearTerm(month < 3 ? year - 1 : year)
+            + "\0\3\2\5\0\3\5\1\4\6\2\4"[month - 1] + day) % 7;
+}
+constexpr bool timeIsLeapYear(int year) {
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+/** 纯函数（编译期可用）：某月天数（month 1..12） */
+constexpr int timeDaysInMonth(int year, int month) {
+    return month == 2 ? (timeIsLeapYear(year) ? 29 : 28)
+                      : 30 + ((month + (month >> 3)) & 1);
+}
+
+static_assert(timeDayOfWeek(2026, 1, 1) == 4, "2026-01-01 is a Thursday");
+static_assert(timeDaysInMonth(2024, 2) == 29 && timeDaysInMonth(2026, 8) == 31, "days in month");
+
+#endif
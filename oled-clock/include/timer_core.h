@@ -0,0 +1,64 @@
+/**
+ * @file timer_core.h
+ * @brief 多路倒计时核心（纯逻辑，可在主机编译）：槽位状态机 + 按截止时刻排序的最小堆
+ *
+ * 时刻一律为 64 位微秒（设备上是 esp_timer_get_time()），比较用有符号差值，
+ * 即使计数回绕，只要各截止时刻相距不超过 2^63 微秒顺序仍正确。
+ * 不加锁；多任务访问由调用方（timer_engine）负责。
+ */
+#ifndef TIMER_CORE_H
+#define TIMER_CORE_H
+
+#include <stdint.h>
+
+#define TIMER_SLOTS         4
+#define TIMER_MAX_SECONDS   (99 * 60 + 59)
+
+enum TimerSlotState {
+    TIMER_IDLE,
+    TIMER_RUNNING,
+    TIMER_PAUSED,
+    TIMER_RINGING       /* 已到时，等待确认 */
+};
+
+struct TimerSlot {
+    uint8_t state;
+    uint32_t durationS;     /* 设定时长 */
+    uint64_t deadlineUs;    /* RUNNING 时有效 */
+    uint64_t remainUs;      /* PAUSED 时有效 */
+};
+
+struct TimerHeapNode {
+    uint64_t deadlineUs;
+    uint8_t slot;
+};
+
+struct TimerCore {
+    TimerSlot slots[TIMER_SLOTS];
+    TimerHeapNode heap[TIMER_SLOTS];
+    uint8_t heapLen;
+    int8_t heapPos[TIMER_SLOTS];    /* 槽位在堆中的下标，不在堆中为 -1 */
+};
+
+/** a 是否早于 b（回绕安全） */
+static inline bool timerDeadlineBefore(uint64_t a, uint64_t b) {
+    return (int64_t)(a - b) < 0;
+}
+
+void timerCoreInit(TimerCore* c);
+/** 修改设定时长（只对 IDLE 槽位生效） */
+bool timerCoreSetDuration(TimerCore* c, int slot, uint32_t seconds);
+/** 以设定时长开始（IDLE / RINGING → RUNNING）；时长为 0 时返回 false */
+bool timerCoreStart(TimerCore* c, int slot, uint64_t nowUs);
+bool timerCorePause(TimerCore* c, int slot, uint64_t nowUs);
+bool timerCoreResume(TimerCore* c, int slot, uint64_t nowUs);
+/** 取消运行 / 暂停，或确认响铃，回到 IDLE */
+void timerCoreCancel(TimerCore* c, int slot);
+/** 取出一个已到时的槽位并置为 RINGING；没有则返回 -1 */
+int timerCorePopExpired(TimerCore* c, uint64_t nowUs);
+/** 最早的截止时刻；没有运行中的倒计时返回 false */
+bool timerCoreNextDeadline(const TimerCore* c, uint64_t* outUs);
+/** 剩余时间（微秒）：RUNNING 按 now 计算，PAUSED 为暂停时剩余，IDLE 为设定时长 */
+uint64_t timerCoreRemainingUs(const TimerCore* c, int slot, uint64_t nowUs);
+
+#endif
@@ -0,0 +1,35 @@
+/**
+ * @file timer_engine.h
+ * @brief 多路倒计时引擎：timer_core 堆顶截止时刻驱动一个单次 esp_timer
+ *
+ * 到时回调在 esp_timer 任务中执行，与当前页面无关；回调里不要做耗时操作。
+ * 所有接口可在任意任务中调用（内部用 portMUX 保护）。
+ */
+#ifndef TIMER_ENGINE_H
+#define TIMER_ENGINE_H
+
+#include "timer_core.h"
+
+typedef void (*TimerFiredCb)(int slot);
+
+struct TimerView {
+    uint8_t state;          /* TimerSlotState */
+    uint32_t durationS;
+    uint32_t remainMs;
+};
+
+/** setup() 中调用 */
+void timerEngineBegin(TimerFiredCb onFired);
+bool timerEngineSetDuration(int slot, uint32_t seconds);
+bool timerEngineStart(int slot);
+bool timerEnginePause(int slot);
+bool timerEngineResume(int slot);
+/** 取消运行 / 暂停，或确认响铃 */
+void timerEngineCancel(int slot);
+/** 确认所有响铃中的槽位；返回确认的个数 */
+int timerEngineDismissRinging(void);
+void timerEngineGet(int slot, TimerView* out);
+/** 运行中的倒计时个数 */
+int timerEngineRunningCount(void);
+
+#endif
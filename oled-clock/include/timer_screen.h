@@ -1,11 +1,14 @@
 /**
  * @file timer_screen.h
- * @brief 倒计时页：MM:SS 设置、运行、结束蜂鸣
+ * @brief 倒计时页：多路倒计时列表（底部状态条）、MM:SS 编辑
  */
 #ifndef TIMER_SCREEN_H
 #define TIMER_SCREEN_H
 
-void timerScreenPlayBeep(void);
+/** 以当前选中一路的设定时长进入编辑 */
+void timerScreenBeginEdit(void);
+/** 保存编辑的时长；不为 0 则立即开始 */
+void timerScreenCommitEdit(void);
 void timerScreenDraw(void);
 
 #endif
@@ -0,0 +1,36 @@
+/**
+ * @file tz_engine.h
+ * @brief 时区换算（纯逻辑，可在主机编译）：预编译的 UTC 偏移变化表 + 当前区间缓存
+ *
+ * 不使用 newlib 的 TZ 规则解析：表由 tools/gen_tz_table.py 从 tz 数据库生成（src/tz_table.h），
+ * 查偏移为二分查找；若时刻仍在上次查到的区间内，只需两次比较。
+ */
+#ifndef TZ_ENGINE_H
+#define TZ_ENGINE_H
+
+#include <stdint.h>
+#include <time.h>
+
+#define TZ_DEFAULT_ZONE  0      /* Asia/Shanghai */
+
+int tzZoneCount(void);
+const char* tzZoneName(int zone);
+/** 按 IANA 名称查找，找不到返回 -1 */
+int tzFindZone(const char* name);
+
+/** 选择当前时区（越界时回退到默认时区） */
+void tzSelect(int zone);
+int tzSelected(void);
+
+/**
+ * UTC → 当前时区本地时间（填 tm_isdst / tm_wday / tm_yday）。
+ * nextChange 可为 NULL，否则返回下次偏移变化的 UTC 时刻（无则为 INT64_MAX）。
+ */
+void tzLocalTime(int64_t utc, struct tm* out, int64_t* nextChange);
+/** 指定时区在 utc 时刻的偏移（秒），不影响缓存 */
+int32_t tzOffsetAt(int zone, int64_t utc);
+
+/** 纯函数：把「本地秒数」（自 1970-01-01 00:00 起）拆成年月日时分秒 */
+void tzCivilFromSeconds(int64_t localSec, struct tm* out);
+
+#endif
@@ -5,6 +5,9 @@
 #ifndef WEATHER_SCREEN_H
 #define WEATHER_SCREEN_H
 
+/** 缓存过期时申请租约并拉取（阻塞数秒，计入 weather_fetch）；在绘制之前、绘制计时之外调用 */
+void weatherScreenRefresh(void);
+/** 只绘制缓存的天气 */
 void weatherScreenDraw(void);
 
 #endif
@@ -1,10 +1,13 @@
 /**
  * @file web_config.h
- * @brief Web 配置：天气城市 ID 设置页（GET/POST）
+ * @brief Web 配置：天气城市 ID、时区设置页（GET/POST）
  */
 #ifndef WEB_CONFIG_H
 #define WEB_CONFIG_H
 
+/** 把设置存储中的城市、时区、联网策略、功耗档位应用到各模块（configStoreBegin 之后调用，不依赖网络） */
+void webConfigLoad(void);
+/** 启动 Web 服务（联网后调用） */
 void webConfigBegin(void);
 void webConfigHandleClient(void);
 
@@ -0,0 +1,43 @@
+/**
+ * @file wifi_assoc.h
+ * @brief 上次成功连接的缓存：BSSID、信道、DHCP 地址（RTC 内存 + NVS）
+ *
+ * 重连时按 BSSID + 信道定向连接，跳过全信道扫描；DHCP 租约取得不久时直接把地址
+ * 当作静态 IP 配置，跳过 DHCP。复位 / 深睡后从 RTC 内存读，冷启动从 NVS 读。
+ */
+#ifndef WIFI_ASSOC_H
+#define WIFI_ASSOC_H
+
+#include <stdint.h>
+
+/* 缓存的 DHCP 地址只在取得后这么久内当作静态 IP 用（按常见租期的一半保守取值） */
+#define WIFI_ASSOC_LEASE_MAX_S   3600
+#define WIFI_ASSOC_STATIC_IP     1
+
+struct WifiAssoc {
+    uint32_t magic;
+    uint8_t bssid[6];
+    uint8_t channel;
+    uint8_t hasIp;
+    uint32_t ip;            /* 网络字节序，与 IPAddress 的 uint32_t 转换一致 */
+    uint32_t gateway;
+    uint32_t netmask;
+    uint32_t dns;
+    int64_t leaseEpochS;    /* 经 DHCP 取得地址时的墙钟；静态复用不刷新 */
+    uint32_t check;
+};
+
+/** 纯函数：校验魔数与校验和 */
+bool wifiAssocValid(const WifiAssoc* a);
+void wifiAssocSeal(WifiAssoc* a);
+/** 纯函数：缓存的地址此刻能否当作静态 IP（墙钟未对时返回 false） */
+bool wifiAssocLeaseUsable(const WifiAssoc* a, int64_t nowEpochS);
+
+/** 读缓存：先 RTC 内存，再 NVS；都无效返回 false */
+bool wifiAssocLoad(WifiAssoc* out);
+/** 写缓存：RTC 内存每次都写，NVS 只在 BSSID / 信道 / 地址变化时写 */
+void wifiAssocSave(const WifiAssoc* a);
+/** 清除缓存（重新配网、定向连接失败时） */
+void wifiAssocForget(void);
+
+#endif
@@ -0,0 +1,53 @@
+/**
+ * @file alarm_core.cpp
+ * @brief 闹钟下次响铃时刻计算
+ */
+#include "alarm_core.h"
+#include "tz_engine.h"
+
+/*
+ * 偏移变化一天至多一次，且偏移不超过 ±14 小时：取本地时刻前后各一天的偏移作为候选，
+ * 能还原出同一本地时刻的即为有效换算。
+ */
+int64_t alarmLocalToUtc(int zone, int64_t localSec) {
+    int32_t before = tzOffsetAt(zone, localSec - 86400);
+    int32_t after = tzOffsetAt(zone, localSec + 86400);
+    int64_t u1 = localSec - before;
+    int64_t u2 = localSec - after;
+    bool ok1 = (u1 + tzOffsetAt(zone, u1) == localSec);
+    bool ok2 = (u2 + tzOffsetAt(zone, u2) == localSec);
+    if (ok1 && ok2) return u1 < u2 ? u1 : u2;
+    if (ok2) return u2;
+    return u1;      /* 有效，或落在跳过的时间里 */
+}
+
+int64_t alarmNextFireOne(const Alarm* a, int zone, int64_t nowUtc) {
+    if (!a->enabled) return -1;
+    int64_t localNow = nowUtc + tzOffsetAt(zone, nowUtc);
+    int64_t day = localNow / 86400;
+    if (localNow % 86400 < 0) day--;
+    int32_t sod = a->hour * 3600 + a->minute * 60;
+    /* 今天起 8 天内必有一天匹配星期掩码且晚于现在 */
+    for (int d = 0; d <= 7; d++) {
+        int64_t dd = day + d;
+        int wday = (int)((dd % 7 + 11) % 7);     /* 1970-01-01 为周四 */
+        if (a->weekdays != 0 && !(a->weekdays & (1u << wday))) continue;
+        int64_t utc = alarmLocalToUtc(zone, dd * 86400 + sod);
+        if (utc > nowUtc) return utc;
+    }
+    return -1;
+}
+
+int64_t alarmNextFire(const Alarm* alarms, int count, int zone, int64_t nowUtc, int* outIndex) {
+    int64_t best = -1;
+    int bestIdx = -1;
+    for (int i = 0; i < count; i++) {
+        int64_t t = alarmNextFireOne(&alarms[i], zone, nowUtc);
+        if (t >= 0 && (best < 0 || t < best)) {
+            best = t;
+            bestIdx = i;
+        }
+    }
+    if (outIndex) *outIndex = bestIdx;
+    return best;
+}
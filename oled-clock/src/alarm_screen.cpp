@@ -0,0 +1,202 @@
+/**
+ * @file alarm_screen.cpp
+ * @brief 闹钟页
+ *
+ * 列表：每行「时:分 重复」+ 右侧开关框，末行为「新建」（未满时）。
+ * 编辑：字段依次为 时、分、周一 … 周日、删除（新建时无删除）。
+ */
+#include "alarm_screen.h"
+#include "alarm_service.h"
+#include "display.h"
+#include "app_state.h"
+#include "metrics.h"
+#include "net_service.h"
+
+#define ALARM_ROW_H         12
+#define ALARM_ROWS          4
+#define ALARM_LIST_Y0       (TOP_BAR_H + 12)
+#define ALARM_SWITCH_SIZE   8
+#define ALARM_FIELD_HOUR    0
+#define ALARM_FIELD_MINUTE  1
+#define ALARM_FIELD_DAY0    2           /* 2..8：周一 .. 周日 */
+#define ALARM_FIELD_DELETE  9
+#define ALARM_CELL_W        14
+#define ALARM_TIME_Y        32
+#define ALARM_DAYS_Y        52
+
+static const char* const WEEKDAY_NAMES[7] = {
+    u8"一", u8"二", u8"三", u8"四", u8"五", u8"六", u8"日"
+};
+
+/* 显示顺序（周一起）→ 掩码位（bit0 = 周日） */
+static inline uint8_t dayBit(int cell) {
+    return (uint8_t)(1u << ((cell + 1) % 7));
+}
+
+static int itemCount(void) {
+    int n = alarmServiceCount();
+    return n < ALARM_MAX ? n + 1 : n;
+}
+
+static bool editingExisting(void) {
+    return g_alarmSel < alarmServiceCount();
+}
+
+static void repeatSummary(uint8_t days, char* buf, size_t cap) {
+    if (days == 0) { snprintf(buf, cap, "%s", u8"单次"); return; }
+    if (days == ALARM_EVERY_DAY) { snprintf(buf, cap, "%s", u8"每天"); return; }
+    if (days == 0x3E) { snprintf(buf, cap, "%s", u8"工作日"); return; }
+    if (days == 0x41) { snprintf(buf, cap, "%s", u8"周末"); return; }
+    size_t n = 0;
+    buf[0] = '\0';
+    for (int i = 0; i < 7; i++) {
+        if (!(days & dayBit(i))) continue;
+        n += snprintf(buf + n, cap - n, "%s", WEEKDAY_NAMES[i]);
+        if (n >= cap) break;
+    }
+}
+
+void alarmScreenEnter(void) {
+    g_alarmEditing = false;
+    if (g_alarmSel >= itemCount()) g_alarmSel = 0;
+}
+
+static void beginEdit(void) {
+    if (!alarmServiceGet(g_alarmSel, &g_alarmDraft)) {
+        g_alarmDraft.enabled = 1;
+        g_alarmDraft.hour = 7;
+        g_alarmDraft.minute = 0;
+        g_alarmDraft.weekdays = ALARM_EVERY_DAY;
+    }
+    g_alarmField = ALARM_FIELD_HOUR;
+    g_alarmEditing = true;
+}
+
+static void handleEdit(ButtonEvent left, ButtonEvent center, ButtonEvent right) {
+    int fields = editingExisting() ? ALARM_FIELD_DELETE + 1 : ALARM_FIELD_DELETE;
+    if (left == BTN_CLICK || left == BTN_DOUBLE_CLICK)
+        g_alarmField = (g_alarmField + fields - 1) % fields;
+    if (right == BTN_CLICK || right == BTN_DOUBLE_CLICK)
+        g_alarmField = (g_alarmField + 1) % fields;
+    if (center == BTN_CLICK) {
+        if (g_alarmField == ALARM_FIELD_HOUR) {
+            g_alarmDraft.hour = (uint8_t)((g_alarmDraft.hour + 1) % 24);
+        } else if (g_alarmField == ALARM_FIELD_MINUTE) {
+            g_alarmDraft.minute = (uint8_t)((g_alarmDraft.minute + 1) % 60);
+        } else if (g_alarmField == ALARM_FIELD_DELETE) {
+            alarmServiceRemove(g_alarmSel);
+            g_alarmEditing = false;
+        } else {
+            g_alarmDraft.weekdays ^= dayBit(g_alarmField - ALARM_FIELD_DAY0);
+        }
+    }
+    if (center == BTN_DOUBLE_CLICK) {
+        g_alarmDraft.enabled = 1;
+        alarmServiceSet(g_alarmSel, &g_alarmDraft);
+        g_alarmEditing = false;
+    }
+}
+
+void alarmScreenHandleButtons(ButtonEvent left, ButtonEvent center, ButtonEvent right) {
+    if (g_alarmEditing) {
+        handleEdit(left, center, right);
+        return;
+    }
+    int items = itemCount();
+    if (left == BTN_CLICK || left == BTN_DOUBLE_CLICK)
+        g_alarmSel = (g_alarmSel + items - 1) % items;
+    if (right == BTN_CLICK || right == BTN_DOUBLE_CLICK)
+        g_alarmSel = (g_alarmSel + 1) % items;
+    if (center == BTN_CLICK) {
+        Alarm a;
+        if (alarmServiceGet(g_alarmSel, &a)) {
+            a.enabled = !a.enabled;
+            alarmServiceSet(g_alarmSel, &a);
+        } else {
+            beginEdit();
+        }
+    }
+    if (center == BTN_DOUBLE_CLICK)
+        beginEdit();
+}
+
+static void drawList(void) {
+    int count = alarmServiceCount();
+    int items = itemCount();
+    int first = g_alarmSel - (ALARM_ROWS - 1);
+    if (first < 0) first = 0;
+    for (int row = 0; row < ALARM_ROWS && first + row < items; row++) {
+        int i = first + row;
+        int top = TOP_BAR_H + row * ALARM_ROW_H;
+        int baseY = ALARM_LIST_Y0 + row * ALARM_ROW_H;
+        if (i == g_alarmSel) {
+            u8g2.drawBox(0, top, SCREEN_W, ALARM_ROW_H);
+            u8g2.setDrawColor(0);
+        }
+        if (i < count) {
+            Alarm a;
+            alarmServiceGet(i, &a);
+            char line[40], rep[24];
+            repeatSummary(a.weekdays, rep, sizeof(rep));
+            snprintf(line, sizeof(line), "%02u:%02u %s", a.hour, a.minute, rep);
+            u8g2.drawUTF8(MARGIN_LEFT, baseY, line);
+            int sx = SCREEN_W - ALARM_SWITCH_SIZE - 2;
+            int sy = top + (ALARM_ROW_H - ALARM_SWITCH_SIZE) / 2;
+            if (a.enabled)
+                u8g2.drawBox(sx, sy, ALARM_SWITCH_SIZE, ALARM_SWITCH_SIZE);
+            else
+                u8g2.drawFrame(sx, sy, ALARM_SWITCH_SIZE, ALARM_SWITCH_SIZE);
+        } else {
+            u8g2.drawUTF8(MARGIN_LEFT, baseY, u8"+ 新建闹钟");
+        }
+        u8g2.setDrawColor(1);
+    }
+}
+
+static void drawEdit(void) {
+    char buf[8];
+    u8g2.setFont(u8g2_font_7x13B_tf);
+    snprintf(buf, sizeof(buf), "%02u:%02u", g_alarmDraft.hour, g_alarmDraft.minute);
+    int tw = u8g2.getStrWidth(buf);
+    int tx = (SCREEN_W - tw) / 2;
+    u8g2.drawStr(tx, ALARM_TIME_Y, buf);
+    if (g_alarmField <= ALARM_FIELD_MINUTE) {
+        int ux = tx + g_alarmField * 3 * 7;
+        u8g2.drawHLine(ux, ALARM_TIME_Y + 2, 14);
+    }
+
+    u8g2.setFont(u8g2_font_wqy12_t_gb2312);
+    int cells = editingExisting() ? 8 : 7;
+    int x0 = (SCREEN_W - cells * ALARM_CELL_W) / 2;
+    for (int c = 0; c < cells; c++) {
+        int x = x0 + c * ALARM_CELL_W;
+        const char* label = c < 7 ? WEEKDAY_NAMES[c] : u8"删";
+        bool on = c < 7 && (g_alarmDraft.weekdays & dayBit(c));
+        if (on) {
+            u8g2.drawBox(x, ALARM_DAYS_Y - 11, ALARM_CELL_W - 1, 13);
+            u8g2.setDrawColor(0);
+        }
+        u8g2.drawUTF8(x + 1, ALARM_DAYS_Y, label);
+        u8g2.setDrawColor(1);
+        if (g_alarmField == ALARM_FIELD_DAY0 + c)
+            u8g2.drawHLine(x, ALARM_DAYS_Y + 4, ALARM_CELL_W - 1);
+    }
+}
+
+void alarmScreenDraw(void) {
+    METRICS_SCOPE(MET_DRAW_ALARM);
+    u8g2.clearBuffer();
+    displayTopBarBackground();
+    displayWiFiIcon(WIFI_ICON_X, WIFI_ICON_Y, netServiceIsConnected());
+    displayPowerStatus();
+    u8g2.setFont(u8g2_font_wqy12_t_gb2312);
+    const char* title = g_alarmEditing ? u8"设置闹钟" : u8"闹钟";
+    int tw = u8g2.getUTF8Width(title);
+    u8g2.drawUTF8((SCREEN_W - tw) / 2, DATE_Y_TOP, title);
+
+    if (g_alarmEditing)
+        drawEdit();
+    else
+        drawList();
+    displaySendBuffer();
+}
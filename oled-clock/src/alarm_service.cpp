@@ -0,0 +1,153 @@
+/**
+ * @file alarm_service.cpp
+ * @brief 闹钟服务实现
+ *
+ * esp_timer 按单调时钟计时，墙钟跳变（对时、改时区）后须 alarmServiceReschedule。
+ * 换算延时用「墙钟 + 尚未完成的 adjtime 调整量」，平滑校正期间也不会提前或推迟。
+ */
+#include "alarm_service.h"
+#include "buzzer.h"
+#include "tz_engine.h"
+#include "config_store.h"
+#include <esp_timer.h>
+#include <sys/time.h>
+
+#define ALARM_VALID_EPOCH   1577836800      /* 2020-01-01，之前视为系统时间未设置 */
+
+static Alarm s_alarms[ALARM_MAX];
+static int s_count = 0;
+static esp_timer_handle_t s_timer = NULL;
+static int64_t s_nextUtc = -1;
+static int s_nextIndex = -1;
+static int64_t s_lastFiredUtc = 0;
+/* esp_timer 任务写、loop 读 */
+static volatile int s_firedIndex = -1;
+static volatile bool s_pendingFire = false;
+
+static int64_t wallNowUs(void) {
+    struct timeval tv, left;
+    gettimeofday(&tv, NULL);
+    int64_t us = (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+    if (adjtime(NULL, &left) == 0)
+        us += (int64_t)left.tv_sec * 1000000 + left.tv_usec;
+    return us;
+}
+
+static void onAlarm(void* arg) {
+    buzzerAlarm(ALARM_RING_MS);
+    s_firedIndex = s_nextIndex;
+    s_pendingFire = true;
+}
+
+/* 只改设置存储的内存副本，连续增删改由它合并成一次写入 */
+static void save(void) {
+    ConfigData* c = configStoreEdit();
+    memcpy(c->alarms, s_alarms, sizeof(Alarm) * s_count);
+    c->alarmCount = (uint8_t)s_count;
+}
+
+void alarmServiceReschedule(void) {
+    if (s_timer == NULL) return;
+    esp_timer_stop(s_timer);
+    s_nextUtc = -1;
+    s_nextIndex = -1;
+    int64_t nowUs = wallNowUs();
+    int64_t nowS = nowUs / 1000000;
+    if (nowS < ALARM_VALID_EPOCH) return;
+    /* 刚响过的时刻之前不再计算，避免 esp_timer 比墙钟略早触发时重复响铃 */
+    int64_t fromS = nowS > s_lastFiredUtc ? nowS : s_lastFiredUtc;
+    s_nextUtc = alarmNextFire(s_alarms, s_count, tzSelected(), fromS, &s_nextIndex);
+    if (s_nextUtc < 0) return;
+    int64_t delayUs = s_nextUtc * 1000000 - nowUs;
+    esp_timer_start_once(s_timer, delayUs > 0 ? (uint64_t)delayUs : 0);
+}
+
+void alarmServiceBegin(void) {
+    const ConfigData* c = configStoreGet();
+    s_count = c->alarmCount;
+    memcpy(s_alarms, c->alarms, sizeof(Alarm) * s_count);
+
+    esp_timer_create_args_t args = {};
+    args.callback = onAlarm;
+    args.dispatch_method = ESP_TIMER_TASK;
+    args.name = "alarm";
+    esp_timer_create(&args, &s_timer);
+    alarmServiceReschedule();
+}
+
+void alarmServiceLoop(void) {
+    if (!s_pendingFire) return;
+    s_pendingFire = false;
+    s_lastFiredUtc = s_nextUtc;
+    int idx = s_firedIndex;
+    if (idx >= 0 && idx < s_count && s_alarms[idx].weekdays == 0) {
+        s_alarms[idx].enabled = 0;
+        save();
+    }
+    alarmServiceReschedule();
+}
+
+void alarmServiceFireMissed(int index, int64_t utc) {
+    if (index < 0 || index >= s_count) return;
+    s_nextUtc = utc;
+    s_nextIndex = index;
+    onAlarm(NULL);
+}
+
+int alarmServiceTakeFired(void) {
+    if (s_pendingFire) return -1;       /* 等 alarmServiceLoop 收尾后再交给界面 */
+    int idx = s_firedIndex;
+    s_firedIndex = -1;
+    return idx;
+}
+
+int alarmServiceCount(void) {
+    return s_count;
+}
+
+bool alarmServiceGet(int index, Alarm* out) {
+    if (index < 0 || index >= s_count) return false;
+    *out = s_alarms[index];
+    return true;
+}
+
+bool alarmServiceSet(int index, const Alarm* a) {
+    if (index < 0 || index > s_count || index >= ALARM_MAX) return false;
+    if (a->hour > 23 || a->minute > 59) return false;
+    s_alarms[index] = *a;
+    s_alarms[index].weekdays &= ALARM_EVERY_DAY;
+    if (index == s_count) s_count++;
+    save();
+    alarmServiceReschedule();
+    return true;
+}
+
+bool alarmServiceRemove(int index) {
+    if (index < 0 || index >= s_count) return false;
+    for (int i = index; i + 1 < s_count; i++) s_alarms[i] = s_alarms[i + 1];
+    s_count--;
+    save();
+    alarmServiceReschedule();
+    return true;
+}
+
+bool alarmServiceNextFire(int64_t* outUtc, int* outIndex) {
+    if (s_nextUtc < 0) return false;
+    if (outUtc) *outUtc = s_nextUtc;
+    if (outIndex) *outIndex = s_nextIndex;
+    return true;
+}
+
+void alarmServiceWriteJson(Print& out) {
+    out.print("{\"alarms\":[");
+    for (int i = 0; i < s_count; i++) {
+        const Alarm* a = &s_alarms[i];
+        out.printf("%s{\"enabled\":%s,\"hour\":%u,\"minute\":%u,\"days\":%u}", i ? "," : "",
+                   a->enabled ? "true" : "false", a->hour, a->minute, a->weekdays);
+    }
+    out.printf("],\"max\":%d,\"next\":", ALARM_MAX);
+    if (s_nextUtc >= 0)
+        out.printf("{\"utc\":%lld,\"index\":%d}}", (long long)s_nextUtc, s_nextIndex);
+    else
+        out.print("null}");
+}
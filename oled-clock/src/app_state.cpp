@@ -6,32 +6,45 @@
 
 AppState g_state = STATE_MENU;
 int g_menuIndex = 0;
-int g_calYear = 2026;
-int g_calMonth = 1;
 
-uint32_t g_stopwatchAccumulatedMs = 0;
-uint32_t g_stopwatchRunStartMillis = 0;
+static const CalendarState CALENDAR_INIT = { 2026, 1 };
+SeqBlock<CalendarState> g_calendar(CALENDAR_INIT);
+SeqBlock<StopwatchState> g_stopwatch;
 
 bool g_ntpSynced = false;
 
-uint8_t g_timerDigits[4] = { 0, 0, 0, 0 };
-int g_timerDigitPos = 0;
-bool g_timerRunning = false;
-uint32_t g_timerEndMillis = 0;
+SeqBlock<TimerPageState> g_timerPage;
 
-char g_weatherLocation[32] = "kunming";
-char g_weatherCityName[16] = u8"昆明";
-char g_weatherTemp[8] = "--";
-char g_weatherText[8] = u8"晴";
-int g_weatherIconCode = 69;
-uint32_t g_weatherLastFetch = 0;
+int g_alarmSel = 0;
+bool g_alarmEditing = false;
+int g_alarmField = 0;
+Alarm g_alarmDraft = { 1, 7, 0, ALARM_EVERY_DAY };
+
+static const WeatherState WEATHER_INIT = { u8"昆明", "--", u8"晴", 69, 0 };
+SeqBlock<WeatherState> g_weather(WEATHER_INIT);
+static const ConfigState CONFIG_INIT = { "kunming" };
+SeqBlock<ConfigState> g_config(CONFIG_INIT);
+
+static uint8_t s_scratchBuf[SCRATCH_ARENA_BYTES];
+Arena g_scratchArena = { s_scratchBuf, sizeof(s_scratchBuf), 0, 0, 0, 0 };
+
+LoopBeat g_loopBeat = { 0, STALL_SETUP, NULL };
 
 void appStateInit(void) {
     g_state = STATE_MENU;
     g_menuIndex = 0;
     g_ntpSynced = false;
-    g_stopwatchAccumulatedMs = 0;
-    g_stopwatchRunStartMillis = 0;
-    g_timerDigitPos = 0;
-    g_timerRunning = false;
+    {
+        SeqWrite<StopwatchState> sw(g_stopwatch);
+        stopwatchCoreReset(&sw->core);
+        sw->showLaps = false;
+    }
+    {
+        SeqWrite<TimerPageState> tp(g_timerPage);
+        tp->sel = 0;
+        tp->editing = false;
+        tp->digitPos = 0;
+    }
+    g_alarmSel = 0;
+    g_alarmEditing = false;
 }
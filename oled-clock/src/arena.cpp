@@ -0,0 +1,39 @@
+/**
+ * @file arena.cpp
+ * @brief 区域分配器实现
+ */
+#include "arena.h"
+#include <string.h>
+
+void arenaInit(Arena* a, void* buf, size_t capacity) {
+    memset(a, 0, sizeof(*a));
+    a->base = (uint8_t*)buf;
+    a->capacity = capacity;
+}
+
+void* arenaAlloc(Arena* a, size_t size) {
+    /* 按绝对地址对齐：缓冲区本身不一定 8 字节对齐 */
+    uintptr_t at = (uintptr_t)(a->base + a->used);
+    size_t pad = (size_t)((ARENA_ALIGN - at % ARENA_ALIGN) % ARENA_ALIGN);
+    if (size > a->capacity || pad + size > a->capacity - a->used) {
+        a->failures++;
+        return NULL;
+    }
+    void* p = a->base + a->used + pad;
+    a->used += pad + size;
+    if (a->used > a->highWater) a->highWater = a->used;
+    a->allocs++;
+    return p;
+}
+
+size_t arenaMark(const Arena* a) {
+    return a->used;
+}
+
+void arenaRelease(Arena* a, size_t mark) {
+    if (mark < a->used) a->used = mark;
+}
+
+size_t arenaRemaining(const Arena* a) {
+    return a->capacity - a->used;
+}
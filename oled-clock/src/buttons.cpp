@@ -1,8 +1,21 @@
 /**
  * @file buttons.cpp
- * @brief 按键状态机：消抖 + 单击/双击/长按判定
+ * @brief 按键状态机：消抖 + 单击/双击/长按判定；按下沿由中断记录精确时刻
+ *
+ * 事件判定仍靠轮询（有按键动作时 loop 每 14ms 左右一次，绘制较慢的帧会更久），中断负责
+ * 记下按下沿的 esp_timer 时刻：一段 BTN_DEBOUNCE_MS 的静默之后的第一个下降沿。
+ *
+ * 中断用电平触发并在每次触发后翻转电平（低→等高、高→等低），效果等同双边沿；
+ * 电平触发同时作为浅睡的 GPIO 唤醒条件（ESP32 浅睡只支持电平唤醒）。
+ * 每个沿都通知等待中的 loop 任务，使空闲等待可以一直阻塞到有按键动作为止。
  */
 #include "buttons.h"
+#include <esp_timer.h>
+#include <driver/gpio.h>
+#include <soc/gpio_struct.h>
+
+/* 轮询确认按下时，中断时刻须在这个时间之内才采用，否则退回轮询时刻 */
+#define BTN_EDGE_MAX_AGE_MS  250
 
 static uint8_t readStable(int pin, uint8_t* lastRaw, uint32_t* lastChange) {
     uint8_t raw = (digitalRead(pin) == LOW) ? 1 : 0;
@@ -26,11 +39,63 @@ struct BtnState {
     uint8_t inDoubleWindow;
     uint32_t releaseTime;
     ButtonEvent pending;
+    int64_t pressUs;            /* 当前这次按下的时刻 */
+    int64_t eventPressUs;       /* pending 事件对应的按下时刻 */
+    int64_t consumedPressUs;    /* 最近一次取走的事件对应的按下时刻 */
+    volatile int64_t isrPressUs;
+    volatile int64_t isrLastEdgeUs;
+    volatile uint8_t isrWaitHigh;   /* 当前等待松开（高电平） */
 };
 
-static BtnState s_left  = { BTN_LEFT_PIN,   0, 0, 0, 0, 0, 0, 0, BTN_NONE };
-static BtnState s_center = { BTN_CENTER_PIN, 0, 0, 0, 0, 0, 0, 0, BTN_NONE };
-static BtnState s_right = { BTN_RIGHT_PIN,  0, 0, 0, 0, 0, 0, 0, BTN_NONE };
+static portMUX_TYPE s_isrMux = portMUX_INITIALIZER_UNLOCKED;
+
+static BtnState s_left  = { BTN_LEFT_PIN,   0, 0, 0, 0, 0, 0, 0, BTN_NONE, 0, 0, 0, 0, 0, 0 };
+static BtnState s_center = { BTN_CENTER_PIN, 0, 0, 0, 0, 0, 0, 0, BTN_NONE, 0, 0, 0, 0, 0, 0 };
+static BtnState s_right = { BTN_RIGHT_PIN,  0, 0, 0, 0, 0, 0, 0, BTN_NONE, 0, 0, 0, 0, 0, 0 };
+
+static TaskHandle_t s_waitTask = NULL;
+
+static void IRAM_ATTR onEdge(BtnState* b) {
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL_ISR(&s_isrMux);
+    bool pressed = !b->isrWaitHigh;
+    if (pressed && now - b->isrLastEdgeUs >= (int64_t)BTN_DEBOUNCE_MS * 1000)
+        b->isrPressUs = now;
+    b->isrLastEdgeUs = now;
+    b->isrWaitHigh = pressed ? 1 : 0;
+    portEXIT_CRITICAL_ISR(&s_isrMux);
+    /*
+     * 翻转触发电平（中断与浅睡唤醒共用 int_type）。GPIO 中断服务以 ESP_INTR_FLAG_IRAM 安装，
+     * 写 NVS / Flash 期间 cache 关闭时也会进来，不能调用放在 Flash 中的 gpio_wakeup_enable，
+     * 直接写寄存器；wakeup_enable 位在 buttonsInit 中已置上
+     */
+    GPIO.pin[b->pin].int_type = pressed ? GPIO_INTR_HIGH_LEVEL : GPIO_INTR_LOW_LEVEL;
+
+    if (s_waitTask) {
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR(s_waitTask, &woken);
+        portYIELD_FROM_ISR(woken);
+    }
+}
+
+static void IRAM_ATTR onLeftEdge(void)   { onEdge(&s_left);   }
+static void IRAM_ATTR onCenterEdge(void) { onEdge(&s_center); }
+static void IRAM_ATTR onRightEdge(void)  { onEdge(&s_right);  }
+
+static int64_t pressTimestampUs(BtnState* b) {
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&s_isrMux);
+    int64_t edge = b->isrPressUs;
+    portEXIT_CRITICAL(&s_isrMux);
+    if (edge <= now && now - edge <= (int64_t)BTN_EDGE_MAX_AGE_MS * 1000)
+        return edge;
+    return now;
+}
+
+static void setPending(BtnState* b, ButtonEvent e) {
+    b->pending = e;
+    b->eventPressUs = b->pressUs;
+}
 
 static void updateOne(BtnState* b) {
     b->wasStable = b->stable;
@@ -39,15 +104,16 @@ static void updateOne(BtnState* b) {
 
     if (b->stable && !b->wasStable) {
         b->pressTime = now;
+        b->pressUs = pressTimestampUs(b);
     }
     if (!b->stable && b->wasStable) {
         uint32_t hold = now - b->pressTime;
         if (hold >= BTN_LONG_PRESS_MS) {
-            b->pending = BTN_LONG_PRESS;
+            setPending(b, BTN_LONG_PRESS);
             b->inDoubleWindow = 0;
         } else if (hold >= BTN_DEBOUNCE_MS) {
             if (b->inDoubleWindow && (now - b->releaseTime <= BTN_DOUBLE_MS)) {
-                b->pending = BTN_DOUBLE_CLICK;
+                setPending(b, BTN_DOUBLE_CLICK);
                 b->inDoubleWindow = 0;
             } else {
                 b->releaseTime = now;
@@ -58,7 +124,7 @@ static void updateOne(BtnState* b) {
     if (b->inDoubleWindow && (now - b->releaseTime >= BTN_DOUBLE_MS)) {
         b->inDoubleWindow = 0;
         if (b->pending == BTN_NONE)
-            b->pending = BTN_CLICK;
+            setPending(b, BTN_CLICK);
     }
 }
 
@@ -66,6 +132,14 @@ void buttonsInit(void) {
     pinMode(BTN_LEFT_PIN,   INPUT_PULLUP);
     pinMode(BTN_CENTER_PIN, INPUT_PULLUP);
     pinMode(BTN_RIGHT_PIN,  INPUT_PULLUP);
+    s_waitTask = xTaskGetCurrentTaskHandle();
+    attachInterrupt(digitalPinToInterrupt(BTN_LEFT_PIN),   onLeftEdge,   ONLOW);
+    attachInterrupt(digitalPinToInterrupt(BTN_CENTER_PIN), onCenterEdge, ONLOW);
+    attachInterrupt(digitalPinToInterrupt(BTN_RIGHT_PIN),  onRightEdge,  ONLOW);
+    /* 同一电平也作为浅睡唤醒条件；是否启用 GPIO 唤醒由 power_service 决定 */
+    gpio_wakeup_enable((gpio_num_t)BTN_LEFT_PIN,   GPIO_INTR_LOW_LEVEL);
+    gpio_wakeup_enable((gpio_num_t)BTN_CENTER_PIN, GPIO_INTR_LOW_LEVEL);
+    gpio_wakeup_enable((gpio_num_t)BTN_RIGHT_PIN,  GPIO_INTR_LOW_LEVEL);
 }
 
 void buttonsUpdate(void) {
@@ -74,12 +148,33 @@ void buttonsUpdate(void) {
     updateOne(&s_right);
 }
 
+static bool busyOne(const BtnState* b) {
+    return b->stable || b->lastRaw || b->inDoubleWindow || b->isrWaitHigh;
+}
+
+bool buttonsBusy(void) {
+    return busyOne(&s_left) || busyOne(&s_center) || busyOne(&s_right);
+}
+
+bool buttonsPending(void) {
+    return s_left.pending != BTN_NONE || s_center.pending != BTN_NONE || s_right.pending != BTN_NONE;
+}
+
+bool buttonsWaitEdge(uint32_t timeoutMs) {
+    return ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(timeoutMs)) > 0;
+}
+
 static ButtonEvent consume(BtnState* b) {
     ButtonEvent e = b->pending;
     b->pending = BTN_NONE;
+    if (e != BTN_NONE) b->consumedPressUs = b->eventPressUs;
     return e;
 }
 
 ButtonEvent buttonsGetLeft(void)   { return consume(&s_left);   }
 ButtonEvent buttonsGetCenter(void) { return consume(&s_center); }
 ButtonEvent buttonsGetRight(void)  { return consume(&s_right); }
+
+int64_t buttonsLeftPressUs(void)   { return s_left.consumedPressUs;   }
+int64_t buttonsCenterPressUs(void) { return s_center.consumedPressUs; }
+int64_t buttonsRightPressUs(void)  { return s_right.consumedPressUs;  }
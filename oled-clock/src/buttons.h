@@ -28,5 +28,15 @@ void buttonsUpdate(void);
 ButtonEvent buttonsGetLeft(void);
 ButtonEvent buttonsGetCenter(void);
 ButtonEvent buttonsGetRight(void);
+/** 最近一次取走的事件对应的按下时刻（esp_timer 微秒；双击为第二次按下） */
+int64_t buttonsLeftPressUs(void);
+int64_t buttonsCenterPressUs(void);
+int64_t buttonsRightPressUs(void);
+/** 有键按下、抖动未稳或处于双击窗口：此时需要按 BTN 轮询间隔调用 buttonsUpdate */
+bool buttonsBusy(void);
+/** 有尚未取走的事件 */
+bool buttonsPending(void);
+/** 只能在 buttonsInit 所在任务（loop）中调用：阻塞到下一个按键沿或超时，返回是否有沿 */
+bool buttonsWaitEdge(uint32_t timeoutMs);
 
 #endif
@@ -0,0 +1,81 @@
+/**
+ * @file buzzer.cpp
+ * @brief 蜂鸣器节奏提醒实现
+ *
+ * 所有 ledcWriteTone 都在 esp_timer 回调中执行，buzzerStop 只清标志并立即触发一次回调，
+ * 避免不同任务交错写 LEDC。响铃期间持有忙锁：LEDC 在浅睡中停振，降频也会改变音调。
+ */
+#include "buzzer.h"
+#include "power_service.h"
+#include "energy_service.h"
+#include <Arduino.h>
+#include <esp_timer.h>
+
+/* 响 180ms、停 120ms、响 180ms、停 480ms，循环 */
+static const uint16_t BUZZER_PATTERN_MS[] = { 180, 120, 180, 480 };
+#define BUZZER_PATTERN_LEN  (sizeof(BUZZER_PATTERN_MS) / sizeof(BUZZER_PATTERN_MS[0]))
+
+static esp_timer_handle_t s_timer = NULL;
+static volatile bool s_active = false;
+static volatile int64_t s_endUs = 0;
+static uint8_t s_step = 0;
+static portMUX_TYPE s_holdMux = portMUX_INITIALIZER_UNLOCKED;
+static bool s_holding = false;
+
+/* buzzerAlarm 可能来自 loop 或 esp_timer 任务，持锁状态的翻转要原子 */
+static void holdPower(bool hold) {
+    portENTER_CRITICAL(&s_holdMux);
+    bool change = s_holding != hold;
+    s_holding = hold;
+    portEXIT_CRITICAL(&s_holdMux);
+    if (!change) return;
+    if (hold) powerBusyAcquire();
+    else powerBusyRelease();
+}
+
+static void onStep(void* arg) {
+    if (!s_active || esp_timer_get_time() >= s_endUs) {
+        s_active = false;
+        ledcWriteTone(BUZZER_LEDC_CHANNEL, 0);
+        energyBuzzer(false);
+        holdPower(false);
+        return;
+    }
+    holdPower(true);    /* 与 buzzerAlarm 交错时可能刚被上一轮收尾释放 */
+    ledcWriteTone(BUZZER_LEDC_CHANNEL, (s_step & 1) ? 0 : BUZZER_FREQ_HZ);
+    energyBuzzer((s_step & 1) == 0);
+    uint32_t ms = BUZZER_PATTERN_MS[s_step];
+    s_step = (uint8_t)((s_step + 1) % BUZZER_PATTERN_LEN);
+    esp_timer_start_once(s_timer, (uint64_t)ms * 1000);
+}
+
+void buzzerBegin(void) {
+    pinMode(BUZZER_PIN, OUTPUT);
+    ledcAttachPin(BUZZER_PIN, BUZZER_LEDC_CHANNEL);
+    esp_timer_create_args_t args = {};
+    args.callback = onStep;
+    args.dispatch_method = ESP_TIMER_TASK;
+    args.name = "buzzer";
+    esp_timer_create(&args, &s_timer);
+}
+
+void buzzerAlarm(uint32_t durationMs) {
+    if (s_timer == NULL) return;
+    holdPower(true);
+    esp_timer_stop(s_timer);
+    s_step = 0;
+    s_endUs = esp_timer_get_time() + (int64_t)durationMs * 1000;
+    s_active = true;
+    esp_timer_start_once(s_timer, 0);
+}
+
+void buzzerStop(void) {
+    if (s_timer == NULL || !s_active) return;
+    s_active = false;
+    esp_timer_stop(s_timer);
+    esp_timer_start_once(s_timer, 0);
+}
+
+bool buzzerIsActive(void) {
+    return s_active;
+}
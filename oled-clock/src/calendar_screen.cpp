@@ -1,115 +1,225 @@
 /**
  * @file calendar_screen.cpp
- * @brief 日历：月历网格 + 右侧年月显示
+ * @brief 日历：月历网格（支持 6 行、相邻月份位图缓存、节气 / 初一标记）+ 右侧年月与农历
  */
 #include "calendar_screen.h"
 #include "display.h"
 #include "app_state.h"
-#include <time.h>
+#include "metrics.h"
+#include "month_layout.h"
+#include "lunar_calendar.h"
+#include <string.h>
 
 #define CAL_LEFT_W   101
 #define CAL_RIGHT_W  (SCREEN_W - CAL_LEFT_W)
 #define CAL_HEADER_H 12
-#define CAL_ROW_H    10
-#define CAL_ROWS     5
+#define CAL_GRID_H   (SCREEN_H - CAL_HEADER_H)
 #define CAL_CELL_W   (CAL_LEFT_W / 7)
+#define CAL_PAGES    (SCREEN_H / 8)
+#define CAL_CACHE_N  3      /* 当前月与前后各一个月 */
 
-static int daysInMonth(int year, int month) {
-    static const int d[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
-    int n = d[month - 1];
-    if (month == 2 && (year % 4 == 0 && year % 100 != 0 || year % 400 == 0))
-        n = 29;
-    return n;
+/*
+ * 左侧月历（星期表头 + 日期网格 + 节气 / 初一标记，不含「今天」高亮）按 u8g2 帧缓冲的页格式缓存：
+ * 每页 8 行像素、每列 1 字节，只存前 CAL_LEFT_W 列。翻月时直接 memcpy 进帧缓冲，
+ * 缺失的相邻月份在送显之后再渲染（借用已送显的帧缓冲），每帧最多一个。
+ */
+struct CalCacheSlot {
+    int16_t year;
+    int8_t month;       /* 0 表示空 */
+    uint8_t pages[CAL_PAGES][CAL_LEFT_W];
+};
+
+static CalCacheSlot s_cache[CAL_CACHE_N];
+
+/* 右侧农历文字：参考日变化时才重新换算 */
+struct LunarRef {
+    int year, month, day;
+    char monthText[12];     /* "七月" / "闰六" */
+    char dayText[8];        /* "初五" 或节气名 */
+};
+
+static LunarRef s_ref;
+/* 本帧显示的年月：绘制开始时从 g_calendar 取一次快照，预取相邻月份也以它为准 */
+static CalendarState s_cal;
+
+static int termOfDay(int year, int month, int day) {
+    int k = (month - 1) * 2;
+    if (solarTermDay(year, k) == day) return k;
+    if (solarTermDay(year, k + 1) == day) return k + 1;
+    return -1;
 }
 
-static int firstWday(int year, int month) {
-    struct tm t = {};
-    t.tm_year = year - 1900;
-    t.tm_mon = month - 1;
-    t.tm_mday = 1;
-    t.tm_hour = 12;
-    time_t tt = mktime(&t);
-    if (tt == (time_t)-1) return 0;
-    localtime_r(&tt, &t);
-    return t.tm_wday;
+static void updateLunarRef(int day) {
+    s_ref.year = s_cal.year;
+    s_ref.month = s_cal.month;
+    s_ref.day = day;
+    LunarDate ld;
+    if (!lunarFromSolar(s_cal.year, s_cal.month, day, &ld)) {
+        s_ref.monthText[0] = s_ref.dayText[0] = '\0';
+        return;
+    }
+    const char* mn = lunarMonthName(ld.month);
+    if (ld.leap)
+        snprintf(s_ref.monthText, sizeof(s_ref.monthText), u8"闰%.3s", mn);   /* 每个汉字 3 字节 */
+    else
+        snprintf(s_ref.monthText, sizeof(s_ref.monthText), "%s", mn);
+    int term = termOfDay(s_cal.year, s_cal.month, day);
+    snprintf(s_ref.dayText, sizeof(s_ref.dayText), "%s",
+             term >= 0 ? solarTermName(term) : lunarDayName(ld.day));
 }
 
-void calendarScreenDraw(int todayYear, int todayMonth, int todayDay) {
-    u8g2.clearBuffer();
+/* 6 行的月份行高压到 8 像素并换小字体 */
+static int rowHeight(const MonthLayout* l) {
+    int h = CAL_GRID_H / l->rows;
+    return h > 10 ? 10 : h;
+}
 
-    const int first = firstWday(g_calYear, g_calMonth);
-    const int days = daysInMonth(g_calYear, g_calMonth);
+static const uint8_t* dayFont(const MonthLayout* l) {
+    return l->rows > 5 ? u8g2_font_5x7_tf : u8g2_font_6x10_tf;
+}
 
+static void drawDayNumber(const MonthLayout* l, int day, int x, int cellY, int rowH) {
+    char num[4];
+    snprintf(num, sizeof(num), "%d", day);
+    int nw = u8g2.getStrWidth(num);
+    u8g2.drawStr(x + (CAL_CELL_W - nw) / 2, cellY + rowH - (l->rows > 5 ? 1 : 2), num);
+}
+
+static void drawGrid(const MonthLayout* l) {
     u8g2.setFont(u8g2_font_wqy12_t_gb2312);
     const char* weekdays[] = { u8"日", u8"一", u8"二", u8"三", u8"四", u8"五", u8"六" };
     for (int c = 0; c < 7; c++) {
         int cw = u8g2.getUTF8Width(weekdays[c]);
         u8g2.drawUTF8(c * CAL_CELL_W + (CAL_CELL_W - cw) / 2, CAL_HEADER_H - 2, weekdays[c]);
     }
+    u8g2.setFont(dayFont(l));
+    int rowH = rowHeight(l);
+    int term0 = solarTermDay(l->year, (l->month - 1) * 2);
+    int term1 = solarTermDay(l->year, (l->month - 1) * 2 + 1);
+    LunarDate ld;
+    for (int day = 1; day <= l->days; day++) {
+        int row, col;
+        monthLayoutCell(l, day, &row, &col);
+        int x = col * CAL_CELL_W, cellY = CAL_HEADER_H + row * rowH;
+        drawDayNumber(l, day, x, cellY, rowH);
+        /* 格内放不下汉字：节气日在格右上、农历初一在格左上各画一道短竖线 */
+        if (day == term0 || day == term1)
+            u8g2.drawVLine(x + CAL_CELL_W - 1, cellY + 1, 3);
+        if (lunarFromSolar(l->year, l->month, day, &ld) && ld.day == 1)
+            u8g2.drawVLine(x, cellY + 1, 3);
+    }
+}
+
+static CalCacheSlot* cacheFind(int year, int month) {
+    for (int i = 0; i < CAL_CACHE_N; i++)
+        if (s_cache[i].month == month && s_cache[i].year == year) return &s_cache[i];
+    return NULL;
+}
+
+/* 槽位是否为当前显示月份或其相邻月份 */
+static bool slotInWindow(const CalCacheSlot* slot) {
+    for (int d = -1; d <= 1; d++) {
+        int y = s_cal.year, m = s_cal.month;
+        monthLayoutStep(&y, &m, d);
+        if (slot->year == y && slot->month == m) return true;
+    }
+    return false;
+}
 
-    u8g2.setFont(u8g2_font_6x10_tf);
-    for (int day = 1; day <= days; day++) {
-        int pos = first + (day - 1);
-        if (pos >= CAL_ROWS * 7) break;
-        int row = pos / 7;
-        int col = pos % 7;
-        int x = col * CAL_CELL_W;
-        int cellY = CAL_HEADER_H + row * CAL_ROW_H;
-        int y = cellY + CAL_ROW_H - 2;
-        int isToday = (g_calYear == todayYear && g_calMonth == todayMonth && day == todayDay);
-        if (isToday) {
-            int bx = x + 1, by = cellY + 1, bw = CAL_CELL_W - 2, bh = CAL_ROW_H - 2;
-            u8g2.drawRBox(bx, by, bw, bh, 1);
-            u8g2.setDrawColor(0);
+/* 把帧缓冲中刚画好的月历存入缓存；替换不在当前窗口内的槽 */
+static void cacheStore(int year, int month) {
+    CalCacheSlot* slot = &s_cache[0];
+    for (int i = 0; i < CAL_CACHE_N; i++) {
+        if (!slotInWindow(&s_cache[i])) {
+            slot = &s_cache[i];
+            break;
         }
-        char num[4];
-        snprintf(num, sizeof(num), "%d", day);
-        int nw = u8g2.getStrWidth(num);
-        u8g2.drawStr(x + (CAL_CELL_W - nw) / 2, y, num);
-        if (isToday)
-            u8g2.setDrawColor(1);
     }
+    const uint8_t* fb = u8g2.getBufferPtr();
+    for (int p = 0; p < CAL_PAGES; p++)
+        memcpy(slot->pages[p], fb + p * SCREEN_W, CAL_LEFT_W);
+    slot->year = (int16_t)year;
+    slot->month = (int8_t)month;
+}
 
-    int rx = CAL_LEFT_W;
-    int rw = CAL_RIGHT_W;
-    u8g2.drawVLine(CAL_LEFT_W, 0, SCREEN_H);
+static void cacheBlit(const CalCacheSlot* slot) {
+    uint8_t* fb = u8g2.getBufferPtr();
+    for (int p = 0; p < CAL_PAGES; p++)
+        memcpy(fb + p * SCREEN_W, slot->pages[p], CAL_LEFT_W);
+}
 
-    u8g2.setFont(u8g2_font_wqy12_t_gb2312);
-    const int RIGHT_LINE_H = 16;
-    const int RIGHT_BLOCK_H = 4 * RIGHT_LINE_H;
-    int startY = (SCREEN_H - RIGHT_BLOCK_H) / 2;
-    if (startY < 0) startY = 0;
-    int baseOff = 10;
-
-    char yearNum[4], monthNum[4];
-    snprintf(yearNum, sizeof(yearNum), "%02d", g_calYear % 100);
-    snprintf(monthNum, sizeof(monthNum), "%02d", g_calMonth);
-    const char* yearSuffix = u8"年";
-    const char* monthSuffix = u8"月";
-    int yNumW = u8g2.getStrWidth(yearNum);
-    int ySufW = u8g2.getUTF8Width(yearSuffix);
-    int mNumW = u8g2.getStrWidth(monthNum);
-    int mSufW = u8g2.getUTF8Width(monthSuffix);
-
-    int yearNumY = startY + baseOff;
-    int yearSufY = startY + RIGHT_LINE_H + baseOff;
-    int monthNumY = startY + 2 * RIGHT_LINE_H + baseOff;
-    int monthSufY = startY + 3 * RIGHT_LINE_H + baseOff;
-
-    int cx = rx + rw / 2;
-    int startX = cx - (yNumW + 2) / 2;
-    u8g2.drawRBox(startX, yearNumY - 10, yNumW + 2, 14, 1);
-    u8g2.setDrawColor(0);
-    u8g2.drawStr(startX + 1, yearNumY, yearNum);
-    u8g2.setDrawColor(1);
-    u8g2.drawUTF8(cx - ySufW / 2, yearSufY, yearSuffix);
+/* 送显后调用：补齐一个缺失的相邻月份 */
+static void prefetchNeighbour(void) {
+    for (int d = -1; d <= 1; d += 2) {
+        int y = s_cal.year, m = s_cal.month;
+        monthLayoutStep(&y, &m, d);
+        if (cacheFind(y, m)) continue;
+        MonthLayout l = monthLayoutCompute(y, m);
+        u8g2.clearBuffer();
+        drawGrid(&l);
+        cacheStore(y, m);
+        return;
+    }
+}
 
-    startX = cx - (mNumW + 2) / 2;
-    u8g2.drawRBox(startX, monthNumY - 10, mNumW + 2, 14, 1);
+/* 右侧一行：反色框数字 + 后缀，如 [26]年 */
+static void drawBoxedNumber(int y, int num, const char* suffix) {
+    char buf[4];
+    snprintf(buf, sizeof(buf), "%02d", num);
+    int nw = u8g2.getStrWidth(buf);
+    int sw = u8g2.getUTF8Width(suffix);
+    int x = CAL_LEFT_W + 1 + (CAL_RIGHT_W - 1 - (nw + 2 + sw)) / 2;
+    u8g2.drawRBox(x, y - 10, nw + 2, 13, 1);
     u8g2.setDrawColor(0);
-    u8g2.drawStr(startX + 1, monthNumY, monthNum);
+    u8g2.drawStr(x + 1, y, buf);
     u8g2.setDrawColor(1);
-    u8g2.drawUTF8(cx - mSufW / 2, monthSufY, monthSuffix);
+    u8g2.drawUTF8(x + nw + 2, y, suffix);
+}
+
+static void drawCentered(int y, const char* s) {
+    int w = u8g2.getUTF8Width(s);
+    u8g2.drawUTF8(CAL_LEFT_W + 1 + (CAL_RIGHT_W - 1 - w) / 2, y, s);
+}
+
+/* 右侧：年、月，以及参考日（本月含今天则为今天，否则为 1 日）的农历月与农历日 / 节气 */
+static void drawRightPanel(int refDay) {
+    if (s_ref.year != s_cal.year || s_ref.month != s_cal.month || s_ref.day != refDay)
+        updateLunarRef(refDay);
+    u8g2.setFont(u8g2_font_wqy12_t_gb2312);
+    drawBoxedNumber(12, s_cal.year % 100, u8"年");
+    drawBoxedNumber(28, s_cal.month, u8"月");
+    drawCentered(44, s_ref.monthText);
+    drawCentered(60, s_ref.dayText);
+}
+
+void calendarScreenDraw(int todayYear, int todayMonth, int todayDay) {
+    METRICS_SCOPE(MET_DRAW_CALENDAR);
+    g_calendar.read(&s_cal);
+    u8g2.clearBuffer();
+
+    MonthLayout l = monthLayoutCompute(s_cal.year, s_cal.month);
+    CalCacheSlot* slot = cacheFind(s_cal.year, s_cal.month);
+    if (slot) {
+        cacheBlit(slot);
+    } else {
+        drawGrid(&l);
+        cacheStore(s_cal.year, s_cal.month);
+    }
+
+    if (s_cal.year == todayYear && s_cal.month == todayMonth && todayDay >= 1 && todayDay <= l.days) {
+        int row, col, rowH = rowHeight(&l);
+        monthLayoutCell(&l, todayDay, &row, &col);
+        int x = col * CAL_CELL_W, cellY = CAL_HEADER_H + row * rowH;
+        u8g2.drawRBox(x + 1, cellY + (rowH > 8 ? 1 : 0), CAL_CELL_W - 2, rowH > 8 ? rowH - 2 : rowH, 1);
+        u8g2.setDrawColor(0);
+        u8g2.setFont(dayFont(&l));
+        drawDayNumber(&l, todayDay, x, cellY, rowH);
+        u8g2.setDrawColor(1);
+    }
+
+    u8g2.drawVLine(CAL_LEFT_W, 0, SCREEN_H);
+    drawRightPanel(s_cal.year == todayYear && s_cal.month == todayMonth ? todayDay : 1);
 
-    u8g2.sendBuffer();
+    displaySendBuffer();
+    prefetchNeighbour();
 }
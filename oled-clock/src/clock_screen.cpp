@@ -1,36 +1,79 @@
 /**
  * @file clock_screen.cpp
- * @brief 时钟页：顶栏 + 日期 + 时间位图；NTP 同步
+ * @brief 时钟页：顶栏 + 日期 + 时间位图；右键切换对时详情
  */
 #include "clock_screen.h"
 #include "display.h"
 #include "app_state.h"
-#include <WiFi.h>
-#include <time.h>
-
-static const char* ntpServer = "ntp.aliyun.com";
-static const long  gmtOffset_sec = 8 * 3600;
-static const int   daylightOffset_sec = 0;
-
-bool clockScreenSyncNtp(void (*drawNtp)(const char*, int), int maxTries, int intervalMs) {
-    configTime(gmtOffset_sec, daylightOffset_sec, ntpServer);
-    struct tm t = {};
-    for (int i = 0; i < maxTries; i++) {
-        if (drawNtp) drawNtp(u8"正在同步时间", i % 4);
-        if (getLocalTime(&t))
-            return true;
-        delay(intervalMs);
-    }
-    return false;
+#include "metrics.h"
+#include "net_service.h"
+#include "power_governor.h"
+#include "sntp_service.h"
+#include "time_persist.h"
+#include "time_service.h"
+#include <Arduino.h>
+
+static bool s_showSyncDetail = false;
+
+void clockScreenToggleDetail(void) {
+    s_showSyncDetail = !s_showSyncDetail;
+}
+
+/* 时间来自恢复的估计值（尚未对时）：底部小字标注及误差上界 */
+static void drawUnsyncedNote(void) {
+    TimeSource src = timePersistSource();
+    if (src == TIME_SRC_NTP) return;
+    char note[24];
+    uint32_t errMs;
+    if (timePersistErrorBoundMs(&errMs))
+        snprintf(note, sizeof(note), "UNSYNCED +-%lus", (unsigned long)((errMs + 999) / 1000));
+    else
+        snprintf(note, sizeof(note), "UNSYNCED +-?");
+    u8g2.setFont(u8g2_font_4x6_tf);
+    int w = u8g2.getStrWidth(note);
+    u8g2.drawStr((SCREEN_W - w) / 2, SCREEN_H - 1, note);
+}
+
+/* 对时详情：偏差、延迟、漂移估计、距上次对时 */
+static void drawSyncDetail(void) {
+    SntpStatus st;
+    sntpServiceGetStatus(&st);
+    char line[40];
+    if (!st.synced)
+        snprintf(line, sizeof(line), "SNTP no sync, fail %lu", (unsigned long)st.failCount);
+    else if (st.ageS < 3600)
+        snprintf(line, sizeof(line), "%+ldms rt%lu %+.1fppm %lum", (long)st.offsetMs,
+                 (unsigned long)st.delayMs, st.driftPpm, (unsigned long)(st.ageS / 60));
+    else
+        snprintf(line, sizeof(line), "%+ldms rt%lu %+.1fppm %luh", (long)st.offsetMs,
+                 (unsigned long)st.delayMs, st.driftPpm, (unsigned long)(st.ageS / 3600));
+    u8g2.setFont(u8g2_font_4x6_tf);
+    int w = u8g2.getStrWidth(line);
+    u8g2.drawStr((SCREEN_W - w) / 2, SCREEN_H - 1, line);
+}
+
+/* 尚未对时：顶栏照常，时间区显示等待提示 */
+static void drawWaitingForTime(void) {
+    u8g2.setFont(u8g2_font_wqy12_t_gb2312);
+    const char* msg = netServiceIsConnected() ? u8"正在对时..." : u8"等待网络对时";
+    int w = u8g2.getUTF8Width(msg);
+    u8g2.drawUTF8((SCREEN_W - w) / 2, TIME_Y_TOP + 20, msg);
 }
 
 void clockScreenDraw(void) {
+    METRICS_SCOPE(MET_DRAW_CLOCK);
     struct tm t;
-    if (!getLocalTime(&t)) return;
+    bool valid = timeServiceNow(&t);
 
     u8g2.clearBuffer();
     displayTopBarBackground();
-    displayWiFiIcon(WIFI_ICON_X, WIFI_ICON_Y, WiFi.status() == WL_CONNECTED);
+    displayWiFiIcon(WIFI_ICON_X, WIFI_ICON_Y, netServiceIsConnected());
+    displayPowerStatus();
+    if (!valid) {
+        drawWaitingForTime();
+        displaySendBuffer();
+        return;
+    }
 
     char date[16];
     snprintf(date, sizeof(date), "%04d/%02d/%02d",
@@ -39,7 +82,10 @@ void clockScreenDraw(void) {
     int dateW = u8g2.getUTF8Width(date);
     u8g2.drawStr((SCREEN_W - dateW) / 2, DATE_Y_TOP, date);
 
-    displayBatteryIcon(BATTERY_ICON_X, BATTERY_ICON_Y, displayGetBatteryPercent());
-    displayDrawTime(t.tm_hour, t.tm_min, t.tm_sec);
-    u8g2.sendBuffer();
+    displayDrawTime(t.tm_hour, t.tm_min, powerGovernorSpec()->showSeconds ? t.tm_sec : -1);
+    if (s_showSyncDetail)
+        drawSyncDetail();
+    else
+        drawUnsyncedNote();
+    displaySendBuffer();
 }
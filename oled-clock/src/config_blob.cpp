@@ -0,0 +1,219 @@
+/**
+ * @file config_blob.cpp
+ * @brief 设置块编解码实现
+ */
+#include "config_blob.h"
+#include <string.h>
+
+enum ConfigFieldKind {
+    FIELD_STR,          /* 不含结尾 0 的字符串，长度 < size */
+    FIELD_ALARMS        /* 每条 4 字节：enabled hour minute weekdays */
+};
+
+struct ConfigField {
+    uint8_t tag;        /* 一经发布不再改动、不再复用 */
+    uint8_t kind;
+    uint16_t offset;
+    uint16_t size;
+};
+
+#define FIELD(tag, kind, member) { tag, kind, (uint16_t)offsetof(ConfigData, member), \
+                                   (uint16_t)sizeof(((ConfigData*)0)->member) }
+
+static const ConfigField CONFIG_FIELDS[] = {
+    FIELD(1, FIELD_STR, weatherLocation),
+    FIELD(2, FIELD_STR, tzName),
+    FIELD(3, FIELD_STR, netPolicy),
+    FIELD(4, FIELD_STR, powerProfile),
+    FIELD(5, FIELD_ALARMS, alarms),
+};
+#define CONFIG_FIELD_COUNT  (sizeof(CONFIG_FIELDS) / sizeof(CONFIG_FIELDS[0]))
+
+#define ALARM_RECORD_BYTES  4
+
+static void put16(uint8_t* p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void put32(uint8_t* p, uint32_t v) {
+    for (int i = 0; i < 4; i++) p[i] = (uint8_t)(v >> (8 * i));
+}
+
+static uint16_t get16(const uint8_t* p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t get32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/* CRC-32（IEEE 802.3，反射多项式）；设置块只有百余字节，逐位计算不占查表的 1KB */
+static uint32_t crcUpdate(uint32_t crc, const uint8_t* data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (int b = 0; b < 8; b++)
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+    }
+    return crc;
+}
+
+uint32_t configCrc32(const uint8_t* data, size_t len) {
+    return ~crcUpdate(0xFFFFFFFFu, data, len);
+}
+
+/* CRC 覆盖头部 CRC 之前的字节与全部负载 */
+static uint32_t blobCrc(const uint8_t* blob, size_t payloadLen) {
+    uint32_t crc = crcUpdate(0xFFFFFFFFu, blob, CONFIG_HEADER_BYTES - 4);
+    return ~crcUpdate(crc, blob + CONFIG_HEADER_BYTES, payloadLen);
+}
+
+static bool copyString(char* dst, size_t cap, const char* src, size_t n) {
+    if (n >= cap) return false;
+    memcpy(dst, src, n);
+    dst[n] = '\0';
+    return true;
+}
+
+static bool alarmSane(const Alarm* a) {
+    return a->enabled <= 1 && a->hour < 24 && a->minute < 60 && a->weekdays <= ALARM_EVERY_DAY;
+}
+
+void configDefaults(ConfigData* c) {
+    memset(c, 0, sizeof(*c));
+}
+
+static void legacyString(char* dst, size_t cap, const char* src) {
+    if (src) copyString(dst, cap, src, strlen(src));
+}
+
+void configFromLegacy(const ConfigLegacy* legacy, ConfigData* out) {
+    configDefaults(out);
+    legacyString(out->weatherLocation, sizeof(out->weatherLocation), legacy->weatherLocation);
+    legacyString(out->tzName, sizeof(out->tzName), legacy->tzName);
+    legacyString(out->netPolicy, sizeof(out->netPolicy), legacy->netPolicy);
+    legacyString(out->powerProfile, sizeof(out->powerProfile), legacy->powerProfile);
+    /* 旧的闹钟是直接存的结构体字节，没有校验：长度不整齐说明布局不对，整体丢弃 */
+    if (legacy->alarms == NULL || legacy->alarmsLen % sizeof(Alarm) != 0 ||
+        legacy->alarmsLen > sizeof(out->alarms))
+        return;
+    const Alarm* src = (const Alarm*)legacy->alarms;
+    for (size_t i = 0; i < legacy->alarmsLen / sizeof(Alarm); i++)
+        if (alarmSane(&src[i])) out->alarms[out->alarmCount++] = src[i];
+}
+
+size_t configEncode(const ConfigData* c, uint32_t writes, uint8_t* out, size_t cap) {
+    if (cap < CONFIG_HEADER_BYTES) return 0;
+    size_t n = CONFIG_HEADER_BYTES;
+    for (size_t i = 0; i < CONFIG_FIELD_COUNT; i++) {
+        const ConfigField* f = &CONFIG_FIELDS[i];
+        const uint8_t* src = (const uint8_t*)c + f->offset;
+        size_t len;
+        if (f->kind == FIELD_STR) {
+            len = strnlen((const char*)src, f->size - 1);
+            if (len == 0) continue;         /* 默认值不写，解码时缺省即默认 */
+        } else {
+            if (c->alarmCount == 0) continue;
+            len = (size_t)(c->alarmCount > ALARM_MAX ? ALARM_MAX : c->alarmCount) * ALARM_RECORD_BYTES;
+        }
+        if (n + 2 + len > cap) return 0;
+        out[n++] = f->tag;
+        out[n++] = (uint8_t)len;
+        if (f->kind == FIELD_STR) {
+            memcpy(out + n, src, len);
+        } else {
+            const Alarm* a = (const Alarm*)src;
+            for (size_t k = 0; k < len / ALARM_RECORD_BYTES; k++) {
+                uint8_t* r = out + n + k * ALARM_RECORD_BYTES;
+                r[0] = a[k].enabled;
+                r[1] = a[k].hour;
+                r[2] = a[k].minute;
+                r[3] = a[k].weekdays;
+            }
+        }
+        n += len;
+    }
+    put32(out, CONFIG_BLOB_MAGIC);
+    put16(out + 4, CONFIG_SCHEMA_VERSION);
+    put16(out + 6, (uint16_t)(n - CONFIG_HEADER_BYTES));
+    put32(out + 8, writes);
+    put32(out + 12, blobCrc(out, n - CONFIG_HEADER_BYTES));
+    return n;
+}
+
+static const ConfigField* findField(uint8_t tag) {
+    for (size_t i = 0; i < CONFIG_FIELD_COUNT; i++)
+        if (CONFIG_FIELDS[i].tag == tag) return &CONFIG_FIELDS[i];
+    return NULL;
+}
+
+static void decodeField(const ConfigField* f, const uint8_t* p, size_t len, ConfigData* out) {
+    uint8_t* dst = (uint8_t*)out + f->offset;
+    if (f->kind == FIELD_STR) {
+        copyString((char*)dst, f->size, (const char*)p, len);
+        return;
+    }
+    if (len % ALARM_RECORD_BYTES != 0 || len / ALARM_RECORD_BYTES > ALARM_MAX) return;
+    out->alarmCount = 0;
+    for (size_t k = 0; k < len / ALARM_RECORD_BYTES; k++) {
+        const uint8_t* r = p + k * ALARM_RECORD_BYTES;
+        Alarm a = { r[0], r[1], r[2], r[3] };
+        if (alarmSane(&a)) out->alarms[out->alarmCount++] = a;
+    }
+}
+
+ConfigLoadResult configDecode(const uint8_t* data, size_t len, ConfigData* out, uint32_t* outWrites) {
+    configDefaults(out);
+    if (len < CONFIG_HEADER_BYTES) return CONFIG_LOAD_BAD_LENGTH;
+    uint16_t version = get16(data + 4);
+    if (get32(data) != CONFIG_BLOB_MAGIC || version == 0) return CONFIG_LOAD_BAD_MAGIC;
+    size_t payloadLen = get16(data + 6);
+    if (CONFIG_HEADER_BYTES + payloadLen != len) return CONFIG_LOAD_BAD_LENGTH;
+    /* 魔数与长度对得上时先给出写入次数：负载损坏不应抹掉磨损记录 */
+    if (outWrites) *outWrites = get32(data + 8);
+    if (get32(data + 12) != blobCrc(data, payloadLen)) return CONFIG_LOAD_BAD_CRC;
+
+    const uint8_t* p = data + CONFIG_HEADER_BYTES;
+    const uint8_t* end = p + payloadLen;
+    while (p < end) {
+        if (end - p < 2 || end - p - 2 < p[1]) {
+            configDefaults(out);
+            return CONFIG_LOAD_BAD_RECORD;
+        }
+        const ConfigField* f = findField(p[0]);
+        if (f) decodeField(f, p + 2, p[1], out);
+        p += 2 + p[1];
+    }
+    /* 比当前新的版本（降级固件）：认识的字段照常读出，不认识的已跳过 */
+    if (version >= CONFIG_SCHEMA_VERSION) return CONFIG_LOAD_OK;
+    configMigrate(out, version);
+    return CONFIG_LOAD_MIGRATED;
+}
+
+void configMigrate(ConfigData* c, uint16_t fromVersion) {
+    /*
+     * 逐级转换：if (fromVersion < 2) {…} if (fromVersion < 3) {…} 依次执行。第 1 版是第一个设置块版本，
+     * 目前没有步骤（第 0 版的逐键设置由 configFromLegacy 转换）；字段含义改变时把 CONFIG_SCHEMA_VERSION 加一并在这里补一步
+     */
+    (void)c;
+    (void)fromVersion;
+}
+
+bool configSamePayload(const uint8_t* a, size_t aLen, const uint8_t* b, size_t bLen) {
+    if (aLen != bLen || aLen < CONFIG_HEADER_BYTES) return false;
+    /* 魔数、版本、长度相同且负载相同；写入次数与 CRC 不比较 */
+    return memcmp(a, b, 8) == 0 &&
+           memcmp(a + CONFIG_HEADER_BYTES, b + CONFIG_HEADER_BYTES, aLen - CONFIG_HEADER_BYTES) == 0;
+}
+
+const char* configLoadResultName(ConfigLoadResult r) {
+    switch (r) {
+    case CONFIG_LOAD_OK:         return "ok";
+    case CONFIG_LOAD_MIGRATED:   return "migrated";
+    case CONFIG_LOAD_BAD_MAGIC:  return "bad magic";
+    case CONFIG_LOAD_BAD_LENGTH: return "bad length";
+    case CONFIG_LOAD_BAD_CRC:    return "bad crc";
+    case CONFIG_LOAD_BAD_RECORD: return "bad record";
+    }
+    return "?";
+}
@@ -0,0 +1,172 @@
+/**
+ * @file config_store.cpp
+ * @brief 设置存储实现
+ */
+#include "config_store.h"
+#include "log_service.h"
+#include <Preferences.h>
+
+#define PREF_NAMESPACE      "vibe"
+#define PREF_KEY_CONFIG     "cfg"
+/* 改用设置块之前逐键保存的设置，迁移成功后删除 */
+#define PREF_KEY_LOC        "wloc"
+#define PREF_KEY_TZ         "tz"
+#define PREF_KEY_NETPOL     "netpol"
+#define PREF_KEY_PPROF      "pprof"
+#define PREF_KEY_ALARMS     "alarms"
+
+static ConfigData s_config;
+static bool s_dirty = false;
+static uint32_t s_firstEditMs = 0;
+static uint32_t s_lastEditMs = 0;
+
+/* 上次写入（或开机读到）的编码，用于跳过无变化的写入 */
+static uint8_t s_saved[CONFIG_BLOB_MAX];
+static size_t s_savedLen = 0;
+static uint32_t s_writes = 0;
+static uint32_t s_skipped = 0;
+static uint32_t s_failures = 0;
+
+/* 编码当前设置；与上次写入相同返回 0 */
+static size_t encodeIfChanged(uint8_t* blob) {
+    size_t n = configEncode(&s_config, s_writes + 1, blob, CONFIG_BLOB_MAX);
+    if (n == 0) {
+        s_failures++;
+        return 0;
+    }
+    if (configSamePayload(blob, n, s_saved, s_savedLen)) {
+        s_skipped++;
+        return 0;
+    }
+    return n;
+}
+
+/* prefs 须已以读写方式打开 */
+static bool commit(Preferences& prefs, const uint8_t* blob, size_t n) {
+    if (prefs.putBytes(PREF_KEY_CONFIG, blob, n) != n) {
+        s_failures++;
+        LOG_E("Config: NVS write failed");
+        return false;
+    }
+    s_writes++;
+    memcpy(s_saved, blob, n);
+    s_savedLen = n;
+    return true;
+}
+
+static void save(void) {
+    s_dirty = false;
+    uint8_t blob[CONFIG_BLOB_MAX];
+    size_t n = encodeIfChanged(blob);
+    if (n == 0) return;
+    Preferences prefs;
+    prefs.begin(PREF_NAMESPACE, false);
+    bool ok = commit(prefs, blob, n);
+    prefs.end();
+    if (!ok) {
+        /* 等下一个防抖周期重试，不在每帧反复写 */
+        s_dirty = true;
+        s_firstEditMs = s_lastEditMs = millis();
+    }
+}
+
+static const char* legacyString(Preferences& prefs, const char* key, char* buf, size_t cap) {
+    if (!prefs.isKey(key) || prefs.getString(key, buf, cap) == 0) return NULL;
+    return buf;
+}
+
+static void migrateLegacy(Preferences& prefs) {
+    char loc[CONFIG_STR_MAX], tz[CONFIG_STR_MAX], netpol[CONFIG_NAME_MAX], pprof[CONFIG_NAME_MAX];
+    uint8_t alarms[sizeof(Alarm) * ALARM_MAX];
+    ConfigLegacy legacy;
+    legacy.weatherLocation = legacyString(prefs, PREF_KEY_LOC, loc, sizeof(loc));
+    legacy.tzName = legacyString(prefs, PREF_KEY_TZ, tz, sizeof(tz));
+    legacy.netPolicy = legacyString(prefs, PREF_KEY_NETPOL, netpol, sizeof(netpol));
+    legacy.powerProfile = legacyString(prefs, PREF_KEY_PPROF, pprof, sizeof(pprof));
+    legacy.alarms = alarms;
+    legacy.alarmsLen = prefs.isKey(PREF_KEY_ALARMS) ? prefs.getBytes(PREF_KEY_ALARMS, alarms, sizeof(alarms)) : 0;
+    configFromLegacy(&legacy, &s_config);
+    if (!legacy.weatherLocation && !legacy.tzName && !legacy.netPolicy && !legacy.powerProfile &&
+        legacy.alarmsLen == 0)
+        return;     /* 新设备：没有可迁移的，等第一次修改再写 */
+
+    uint8_t blob[CONFIG_BLOB_MAX];
+    size_t n = encodeIfChanged(blob);
+    if (n == 0 || !commit(prefs, blob, n)) return;
+    static const char* const LEGACY_KEYS[] = { PREF_KEY_LOC, PREF_KEY_TZ, PREF_KEY_NETPOL, PREF_KEY_PPROF, PREF_KEY_ALARMS };
+    for (size_t i = 0; i < sizeof(LEGACY_KEYS) / sizeof(LEGACY_KEYS[0]); i++)
+        if (prefs.isKey(LEGACY_KEYS[i])) prefs.remove(LEGACY_KEYS[i]);
+    LOG_I("Config: migrated legacy keys to schema v%d (%u bytes)", CONFIG_SCHEMA_VERSION, (unsigned)n);
+}
+
+void configStoreBegin(void) {
+    configDefaults(&s_config);
+    s_savedLen = 0;
+    s_writes = 0;
+    Preferences prefs;
+    prefs.begin(PREF_NAMESPACE, false);
+    if (!prefs.isKey(PREF_KEY_CONFIG)) {
+        migrateLegacy(prefs);
+        prefs.end();
+        return;
+    }
+    uint8_t blob[CONFIG_BLOB_MAX];
+    size_t n = prefs.getBytes(PREF_KEY_CONFIG, blob, sizeof(blob));
+    ConfigLoadResult r = configDecode(blob, n, &s_config, &s_writes);
+    if (r == CONFIG_LOAD_OK) {
+        memcpy(s_saved, blob, n);
+        s_savedLen = n;
+    } else if (r == CONFIG_LOAD_MIGRATED) {
+        n = encodeIfChanged(blob);
+        if (n > 0) commit(prefs, blob, n);
+    } else {
+        /* 损坏的设置块保留到下一次修改时覆盖；在此之前用默认值。头部尚可读时写入次数接着累计 */
+        LOG_W("Config: stored settings rejected (%s), using defaults, %lu writes so far", configLoadResultName(r),
+              (unsigned long)s_writes);
+    }
+    prefs.end();
+}
+
+void configStoreLoop(void) {
+    if (!s_dirty) return;
+    uint32_t now = millis();
+    if ((uint32_t)(now - s_lastEditMs) < CONFIG_STORE_DEBOUNCE_MS &&
+        (uint32_t)(now - s_firstEditMs) < CONFIG_STORE_MAX_DELAY_MS)
+        return;
+    save();
+}
+
+void configStoreFlush(void) {
+    if (s_dirty) save();
+}
+
+const ConfigData* configStoreGet(void) {
+    return &s_config;
+}
+
+ConfigData* configStoreEdit(void) {
+    uint32_t now = millis();
+    if (!s_dirty) {
+        s_dirty = true;
+        s_firstEditMs = now;
+    }
+    s_lastEditMs = now;
+    return &s_config;
+}
+
+uint32_t configStoreWrites(void) {
+    return s_writes;
+}
+
+void configStoreWritePrometheus(Print& out) {
+    out.printf("# HELP oled_config_writes_total Settings blob writes to flash over the device lifetime\n"
+               "# TYPE oled_config_writes_total counter\noled_config_writes_total %lu\n",
+               (unsigned long)s_writes);
+    out.printf("# HELP oled_config_writes_skipped_total Debounced saves skipped because nothing changed\n"
+               "# TYPE oled_config_writes_skipped_total counter\noled_config_writes_skipped_total %lu\n",
+               (unsigned long)s_skipped);
+    out.printf("# TYPE oled_config_write_failures_total counter\noled_config_write_failures_total %lu\n",
+               (unsigned long)s_failures);
+    out.printf("# TYPE oled_config_bytes gauge\noled_config_bytes %u\n", (unsigned)s_savedLen);
+    out.printf("# TYPE oled_config_pending gauge\noled_config_pending %d\n", s_dirty ? 1 : 0);
+}
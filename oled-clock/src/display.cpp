@@ -4,6 +4,11 @@
  */
 #include "display.h"
 #include "bitmap.h"
+#include "live_view.h"
+#include "metrics.h"
+#include "power_service.h"
+#include "power_governor.h"
+#include "energy_service.h"
 #include <Wire.h>
 #include <WiFi.h>
 #include <math.h>
@@ -34,6 +39,16 @@ void displayInit(void) {
     u8g2.begin();
 }
 
+void displaySendBuffer(void) {
+    {
+        POWER_BUSY_SCOPE();
+        METRICS_SCOPE(MET_SEND_BUFFER);
+        u8g2.sendBuffer();
+    }
+    energyCountI2c(ENERGY_SH1106_FRAME_BYTES);
+    liveViewOnFrame(u8g2.getBufferPtr());
+}
+
 void displayTopBarBackground(void) {
     u8g2.setDrawColor(0);
     u8g2.drawBox(0, 0, SCREEN_W, TOP_BAR_H);
@@ -87,13 +102,23 @@ void displayBatteryIcon(int x, int y, int percent) {
         u8g2.drawBox(x + pad, y + pad, fill, innerH);
 }
 
+void displayPowerStatus(void) {
+    int percent = powerGovernorBatteryPercent();
+    displayBatteryIcon(BATTERY_ICON_X, BATTERY_ICON_Y, percent < 0 ? 0 : percent);
+    char mark[2] = { powerGovernorSpec()->mark, '\0' };
+    u8g2.setFont(u8g2_font_4x6_tf);
+    u8g2.drawStr(PROFILE_MARK_X, PROFILE_MARK_Y, mark);
+}
+
 int displayGetBatteryPercent(void) {
+    METRICS_SCOPE(MET_BATTERY);
     const int samples = 8;
     uint32_t sum = 0;
     for (int i = 0; i < samples; i++) {
         sum += analogRead(BATTERY_ADC_PIN);
         delay(3);
     }
+    energyCountAdc(samples);
     int raw = sum / samples;
     int p = (raw - ADC_RAW_EMPTY) * 100 / (ADC_RAW_FULL - ADC_RAW_EMPTY);
     if (p < 0) p = 0;
@@ -118,15 +143,16 @@ void displayDrawDot(int x, int y) {
 void displayDrawTime(int hour, int minute, int second) {
     int h1 = hour / 10, h2 = hour % 10;
     int m1 = minute / 10, m2 = minute % 10;
-    int s1 = second / 10, s2 = second % 10;
     int x = MARGIN_LEFT;
     displayDrawBigDigit(x, TIME_Y_TOP, h1);  x += BIG_W;
     displayDrawBigDigit(x, TIME_Y_TOP, h2);  x += BIG_W;
-    if ((second & 1) == 0)
+    if (second < 0 || (second & 1) == 0)
         displayDrawDot(x, TIME_Y_TOP);
     x += DOT_W;
     displayDrawBigDigit(x, TIME_Y_TOP, m1);  x += BIG_W;
     displayDrawBigDigit(x, TIME_Y_TOP, m2);  x += BIG_W;
+    if (second < 0) return;
+    int s1 = second / 10, s2 = second % 10;
     x += 4;
     displayDrawMiniDigit(x, MINI_Y, s1);  x += MINI_W;
     displayDrawMiniDigit(x, MINI_Y, s2);
@@ -154,7 +180,7 @@ void displayBootScreen(bool showWifiIcon, bool wifiOk, const char* title, const
         int sw = u8g2.getUTF8Width(subtitle);
         u8g2.drawUTF8((SCREEN_W - sw) / 2, cy, subtitle);
     }
-    u8g2.sendBuffer();
+    displaySendBuffer();
 }
 
 #define OI_CLOCK  (64 + 5)
@@ -180,7 +206,7 @@ void displayNtpBootScreen(const char* title, int dotCount) {
     int tw = u8g2.getUTF8Width(line);
     int textY = iconY + NTP_ICON_SIZE + NTP_ICON_GAP + NTP_TEXT_H - 2;
     u8g2.drawUTF8(cx - tw / 2, textY, line);
-    u8g2.sendBuffer();
+    displaySendBuffer();
 }
 
 void displayPlaceholderPage(const char* title, const char* hint) {
@@ -195,5 +221,5 @@ void displayPlaceholderPage(const char* title, const char* hint) {
     const char* back = u8"中键长按返回";
     int bw = u8g2.getUTF8Width(back);
     u8g2.drawUTF8((SCREEN_W - bw) / 2, 58, back);
-    u8g2.sendBuffer();
+    displaySendBuffer();
 }
@@ -0,0 +1,58 @@
+/**
+ * @file drift_estimator.cpp
+ * @brief 加权指数遗忘的漂移估计与对时间隔调度
+ */
+#include "drift_estimator.h"
+#include <math.h>
+#include <string.h>
+
+void driftEstimatorReset(DriftEstimator* d) {
+    memset(d, 0, sizeof(*d));
+}
+
+float driftEstimatorPpm(const DriftEstimator* d) {
+    if (d->samples == 0 || d->sumW <= 0.0f) return 0.0f;
+    return d->sumWX / d->sumW;
+}
+
+float driftEstimatorSigmaPpm(const DriftEstimator* d) {
+    if (d->samples < 2 || d->sumW <= 0.0f) return -1.0f;
+    float mean = d->sumWX / d->sumW;
+    float var = d->sumWXX / d->sumW - mean * mean;
+    return var > 0.0f ? sqrtf(var) : 0.0f;
+}
+
+bool driftEstimatorAdd(DriftEstimator* d, float intervalS, float offsetMs, float offsetErrMs) {
+    if (intervalS < DRIFT_MIN_INTERVAL_S) return false;
+    if (offsetErrMs < 1.0f) offsetErrMs = 1.0f;
+    float x = offsetMs * 1000.0f / intervalS;
+    float errPpm = offsetErrMs * 1000.0f / intervalS;
+
+    if (d->samples >= DRIFT_MIN_SAMPLES_FOR_OUTLIER) {
+        float sigma = driftEstimatorSigmaPpm(d);
+        float tol = DRIFT_OUTLIER_SIGMA * sqrtf(sigma * sigma + errPpm * errPpm);
+        if (fabsf(x - driftEstimatorPpm(d)) > tol) {
+            d->rejected++;
+            return false;
+        }
+    }
+    float w = 1.0f / (errPpm * errPpm);
+    d->sumW = d->sumW * DRIFT_FORGET + w;
+    d->sumWX = d->sumWX * DRIFT_FORGET + w * x;
+    d->sumWXX = d->sumWXX * DRIFT_FORGET + w * x * x;
+    d->samples++;
+    return true;
+}
+
+uint32_t driftNextIntervalS(const DriftEstimator* d, uint32_t targetErrMs,
+                            uint32_t minS, uint32_t maxS, uint32_t defaultS) {
+    if (d->samples == 0) return defaultS;
+    float ppm = fabsf(driftEstimatorPpm(d));
+    float sigma = driftEstimatorSigmaPpm(d);
+    if (sigma > 0.0f) ppm += sigma;   /* 保守：按估计上沿安排 */
+    if (ppm < 0.01f) return maxS;
+    float s = (float)targetErrMs * 1000.0f / ppm;
+    if (s < (float)minS) return minS;
+    if (s > (float)maxS) return maxS;
+    return (uint32_t)s;
+}
@@ -0,0 +1,77 @@
+/**
+ * @file energy_model.cpp
+ * @brief 能耗核算实现
+ */
+#include "energy_model.h"
+#include <string.h>
+
+#define US_PER_HOUR  3600e6f
+#define S_PER_HOUR   3600.0f
+
+static const char* const ITEM_NAMES[ENERGY_ITEM_COUNT] = {
+    "cpu_active", "cpu_idle", "cpu_light_sleep", "radio", "tls", "i2c", "display", "adc", "buzzer"
+};
+
+void energyModelDefaults(EnergyModel* m) {
+    m->activeMa = ENERGY_ACTIVE_MA;
+    m->idleMa = ENERGY_IDLE_MA;
+    m->lightSleepMa = ENERGY_LIGHT_SLEEP_MA;
+    m->radioMa = ENERGY_RADIO_MA;
+    m->tlsMas = ENERGY_TLS_MAS;
+    m->i2cUsPerByte = ENERGY_I2C_US_PER_BYTE;
+    m->i2cBusMa = ENERGY_I2C_BUS_MA;
+    m->displayMa = ENERGY_DISPLAY_MA;
+    m->adcMas = ENERGY_ADC_MAS;
+    m->buzzerMa = ENERGY_BUZZER_MA;
+}
+
+const char* energyItemName(EnergyItem item) {
+    return ((int)item >= 0 && item < ENERGY_ITEM_COUNT) ? ITEM_NAMES[item] : "";
+}
+
+void energyCountersDelta(const EnergyCounters* a, const EnergyCounters* b, EnergyCounters* out) {
+    out->elapsedUs = a->elapsedUs - b->elapsedUs;
+    out->activeUs = a->activeUs - b->activeUs;
+    out->idleUs = a->idleUs - b->idleUs;
+    out->lightSleepUs = a->lightSleepUs - b->lightSleepUs;
+    out->radioOnUs = a->radioOnUs - b->radioOnUs;
+    out->panelUs = a->panelUs - b->panelUs;
+    out->buzzerOnUs = a->buzzerOnUs - b->buzzerOnUs;
+    out->i2cBytes = a->i2cBytes - b->i2cBytes;
+    out->tlsHandshakes = a->tlsHandshakes - b->tlsHandshakes;
+    out->adcSamples = a->adcSamples - b->adcSamples;
+}
+
+void energyModelCompute(const EnergyModel* m, const EnergyCounters* c, EnergyReport* out) {
+    memset(out, 0, sizeof(*out));
+    out->hours = (float)c->elapsedUs / US_PER_HOUR;
+
+    /* sendBuffer 期间 CPU 满频等传输完成：这段时间从 active 中划给 I2C */
+    float i2cUs = (float)c->i2cBytes * m->i2cUsPerByte;
+    float activeUs = (float)c->activeUs - i2cUs;
+    if (activeUs < 0) {
+        i2cUs = (float)c->activeUs;
+        activeUs = 0;
+    }
+    out->mah[ENERGY_CPU_ACTIVE] = activeUs * m->activeMa / US_PER_HOUR;
+    out->mah[ENERGY_CPU_IDLE] = (float)c->idleUs * m->idleMa / US_PER_HOUR;
+    out->mah[ENERGY_CPU_LIGHT_SLEEP] = (float)c->lightSleepUs * m->lightSleepMa / US_PER_HOUR;
+    out->mah[ENERGY_RADIO] = (float)c->radioOnUs * m->radioMa / US_PER_HOUR;
+    out->mah[ENERGY_TLS] = (float)c->tlsHandshakes * m->tlsMas / S_PER_HOUR;
+    out->mah[ENERGY_I2C] = i2cUs * (m->activeMa + m->i2cBusMa) / US_PER_HOUR;
+    out->mah[ENERGY_DISPLAY] = (float)c->panelUs * m->displayMa / US_PER_HOUR;
+    out->mah[ENERGY_ADC] = (float)c->adcSamples * m->adcMas / S_PER_HOUR;
+    out->mah[ENERGY_BUZZER] = (float)c->buzzerOnUs * m->buzzerMa / US_PER_HOUR;
+    for (int i = 0; i < ENERGY_ITEM_COUNT; i++) out->totalMah += out->mah[i];
+}
+
+float energyReportMa(const EnergyReport* r, int item) {
+    if (r->hours <= 0) return 0;
+    float mah = (item >= 0 && item < ENERGY_ITEM_COUNT) ? r->mah[item] : r->totalMah;
+    return mah / r->hours;
+}
+
+float energyReportHours(const EnergyReport* r, float batteryMah) {
+    float ma = energyReportMa(r, -1);
+    return ma > 0 ? batteryMah / ma : 0;
+}
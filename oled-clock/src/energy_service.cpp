@@ -0,0 +1,160 @@
+/**
+ * @file energy_service.cpp
+ * @brief 能耗核算服务实现
+ */
+#include "energy_service.h"
+#include "power_service.h"
+#include "power_governor.h"
+#include "net_service.h"
+#include <esp_timer.h>
+
+static portMUX_TYPE s_mux = portMUX_INITIALIZER_UNLOCKED;
+static uint64_t s_i2cBytes = 0;
+static uint32_t s_tls = 0;
+static uint32_t s_adc = 0;
+static uint64_t s_buzzerUs = 0;
+static int64_t s_buzzerSinceUs = 0;      /* 0 表示未发声 */
+
+static EnergyModel s_model;
+static bool s_modelReady = false;
+static EnergyCounters s_windowStart;
+static bool s_windowStarted = false;
+static EnergyReport s_window;
+static bool s_haveWindow = false;
+static uint32_t s_windowMs = 0;
+
+void energyCountTls(void) {
+    portENTER_CRITICAL(&s_mux);
+    s_tls++;
+    portEXIT_CRITICAL(&s_mux);
+}
+
+void energyCountI2c(uint32_t bytes) {
+    portENTER_CRITICAL(&s_mux);
+    s_i2cBytes += bytes;
+    portEXIT_CRITICAL(&s_mux);
+}
+
+void energyCountAdc(uint32_t samples) {
+    portENTER_CRITICAL(&s_mux);
+    s_adc += samples;
+    portEXIT_CRITICAL(&s_mux);
+}
+
+void energyBuzzer(bool on) {
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&s_mux);
+    if (on && s_buzzerSinceUs == 0) {
+        s_buzzerSinceUs = now;
+    } else if (!on && s_buzzerSinceUs != 0) {
+        s_buzzerUs += (uint64_t)(now - s_buzzerSinceUs);
+        s_buzzerSinceUs = 0;
+    }
+    portEXIT_CRITICAL(&s_mux);
+}
+
+void energyServiceSnapshot(EnergyCounters* out) {
+    int64_t now = esp_timer_get_time();
+    memset(out, 0, sizeof(*out));
+    out->elapsedUs = (uint64_t)now;
+    powerServiceResidency(&out->activeUs, &out->idleUs, &out->lightSleepUs);
+    out->radioOnUs = netServiceRadioOnUs();
+    out->panelUs = powerGovernorPanelUs();
+    portENTER_CRITICAL(&s_mux);
+    out->i2cBytes = s_i2cBytes;
+    out->tlsHandshakes = s_tls;
+    out->adcSamples = s_adc;
+    out->buzzerOnUs = s_buzzerUs + (s_buzzerSinceUs != 0 ? (uint64_t)(now - s_buzzerSinceUs) : 0);
+    portEXIT_CRITICAL(&s_mux);
+}
+
+static const EnergyModel* model(void) {
+    if (!s_modelReady) {
+        energyModelDefaults(&s_model);
+        s_modelReady = true;
+    }
+    return &s_model;
+}
+
+void energyServiceLoop(void) {
+    uint32_t now = millis();
+    if (s_windowStarted && (uint32_t)(now - s_windowMs) < ENERGY_WINDOW_MS) return;
+    EnergyCounters cur;
+    energyServiceSnapshot(&cur);
+    if (s_windowStarted) {
+        EnergyCounters delta;
+        energyCountersDelta(&cur, &s_windowStart, &delta);
+        energyModelCompute(model(), &delta, &s_window);
+        s_haveWindow = true;
+    }
+    s_windowStart = cur;
+    s_windowStarted = true;
+    s_windowMs = now;
+}
+
+bool energyServiceReport(bool window, EnergyReport* out) {
+    if (window) {
+        if (!s_haveWindow) return false;
+        *out = s_window;
+        return true;
+    }
+    EnergyCounters c;
+    energyServiceSnapshot(&c);
+    energyModelCompute(model(), &c, out);
+    return true;
+}
+
+void energyServiceDump(Print& out) {
+    EnergyReport boot, win;
+    energyServiceReport(false, &boot);
+    bool haveWin = energyServiceReport(true, &win);
+    out.printf("energy (model estimate) since boot %.2fh%s\n", boot.hours,
+               haveWin ? ", last window" : "");
+    for (int i = 0; i < ENERGY_ITEM_COUNT; i++) {
+        out.printf("  %-16s %8.3f mAh %7.2f mA", energyItemName((EnergyItem)i), boot.mah[i],
+                   energyReportMa(&boot, i));
+        if (haveWin) out.printf(" | %7.2f mA", energyReportMa(&win, i));
+        out.print('\n');
+    }
+    out.printf("  %-16s %8.3f mAh %7.2f mA", "total", boot.totalMah, energyReportMa(&boot, -1));
+    if (haveWin) out.printf(" | %7.2f mA", energyReportMa(&win, -1));
+    out.printf("\n  %.0fmAh battery: ~%.1fh at since-boot rate\n", ENERGY_BATTERY_MAH,
+               energyReportHours(&boot, ENERGY_BATTERY_MAH));
+}
+
+static void writeJsonReport(Print& out, const EnergyReport* r) {
+    out.printf("{\"hours\":%.4f,\"total_mah\":%.4f,\"total_ma\":%.3f,\"items\":{", r->hours, r->totalMah,
+               energyReportMa(r, -1));
+    for (int i = 0; i < ENERGY_ITEM_COUNT; i++)
+        out.printf("%s\"%s\":{\"mah\":%.4f,\"ma\":%.3f}", i ? "," : "", energyItemName((EnergyItem)i),
+                   r->mah[i], energyReportMa(r, i));
+    out.print("}}");
+}
+
+void energyServiceWriteJson(Print& out) {
+    EnergyReport r;
+    energyServiceReport(false, &r);
+    out.printf("{\"battery_mah\":%.0f,\"projected_hours\":%.2f,\"window_s\":%lu,\"boot\":",
+               ENERGY_BATTERY_MAH, energyReportHours(&r, ENERGY_BATTERY_MAH),
+               (unsigned long)(ENERGY_WINDOW_MS / 1000));
+    writeJsonReport(out, &r);
+    out.print(",\"window\":");
+    if (energyServiceReport(true, &r)) writeJsonReport(out, &r);
+    else out.print("null");
+    out.print('}');
+}
+
+void energyServiceWritePrometheus(Print& out) {
+    EnergyReport r;
+    energyServiceReport(false, &r);
+    out.print("# HELP oled_energy_mah Modelled charge since boot per subsystem\n"
+              "# TYPE oled_energy_mah counter\n");
+    for (int i = 0; i < ENERGY_ITEM_COUNT; i++)
+        out.printf("oled_energy_mah{item=\"%s\"} %.4f\n", energyItemName((EnergyItem)i), r.mah[i]);
+    if (!energyServiceReport(true, &r)) return;
+    out.print("# HELP oled_energy_window_ma Modelled average current over the last window\n"
+              "# TYPE oled_energy_window_ma gauge\n");
+    for (int i = 0; i < ENERGY_ITEM_COUNT; i++)
+        out.printf("oled_energy_window_ma{item=\"%s\"} %.3f\n", energyItemName((EnergyItem)i),
+                   energyReportMa(&r, i));
+}
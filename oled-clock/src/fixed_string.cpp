@@ -0,0 +1,81 @@
+/**
+ * @file fixed_string.cpp
+ * @brief 定长字符串实现
+ */
+#include "fixed_string.h"
+#include <stdio.h>
+#include <string.h>
+
+static bool isSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+StrBuilder::StrBuilder(char* buf, size_t cap) : m_buf(buf), m_cap(cap), m_len(0), m_truncated(false) {
+    m_buf[0] = '\0';
+}
+
+StrBuilder& StrBuilder::append(const char* s, size_t n) {
+    size_t room = m_cap - 1 - m_len;
+    if (n > room) {
+        n = room;
+        m_truncated = true;
+    }
+    memcpy(m_buf + m_len, s, n);
+    m_len += n;
+    m_buf[m_len] = '\0';
+    return *this;
+}
+
+StrBuilder& StrBuilder::append(const char* s) {
+    return s ? append(s, strlen(s)) : *this;
+}
+
+StrBuilder& StrBuilder::append(char c) {
+    return append(&c, 1);
+}
+
+StrBuilder& StrBuilder::vappendf(const char* fmt, va_list ap) {
+    size_t room = m_cap - m_len;
+    int n = vsnprintf(m_buf + m_len, room, fmt, ap);
+    if (n < 0) {
+        m_buf[m_len] = '\0';
+        return *this;
+    }
+    if ((size_t)n >= room) {
+        m_len = m_cap - 1;
+        m_truncated = true;
+    } else {
+        m_len += (size_t)n;
+    }
+    return *this;
+}
+
+StrBuilder& StrBuilder::appendf(const char* fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    vappendf(fmt, ap);
+    va_end(ap);
+    return *this;
+}
+
+void StrBuilder::trim(void) {
+    size_t start = 0;
+    while (start < m_len && isSpace(m_buf[start])) start++;
+    size_t end = m_len;
+    while (end > start && isSpace(m_buf[end - 1])) end--;
+    m_len = end - start;
+    memmove(m_buf, m_buf + start, m_len);
+    m_buf[m_len] = '\0';
+}
+
+void StrBuilder::clear(void) {
+    m_len = 0;
+    m_truncated = false;
+    m_buf[0] = '\0';
+}
+
+void StrBuilder::assign(const StrBuilder& other) {
+    clear();
+    append(other.m_buf, other.m_len);
+    if (other.m_truncated) m_truncated = true;
+}
@@ -0,0 +1,97 @@
+/**
+ * @file frame_codec.cpp
+ * @brief 帧缓冲 XOR 差分 + 游程编解码实现
+ */
+#include "frame_codec.h"
+#include <string.h>
+
+#define RLE_MIN_RUN   3
+#define RLE_MAX_RUN   129
+#define RLE_MAX_LIT   128
+
+static size_t runLength(const uint8_t* p, size_t n) {
+    size_t r = 1;
+    while (r < n && r < RLE_MAX_RUN && p[r] == p[0]) r++;
+    return r;
+}
+
+/* 编码 n 个字节到 out，返回写入长度；空间不足返回 0 */
+static size_t rleEncode(const uint8_t* in, size_t n, uint8_t* out, size_t cap) {
+    size_t i = 0, o = 0;
+    while (i < n) {
+        size_t r = runLength(in + i, n - i);
+        if (r >= RLE_MIN_RUN) {
+            if (o + 2 > cap) return 0;
+            out[o++] = (uint8_t)(0x80 | (r - 2));
+            out[o++] = in[i];
+            i += r;
+            continue;
+        }
+        size_t start = i;
+        while (i < n && i - start < RLE_MAX_LIT) {
+            if (runLength(in + i, n - i) >= RLE_MIN_RUN) break;
+            i++;
+        }
+        size_t lit = i - start;
+        if (o + 1 + lit > cap) return 0;
+        out[o++] = (uint8_t)(lit - 1);
+        memcpy(out + o, in + start, lit);
+        o += lit;
+    }
+    return o;
+}
+
+size_t frameEncode(const uint8_t* cur, const uint8_t* prev, uint8_t* out, size_t cap) {
+    if (cap < 2) return 0;
+    uint8_t x[FRAME_W];
+    uint8_t mask = 0;
+    size_t o = 2;
+    for (int p = 0; p < FRAME_PAGES; p++) {
+        const uint8_t* c = cur + p * FRAME_W;
+        if (prev) {
+            const uint8_t* q = prev + p * FRAME_W;
+            if (memcmp(c, q, FRAME_W) == 0) continue;
+            for (int i = 0; i < FRAME_W; i++) x[i] = c[i] ^ q[i];
+        } else {
+            memcpy(x, c, FRAME_W);
+        }
+        size_t n = rleEncode(x, FRAME_W, out + o, cap - o);
+        if (n == 0) return 0;
+        o += n;
+        mask |= (uint8_t)(1u << p);
+    }
+    if (prev && mask == 0) return 0;
+    out[0] = prev ? FRAME_MSG_DELTA : FRAME_MSG_KEY;
+    out[1] = mask;
+    return o;
+}
+
+bool frameDecode(const uint8_t* msg, size_t len, uint8_t* fb) {
+    if (len < 2) return false;
+    if (msg[0] == FRAME_MSG_KEY)
+        memset(fb, 0, FRAME_BYTES);
+    else if (msg[0] != FRAME_MSG_DELTA)
+        return false;
+    uint8_t mask = msg[1];
+    size_t i = 2;
+    for (int p = 0; p < FRAME_PAGES; p++) {
+        if (!(mask & (1u << p))) continue;
+        uint8_t* dst = fb + p * FRAME_W;
+        size_t k = 0;
+        while (k < FRAME_W) {
+            if (i >= len) return false;
+            uint8_t c = msg[i++];
+            if (c & 0x80) {
+                size_t r = (size_t)(c & 0x7f) + 2;
+                if (i >= len || k + r > FRAME_W) return false;
+                uint8_t v = msg[i++];
+                for (size_t j = 0; j < r; j++) dst[k++] ^= v;
+            } else {
+                size_t lit = (size_t)c + 1;
+                if (i + lit > len || k + lit > FRAME_W) return false;
+                for (size_t j = 0; j < lit; j++) dst[k++] ^= msg[i++];
+            }
+        }
+    }
+    return i == len;
+}
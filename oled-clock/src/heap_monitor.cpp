@@ -0,0 +1,109 @@
+/**
+ * @file heap_monitor.cpp
+ * @brief 堆碎片监测实现
+ */
+#include "heap_monitor.h"
+#include "log_service.h"
+#include "app_state.h"
+#include <esp_heap_caps.h>
+
+#define HOUR_MS  (3600UL * 1000)
+
+static uint32_t s_lastSampleMs = 0;
+static bool s_sampled = false;
+static uint32_t s_largest = 0;
+static uint32_t s_minLargest = UINT32_MAX;
+static bool s_low = false;
+static uint32_t s_lowEvents = 0;
+
+/* 每小时最低值环形缓冲；s_hourMin 为正在累计的这一小时 */
+static uint32_t s_history[HEAP_MON_HISTORY_HOURS];
+static uint8_t s_historyHead = 0;
+static uint8_t s_historyCount = 0;
+static uint32_t s_hourStartMs = 0;
+static uint32_t s_hourMin = UINT32_MAX;
+
+static void closeHours(uint32_t now) {
+    while ((uint32_t)(now - s_hourStartMs) >= HOUR_MS) {
+        s_history[s_historyHead] = s_hourMin;
+        s_historyHead = (uint8_t)((s_historyHead + 1) % HEAP_MON_HISTORY_HOURS);
+        if (s_historyCount < HEAP_MON_HISTORY_HOURS) s_historyCount++;
+        s_hourStartMs += HOUR_MS;
+        /* 没有采样的小时沿用上一小时的最低值，否则记为 0 会被误读成耗尽 */
+        s_hourMin = s_largest;
+    }
+}
+
+/* 返回本次是否新进入低位 */
+static bool sample(void) {
+    uint32_t now = millis();
+    s_lastSampleMs = now;
+    s_sampled = true;
+    s_largest = (uint32_t)heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+    closeHours(now);
+    if (s_largest < s_minLargest) s_minLargest = s_largest;
+    if (s_largest < s_hourMin) s_hourMin = s_largest;
+    if (!s_low && s_largest < HEAP_MON_TLS_BLOCK) {
+        s_low = true;
+        s_lowEvents++;
+        return true;
+    }
+    if (s_low && s_largest >= HEAP_MON_TLS_BLOCK + HEAP_MON_REARM_BYTES) s_low = false;
+    return false;
+}
+
+static void warn(const char* tag) {
+    LOG_W("Heap: largest free block %luB < TLS %luB (%s, free %luB)", (unsigned long)s_largest,
+          (unsigned long)HEAP_MON_TLS_BLOCK, tag, (unsigned long)ESP.getFreeHeap());
+}
+
+void heapMonitorLoop(void) {
+    if (s_sampled && (uint32_t)(millis() - s_lastSampleMs) < HEAP_MON_SAMPLE_MS) return;
+    if (sample()) warn("periodic");
+}
+
+bool heapMonitorCheck(const char* tag) {
+    sample();
+    if (s_largest < HEAP_MON_TLS_BLOCK) warn(tag);
+    return s_largest >= HEAP_MON_TLS_BLOCK;
+}
+
+uint32_t heapMonitorMinLargestBlock(void) {
+    return s_sampled ? s_minLargest : 0;
+}
+
+void heapMonitorWriteJson(Print& out) {
+    out.printf("{\"largest\":%lu,\"min_largest\":%lu,\"free\":%lu,\"min_free\":%lu,\"tls_block\":%lu,"
+               "\"low\":%s,\"low_events\":%lu,\"hourly_min_largest\":[",
+               (unsigned long)s_largest, (unsigned long)heapMonitorMinLargestBlock(),
+               (unsigned long)ESP.getFreeHeap(), (unsigned long)ESP.getMinFreeHeap(),
+               (unsigned long)HEAP_MON_TLS_BLOCK, s_low ? "true" : "false", (unsigned long)s_lowEvents);
+    int first = (s_historyHead + HEAP_MON_HISTORY_HOURS - s_historyCount) % HEAP_MON_HISTORY_HOURS;
+    for (int i = 0; i < s_historyCount; i++)
+        out.printf("%s%lu", i ? "," : "", (unsigned long)s_history[(first + i) % HEAP_MON_HISTORY_HOURS]);
+    const Arena* a = &g_scratchArena;
+    out.printf("],\"scratch\":{\"capacity\":%lu,\"high_water\":%lu,\"allocs\":%lu,\"failures\":%lu}}",
+               (unsigned long)a->capacity, (unsigned long)a->highWater, (unsigned long)a->allocs,
+               (unsigned long)a->failures);
+}
+
+void heapMonitorWritePrometheus(Print& out) {
+    out.printf("# TYPE oled_heap_min_largest_free_block_bytes gauge\noled_heap_min_largest_free_block_bytes %lu\n",
+               (unsigned long)heapMonitorMinLargestBlock());
+    out.printf("# TYPE oled_heap_tls_block_bytes gauge\noled_heap_tls_block_bytes %lu\n",
+               (unsigned long)HEAP_MON_TLS_BLOCK);
+    out.printf("# HELP oled_heap_tls_low_total Times the largest free block fell below the TLS working set\n"
+               "# TYPE oled_heap_tls_low_total counter\noled_heap_tls_low_total %lu\n",
+               (unsigned long)s_lowEvents);
+    const Arena* a = &g_scratchArena;
+    out.printf("# HELP oled_scratch_arena_high_water_bytes Peak use of the loop-task scratch arena\n"
+               "# TYPE oled_scratch_arena_high_water_bytes gauge\noled_scratch_arena_high_water_bytes %lu\n",
+               (unsigned long)a->highWater);
+    out.printf("# TYPE oled_scratch_arena_capacity_bytes gauge\noled_scratch_arena_capacity_bytes %lu\n",
+               (unsigned long)a->capacity);
+    out.printf("# TYPE oled_scratch_arena_allocs_total counter\noled_scratch_arena_allocs_total %lu\n",
+               (unsigned long)a->allocs);
+    out.printf("# HELP oled_scratch_arena_failures_total Scratch allocations refused for exceeding the budget\n"
+               "# TYPE oled_scratch_arena_failures_total counter\noled_scratch_arena_failures_total %lu\n",
+               (unsigned long)a->failures);
+}
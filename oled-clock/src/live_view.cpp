@@ -0,0 +1,146 @@
+/**
+ * @file live_view.cpp
+ * @brief /live 画面镜像：首帧整帧，之后只发变化页的 XOR 差分；限速、拥塞时丢帧
+ *
+ * loop 任务只把帧缓冲拷进单格邮箱；编码、WebSocket 收发都在低优先级的镜像任务里，
+ * 客户端网络慢时阻塞的是镜像任务，不拖慢界面。wsServer 只在镜像任务中使用。
+ */
+#include "live_view.h"
+#include "frame_codec.h"
+#include "net_service.h"
+#include "metrics.h"
+#include <Arduino.h>
+#include <WebSocketsServer.h>
+
+#define LIVE_WS_PORT          81
+#define LIVE_MIN_INTERVAL_MS  200     /* 最高 5 帧/秒 */
+#define LIVE_MAX_INTERVAL_MS  2000
+#define LIVE_SLOW_SEND_US     15000   /* 单帧编码+发送超过此值视为拥塞，拉长发送间隔 */
+#define LIVE_STATS_MS         1000
+#define LIVE_POLL_MS          20      /* 没有新帧时处理握手、心跳的周期 */
+/* 镜像任务：与日志、联网任务同级，低于 WiFi / lwIP；放在 core 0，不与 loop 争 core 1 */
+#define LIVE_TASK_STACK       4096
+#define LIVE_TASK_PRIO        1
+#define LIVE_TASK_CORE        0
+
+static WebSocketsServer wsServer(LIVE_WS_PORT);
+static QueueHandle_t s_mailbox = NULL;   /* 长度 1，新帧覆盖未取走的旧帧 */
+static volatile uint8_t s_clients = 0;
+static volatile uint32_t s_intervalMs = LIVE_MIN_INTERVAL_MS;
+static uint32_t s_lastSendMs = 0;        /* 只在 loop 任务中使用 */
+
+/* 以下只在镜像任务中使用 */
+static uint8_t s_cur[FRAME_BYTES];
+static uint8_t s_prev[FRAME_BYTES];
+static uint8_t s_msg[FRAME_CODEC_MAX_OUT];
+static bool s_needKey = true;
+
+/* 统计窗口：发送字节、帧数、丢帧（限速、邮箱覆盖、发送失败）、镜像任务占用的 CPU 时间 */
+static uint32_t s_statStartMs = 0;
+static uint32_t s_statBytes = 0;
+static uint32_t s_statFrames = 0;
+static uint32_t s_statDropped = 0;       /* 两个任务都会累加，原子操作 */
+static uint32_t s_statBusyUs = 0;
+
+static void countDropped(void) {
+    __atomic_fetch_add(&s_statDropped, 1, __ATOMIC_RELAXED);
+}
+
+static void onWsEvent(uint8_t num, WStype_t type, uint8_t* payload, size_t length) {
+    /* 每个镜像客户端持有一个 Web 租约，看着画面时射频不会关掉；这里只改租约，驱动调用由 loop 执行 */
+    if (type == WStype_CONNECTED) {
+        netServiceAcquire(NET_JOB_WEB, 0);
+        s_clients++;
+        s_needKey = true;               /* 新客户端需要完整参考帧 */
+        s_intervalMs = LIVE_MIN_INTERVAL_MS;
+    } else if (type == WStype_DISCONNECTED) {
+        if (s_clients > 0) {
+            s_clients--;
+            netServiceRelease(NET_JOB_WEB);
+        }
+    }
+}
+
+static void sendStats(uint32_t now) {
+    uint32_t windowMs = now - s_statStartMs;
+    if (windowMs == 0) return;
+    char json[112];
+    int n = snprintf(json, sizeof(json),
+        "{\"fps\":%.1f,\"bps\":%lu,\"cpu\":%.2f,\"drop\":%lu,\"interval\":%lu}",
+        s_statFrames * 1000.0f / windowMs,
+        (unsigned long)((uint64_t)s_statBytes * 1000 / windowMs),
+        s_statBusyUs / (windowMs * 10.0f),
+        (unsigned long)__atomic_exchange_n(&s_statDropped, 0, __ATOMIC_RELAXED),
+        (unsigned long)s_intervalMs);
+    wsServer.broadcastTXT(json, (size_t)n);
+    s_statStartMs = now;
+    s_statBytes = 0;
+    s_statFrames = 0;
+    s_statBusyUs = 0;
+}
+
+/* 编码并发送一帧；按耗时与结果调整 loop 侧的发送间隔 */
+static void sendFrame(const uint8_t* fb) {
+    uint32_t t0 = micros();
+    bool ok = true;
+    size_t n = frameEncode(fb, s_needKey ? NULL : s_prev, s_msg, sizeof(s_msg));
+    if (n > 0) {
+        ok = wsServer.broadcastBIN(s_msg, n);
+        if (ok) {
+            memcpy(s_prev, fb, FRAME_BYTES);
+            s_needKey = false;
+            s_statBytes += n;
+            s_statFrames++;
+        } else {
+            s_needKey = true;           /* 有客户端漏帧，下一帧重发整帧 */
+            countDropped();
+        }
+    }
+    uint32_t cost = micros() - t0;
+    s_statBusyUs += cost;
+
+    uint32_t interval = s_intervalMs;
+    if (!ok || cost > LIVE_SLOW_SEND_US) {
+        interval *= 2;
+        if (interval > LIVE_MAX_INTERVAL_MS) interval = LIVE_MAX_INTERVAL_MS;
+    } else if (interval > LIVE_MIN_INTERVAL_MS) {
+        interval -= (interval - LIVE_MIN_INTERVAL_MS + 1) / 2;
+    }
+    s_intervalMs = interval;
+}
+
+static void liveTask(void* arg) {
+    for (;;) {
+        uint32_t t0 = micros();
+        wsServer.loop();
+        if (s_clients > 0) s_statBusyUs += micros() - t0;
+        if (xQueueReceive(s_mailbox, s_cur, pdMS_TO_TICKS(LIVE_POLL_MS)) == pdTRUE && s_clients > 0)
+            sendFrame(s_cur);
+        uint32_t now = millis();
+        if (s_clients > 0 && (uint32_t)(now - s_statStartMs) >= LIVE_STATS_MS)
+            sendStats(now);
+    }
+}
+
+void liveViewBegin(void) {
+    wsServer.begin();
+    wsServer.onEvent(onWsEvent);
+    s_mailbox = xQueueCreate(1, FRAME_BYTES);
+    TaskHandle_t task = NULL;
+    xTaskCreatePinnedToCore(liveTask, "live", LIVE_TASK_STACK, NULL, LIVE_TASK_PRIO, &task, LIVE_TASK_CORE);
+    metricsRegisterTask("live", task);
+}
+
+void liveViewOnFrame(const uint8_t* fb) {
+    if (s_clients == 0 || s_mailbox == NULL) return;
+    uint32_t now = millis();
+    uint32_t since = now - s_lastSendMs;
+    if (since < s_intervalMs) {
+        if (since >= LIVE_MIN_INTERVAL_MS) countDropped();
+        return;
+    }
+    s_lastSendMs = now;
+    /* 镜像任务还没取走上一帧（正阻塞在发送上）：覆盖它，只发最新画面 */
+    if (uxQueueMessagesWaiting(s_mailbox) > 0) countDropped();
+    xQueueOverwrite(s_mailbox, fb);
+}
@@ -0,0 +1,172 @@
+/**
+ * @file log_ring.cpp
+ * @brief 日志环形缓冲与延后格式化实现
+ */
+#include "log_ring.h"
+#include <stdio.h>
+
+#define LOG_RING_MASK  (LOG_RING_SIZE - 1)
+
+void logRingInit(LogRing* r) {
+    memset(r, 0, sizeof(*r));
+}
+
+bool logRingPush(LogRing* r, LogLevel level, int64_t timeUs, const char* fmt, const uint64_t* args, int argc,
+                 bool* wasEmpty) {
+    uint32_t h = __atomic_load_n(&r->head, __ATOMIC_RELAXED);
+    uint32_t t;
+    for (;;) {
+        t = __atomic_load_n(&r->tail, __ATOMIC_ACQUIRE);
+        if (h - t >= LOG_RING_SIZE) {
+            __atomic_fetch_add(&r->dropped, 1, __ATOMIC_RELAXED);
+            return false;
+        }
+        if (__atomic_compare_exchange_n(&r->head, &h, h + 1, true, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) break;
+    }
+    if (wasEmpty) *wasEmpty = (h == t);
+    LogEntry* e = &r->slots[h & LOG_RING_MASK];
+    if (argc > LOG_MAX_ARGS) argc = LOG_MAX_ARGS;
+    e->level = (uint8_t)level;
+    e->argc = (uint8_t)argc;
+    e->timeUs = timeUs;
+    e->fmt = fmt;
+    for (int i = 0; i < argc; i++) e->args[i] = args[i];
+    __atomic_store_n(&e->seq, h + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+bool logRingPop(LogRing* r, LogEntry* out) {
+    uint32_t t = __atomic_load_n(&r->tail, __ATOMIC_RELAXED);
+    if (t == __atomic_load_n(&r->head, __ATOMIC_ACQUIRE)) return false;
+    const LogEntry* e = &r->slots[t & LOG_RING_MASK];
+    if (__atomic_load_n(&e->seq, __ATOMIC_ACQUIRE) != t + 1) return false;
+    memcpy(out, e, sizeof(*out));
+    __atomic_store_n(&r->tail, t + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+uint32_t logRingPending(const LogRing* r) {
+    return __atomic_load_n(&r->head, __ATOMIC_ACQUIRE) - __atomic_load_n(&r->tail, __ATOMIC_ACQUIRE);
+}
+
+char logLevelChar(LogLevel level) {
+    static const char LEVELS[LOG_LEVEL_COUNT] = { 'E', 'W', 'I', 'D' };
+    return level < LOG_LEVEL_COUNT ? LEVELS[level] : '?';
+}
+
+/* 按长度修饰把参数槽截成调用处的实际宽度：%x 传 -1 时与 printf 一样输出 8 个 f 而不是 16 个 */
+static uint64_t narrow(uint64_t v, int bits, bool isSigned) {
+    if (bits >= 64) return v;
+    uint64_t mask = ((uint64_t)1 << bits) - 1;
+    v &= mask;
+    if (isSigned && (v >> (bits - 1)) & 1) v |= ~mask;
+    return v;
+}
+
+/* 解析一个转换说明，追加到 out[*n]；返回格式串中说明之后的位置 */
+static const char* formatOne(const char* p, const LogEntry* e, int* argi, char* out, size_t cap, size_t* n) {
+    char spec[24];
+    size_t s = 0;
+    spec[s++] = '%';
+    int starArgs[2];
+    int stars = 0;
+    /* 标志、宽度、精度 */
+    while (*p && strchr("-+ #0123456789.*", *p)) {
+        if (*p == '*') {
+            starArgs[stars < 2 ? stars : 1] = *argi < e->argc ? (int)(int64_t)e->args[(*argi)++] : 0;
+            if (stars < 2) stars++;
+        }
+        if (s < sizeof(spec) - 6) spec[s++] = *p;
+        p++;
+    }
+    /* 长度修饰：记下参数宽度，输出时统一用 ll */
+    int bits = 32;
+    if (p[0] == 'h' && p[1] == 'h') { bits = 8; p += 2; }
+    else if (p[0] == 'h') { bits = 16; p++; }
+    else if (p[0] == 'l' && p[1] == 'l') { bits = 64; p += 2; }
+    else if (p[0] == 'l') { bits = (int)sizeof(long) * 8; p++; }
+    else if (p[0] == 'z' || p[0] == 't') { bits = (int)sizeof(size_t) * 8; p++; }
+    else if (p[0] == 'j') { bits = 64; p++; }
+    else if (p[0] == 'L') p++;
+    char conv = *p;
+    if (conv == '\0') return p;
+    p++;
+    uint64_t v = *argi < e->argc ? e->args[*argi] : 0;
+    char* dst = out + *n;
+    size_t room = cap - *n;
+    int w = 0;
+    switch (conv) {
+    case '%':
+        w = snprintf(dst, room, "%%");
+        break;
+    case 'd': case 'i':
+        spec[s++] = 'l'; spec[s++] = 'l'; spec[s++] = conv; spec[s] = '\0';
+        v = narrow(v, bits, true);
+        (*argi)++;
+        if (stars == 2) w = snprintf(dst, room, spec, starArgs[0], starArgs[1], (long long)v);
+        else if (stars == 1) w = snprintf(dst, room, spec, starArgs[0], (long long)v);
+        else w = snprintf(dst, room, spec, (long long)v);
+        break;
+    case 'u': case 'x': case 'X': case 'o':
+        spec[s++] = 'l'; spec[s++] = 'l'; spec[s++] = conv; spec[s] = '\0';
+        v = narrow(v, bits, false);
+        (*argi)++;
+        if (stars == 2) w = snprintf(dst, room, spec, starArgs[0], starArgs[1], (unsigned long long)v);
+        else if (stars == 1) w = snprintf(dst, room, spec, starArgs[0], (unsigned long long)v);
+        else w = snprintf(dst, room, spec, (unsigned long long)v);
+        break;
+    case 'c':
+        spec[s++] = 'c'; spec[s] = '\0';
+        (*argi)++;
+        if (stars == 1) w = snprintf(dst, room, spec, starArgs[0], (int)v);
+        else w = snprintf(dst, room, spec, (int)v);
+        break;
+    case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A': {
+        double d;
+        memcpy(&d, &v, sizeof(d));
+        spec[s++] = conv; spec[s] = '\0';
+        (*argi)++;
+        if (stars == 2) w = snprintf(dst, room, spec, starArgs[0], starArgs[1], d);
+        else if (stars == 1) w = snprintf(dst, room, spec, starArgs[0], d);
+        else w = snprintf(dst, room, spec, d);
+        break;
+    }
+    case 's': {
+        const char* str = (const char*)(uintptr_t)v;
+        spec[s++] = 's'; spec[s] = '\0';
+        (*argi)++;
+        if (!str) str = "(null)";
+        if (stars == 2) w = snprintf(dst, room, spec, starArgs[0], starArgs[1], str);
+        else if (stars == 1) w = snprintf(dst, room, spec, starArgs[0], str);
+        else w = snprintf(dst, room, spec, str);
+        break;
+    }
+    case 'p':
+        (*argi)++;
+        w = snprintf(dst, room, "%p", (void*)(uintptr_t)v);
+        break;
+    default:
+        /* 不支持的转换（含 %n）原样输出 */
+        w = snprintf(dst, room, "%%%c", conv);
+        break;
+    }
+    if (w > 0) *n += (size_t)w < room ? (size_t)w : room - 1;
+    return p;
+}
+
+size_t logFormat(const LogEntry* e, char* out, size_t cap) {
+    if (cap == 0) return 0;
+    size_t n = 0;
+    int argi = 0;
+    out[0] = '\0';
+    const char* p = e->fmt ? e->fmt : "(null)";
+    while (*p && n + 1 < cap) {
+        if (*p != '%') {
+            out[n++] = *p++;
+            continue;
+        }
+        p = formatOne(p + 1, e, &argi, out, cap, &n);
+    }
+    out[n] = '\0';
+    return n;
+}
@@ -0,0 +1,214 @@
+/**
+ * @file log_service.cpp
+ * @brief 日志服务实现：取日志任务、RTC 内存中的最近日志、串口基准
+ */
+#include "log_service.h"
+#include "power_service.h"
+#include "metrics.h"
+#include <esp_system.h>
+#include <esp_timer.h>
+
+#define LOG_RTC_MAGIC       0x4C4F4752u   /* "LOGR" */
+#define LOG_BENCH_ROUNDS    8
+#define LOG_BENCH_BATCH     16             /* 每轮写入数，小于环容量，基准本身不丢记录 */
+#define LOG_BENCH_PRINTF    16
+
+/*
+ * 最近日志的文本环。崩溃时可能正写到一半，因此不做整体校验（校验和会让整块作废）：
+ * 只校验魔数与下标范围，每行读取时限长
+ */
+struct RtcLogText {
+    uint32_t magic;
+    uint16_t next;          /* 下一行写入位置 */
+    uint16_t count;
+    char lines[LOG_RTC_LINES][LOG_LINE_MAX];
+};
+
+static LogRing s_ring;
+static RTC_NOINIT_ATTR RtcLogText s_rtc;
+static RtcLogText s_prev;           /* 开机时从 RTC 取出的上次日志 */
+static esp_reset_reason_t s_prevReason = ESP_RST_UNKNOWN;
+static TaskHandle_t volatile s_task = NULL;
+static volatile uint8_t s_level = LOG_INFO;
+static volatile bool s_draining = false;
+static uint32_t s_written = 0;
+static uint32_t s_reportedDropped = 0;
+
+static const char* resetReasonName(esp_reset_reason_t r) {
+    switch (r) {
+    case ESP_RST_POWERON:   return "power-on";
+    case ESP_RST_EXT:       return "external";
+    case ESP_RST_SW:        return "software";
+    case ESP_RST_PANIC:     return "panic";
+    case ESP_RST_INT_WDT:   return "interrupt watchdog";
+    case ESP_RST_TASK_WDT:  return "task watchdog";
+    case ESP_RST_WDT:       return "watchdog";
+    case ESP_RST_DEEPSLEEP: return "deep sleep";
+    case ESP_RST_BROWNOUT:  return "brownout";
+    default:                return "unknown";
+    }
+}
+
+static bool abnormalReset(esp_reset_reason_t r) {
+    return r == ESP_RST_PANIC || r == ESP_RST_INT_WDT || r == ESP_RST_TASK_WDT || r == ESP_RST_WDT ||
+           r == ESP_RST_BROWNOUT;
+}
+
+static bool rtcValid(const RtcLogText* t) {
+    return t->magic == LOG_RTC_MAGIC && t->next < LOG_RTC_LINES && t->count <= LOG_RTC_LINES;
+}
+
+static void rtcAppend(const char* line, size_t n) {
+    if (n >= LOG_LINE_MAX) n = LOG_LINE_MAX - 1;
+    char* dst = s_rtc.lines[s_rtc.next];
+    memcpy(dst, line, n);
+    dst[n] = '\0';
+    s_rtc.next = (uint16_t)((s_rtc.next + 1) % LOG_RTC_LINES);
+    if (s_rtc.count < LOG_RTC_LINES) s_rtc.count++;
+}
+
+/* 从最早到最新逐行输出 */
+static void writeLines(const RtcLogText* t, Print& out) {
+    int first = (t->next + LOG_RTC_LINES - t->count) % LOG_RTC_LINES;
+    for (int i = 0; i < t->count; i++) {
+        const char* line = t->lines[(first + i) % LOG_RTC_LINES];
+        out.write((const uint8_t*)line, strnlen(line, LOG_LINE_MAX));
+        out.write('\n');
+    }
+}
+
+/* 「秒.毫秒 级别 正文」，去掉正文末尾的换行 */
+static size_t formatLine(const LogEntry* e, char* line, size_t cap) {
+    int64_t ms = e->timeUs / 1000;
+    int n = snprintf(line, cap, "%5lu.%03u %c ", (unsigned long)(ms / 1000), (unsigned)(ms % 1000),
+                     logLevelChar((LogLevel)e->level));
+    size_t len = (size_t)n + logFormat(e, line + n, cap - n);
+    while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r')) line[--len] = '\0';
+    return len;
+}
+
+static void emit(const char* line, size_t n) {
+    Serial.write((const uint8_t*)line, n);
+    Serial.write('\n');
+    rtcAppend(line, n);
+}
+
+static void drain(void) {
+    s_draining = true;
+    LogEntry e;
+    char line[LOG_LINE_MAX];
+    while (logRingPop(&s_ring, &e)) {
+        emit(line, formatLine(&e, line, sizeof(line)));
+    }
+    uint32_t dropped = __atomic_load_n(&s_ring.dropped, __ATOMIC_RELAXED);
+    if (dropped != s_reportedDropped) {
+        int n = snprintf(line, sizeof(line), "Log: %lu entries dropped (ring full)",
+                         (unsigned long)(dropped - s_reportedDropped));
+        emit(line, (size_t)n);
+        s_reportedDropped = dropped;
+    }
+    s_draining = false;
+}
+
+static void drainTask(void* arg) {
+    if (abnormalReset(s_prevReason) && s_prev.count > 0) {
+        Serial.printf("Log: previous boot ended by %s reset, last %u lines:\n", resetReasonName(s_prevReason),
+                      (unsigned)s_prev.count);
+        writeLines(&s_prev, Serial);
+    }
+    for (;;) {
+        drain();
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(LOG_DRAIN_IDLE_MS));
+    }
+}
+
+void logServiceBegin(void) {
+    /* 开机前写入的记录（静态区清零即空环）保留，由取日志任务输出 */
+    s_prevReason = esp_reset_reason();
+    if (s_prevReason != ESP_RST_POWERON && rtcValid(&s_rtc)) s_prev = s_rtc;
+    memset(&s_rtc, 0, sizeof(s_rtc));
+    s_rtc.magic = LOG_RTC_MAGIC;
+    TaskHandle_t task = NULL;
+    xTaskCreatePinnedToCore(drainTask, "log", LOG_TASK_STACK, NULL, LOG_TASK_PRIO, &task, LOG_TASK_CORE);
+    s_task = task;
+    metricsRegisterTask("log", task);
+}
+
+void logServiceRecord(LogLevel level, const char* fmt, const uint64_t* args, int argc) {
+    if (level > s_level) return;
+    bool wasEmpty = false;
+    if (!logRingPush(&s_ring, level, esp_timer_get_time(), fmt, args, argc, &wasEmpty)) return;
+    __atomic_fetch_add(&s_written, 1, __ATOMIC_RELAXED);
+    /* 一批记录只唤醒一次；警告以上立即唤醒，崩溃前尽量已写进 RTC */
+    TaskHandle_t task = s_task;
+    if (task && (wasEmpty || level <= LOG_WARN)) xTaskNotifyGive(task);
+}
+
+void logServiceFlush(void) {
+    if (s_task == NULL) {
+        drain();
+    } else {
+        xTaskNotifyGive(s_task);
+        uint32_t start = millis();
+        while ((logRingPending(&s_ring) > 0 || s_draining) &&
+               (uint32_t)(millis() - start) < LOG_FLUSH_TIMEOUT_MS)
+            vTaskDelay(1);
+    }
+    Serial.flush();
+}
+
+void logServiceSetLevel(LogLevel level) {
+    s_level = (uint8_t)level;
+}
+
+LogLevel logServiceLevel(void) {
+    return (LogLevel)s_level;
+}
+
+void logServiceWriteText(Print& out) {
+    if (s_prev.count > 0) {
+        out.printf("# previous boot (ended by %s reset)\n", resetReasonName(s_prevReason));
+        writeLines(&s_prev, out);
+    }
+    /* 当前这一份可能正被取日志任务追加，最多读到一行写了一半（行内限长，不会越界） */
+    RtcLogText cur = s_rtc;
+    out.printf("# current boot (%lu entries logged, last %u shown)\n", (unsigned long)s_written,
+               (unsigned)cur.count);
+    writeLines(&cur, out);
+}
+
+void logServiceWritePrometheus(Print& out) {
+    out.printf("# HELP oled_log_entries_total Log entries recorded (after the level filter)\n"
+               "# TYPE oled_log_entries_total counter\noled_log_entries_total %lu\n",
+               (unsigned long)s_written);
+    out.printf("# HELP oled_log_dropped_total Log entries dropped because the ring was full\n"
+               "# TYPE oled_log_dropped_total counter\noled_log_dropped_total %lu\n",
+               (unsigned long)__atomic_load_n(&s_ring.dropped, __ATOMIC_RELAXED));
+    out.printf("# TYPE oled_log_pending gauge\noled_log_pending %lu\n", (unsigned long)logRingPending(&s_ring));
+}
+
+void logServiceBenchmark(Print& out) {
+    /* 固定在最高频率下计时；每轮先等环取空，只计写入本身 */
+    POWER_BUSY_SCOPE();
+    uint32_t logCycles = 0;
+    for (int round = 0; round < LOG_BENCH_ROUNDS; round++) {
+        logServiceFlush();
+        uint32_t start = ESP.getCycleCount();
+        for (int i = 0; i < LOG_BENCH_BATCH; i++)
+            LOG_I("Log bench: round %d call %d value %lu", round, i, (unsigned long)start);
+        logCycles += ESP.getCycleCount() - start;
+    }
+    logServiceFlush();
+    uint32_t printfCycles = 0;
+    for (int i = 0; i < LOG_BENCH_PRINTF; i++) {
+        uint32_t start = ESP.getCycleCount();
+        Serial.printf("Log bench: printf call %d value %lu\n", i, (unsigned long)start);
+        printfCycles += ESP.getCycleCount() - start;
+    }
+    uint32_t mhz = ESP.getCpuFreqMHz();
+    uint32_t logCalls = LOG_BENCH_ROUNDS * LOG_BENCH_BATCH;
+    Serial.flush();
+    out.printf("Log bench @%luMHz: LOG_I %lu ns/call (%lu calls), Serial.printf %lu ns/call (%d calls)\n",
+               (unsigned long)mhz, (unsigned long)(logCycles / logCalls * 1000 / mhz), (unsigned long)logCalls,
+               (unsigned long)(printfCycles / LOG_BENCH_PRINTF * 1000 / mhz), LOG_BENCH_PRINTF);
+}
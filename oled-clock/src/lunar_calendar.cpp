@@ -0,0 +1,92 @@
+/**
+ * @file lunar_calendar.cpp
+ * @brief 农历与节气：位压缩表查询
+ */
+#include "lunar_calendar.h"
+#include "lunar_table.h"
+#include "time_service.h"
+
+static const char* const LUNAR_MONTH_NAMES[12] = {
+    u8"正月", u8"二月", u8"三月", u8"四月", u8"五月", u8"六月",
+    u8"七月", u8"八月", u8"九月", u8"十月", u8"冬月", u8"腊月"
+};
+
+static const char* const LUNAR_DAY_NAMES[30] = {
+    u8"初一", u8"初二", u8"初三", u8"初四", u8"初五", u8"初六", u8"初七", u8"初八", u8"初九", u8"初十",
+    u8"十一", u8"十二", u8"十三", u8"十四", u8"十五", u8"十六", u8"十七", u8"十八", u8"十九", u8"二十",
+    u8"廿一", u8"廿二", u8"廿三", u8"廿四", u8"廿五", u8"廿六", u8"廿七", u8"廿八", u8"廿九", u8"三十"
+};
+
+static const char* const SOLAR_TERM_NAMES[SOLAR_TERM_COUNT] = {
+    u8"小寒", u8"大寒", u8"立春", u8"雨水", u8"惊蛰", u8"春分",
+    u8"清明", u8"谷雨", u8"立夏", u8"小满", u8"芒种", u8"夏至",
+    u8"小暑", u8"大暑", u8"立秋", u8"处暑", u8"白露", u8"秋分",
+    u8"寒露", u8"霜降", u8"立冬", u8"小雪", u8"大雪", u8"冬至"
+};
+
+/* 1 月 1 日起到各月 1 日的天数（平年） */
+static const uint16_t DAYS_BEFORE_MONTH[12] = {
+    0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334
+};
+
+static inline uint32_t yearInfo(int lunarYear) {
+    const uint8_t* p = LUNAR_YEAR_INFO[lunarYear - LUNAR_TABLE_FIRST_YEAR];
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16);
+}
+
+static inline int newYearOffset(uint32_t info) {
+    return (int)(info >> 17);
+}
+
+/* 第 i 个月（按顺序，含闰月）之前的天数：每月 29 天 + 之前大月的个数 */
+static inline int monthStart(uint32_t info, int i) {
+    return 29 * i + __builtin_popcount(info & ((1u << i) - 1));
+}
+
+static inline int monthCount(uint32_t info) {
+    return ((info >> 13) & 0xF) ? 13 : 12;
+}
+
+bool lunarFromSolar(int year, int month, int day, LunarDate* out) {
+    if (year < LUNAR_TABLE_FIRST_YEAR + 1 || year > LUNAR_TABLE_LAST_YEAR) return false;
+    int doy = DAYS_BEFORE_MONTH[month - 1] + day - 1;
+    if (month > 2 && timeIsLeapYear(year)) doy++;
+
+    int ly = year;
+    uint32_t info = yearInfo(ly);
+    int off = doy - newYearOffset(info);
+    if (off < 0) {
+        ly--;
+        info = yearInfo(ly);
+        off = doy + (timeIsLeapYear(ly) ? 366 : 365) - newYearOffset(info);
+    }
+
+    /* 每月 29 或 30 天，off / 30 至多比实际月序小 1 */
+    int i = off / 30;
+    if (i + 1 < monthCount(info) && monthStart(info, i + 1) <= off) i++;
+
+    int leapMonth = (info >> 13) & 0xF;
+    out->year = (int16_t)ly;
+    out->day = (int8_t)(off - monthStart(info, i) + 1);
+    out->leap = (leapMonth != 0 && i == leapMonth);
+    out->month = (int8_t)((leapMonth != 0 && i >= leapMonth) ? i : i + 1);
+    return true;
+}
+
+int solarTermDay(int year, int term) {
+    if (year < SOLAR_TERM_FIRST_YEAR || year > SOLAR_TERM_LAST_YEAR) return 0;
+    const uint8_t* d = SOLAR_TERM_DELTA[year - SOLAR_TERM_FIRST_YEAR];
+    return SOLAR_TERM_BASE[term] + ((d[term >> 2] >> ((term & 3) * 2)) & 3);
+}
+
+const char* lunarMonthName(int month) {
+    return LUNAR_MONTH_NAMES[month - 1];
+}
+
+const char* lunarDayName(int day) {
+    return LUNAR_DAY_NAMES[day - 1];
+}
+
+const char* solarTermName(int term) {
+    return SOLAR_TERM_NAMES[term];
+}
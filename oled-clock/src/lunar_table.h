@@ -0,0 +1,120 @@
+/*
+ * 由 tools/gen_lunar_table.py 生成，勿手工修改。
+ *
+ * LUNAR_YEAR_INFO：农历 1899..2100 年，每年 3 字节（小端 24 位）：
+ *   bit 0..12  按顺序各月是否大月（30 天），闰月紧跟在同名月之后
+ *   bit 13..16 闰月月份，0 表示无闰月
+ *   bit 17..22 正月初一距公历同年 1 月 1 日的天数
+ * SOLAR_TERM_DELTA：公历 1900..2100 年，每年 24 个节气 × 2 位（小端），
+ *   节气 k 在 k/2+1 月的 SOLAR_TERM_BASE[k] + delta 日
+ * 交节 / 合朔时刻距零点不足 2 分钟（日期依赖历表精度，可能与其他历书不同）：
+ *   节气 1911/8, 节气 1917/9, 节气 1917/22, 节气 1923/3, 节气 1950/7, 节气 1951/23
+ *   节气 1979/1, 节气 1984/13, 节气 2008/9, 节气 2021/23, 节气 2051/5, 节气 2083/2
+ *   节气 2084/5, 朔 1914-11-18, 朔 2057-09-29, 朔 2097-08-08
+ */
+#ifndef LUNAR_TABLE_H
+#define LUNAR_TABLE_H
+
+#include <stdint.h>
+
+#define LUNAR_TABLE_FIRST_YEAR 1899
+#define LUNAR_TABLE_LAST_YEAR  2100
+#define SOLAR_TERM_FIRST_YEAR  1900
+#define SOLAR_TERM_LAST_YEAR   2100
+
+static const uint8_t LUNAR_YEAR_INFO[202][3] = {
+    {0xd5,0x0a,0x50}, {0xd2,0x16,0x3d}, {0x52,0x07,0x62}, {0xa5,0x0e,0x4c}, {0x4a,0xb6,0x38}, {0x4b,0x06,0x5c},  /* 1899 */
+    {0x9b,0x0a,0x44}, {0x56,0x95,0x30}, {0x6a,0x05,0x56}, {0x59,0x0b,0x40}, {0x52,0x57,0x2a}, {0x52,0x07,0x50},  /* 1905 */
+    {0x25,0xdb,0x3a}, {0x25,0x0b,0x60}, {0x4b,0x0a,0x48}, {0xab,0xb2,0x32}, {0xad,0x0a,0x58}, {0x6a,0x05,0x44},  /* 1911 */
+    {0x69,0x4b,0x2c}, {0xa9,0x0d,0x52}, {0x92,0xfd,0x3e}, {0x92,0x0d,0x64}, {0x25,0x0d,0x4c}, {0x4d,0xba,0x36},  /* 1917 */
+    {0x56,0x0a,0x5c}, {0xb6,0x02,0x46}, {0xb5,0x95,0x2e}, {0xd4,0x06,0x56}, {0xa9,0x0e,0x40}, {0x92,0x5e,0x2c},  /* 1923 */
+    {0x92,0x0e,0x50}, {0x26,0xcd,0x3a}, {0x2b,0x05,0x5e}, {0x57,0x0a,0x48}, {0xb6,0xb2,0x32}, {0x5a,0x0b,0x58},  /* 1929 */
+    {0xd4,0x06,0x44}, {0xc9,0x6e,0x2e}, {0x49,0x07,0x52}, {0x93,0xf6,0x3c}, {0x93,0x0a,0x62}, {0x2b,0x05,0x4c},  /* 1935 */
+    {0x5b,0xca,0x34}, {0xad,0x0a,0x5a}, {0x6a,0x05,0x46}, {0x55,0x9b,0x30}, {0xa4,0x0b,0x56}, {0x49,0x0b,0x40},  /* 1941 */
+    {0x93,0x5a,0x2a}, {0x95,0x0a,0x50}, {0x2d,0xf5,0x38}, {0x36,0x05,0x5e}, {0xad,0x0a,0x48}, {0xaa,0xb5,0x34},  /* 1947 */
+    {0xb2,0x05,0x58}, {0xa5,0x0d,0x42}, {0x4a,0x7d,0x2e}, {0x4a,0x0d,0x54}, {0x95,0x0a,0x3d}, {0x97,0x0a,0x60},  /* 1953 */
+    {0x56,0x05,0x4c}, {0xb5,0xca,0x36}, {0xd5,0x0a,0x5a}, {0xd2,0x06,0x46}, {0xa5,0x8e,0x30}, {0xa5,0x0e,0x56},  /* 1959 */
+    {0x4a,0x06,0x40}, {0x97,0x6c,0x28}, {0x9b,0x0a,0x4e}, {0x5a,0xf5,0x3a}, {0x6a,0x05,0x5e}, {0x69,0x0b,0x48},  /* 1965 */
+    {0x52,0xb7,0x34}, {0x52,0x0b,0x5a}, {0x25,0x0b,0x42}, {0x4b,0x96,0x2c}, {0x4b,0x0a,0x52}, {0xab,0x14,0x3d},  /* 1971 */
+    {0xad,0x02,0x60}, {0x6d,0x05,0x4a}, {0x69,0xcb,0x36}, {0xa9,0x0d,0x5c}, {0x92,0x0d,0x46}, {0x25,0x9d,0x30},  /* 1977 */
+    {0x25,0x0d,0x56}, {0x4d,0x5a,0x41}, {0x56,0x0a,0x64}, {0xb6,0x02,0x4e}, {0xb5,0xc5,0x38}, {0xd5,0x06,0x5e},  /* 1983 */
+    {0xa9,0x0e,0x48}, {0x92,0xbe,0x34}, {0x92,0x0e,0x5a}, {0x26,0x0d,0x44}, {0x56,0x6a,0x2c}, {0x57,0x0a,0x50},  /* 1989 */
+    {0xd6,0x14,0x3d}, {0x5a,0x03,0x62}, {0xd5,0x06,0x4a}, {0xc9,0xb6,0x36}, {0x49,0x07,0x5c}, {0x93,0x06,0x46},  /* 1995 */
+    {0x2b,0x95,0x2e}, {0x2b,0x05,0x54}, {0x5b,0x0a,0x3e}, {0x5a,0x55,0x2a}, {0x6a,0x05,0x4e}, {0x55,0xfb,0x38},  /* 2001 */
+    {0xa4,0x0b,0x60}, {0x49,0x0b,0x4a}, {0x93,0xba,0x32}, {0x95,0x0a,0x58}, {0x2d,0x05,0x42}, {0xad,0x8a,0x2c},  /* 2007 */
+    {0xb5,0x0a,0x50}, {0xaa,0x35,0x3d}, {0xd2,0x05,0x62}, {0xa5,0x0d,0x4c}, {0x4a,0xdd,0x36}, {0x4a,0x0d,0x5c},  /* 2013 */
+    {0x95,0x0c,0x46}, {0x2e,0x95,0x30}, {0x56,0x05,0x54}, {0xb5,0x0a,0x3e}, {0xb2,0x55,0x2a}, {0xd2,0x06,0x50},  /* 2019 */
+    {0xa5,0xce,0x38}, {0x25,0x07,0x5e}, {0x4b,0x06,0x48}, {0x97,0xac,0x32}, {0xab,0x0c,0x56}, {0x5a,0x05,0x42},  /* 2025 */
+    {0xd6,0x6a,0x2c}, {0x69,0x0b,0x52}, {0x52,0x77,0x3d}, {0x52,0x0b,0x62}, {0x25,0x0b,0x4c}, {0x4b,0xda,0x36},  /* 2031 */
+    {0x4b,0x0a,0x5a}, {0xab,0x04,0x44}, {0x5b,0xa5,0x2e}, {0xad,0x05,0x54}, {0x6a,0x0b,0x3e}, {0x52,0x5b,0x2a},  /* 2037 */
+    {0x92,0x0d,0x50}, {0x25,0xfd,0x3a}, {0x25,0x0d,0x5e}, {0x55,0x0a,0x48}, {0xad,0xb4,0x32}, {0xb6,0x04,0x58},  /* 2043 */
+    {0xb5,0x05,0x40}, {0xaa,0x6d,0x2c}, {0xc9,0x0e,0x52}, {0x92,0x1e,0x3f}, {0x92,0x0e,0x62}, {0x26,0x0d,0x4c},  /* 2049 */
+    {0x56,0xca,0x36}, {0x57,0x0a,0x5a}, {0x56,0x05,0x44}, {0xd5,0x86,0x2e}, {0x55,0x07,0x54}, {0x49,0x07,0x40},  /* 2055 */
+    {0x93,0x6e,0x28}, {0x93,0x06,0x4e}, {0x2b,0xf5,0x38}, {0x2b,0x05,0x5e}, {0x5b,0x0a,0x46}, {0x5a,0xb5,0x32},  /* 2061 */
+    {0x6a,0x05,0x58}, {0x65,0x0b,0x42}, {0x4a,0x97,0x2c}, {0x4a,0x0b,0x52}, {0x95,0x1a,0x3d}, {0x95,0x0a,0x62},  /* 2067 */
+    {0x2d,0x05,0x4a}, {0xad,0xca,0x34}, {0xb5,0x0a,0x5a}, {0xaa,0x05,0x46}, {0xa5,0x8b,0x2e}, {0xa5,0x0d,0x54},  /* 2073 */
+    {0x4a,0x0d,0x40}, {0x95,0x7c,0x2a}, {0x96,0x0c,0x4e}, {0x4e,0xf9,0x38}, {0x56,0x05,0x5e}, {0xb5,0x0a,0x48},  /* 2079 */
+    {0xb2,0xb5,0x32}, {0xd2,0x06,0x58}, {0xa5,0x0e,0x42}, {0x4a,0x8e,0x2e}, {0x8b,0x06,0x50}, {0x97,0x0c,0x3b},  /* 2085 */
+    {0xab,0x04,0x60}, {0x5b,0x05,0x4a}, {0xd6,0xca,0x34}, {0x6a,0x0b,0x5a}, {0x52,0x07,0x46}, {0x25,0x97,0x30},  /* 2091 */
+    {0x45,0x0b,0x54}, {0x8b,0x0a,0x3e}, {0x9b,0x54,0x28}, {0xab,0x04,0x4e},  /* 2097 */
+};
+
+static const uint8_t SOLAR_TERM_BASE[24] = {
+    4, 19, 3, 18, 4, 19, 4, 19, 4, 20, 4, 20, 6, 22, 6, 22, 6, 22, 7, 22, 6, 21, 6, 21
+};
+
+static const uint8_t SOLAR_TERM_DELTA[201][6] = {
+    {0x56,0x5a,0xa6,0x65,0xa6,0x5a}, {0x5a,0x9a,0xaa,0xa6,0xaa,0x6a}, {0x6a,0xaa,0xba,0xaa,0xaa,0xaa}, {0xaa,0xaf,0xbb,0xba,0xab,0xaa},  /* 1900 */
+    {0xab,0x5a,0xa6,0x65,0xa6,0x5a}, {0x5a,0x9a,0xaa,0xa6,0xaa,0x6a}, {0x6a,0xaa,0xaa,0xaa,0xaa,0xaa}, {0xaa,0xaf,0xbb,0xba,0xab,0xaa},  /* 1904 */
+    {0xab,0x5a,0xa6,0x65,0xa6,0x5a}, {0x5a,0x9a,0xaa,0xa6,0xaa,0x6a}, {0x6a,0xaa,0xaa,0xaa,0xaa,0xaa}, {0xaa,0xaf,0xbb,0xba,0xab,0xaa},  /* 1908 */
+    {0xab,0x5a,0xa6,0x65,0xa6,0x56}, {0x56,0x9a,0xaa,0xa6,0xa6,0x6a}, {0x5a,0x9a,0xaa,0xaa,0xaa,0xaa}, {0xaa,0xae,0xba,0xaa,0xab,0xaa},  /* 1912 */
+    {0xaa,0x5a,0xa6,0x65,0x96,0x56}, {0x56,0x9a,0xa6,0xa6,0xa6,0x6a}, {0x5a,0x9a,0xaa,0xaa,0xaa,0x6a}, {0xaa,0xae,0xba,0xaa,0xab,0xaa},  /* 1916 */
+    {0xaa,0x5a,0xa6,0x65,0x96,0x56}, {0x56,0x5a,0xa6,0xa6,0xa6,0x5a}, {0x5a,0x9a,0xaa,0xaa,0xaa,0x6a}, {0x6a,0xaa,0xba,0xaa,0xab,0xaa},  /* 1920 */
+    {0xaa,0x5a,0xa6,0x65,0x96,0x56}, {0x56,0x5a,0xa6,0xa6,0xa6,0x5a}, {0x5a,0x9a,0xaa,0xa6,0xaa,0x6a}, {0x6a,0xaa,0xba,0xaa,0xab,0xaa},  /* 1924 */
+    {0xaa,0x5a,0xa6,0x65,0x56,0x55}, {0x56,0x5a,0xa6,0x65,0xa6,0x5a}, {0x5a,0x9a,0xaa,0xa6,0xaa,0x6a}, {0x6a,0xaa,0xba,0xaa,0xaa,0xaa},  /* 1928 */
+    {0xaa,0x5a,0x66,0x65,0x56,0x55}, {0x56,0x5a,0xa6,0x65,0xa6,0x5a}, {0x5a,0x9a,0xaa,0xa6,0xaa,0x6a}, {0x6a,0xaa,0xaa,0xaa,0xaa,0xaa},  /* 1932 */
+    {0xaa,0x5a,0x66,0x65,0x56,0x55}, {0x56,0x5a,0xa6,0x65,0xa6,0x5a}, {0x5a,0x9a,0xaa,0xa6,0xaa,0x6a}, {0x6a,0xaa,0xaa,0xaa,0xaa,0xaa},  /* 1936 */
+    {0xaa,0x5a,0x66,0x65,0x56,0x55}, {0x56,0x5a,0xa6,0x65,0xa6,0x5a}, {0x5a,0x9a,0xaa,0xa6,0xaa,0x6a}, {0x6a,0xaa,0xaa,0xaa,0xaa,0xaa},  /* 1940 */
+    {0xaa,0x5a,0x65,0x65,0x56,0x55}, {0x56,0x5a,0xa6,0x65,0x96,0x56}, {0x56,0x9a,0xaa,0xa6,0xa6,0x6a}, {0x5a,0x9a,0xaa,0xaa,0xaa,0xaa},  /* 1944 */
+    {0xaa,0x59,0x65,0x55,0x56,0x55}, {0x55,0x5a,0xa6,0x65,0x96,0x56}, {0x56,0x5a,0xa6,0xa6,0xa6,0x6a}, {0x5a,0x9a,0xaa,0xaa,0xaa,0xaa},  /* 1948 */
+    {0xaa,0x59,0x65,0x55,0x56,0x55}, {0x55,0x5a,0xa6,0x65,0x96,0x56}, {0x56,0x5a,0xa6,0xa6,0xa6,0x5a}, {0x5a,0x9a,0xaa,0xa6,0xaa,0x6a},  /* 1952 */
+    {0xaa,0x55,0x65,0x55,0x56,0x55}, {0x55,0x5a,0xa6,0x65,0x96,0x56}, {0x56,0x5a,0xa6,0x65,0xa6,0x5a}, {0x5a,0x9a,0xaa,0xa6,0xaa,0x6a},  /* 1956 */
+    {0x6a,0x55,0x65,0x55,0x55,0x55}, {0x55,0x5a,0x66,0x65,0x56,0x55}, {0x56,0x5a,0xa6,0x65,0xa6,0x5a}, {0x5a,0x9a,0xaa,0xa6,0xaa,0x6a},  /* 1960 */
+    {0x6a,0x55,0x65,0x55,0x55,0x55}, {0x55,0x5a,0x66,0x65,0x56,0x55}, {0x56,0x5a,0xa6,0x65,0xa6,0x5a}, {0x5a,0x9a,0xaa,0xa6,0xaa,0x6a},  /* 1964 */
+    {0x6a,0x55,0x55,0x55,0x55,0x55}, {0x55,0x5a,0x66,0x65,0x56,0x55}, {0x56,0x5a,0xa6,0x65,0xa6,0x5a}, {0x5a,0x9a,0xaa,0xa6,0xaa,0x6a},  /* 1968 */
+    {0x6a,0x55,0x55,0x55,0x55,0x55}, {0x55,0x5a,0x65,0x65,0x56,0x55}, {0x56,0x5a,0xa6,0x65,0xa6,0x5a}, {0x5a,0x9a,0xaa,0xa6,0xa6,0x6a},  /* 1972 */
+    {0x6a,0x45,0x55,0x55,0x55,0x55}, {0x55,0x5a,0x65,0x55,0x56,0x55}, {0x56,0x5a,0xa6,0x65,0x96,0x5a}, {0x56,0x9a,0xa6,0xa6,0xa6,0x6a},  /* 1976 */
+    {0x6a,0x45,0x55,0x55,0x55,0x55}, {0x55,0x5a,0x65,0x55,0x56,0x55}, {0x56,0x5a,0xa6,0x65,0x96,0x56}, {0x56,0x5a,0xa6,0xa6,0xa6,0x6a},  /* 1980 */
+    {0x5a,0x45,0x55,0x51,0x55,0x55}, {0x55,0x59,0x65,0x55,0x56,0x55}, {0x55,0x5a,0xa6,0x65,0x96,0x56}, {0x56,0x5a,0xa6,0xa5,0xa6,0x5a},  /* 1984 */
+    {0x5a,0x45,0x55,0x51,0x55,0x15}, {0x55,0x55,0x65,0x55,0x55,0x55}, {0x55,0x5a,0x66,0x65,0x96,0x56}, {0x56,0x5a,0xa6,0x65,0xa6,0x5a},  /* 1988 */
+    {0x5a,0x45,0x55,0x51,0x55,0x15}, {0x15,0x55,0x65,0x55,0x55,0x55}, {0x55,0x5a,0x66,0x65,0x56,0x55}, {0x56,0x5a,0xa6,0x65,0xa6,0x5a},  /* 1992 */
+    {0x5a,0x45,0x55,0x51,0x55,0x15}, {0x15,0x55,0x55,0x55,0x55,0x55}, {0x55,0x5a,0x66,0x65,0x56,0x55}, {0x56,0x5a,0xa6,0x65,0xa6,0x5a},  /* 1996 */
+    {0x5a,0x45,0x55,0x51,0x55,0x15}, {0x15,0x55,0x55,0x55,0x55,0x55}, {0x55,0x5a,0x66,0x65,0x56,0x55}, {0x56,0x5a,0xa6,0x65,0xa6,0x5a},  /* 2000 */
+    {0x5a,0x45,0x55,0x51,0x55,0x15}, {0x15,0x55,0x55,0x55,0x55,0x55}, {0x55,0x5a,0x65,0x55,0x56,0x55}, {0x56,0x5a,0xa6,0x65,0xa6,0x5a},  /* 2004 */
+    {0x5a,0x45,0x55,0x51,0x51,0x15}, {0x15,0x45,0x55,0x55,0x55,0x55}, {0x55,0x5a,0x65,0x55,0x56,0x55}, {0x56,0x5a,0xa6,0x65,0x96,0x5a},  /* 2008 */
+    {0x5a,0x45,0x51,0x51,0x51,0x15}, {0x15,0x45,0x55,0x51,0x55,0x55}, {0x55,0x5a,0x65,0x55,0x56,0x55}, {0x56,0x5a,0xa6,0x65,0x96,0x56},  /* 2012 */
+    {0x56,0x05,0x51,0x51,0x51,0x15}, {0x05,0x45,0x55,0x51,0x55,0x55}, {0x55,0x59,0x65,0x55,0x56,0x55}, {0x55,0x5a,0x66,0x65,0x96,0x56},  /* 2016 */
+    {0x56,0x05,0x51,0x10,0x51,0x15}, {0x05,0x45,0x55,0x51,0x55,0x15}, {0x55,0x55,0x65,0x55,0x55,0x55}, {0x55,0x5a,0x66,0x65,0x96,0x56},  /* 2020 */
+    {0x56,0x05,0x51,0x10,0x51,0x05}, {0x05,0x45,0x55,0x51,0x55,0x15}, {0x15,0x55,0x55,0x55,0x55,0x55}, {0x55,0x5a,0x66,0x65,0x56,0x55},  /* 2024 */
+    {0x56,0x05,0x51,0x10,0x51,0x05}, {0x05,0x45,0x55,0x51,0x55,0x15}, {0x15,0x55,0x55,0x55,0x55,0x55}, {0x55,0x5a,0x66,0x65,0x56,0x55},  /* 2028 */
+    {0x56,0x05,0x51,0x10,0x51,0x05}, {0x05,0x45,0x55,0x51,0x55,0x15}, {0x15,0x55,0x55,0x55,0x55,0x55}, {0x55,0x5a,0x65,0x55,0x56,0x55},  /* 2032 */
+    {0x56,0x05,0x51,0x10,0x51,0x05}, {0x05,0x45,0x55,0x51,0x55,0x15}, {0x15,0x55,0x55,0x55,0x55,0x55}, {0x55,0x5a,0x65,0x55,0x56,0x55},  /* 2036 */
+    {0x56,0x05,0x51,0x10,0x51,0x05}, {0x05,0x45,0x51,0x51,0x51,0x15}, {0x15,0x45,0x55,0x55,0x55,0x55}, {0x55,0x5a,0x65,0x55,0x56,0x55},  /* 2040 */
+    {0x56,0x05,0x51,0x10,0x41,0x05}, {0x05,0x05,0x51,0x51,0x51,0x15}, {0x15,0x45,0x55,0x51,0x55,0x55}, {0x55,0x5a,0x65,0x55,0x56,0x55},  /* 2044 */
+    {0x56,0x05,0x11,0x10,0x41,0x01}, {0x01,0x05,0x51,0x10,0x51,0x15}, {0x05,0x45,0x55,0x51,0x55,0x55}, {0x55,0x55,0x65,0x55,0x55,0x55},  /* 2048 */
+    {0x55,0x05,0x11,0x10,0x41,0x01}, {0x01,0x05,0x51,0x10,0x51,0x15}, {0x05,0x45,0x55,0x51,0x55,0x55}, {0x55,0x55,0x55,0x55,0x55,0x55},  /* 2052 */
+    {0x55,0x05,0x11,0x10,0x41,0x01}, {0x01,0x05,0x51,0x10,0x51,0x05}, {0x05,0x45,0x55,0x51,0x55,0x15}, {0x55,0x55,0x55,0x55,0x55,0x55},  /* 2056 */
+    {0x55,0x05,0x11,0x10,0x01,0x00}, {0x01,0x05,0x51,0x10,0x51,0x05}, {0x05,0x45,0x55,0x51,0x55,0x15}, {0x15,0x55,0x55,0x55,0x55,0x55},  /* 2060 */
+    {0x55,0x05,0x11,0x10,0x01,0x00}, {0x01,0x05,0x51,0x10,0x51,0x05}, {0x05,0x45,0x55,0x51,0x55,0x15}, {0x15,0x55,0x55,0x55,0x55,0x55},  /* 2064 */
+    {0x55,0x05,0x10,0x00,0x01,0x00}, {0x01,0x05,0x51,0x10,0x51,0x05}, {0x05,0x45,0x51,0x51,0x51,0x15}, {0x15,0x55,0x55,0x55,0x55,0x55},  /* 2068 */
+    {0x55,0x05,0x10,0x00,0x01,0x00}, {0x01,0x05,0x51,0x10,0x41,0x05}, {0x05,0x45,0x51,0x51,0x51,0x15}, {0x15,0x45,0x55,0x51,0x55,0x55},  /* 2072 */
+    {0x55,0x05,0x10,0x00,0x01,0x00}, {0x01,0x05,0x51,0x10,0x41,0x05}, {0x05,0x05,0x51,0x50,0x51,0x15}, {0x15,0x45,0x55,0x51,0x55,0x55},  /* 2076 */
+    {0x55,0x05,0x10,0x00,0x01,0x00}, {0x01,0x05,0x11,0x10,0x41,0x01}, {0x05,0x05,0x51,0x10,0x51,0x15}, {0x05,0x45,0x55,0x51,0x55,0x55},  /* 2080 */
+    {0x55,0x00,0x10,0x00,0x00,0x00}, {0x00,0x05,0x11,0x10,0x41,0x01}, {0x01,0x05,0x51,0x10,0x51,0x15}, {0x05,0x45,0x55,0x51,0x55,0x55},  /* 2084 */
+    {0x55,0x00,0x00,0x00,0x00,0x00}, {0x00,0x05,0x11,0x10,0x41,0x01}, {0x01,0x05,0x51,0x10,0x51,0x05}, {0x05,0x45,0x55,0x51,0x55,0x15},  /* 2088 */
+    {0x55,0x00,0x00,0x00,0x00,0x00}, {0x00,0x05,0x11,0x10,0x01,0x00}, {0x01,0x05,0x51,0x10,0x51,0x05}, {0x05,0x45,0x55,0x51,0x55,0x15},  /* 2092 */
+    {0x15,0x00,0x00,0x00,0x00,0x00}, {0x00,0x05,0x11,0x00,0x01,0x00}, {0x01,0x05,0x51,0x10,0x51,0x05}, {0x05,0x45,0x55,0x51,0x55,0x15},  /* 2096 */
+    {0x15,0x55,0x55,0x55,0x55,0x55},  /* 2100 */
+};
+
+#endif
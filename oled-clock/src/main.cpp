@@ -1,10 +1,8 @@
 /**
  * @file main.cpp
- * @brief ESP32 + SH1106 OLED：主入口，智能配网 / WiFi / NTP / 按键与状态机
+ * @brief ESP32 + SH1106 OLED：主入口，开机流程（后台联网 / NTP）、按键与状态机
  */
 #include <Arduino.h>
-#include <WiFi.h>
-#include <WiFiManager.h>
 #include <time.h>
 
 #include "buttons.h"
@@ -17,215 +15,340 @@
 #include "timer_screen.h"
 #include "stopwatch_screen.h"
 #include "web_config.h"
+#include "live_view.h"
+#include "metrics.h"
+#include "net_service.h"
+#include "time_persist.h"
+#include "sntp_service.h"
+#include "time_service.h"
+#include "timer_engine.h"
+#include "buzzer.h"
+#include "alarm_service.h"
+#include "alarm_screen.h"
+#include "sleep_clock.h"
+#include "power_service.h"
+#include "power_governor.h"
+#include "config_store.h"
+#include "log_service.h"
+#include "energy_service.h"
+#include "heap_monitor.h"
+#include "stall_watch.h"
 
-#define BUZZER_PIN  23
-#define TIMER_LEDC_CHANNEL  0
 #define BATTERY_ADC_PIN     34
 
-static void delayWithButtonPoll(uint32_t totalMs) {
-    const uint32_t stepMs = 14;
-    int steps = (int)(totalMs / stepMs);
-    if (steps < 1) steps = 1;
-    for (int i = 0; i < steps; i++) {
-        buttonsUpdate();
-        delay(stepMs);
-    }
+/* 倒计时到时（esp_timer 任务）：立即响铃，下一帧切到倒计时页并选中该路 */
+static volatile int s_timerFiredSlot = -1;
+
+static void onTimerFired(int slot) {
+    buzzerAlarm(BUZZER_ALARM_MS);
+    s_timerFiredSlot = slot;
 }
 
-void setup() {
-    Serial.begin(115200);
-    delay(300);
+/* 联网后（在 loop 任务中）启动 Web 配置与画面镜像，只执行一次 */
+static bool s_webStarted = false;
 
-    displayInit();
-    displayBootScreen(true, true, u8"正在连接 WiFi", u8"请稍候...");
+static void startWebWhenOnline(void) {
+    if (s_webStarted || !netServiceIsConnected()) return;
+    webConfigBegin();
+    liveViewBegin();
+    s_webStarted = true;
+    IPAddress ip = netServiceLocalIp();
+    LOG_I("Web 配置: http://%u.%u.%u.%u/", ip[0], ip[1], ip[2], ip[3]);
+}
 
-    WiFiManager wm;
-    wm.setConfigPortalTimeout(120);   // 配网页超时 2 分钟
-    wm.setConnectTimeout(30);         // 连接路由器超时 30 秒
-    wm.setMinimumSignalQuality(10);   // 信号强度至少 10%
-    // 若已有保存的 WiFi 则自动连接；否则或连接失败则启动配网 AP「OLEDClock」
-    bool connected = wm.autoConnect("OLEDClock");
-    if (!connected) {
-        displayBootScreen(true, false, u8"WiFi 连接失败", u8"请用手机连 OLEDClock 配网");
-        Serial.println("WiFi: connect failed, restart to reconfigure");
-        for (;;) delay(1000);
-    }
+/* 日历页跳到本月（本地时间未知时保持不变） */
+static void calendarShowToday(void) {
+    struct tm t;
+    if (!timeServiceNow(&t)) return;
+    CalendarState cal = { t.tm_year + 1900, t.tm_mon + 1 };
+    g_calendar.publish(cal);
+}
 
-    webConfigBegin();
-    Serial.print("Web 配置: http://");
-    Serial.println(WiFi.localIP());
+/*
+ * 开机顺序：深睡时钟的定时唤醒最先处理（更新屏幕后直接再睡）；否则显示、按键、本地时间源先就绪，立即进入主菜单；
+ * WiFi（含配网）在后台任务中进行，SNTP 服务联网后自动对时，界面上的图标随之更新。
+ */
+void setup() {
+    sleepClockOnBoot();
+    Serial.begin(115200);
+    metricsInit();
+    logServiceBegin();
+    powerServiceBegin();
 
-    clockScreenSyncNtp(displayNtpBootScreen, 20, 80);
-    g_ntpSynced = true;
+    displayInit();
+    configStoreBegin();
+    webConfigLoad();
+    timePersistRestore();
+    sntpServiceBegin();
 
     analogReadResolution(12);
     analogSetAttenuation(ADC_11db);
     pinMode(BATTERY_ADC_PIN, INPUT);
-    pinMode(BUZZER_PIN, OUTPUT);
-    ledcAttachPin(BUZZER_PIN, TIMER_LEDC_CHANNEL);
-
+    powerGovernorBegin();
+    buzzerBegin();
+    timerEngineBegin(onTimerFired);
+    alarmServiceBegin();
+    sleepClockHandleExit();
     buttonsInit();
-    Serial.println("WiFi & NTP OK");
+
+    menuScreenDraw();
+    metricsBootMark(BOOT_FIRST_FRAME);
+    netServiceBegin();
+    metricsBootMark(BOOT_INTERACTIVE);
+    LOG_I("Boot: interactive after %lums", (unsigned long)millis());
+    stallWatchBegin();
 }
 
-void loop() {
-    webConfigHandleClient();
-    buttonsUpdate();
+/* 处理一帧：按键、状态机、绘制；返回到下一帧前需等待的毫秒数 */
+static uint32_t runFrame(void) {
+    stallWatchStage(STALL_TIME);
+    timeServiceTick();
+    stallWatchStage(STALL_HTTP);
+    startWebWhenOnline();
+    if (s_webStarted) {
+        METRICS_SCOPE(MET_HTTP);
+        webConfigHandleClient();
+    }
+    stallWatchStage(STALL_INPUT);
+    {
+        METRICS_SCOPE(MET_BUTTONS);
+        buttonsUpdate();
+    }
 
     ButtonEvent left   = buttonsGetLeft();
     ButtonEvent center = buttonsGetCenter();
     ButtonEvent right  = buttonsGetRight();
+    if (left != BTN_NONE || center != BTN_NONE || right != BTN_NONE) {
+        powerGovernorNoteInput();
+        LOG_D("Buttons: L%d C%d R%d state %d", left, center, right, g_state);
+    }
+
+    int fired = s_timerFiredSlot;
+    if (fired >= 0) {
+        s_timerFiredSlot = -1;
+        g_state = STATE_TIMER;
+        SeqWrite<TimerPageState> tp(g_timerPage);
+        tp->sel = fired;
+        tp->editing = false;
+    }
+    int alarm = alarmServiceTakeFired();
+    if (alarm >= 0) {
+        g_state = STATE_ALARM;
+        g_alarmSel = alarm;
+        alarmScreenEnter();
+    }
+
+    /* 响铃时任意键只用于确认（停止蜂鸣并复位已到时的倒计时） */
+    if (buzzerIsActive() && (left != BTN_NONE || center != BTN_NONE || right != BTN_NONE)) {
+        buzzerStop();
+        timerEngineDismissRinging();
+        left = center = right = BTN_NONE;
+    }
 
     if (g_state == STATE_MENU) {
+        /* 长按中键：打开射频并保持一段时间，关射频策略下用来访问 Web 配置页 */
+        if (center == BTN_LONG_PRESS) {
+            netServiceWake();
+            LOG_I("WiFi: woken from menu");
+        }
         if (left == BTN_CLICK || left == BTN_DOUBLE_CLICK) {
-            g_menuIndex = (g_menuIndex + 4) % 5;
+            g_menuIndex = (g_menuIndex + MENU_ITEM_COUNT - 1) % MENU_ITEM_COUNT;
         }
         if (right == BTN_CLICK || right == BTN_DOUBLE_CLICK) {
-            g_menuIndex = (g_menuIndex + 1) % 5;
+            g_menuIndex = (g_menuIndex + 1) % MENU_ITEM_COUNT;
         }
         if (center == BTN_CLICK || center == BTN_DOUBLE_CLICK) {
             switch (g_menuIndex) {
                 case 0: g_state = STATE_CLOCK;    break;
-                case 1: {
+                case 1:
                     g_state = STATE_CALENDAR;
-                    struct tm t;
-                    if (getLocalTime(&t)) {
-                        g_calYear = t.tm_year + 1900;
-                        g_calMonth = t.tm_mon + 1;
-                    }
+                    calendarShowToday();
                     break;
-                }
                 case 2: g_state = STATE_WEATHER;  break;
-                case 3:
+                case 3: {
                     g_state = STATE_TIMER;
-                    g_timerRunning = false;
-                    g_timerDigitPos = 0;
+                    SeqWrite<TimerPageState> tp(g_timerPage);
+                    tp->editing = false;
                     break;
+                }
                 case 4: g_state = STATE_STOPWATCH; break;
+                case 5:
+                    g_state = STATE_ALARM;
+                    alarmScreenEnter();
+                    break;
             }
             if (g_state != STATE_MENU) {
-                delayWithButtonPoll(80);
-                return;
+                return 80;
             }
         }
         menuScreenDraw();
-        delayWithButtonPoll(80);
-        return;
+        return 80;
     }
 
     if (center == BTN_LONG_PRESS) {
         g_state = STATE_MENU;
         menuScreenDraw();
-        delayWithButtonPoll(80);
-        return;
+        return 80;
+    }
+
+    if (g_state == STATE_CLOCK && (right == BTN_CLICK || right == BTN_DOUBLE_CLICK)) {
+        clockScreenToggleDetail();
+    }
+    if (g_state == STATE_CLOCK && left == BTN_DOUBLE_CLICK) {
+        if (!sleepClockEnter())
+            LOG_I("Sleep clock: not entered (countdown / stopwatch running or time unset)");
     }
 
     if (g_state == STATE_CALENDAR) {
-        if (left == BTN_CLICK || left == BTN_DOUBLE_CLICK) {
-            g_calMonth--;
-            if (g_calMonth < 1) { g_calMonth = 12; g_calYear--; }
-        }
-        if (right == BTN_CLICK || right == BTN_DOUBLE_CLICK) {
-            g_calMonth++;
-            if (g_calMonth > 12) { g_calMonth = 1; g_calYear++; }
+        if (left == BTN_CLICK || left == BTN_DOUBLE_CLICK || right == BTN_CLICK || right == BTN_DOUBLE_CLICK) {
+            SeqWrite<CalendarState> cal(g_calendar);
+            if (left == BTN_CLICK || left == BTN_DOUBLE_CLICK) {
+                cal->month--;
+                if (cal->month < 1) { cal->month = 12; cal->year--; }
+            }
+            if (right == BTN_CLICK || right == BTN_DOUBLE_CLICK) {
+                cal->month++;
+                if (cal->month > 12) { cal->month = 1; cal->year++; }
+            }
         }
         if (center == BTN_DOUBLE_CLICK) {
-            struct tm t;
-            if (getLocalTime(&t)) {
-                g_calYear = t.tm_year + 1900;
-                g_calMonth = t.tm_mon + 1;
-            }
+            calendarShowToday();
         }
     }
 
-    if (g_state == STATE_STOPWATCH) {
+    /* 秒表：开始 / 暂停 / 记圈都用按键中断记下的按下时刻，不受轮询与绘制延迟影响 */
+    if (g_state == STATE_STOPWATCH && (left != BTN_NONE || center != BTN_NONE || right != BTN_NONE)) {
+        SeqWrite<StopwatchState> sw(g_stopwatch);
         if (center == BTN_DOUBLE_CLICK) {
-            g_stopwatchAccumulatedMs = 0;
-            g_stopwatchRunStartMillis = 0;
+            stopwatchCoreReset(&sw->core);
         } else if (center == BTN_CLICK) {
-            if (g_stopwatchRunStartMillis != 0) {
-                g_stopwatchAccumulatedMs += (uint32_t)(millis() - g_stopwatchRunStartMillis);
-                g_stopwatchRunStartMillis = 0;
-            } else {
-                g_stopwatchRunStartMillis = millis();
-            }
+            if (!stopwatchCoreStop(&sw->core, buttonsCenterPressUs()))
+                stopwatchCoreStart(&sw->core, buttonsCenterPressUs());
+        }
+        if (right == BTN_CLICK || right == BTN_DOUBLE_CLICK) {
+            stopwatchCoreLap(&sw->core, buttonsRightPressUs());
+        }
+        if (left == BTN_CLICK || left == BTN_DOUBLE_CLICK) {
+            sw->showLaps = !sw->showLaps;
         }
     }
 
-    if (g_state == STATE_TIMER) {
-        if (g_timerRunning) {
-            if (millis() >= g_timerEndMillis) {
-                g_timerRunning = false;
-                timerScreenPlayBeep();
-            }
-        } else {
+    TimerPageState tp = g_timerPage.get();
+    if (g_state == STATE_TIMER && tp.editing) {
+        if (left == BTN_CLICK || left == BTN_DOUBLE_CLICK || right == BTN_CLICK || right == BTN_DOUBLE_CLICK ||
+            center == BTN_CLICK) {
+            SeqWrite<TimerPageState> edit(g_timerPage);
             if (left == BTN_CLICK || left == BTN_DOUBLE_CLICK) {
-                g_timerDigitPos = (g_timerDigitPos + 3) % 4;
+                edit->digitPos = (edit->digitPos + 3) % 4;
             }
             if (right == BTN_CLICK || right == BTN_DOUBLE_CLICK) {
-                g_timerDigitPos = (g_timerDigitPos + 1) % 4;
+                edit->digitPos = (edit->digitPos + 1) % 4;
             }
             if (center == BTN_CLICK) {
-                g_timerDigits[g_timerDigitPos] = (g_timerDigits[g_timerDigitPos] + 1) % 10;
+                edit->digits[edit->digitPos] = (edit->digits[edit->digitPos] + 1) % 10;
             }
-            if (center == BTN_DOUBLE_CLICK) {
-                uint32_t totalSec = (g_timerDigits[0] * 10U + g_timerDigits[1]) * 60U
-                    + (g_timerDigits[2] * 10U + g_timerDigits[3]);
-                if (totalSec > 0) {
-                    g_timerEndMillis = millis() + totalSec * 1000;
-                    g_timerRunning = true;
-                }
+        }
+        if (center == BTN_DOUBLE_CLICK) {
+            timerScreenCommitEdit();
+        }
+    } else if (g_state == STATE_TIMER) {
+        int sel = tp.sel;
+        if (left == BTN_CLICK || left == BTN_DOUBLE_CLICK) {
+            sel = (sel + TIMER_SLOTS - 1) % TIMER_SLOTS;
+        }
+        if (right == BTN_CLICK || right == BTN_DOUBLE_CLICK) {
+            sel = (sel + 1) % TIMER_SLOTS;
+        }
+        if (sel != tp.sel) {
+            SeqWrite<TimerPageState> page(g_timerPage);
+            page->sel = sel;
+        }
+        if (center == BTN_CLICK || center == BTN_DOUBLE_CLICK) {
+            TimerView v;
+            timerEngineGet(sel, &v);
+            if (v.state == TIMER_RINGING) {
+                timerEngineCancel(sel);
+            } else if (center == BTN_DOUBLE_CLICK) {
+                /* 双击：运行 / 暂停中则取消，空闲则编辑时长 */
+                if (v.state == TIMER_IDLE) timerScreenBeginEdit();
+                else timerEngineCancel(sel);
+            } else if (v.state == TIMER_RUNNING) {
+                timerEnginePause(sel);
+            } else if (v.state == TIMER_PAUSED) {
+                timerEngineResume(sel);
+            } else if (!timerEngineStart(sel)) {
+                timerScreenBeginEdit();     /* 时长为 0 */
             }
         }
     }
 
+    if (g_state == STATE_ALARM) {
+        alarmScreenHandleButtons(left, center, right);
+    }
+
+    /* 拉取天气单独成段，不计入 draw_weather 的绘制耗时 */
+    if (g_state == STATE_WEATHER) weatherScreenRefresh();
+
+    stallWatchStage(STALL_DRAW);
     switch (g_state) {
         case STATE_CLOCK:
-            if (!g_ntpSynced) {
-                if (!clockScreenSyncNtp(displayNtpBootScreen, 20, 80))
-                    Serial.println("NTP sync failed");
-                g_ntpSynced = true;
-            }
             clockScreenDraw();
-            delayWithButtonPoll(100);
-            break;
+            return 100;
         case STATE_CALENDAR: {
-            if (!g_ntpSynced) {
-                if (!clockScreenSyncNtp(displayNtpBootScreen, 20, 80))
-                    Serial.println("NTP sync failed");
-                g_ntpSynced = true;
-                struct tm t;
-                if (getLocalTime(&t)) {
-                    g_calYear = t.tm_year + 1900;
-                    g_calMonth = t.tm_mon + 1;
-                }
-            }
             struct tm t;
             int ty = 2026, tmon = 1, td = 1;
-            if (getLocalTime(&t)) {
+            if (timeServiceNow(&t)) {
                 ty = t.tm_year + 1900;
                 tmon = t.tm_mon + 1;
                 td = t.tm_mday;
             }
             calendarScreenDraw(ty, tmon, td);
-            delayWithButtonPoll(80);
-            break;
+            return 80;
         }
         case STATE_WEATHER:
             weatherScreenDraw();
-            delayWithButtonPoll(200);
-            break;
+            return 200;
         case STATE_TIMER:
             timerScreenDraw();
-            delayWithButtonPoll(g_timerRunning ? 50 : 80);
-            break;
+            return timerEngineRunningCount() > 0 ? 50 : 80;
         case STATE_STOPWATCH:
             stopwatchScreenDraw();
-            delayWithButtonPoll(50);
-            break;
+            return 50;
+        case STATE_ALARM:
+            alarmScreenDraw();
+            return 80;
         default:
             g_state = STATE_MENU;
-            delayWithButtonPoll(80);
-            break;
+            return 80;
+    }
+}
+
+/* 每段工作前标记阶段，卡顿监测据此归因；帧间等待标为 STALL_IDLE，不算卡顿 */
+void loop() {
+    stallWatchBeat();
+    uint32_t waitMs;
+    {
+        METRICS_SCOPE(MET_FRAME);
+        waitMs = runFrame();
     }
+    stallWatchStage(STALL_METRICS);
+    metricsService();
+    stallWatchStage(STALL_ENERGY);
+    energyServiceLoop();
+    stallWatchStage(STALL_HEAP);
+    heapMonitorLoop();
+    stallWatchStage(STALL_CONFIG);
+    configStoreLoop();
+    stallWatchStage(STALL_TIME_PERSIST);
+    timePersistService();
+    stallWatchStage(STALL_SNTP);
+    sntpServiceLoop();
+    stallWatchStage(STALL_ALARM);
+    alarmServiceLoop();
+    stallWatchStage(STALL_POWER);
+    powerGovernorLoop();
+    stallWatchStage(STALL_NET);
+    netServiceLoop();
+    stallWatchStage(STALL_IDLE);
+    powerServiceIdle(powerGovernorFrameMs(waitMs));
 }
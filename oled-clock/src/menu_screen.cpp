@@ -5,23 +5,26 @@
 #include "menu_screen.h"
 #include "display.h"
 #include "app_state.h"
-#include <WiFi.h>
+#include "metrics.h"
+#include "net_service.h"
 
 #define OI_APP_CLOCK     (64 + 5)
 #define OI_APP_CALENDAR  (64 + 2)
 #define OI_APP_TIMER     (64 + 8)
 #define OI_WEATHER_SUN   (64 + 5)
 #define OI_APP_STOPWATCH (64 + 7)
+#define OI_EMBEDDED_BELL (64 + 1)
 
 static const char* const MENU_ITEMS[] = {
-    u8"时钟", u8"日历", u8"天气", u8"计时", u8"秒表"
+    u8"时钟", u8"日历", u8"天气", u8"计时", u8"秒表", u8"闹钟"
 };
 
 void menuScreenDraw(void) {
+    METRICS_SCOPE(MET_DRAW_MENU);
     u8g2.clearBuffer();
     displayTopBarBackground();
-    displayWiFiIcon(WIFI_ICON_X, WIFI_ICON_Y, WiFi.status() == WL_CONNECTED);
-    displayBatteryIcon(BATTERY_ICON_X, BATTERY_ICON_Y, displayGetBatteryPercent());
+    displayWiFiIcon(WIFI_ICON_X, WIFI_ICON_Y, netServiceIsConnected());
+    displayPowerStatus();
     u8g2.setFont(u8g2_font_wqy12_t_gb2312);
     const char* menuTitle = u8"功能选择";
     int tw = u8g2.getUTF8Width(menuTitle);
@@ -67,9 +70,9 @@ void menuScreenDraw(void) {
                       rightTipX - arrowW, arrowCy + arrowHalfH);
 
     int indices[3] = {
-        (g_menuIndex + 4) % 5,
+        (g_menuIndex + MENU_ITEM_COUNT - 1) % MENU_ITEM_COUNT,
         g_menuIndex,
-        (g_menuIndex + 1) % 5
+        (g_menuIndex + 1) % MENU_ITEM_COUNT
     };
 
     for (int i = 0; i < 3; i++) {
@@ -104,6 +107,10 @@ void menuScreenDraw(void) {
                 u8g2.setFont(u8g2_font_open_iconic_app_2x_t);
                 u8g2.drawGlyph(iconX, iconBaseY, OI_APP_STOPWATCH);
                 break;
+            case 5:
+                u8g2.setFont(u8g2_font_open_iconic_embedded_2x_t);
+                u8g2.drawGlyph(iconX, iconBaseY, OI_EMBEDDED_BELL);
+                break;
         }
         u8g2.setBitmapMode(0);
 
@@ -113,5 +120,5 @@ void menuScreenDraw(void) {
             u8g2.setDrawColor(1);
     }
 
-    u8g2.sendBuffer();
+    displaySendBuffer();
 }
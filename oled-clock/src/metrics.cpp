@@ -0,0 +1,226 @@
+/**
+ * @file metrics.cpp
+ * @brief 分阶段延迟直方图、堆与任务栈量表、Prometheus / 串口输出
+ *
+ * 计时用 CPU 周期计数（32 位，240MHz 下约 17 秒回绕，单次计时不应超过此值）。
+ */
+#include "metrics.h"
+#include "energy_service.h"
+#include "heap_monitor.h"
+#include "log_service.h"
+#include <esp_heap_caps.h>
+
+#define METRICS_BUCKETS        12
+#define METRICS_MAX_TASKS      6
+#define METRICS_SERIAL_DUMP_MS (5 * 60 * 1000)
+#define METRICS_CALIB_ROUNDS   256
+
+static const char* const STAGE_NAMES[MET_STAGE_COUNT] = {
+    "frame", "buttons", "battery",
+    "draw_menu", "draw_clock", "draw_calendar", "draw_weather", "draw_timer", "draw_stopwatch", "draw_alarm",
+    "send_buffer", "http", "weather_fetch"
+};
+
+static const char* const BOOT_MARK_NAMES[BOOT_MARK_COUNT] = {
+    "first_frame", "interactive", "wifi", "time_sync"
+};
+
+/* 桶上界（微秒），最后还有一个 +Inf 桶 */
+static const uint32_t BUCKET_LE_US[METRICS_BUCKETS] = {
+    100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000, 1000000
+};
+
+struct StageHist {
+    uint32_t buckets[METRICS_BUCKETS + 1];
+    uint32_t count;
+    uint32_t maxUs;
+    uint64_t sumUs;
+};
+
+struct TaskEntry {
+    const char* name;
+    TaskHandle_t handle;
+};
+
+static StageHist s_hist[MET_STAGE_COUNT];
+static TaskEntry s_tasks[METRICS_MAX_TASKS];
+static int s_taskCount = 0;
+/*
+ * 周期换算微秒用的主频，只在 metricsInit 读一次（此时还未启用调频，即启动主频），
+ * 换算只在主频固定时成立：所有 METRICS_SCOPE 都在主循环一帧之内，powerServiceBegin
+ * 起到 powerServiceIdle 之前持有忙锁（ESP_PM_CPU_FREQ_MAX，POWER_MAX_MHZ）。
+ * 在忙锁之外计时，调频降到 POWER_MIN_MHZ 时得出的微秒数会偏小
+ */
+static uint32_t s_cpuMhz = 240;
+static uint32_t s_scopeCostCycles = 0;   /* 一次作用域计时自身的开销 */
+static uint32_t s_scopeCount = 0;        /* 自上电起记录的作用域次数（不含 frame） */
+static uint64_t s_frameCycles = 0;       /* 所有帧工作时间之和 */
+static uint32_t s_lastDumpMs = 0;
+static uint32_t s_bootMs[BOOT_MARK_COUNT];
+
+static inline void histAdd(StageHist* h, uint32_t us) {
+    int b = 0;
+    while (b < METRICS_BUCKETS && us > BUCKET_LE_US[b]) b++;
+    h->buckets[b]++;
+    h->count++;
+    h->sumUs += us;
+    if (us > h->maxUs) h->maxUs = us;
+}
+
+/* 不内联：calibrate 与其他文件中的 METRICS_SCOPE 走同样的函数调用 */
+__attribute__((noinline)) void metricsRecord(MetricStage stage, uint32_t cycles) {
+    histAdd(&s_hist[stage], cycles / s_cpuMhz);
+    if (stage == MET_FRAME)
+        s_frameCycles += cycles;
+    else
+        s_scopeCount++;
+}
+
+/*
+ * 测出一次完整 METRICS_SCOPE 的平均开销：构造时读周期计数，析构时再读一次并调用
+ * metricsRecord（除法、分桶、计数）。记到真实阶段里，由 metricsInit 随后清零；
+ * 循环本身的几个周期也算在内，宁可高估
+ */
+static void calibrate(void) {
+    uint32_t t0 = ESP.getCycleCount();
+    for (int i = 0; i < METRICS_CALIB_ROUNDS; i++) {
+        METRICS_SCOPE(MET_BUTTONS);
+    }
+    s_scopeCostCycles = (ESP.getCycleCount() - t0) / METRICS_CALIB_ROUNDS;
+}
+
+void metricsInit(void) {
+    s_cpuMhz = ESP.getCpuFreqMHz();
+    if (s_cpuMhz == 0) s_cpuMhz = 240;
+    calibrate();
+    memset(s_hist, 0, sizeof(s_hist));
+    s_scopeCount = 0;
+    metricsRegisterTask("loop", xTaskGetCurrentTaskHandle());
+}
+
+void metricsBootMark(BootMark mark) {
+    if (s_bootMs[mark] == 0)
+        s_bootMs[mark] = millis();
+}
+
+void metricsRegisterTask(const char* name, TaskHandle_t task) {
+    if (s_taskCount >= METRICS_MAX_TASKS || !task) return;
+    s_tasks[s_taskCount].name = name;
+    s_tasks[s_taskCount].handle = task;
+    s_taskCount++;
+}
+
+/* 计量自身开销占帧工作时间的比例（作用域次数 × 单次开销 / 帧周期总和），目标低于 1% */
+static float overheadRatio(void) {
+    if (s_frameCycles == 0) return 0.0f;
+    return (float)((double)s_scopeCount * s_scopeCostCycles / (double)s_frameCycles);
+}
+
+void metricsWritePrometheus(Print& out) {
+    out.print("# HELP oled_stage_latency_us Stage latency in microseconds\n"
+              "# TYPE oled_stage_latency_us histogram\n");
+    for (int s = 0; s < MET_STAGE_COUNT; s++) {
+        const StageHist* h = &s_hist[s];
+        uint32_t cum = 0;
+        for (int b = 0; b < METRICS_BUCKETS; b++) {
+            cum += h->buckets[b];
+            out.printf("oled_stage_latency_us_bucket{stage=\"%s\",le=\"%lu\"} %lu\n",
+                       STAGE_NAMES[s], (unsigned long)BUCKET_LE_US[b], (unsigned long)cum);
+        }
+        out.printf("oled_stage_latency_us_bucket{stage=\"%s\",le=\"+Inf\"} %lu\n",
+                   STAGE_NAMES[s], (unsigned long)h->count);
+        out.printf("oled_stage_latency_us_sum{stage=\"%s\"} %llu\n",
+                   STAGE_NAMES[s], (unsigned long long)h->sumUs);
+        out.printf("oled_stage_latency_us_count{stage=\"%s\"} %lu\n",
+                   STAGE_NAMES[s], (unsigned long)h->count);
+    }
+    out.print("# TYPE oled_stage_latency_max_us gauge\n");
+    for (int s = 0; s < MET_STAGE_COUNT; s++)
+        out.printf("oled_stage_latency_max_us{stage=\"%s\"} %lu\n",
+                   STAGE_NAMES[s], (unsigned long)s_hist[s].maxUs);
+
+    out.printf("# TYPE oled_heap_free_bytes gauge\noled_heap_free_bytes %lu\n",
+               (unsigned long)ESP.getFreeHeap());
+    out.printf("# TYPE oled_heap_min_free_bytes gauge\noled_heap_min_free_bytes %lu\n",
+               (unsigned long)ESP.getMinFreeHeap());
+    out.printf("# TYPE oled_heap_largest_free_block_bytes gauge\noled_heap_largest_free_block_bytes %lu\n",
+               (unsigned long)heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
+    out.print("# TYPE oled_task_stack_high_water_bytes gauge\n");
+    for (int i = 0; i < s_taskCount; i++)
+        out.printf("oled_task_stack_high_water_bytes{task=\"%s\"} %lu\n",
+                   s_tasks[i].name, (unsigned long)uxTaskGetStackHighWaterMark(s_tasks[i].handle));
+    out.print("# TYPE oled_boot_milestone_ms gauge\n");
+    for (int i = 0; i < BOOT_MARK_COUNT; i++) {
+        if (s_bootMs[i] == 0) continue;
+        out.printf("oled_boot_milestone_ms{mark=\"%s\"} %lu\n", BOOT_MARK_NAMES[i], (unsigned long)s_bootMs[i]);
+    }
+    out.printf("# TYPE oled_instr_scope_cost_cycles gauge\noled_instr_scope_cost_cycles %lu\n",
+               (unsigned long)s_scopeCostCycles);
+    out.printf("# TYPE oled_instr_overhead_ratio gauge\noled_instr_overhead_ratio %.6f\n",
+               overheadRatio());
+    out.printf("# TYPE oled_uptime_seconds counter\noled_uptime_seconds %lu\n",
+               (unsigned long)(millis() / 1000));
+}
+
+void metricsDumpCompact(Print& out) {
+    out.printf("[metrics] up=%lus heap=%lu min=%lu blk=%lu minblk=%lu ovh=%.3f%%\n",
+               (unsigned long)(millis() / 1000),
+               (unsigned long)ESP.getFreeHeap(),
+               (unsigned long)ESP.getMinFreeHeap(),
+               (unsigned long)heap_caps_get_largest_free_block(MALLOC_CAP_8BIT),
+               (unsigned long)heapMonitorMinLargestBlock(),
+               overheadRatio() * 100.0f);
+    out.printf("  boot ms: frame=%lu interactive=%lu wifi=%lu time=%lu\n",
+               (unsigned long)s_bootMs[BOOT_FIRST_FRAME], (unsigned long)s_bootMs[BOOT_INTERACTIVE],
+               (unsigned long)s_bootMs[BOOT_WIFI], (unsigned long)s_bootMs[BOOT_TIME_SYNC]);
+    for (int s = 0; s < MET_STAGE_COUNT; s++) {
+        const StageHist* h = &s_hist[s];
+        if (h->count == 0) continue;
+        out.printf("  %-14s n=%-7lu avg=%-7lu max=%lu us\n", STAGE_NAMES[s],
+                   (unsigned long)h->count, (unsigned long)(h->sumUs / h->count),
+                   (unsigned long)h->maxUs);
+    }
+    for (int i = 0; i < s_taskCount; i++)
+        out.printf("  stack %-8s hwm=%lu B\n", s_tasks[i].name,
+                   (unsigned long)uxTaskGetStackHighWaterMark(s_tasks[i].handle));
+}
+
+/*
+ * 定时摘要只写一条日志记录，由取日志任务输出，loop 不等串口；完整摘要用串口命令 'm'。
+ * heap=当前/最低空闲，frame=平均/最长帧工作时间，整行不超过 LOG_LINE_MAX
+ */
+static void logSummary(void) {
+    const StageHist* f = &s_hist[MET_FRAME];
+    LOG_I("Metrics: heap=%lu/%lu minblk=%lu frame=%lu/%lu us ovh=%.3f%%",
+          (unsigned long)ESP.getFreeHeap(), (unsigned long)ESP.getMinFreeHeap(),
+          (unsigned long)heapMonitorMinLargestBlock(),
+          (unsigned long)(f->count ? f->sumUs / f->count : 0), (unsigned long)f->maxUs,
+          overheadRatio() * 100.0);
+}
+
+void metricsService(void) {
+    bool dump = false;
+    bool energy = false;
+    bool bench = false;
+    while (Serial.available() > 0) {
+        int c = Serial.read();
+        if (c == 'm') dump = true;
+        else if (c == 'e') energy = true;
+        else if (c == 'l') bench = true;
+        else if (c == 'd') {
+            logServiceSetLevel(logServiceLevel() == LOG_DEBUG ? LOG_INFO : LOG_DEBUG);
+            LOG_I("Log: debug %s", logServiceLevel() == LOG_DEBUG ? "on" : "off");
+        }
+    }
+    if (energy)
+        energyServiceDump(Serial);
+    if (bench)
+        logServiceBenchmark(Serial);
+    if (dump)
+        metricsDumpCompact(Serial);
+    uint32_t now = millis();
+    if ((uint32_t)(now - s_lastDumpMs) >= METRICS_SERIAL_DUMP_MS) {
+        s_lastDumpMs = now;
+        logSummary();
+    }
+}
@@ -0,0 +1,27 @@
+/**
+ * @file month_layout.cpp
+ * @brief 月历排版
+ */
+#include "month_layout.h"
+
+MonthLayout monthLayoutCompute(int year, int month) {
+    MonthLayout l;
+    l.year = (int16_t)year;
+    l.month = (int8_t)month;
+    l.firstWday = (int8_t)timeDayOfWeek(year, month, 1);
+    l.days = (int8_t)timeDaysInMonth(year, month);
+    l.rows = (int8_t)((l.firstWday + l.days + 6) / 7);
+    return l;
+}
+
+void monthLayoutCell(const MonthLayout* l, int day, int* row, int* col) {
+    int pos = l->firstWday + day - 1;
+    *row = pos / 7;
+    *col = pos % 7;
+}
+
+void monthLayoutStep(int* year, int* month, int delta) {
+    int m = *month - 1 + delta;
+    *year += (m < 0) ? -1 : m / 12;
+    *month = (m % 12 + 12) % 12 + 1;
+}
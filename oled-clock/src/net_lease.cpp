@@ -0,0 +1,146 @@
+/**
+ * @file net_lease.cpp
+ * @brief 联网租约状态机
+ */
+#include "net_lease.h"
+#include <string.h>
+
+void netLeaseInit(NetLeaseCore* c, NetPolicy policy, uint32_t tailMs, bool radioOn, int64_t nowUs) {
+    memset(c, 0, sizeof(*c));
+    c->policy = (uint8_t)policy;
+    c->tailMs = tailMs;
+    c->tailUntilUs = nowUs + (int64_t)tailMs * 1000;
+    if (radioOn) {
+        c->radio = NET_RADIO_CONNECTING;
+        c->radioOnSinceUs = nowUs;
+        c->radioOnCount = 1;
+    }
+}
+
+static NetAction radioOn(NetLeaseCore* c, int64_t nowUs) {
+    c->radio = NET_RADIO_CONNECTING;
+    c->connected = false;
+    c->deepSleep = false;
+    c->radioOnSinceUs = nowUs;
+    c->radioOnCount++;
+    return NET_ACT_RADIO_ON;
+}
+
+static NetAction radioOff(NetLeaseCore* c, int64_t nowUs) {
+    c->radioOnUs += (uint64_t)(nowUs - c->radioOnSinceUs);
+    c->radio = NET_RADIO_OFF;
+    c->connected = false;
+    c->deepSleep = false;
+    return NET_ACT_RADIO_OFF;
+}
+
+NetAction netLeaseAcquire(NetLeaseCore* c, NetJob job, uint32_t holdMs, int64_t nowUs) {
+    if (c->held[job] == 0) c->heldSinceUs[job] = nowUs;
+    c->held[job]++;
+    c->total++;
+    c->jobs[job].leases++;
+    if (holdMs > 0) {
+        int64_t expire = nowUs + (int64_t)holdMs * 1000;
+        if (expire > c->expireUs[job]) c->expireUs[job] = expire;
+    }
+    if (!c->connected && c->waitSinceUs[job] == 0) c->waitSinceUs[job] = nowUs;
+
+    if (c->radio == NET_RADIO_OFF) return radioOn(c, nowUs);
+    if (c->deepSleep) {
+        c->deepSleep = false;
+        return NET_ACT_SLEEP_LIGHT;
+    }
+    return NET_ACT_NONE;
+}
+
+static void dropJob(NetLeaseCore* c, NetJob job, int64_t nowUs) {
+    c->total = (uint8_t)(c->total - c->held[job]);
+    c->held[job] = 0;
+    c->jobs[job].heldUs += (uint64_t)(nowUs - c->heldSinceUs[job]);
+    c->waitSinceUs[job] = 0;
+    c->expireUs[job] = 0;
+    if (c->total == 0) c->tailUntilUs = nowUs + (int64_t)c->tailMs * 1000;
+}
+
+void netLeaseRelease(NetLeaseCore* c, NetJob job, int64_t nowUs) {
+    if (c->held[job] == 0) return;
+    if (c->held[job] == 1) {
+        dropJob(c, job, nowUs);
+        return;
+    }
+    c->held[job]--;
+    c->total--;
+}
+
+void netLeaseTouch(NetLeaseCore* c, int64_t nowUs) {
+    if (c->radio == NET_RADIO_OFF) return;
+    int64_t until = nowUs + (int64_t)c->tailMs * 1000;
+    if (until > c->tailUntilUs) c->tailUntilUs = until;
+}
+
+void netLeaseSetPolicy(NetLeaseCore* c, NetPolicy policy) {
+    c->policy = (uint8_t)policy;
+}
+
+NetAction netLeaseTick(NetLeaseCore* c, bool connected, int64_t nowUs) {
+    if (c->radio == NET_RADIO_OFF) connected = false;
+    if (connected && !c->connected) {
+        c->radio = NET_RADIO_UP;
+        for (int j = 0; j < NET_JOB_COUNT; j++) {
+            if (c->waitSinceUs[j] == 0) continue;
+            NetJobStats* s = &c->jobs[j];
+            uint32_t ms = (uint32_t)((nowUs - c->waitSinceUs[j]) / 1000);
+            s->waits++;
+            s->lastConnectMs = ms;
+            s->sumConnectMs += ms;
+            if (ms > s->maxConnectMs) s->maxConnectMs = ms;
+            c->waitSinceUs[j] = 0;
+        }
+    } else if (!connected && c->connected) {
+        /* 掉线：驱动会自动重连，持有租约的任务重新开始等 */
+        c->radio = NET_RADIO_CONNECTING;
+        for (int j = 0; j < NET_JOB_COUNT; j++)
+            if (c->held[j] > 0) c->waitSinceUs[j] = nowUs;
+    }
+    c->connected = connected;
+
+    for (int j = 0; j < NET_JOB_COUNT; j++) {
+        if (c->held[j] > 0 && c->expireUs[j] != 0 && nowUs >= c->expireUs[j]) {
+            c->jobs[j].expired++;
+            dropJob(c, (NetJob)j, nowUs);
+        }
+    }
+
+    switch (c->policy) {
+        case NET_POLICY_ALWAYS_ON:
+            if (c->radio == NET_RADIO_OFF) return radioOn(c, nowUs);
+            if (c->deepSleep) {
+                c->deepSleep = false;
+                return NET_ACT_SLEEP_LIGHT;
+            }
+            return NET_ACT_NONE;
+        case NET_POLICY_MODEM_SLEEP:
+            if (c->radio == NET_RADIO_OFF) return radioOn(c, nowUs);
+            if (c->total == 0 && c->connected && !c->deepSleep && nowUs >= c->tailUntilUs) {
+                c->deepSleep = true;
+                return NET_ACT_SLEEP_DEEP;
+            }
+            return NET_ACT_NONE;
+        default:
+            if (c->total == 0 && c->radio != NET_RADIO_OFF && nowUs >= c->tailUntilUs)
+                return radioOff(c, nowUs);
+            return NET_ACT_NONE;
+    }
+}
+
+uint64_t netLeaseRadioOnUs(const NetLeaseCore* c, int64_t nowUs) {
+    uint64_t us = c->radioOnUs;
+    if (c->radio != NET_RADIO_OFF) us += (uint64_t)(nowUs - c->radioOnSinceUs);
+    return us;
+}
+
+uint64_t netLeaseHeldUs(const NetLeaseCore* c, NetJob job, int64_t nowUs) {
+    uint64_t us = c->jobs[job].heldUs;
+    if (c->held[job] > 0) us += (uint64_t)(nowUs - c->heldSinceUs[job]);
+    return us;
+}
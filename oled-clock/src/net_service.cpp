@@ -0,0 +1,471 @@
+/**
+ * @file net_service.cpp
+ * @brief 后台联网与按需联网：开机连接 / 配网任务、租约状态机的驱动层
+ *
+ * 开机时后台任务持有 SETUP 租约连接：有上次连接的缓存（wifi_assoc）时先按 BSSID + 信道定向连接，
+ * 租约够新则同时复用上次的 DHCP 地址；NET_FAST_TIMEOUT_MS 内未拿到地址则清除缓存，退回
+ * WiFiManager（全信道扫描 + DHCP，失败则开放配网热点，超时后退避重试）。连上后释放租约，
+ * 之后射频由 net_lease 按策略在 loop 中开关，重新打开射频同样先走快速路径、超时后由 loop 退回。
+ *
+ * 连接状态与 IP 由 WiFi 事件回调缓存，界面每帧读取不再调用驱动；拿到地址后 loop 把
+ * BSSID / 信道 / 地址写回缓存。租约可在 loop 与联网任务中申请（portMUX 保护），驱动动作都在锁外执行。
+ */
+#include "net_service.h"
+#include "log_service.h"
+#include "metrics.h"
+#include "power_service.h"
+#include "wifi_assoc.h"
+#include <Arduino.h>
+#include <WiFi.h>
+#include <WiFiManager.h>
+#include <esp_timer.h>
+#include <esp_wifi.h>
+#include <sys/time.h>
+
+#define NET_TASK_STACK        8192
+#define NET_TASK_PRIO         1
+#define NET_TASK_CORE         0
+#define NET_RETRY_MIN_S       60
+#define NET_RETRY_MAX_S       (30 * 60)
+#define NET_FAST_POLL_MS      20
+
+static const char* const POLICY_NAMES[NET_POLICY_COUNT] = { "always_on", "modem_sleep", "radio_off" };
+static const char* const JOB_NAMES[NET_JOB_COUNT] = { "setup", "sntp", "weather", "web" };
+static const char* const PATH_NAMES[NET_PATH_COUNT] = { "fast", "slow" };
+
+/* 连接耗时统计；开机那一次另记，从联网任务开始算（含快速路径失败耗掉的时间） */
+struct NetConnectStats {
+    uint32_t fastOk;
+    uint32_t fastFail;
+    uint32_t slowOk;
+    uint32_t lastMs[NET_PATH_COUNT];
+    int8_t bootPath;                  /* -1 表示开机连接还没完成 */
+    uint32_t bootMs;
+};
+
+static portMUX_TYPE s_mux = portMUX_INITIALIZER_UNLOCKED;
+static NetLeaseCore s_core;
+static NetPolicy s_policy = NET_POLICY_MODEM_SLEEP;
+static NetPolicy s_policyFloor = NET_POLICY_ALWAYS_ON;
+
+/* 事件回调写、其余任务读 */
+static volatile bool s_connected = false;
+static volatile uint32_t s_ip = 0;
+
+/* 以下由 s_mux 保护 */
+static WifiAssoc s_assoc;
+static bool s_haveAssoc = false;
+static bool s_assocDirty = false;     /* 拿到新地址，待 loop 写回缓存 */
+static NetAction s_pendingAction = NET_ACT_NONE;   /* 租约申请产生的动作，待 loop 执行 */
+static uint32_t s_gotGateway = 0;
+static uint32_t s_gotNetmask = 0;
+static uint8_t s_gotBssid[6];
+static uint8_t s_gotChannel = 0;
+static bool s_staticIp = false;       /* 本次连接复用了缓存地址（不刷新租约时间） */
+static bool s_bssidLocked = false;    /* 驱动配置当前锁定在缓存的 BSSID 上 */
+static int8_t s_path = -1;            /* 当前连接尝试走的路径，-1 表示没有在计时 */
+static int64_t s_attemptUs = 0;
+static int64_t s_downSinceUs = 0;
+static int64_t s_bootStartUs = 0;
+static NetConnectStats s_stats = { 0, 0, 0, { 0, 0 }, -1, 0 };
+
+static wifi_config_t s_staCfg;        /* 未锁定 BSSID 的原始配置，慢速路径用它恢复 */
+static bool s_haveStaCfg = false;
+
+static void onWiFiEvent(WiFiEvent_t event, WiFiEventInfo_t info) {
+    int64_t now = esp_timer_get_time();
+    switch (event) {
+        case ARDUINO_EVENT_WIFI_STA_CONNECTED:
+            portENTER_CRITICAL(&s_mux);
+            memcpy(s_gotBssid, info.wifi_sta_connected.bssid, sizeof(s_gotBssid));
+            s_gotChannel = info.wifi_sta_connected.channel;
+            portEXIT_CRITICAL(&s_mux);
+            break;
+        case ARDUINO_EVENT_WIFI_STA_GOT_IP:
+            portENTER_CRITICAL(&s_mux);
+            s_gotGateway = info.got_ip.ip_info.gw.addr;
+            s_gotNetmask = info.got_ip.ip_info.netmask.addr;
+            s_assocDirty = true;
+            if (s_path >= 0) {
+                uint32_t ms = (uint32_t)((now - s_attemptUs) / 1000);
+                s_stats.lastMs[s_path] = ms;
+                if (s_path == NET_PATH_FAST) s_stats.fastOk++;
+                else s_stats.slowOk++;
+                if (s_stats.bootPath < 0) {
+                    s_stats.bootPath = s_path;
+                    s_stats.bootMs = (uint32_t)((now - s_bootStartUs) / 1000);
+                }
+                s_path = -1;
+            }
+            portEXIT_CRITICAL(&s_mux);
+            s_ip = info.got_ip.ip_info.ip.addr;
+            s_connected = true;
+            break;
+        case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
+        case ARDUINO_EVENT_WIFI_STA_LOST_IP:
+        case ARDUINO_EVENT_WIFI_STA_STOP:
+            if (s_connected) {
+                portENTER_CRITICAL(&s_mux);
+                s_downSinceUs = now;
+                portEXIT_CRITICAL(&s_mux);
+            }
+            s_connected = false;
+            s_ip = 0;
+            break;
+        default:
+            break;
+    }
+}
+
+static void startAttempt(NetConnectPath path) {
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&s_mux);
+    s_path = (int8_t)path;
+    s_attemptUs = now;
+    s_downSinceUs = now;
+    portEXIT_CRITICAL(&s_mux);
+}
+
+/*
+ * 上次连接用了缓存地址时，把接口改回 DHCP。静态配置留在 netif 上，
+ * 之后不复用地址的连接（租约过期、没有缓存）若不改回，仍会沿用旧地址
+ */
+static void restoreDhcp(void) {
+    portENTER_CRITICAL(&s_mux);
+    bool wasStatic = s_staticIp;
+    s_staticIp = false;
+    portEXIT_CRITICAL(&s_mux);
+    if (wasStatic) WiFi.config(IPAddress((uint32_t)0), IPAddress((uint32_t)0), IPAddress((uint32_t)0));
+}
+
+/* 按缓存定向连接；没有缓存或驱动里没有保存的 WiFi 时返回 false（须在 WiFi.mode(WIFI_STA) 之后调用） */
+static bool beginFast(void) {
+    wifi_config_t cfg;
+    if (esp_wifi_get_config(WIFI_IF_STA, &cfg) != ESP_OK || cfg.sta.ssid[0] == 0) return false;
+    if (!s_haveStaCfg) {
+        /* 上次快速连接可能把锁定的 BSSID 存进了驱动配置，恢复用的副本去掉它 */
+        cfg.sta.bssid_set = false;
+        cfg.sta.channel = 0;
+        s_staCfg = cfg;
+        s_haveStaCfg = true;
+    }
+    WifiAssoc a;
+    portENTER_CRITICAL(&s_mux);
+    bool have = s_haveAssoc;
+    a = s_assoc;
+    portEXIT_CRITICAL(&s_mux);
+    if (!have) return false;
+
+    char ssid[sizeof(cfg.sta.ssid) + 1];
+    char pass[sizeof(cfg.sta.password) + 1];
+    memcpy(ssid, cfg.sta.ssid, sizeof(cfg.sta.ssid));
+    ssid[sizeof(cfg.sta.ssid)] = '\0';
+    memcpy(pass, cfg.sta.password, sizeof(cfg.sta.password));
+    pass[sizeof(cfg.sta.password)] = '\0';
+
+    bool staticIp = false;
+#if WIFI_ASSOC_STATIC_IP
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    staticIp = wifiAssocLeaseUsable(&a, (int64_t)tv.tv_sec);
+    if (staticIp) WiFi.config(IPAddress(a.ip), IPAddress(a.gateway), IPAddress(a.netmask), IPAddress(a.dns));
+#endif
+    if (!staticIp) restoreDhcp();
+    portENTER_CRITICAL(&s_mux);
+    s_staticIp = staticIp;
+    s_bssidLocked = true;
+    portEXIT_CRITICAL(&s_mux);
+    startAttempt(NET_PATH_FAST);
+    WiFi.begin(ssid, pass, a.channel, a.bssid);
+    return true;
+}
+
+/* 快速路径失败：清除缓存，恢复不锁 BSSID 的配置与 DHCP */
+static void abandonFast(void) {
+    portENTER_CRITICAL(&s_mux);
+    s_haveAssoc = false;
+    s_bssidLocked = false;
+    s_path = -1;
+    s_stats.fastFail++;
+    portEXIT_CRITICAL(&s_mux);
+    wifiAssocForget();
+    WiFi.disconnect();
+    restoreDhcp();
+    if (s_haveStaCfg) esp_wifi_set_config(WIFI_IF_STA, &s_staCfg);
+    LOG_W("WiFi: fast reconnect failed, falling back to full scan");
+}
+
+/* 运行中重新打开射频：先走快速路径，失败由 netServiceLoop 退回全信道扫描 */
+static void radioOnConnect(void) {
+    WiFi.mode(WIFI_STA);
+    if (beginFast()) return;
+    restoreDhcp();
+    startAttempt(NET_PATH_SLOW);
+    WiFi.begin();                     /* 用 WiFiManager 保存在驱动中的配置 */
+}
+
+static void runAction(NetAction action) {
+    switch (action) {
+        case NET_ACT_RADIO_ON:
+            radioOnConnect();
+            break;
+        case NET_ACT_RADIO_OFF:
+            WiFi.disconnect(true);
+            WiFi.mode(WIFI_OFF);
+            break;
+        case NET_ACT_SLEEP_LIGHT:
+            WiFi.setSleep(WIFI_PS_MIN_MODEM);
+            break;
+        case NET_ACT_SLEEP_DEEP:
+            WiFi.setSleep(WIFI_PS_MAX_MODEM);
+            break;
+        default:
+            break;
+    }
+}
+
+static void netTask(void* arg) {
+    WiFiManager wm;
+    wm.setConfigPortalTimeout(120);   // 配网页超时 2 分钟
+    wm.setConnectTimeout(30);         // 连接路由器超时 30 秒
+    wm.setMinimumSignalQuality(10);   // 信号强度至少 10%
+    uint32_t retryS = NET_RETRY_MIN_S;
+
+    /* 快速路径：等事件回调报告拿到地址；缓存失效（换了路由器 / 信道）时清除后走下面的完整流程 */
+    bool fast;
+    {
+        POWER_BUSY_SCOPE();
+        WiFi.mode(WIFI_STA);
+        fast = beginFast();
+        if (fast) {
+            uint32_t waited = 0;
+            while (!s_connected && waited < NET_FAST_TIMEOUT_MS) {
+                vTaskDelay(pdMS_TO_TICKS(NET_FAST_POLL_MS));
+                waited += NET_FAST_POLL_MS;
+            }
+            if (!s_connected) {
+                abandonFast();
+                fast = false;
+            }
+        }
+    }
+
+    // 若已有保存的 WiFi 则自动连接；否则或连接失败则启动配网 AP「OLEDClock」
+    // 连接与配网期间持有忙锁，退避等待期间不持有；SETUP 租约一直持有到连上
+    while (!fast) {
+        bool ok;
+        {
+            POWER_BUSY_SCOPE();
+            startAttempt(NET_PATH_SLOW);
+            ok = wm.autoConnect("OLEDClock");
+        }
+        if (ok) break;
+        LOG_W("WiFi: connect failed, retry in %lus", (unsigned long)retryS);
+        vTaskDelay(pdMS_TO_TICKS(retryS * 1000));
+        retryS *= 2;
+        if (retryS > NET_RETRY_MAX_S) retryS = NET_RETRY_MAX_S;
+    }
+    metricsBootMark(BOOT_WIFI);
+    portENTER_CRITICAL(&s_mux);
+    NetConnectStats st = s_stats;
+    portEXIT_CRITICAL(&s_mux);
+    if (st.bootPath >= 0)
+        LOG_I("WiFi: connected via %s path in %lums (%lums after boot)", PATH_NAMES[st.bootPath],
+              (unsigned long)st.bootMs, (unsigned long)millis());
+    netServiceRelease(NET_JOB_SETUP);
+    vTaskDelete(NULL);
+}
+
+void netServiceBegin(void) {
+    WifiAssoc a;
+    bool have = wifiAssocLoad(&a);
+    WiFi.onEvent(onWiFiEvent, ARDUINO_EVENT_MAX);
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&s_mux);
+    s_assoc = a;
+    s_haveAssoc = have;
+    s_bootStartUs = now;
+    netLeaseInit(&s_core, s_policy > s_policyFloor ? s_policy : s_policyFloor, NET_IDLE_TAIL_MS, true, now);
+    netLeaseAcquire(&s_core, NET_JOB_SETUP, 0, now);
+    portEXIT_CRITICAL(&s_mux);
+    TaskHandle_t task = NULL;
+    xTaskCreatePinnedToCore(netTask, "net", NET_TASK_STACK, NULL, NET_TASK_PRIO, &task, NET_TASK_CORE);
+}
+
+bool netServiceIsConnected(void) {
+    return s_connected;
+}
+
+IPAddress netServiceLocalIp(void) {
+    return IPAddress((uint32_t)s_ip);
+}
+
+/* 只改租约状态；WiFi 驱动调用统一在 netServiceLoop 中执行，镜像任务等其他任务申请时不会与之并发 */
+void netServiceAcquire(NetJob job, uint32_t holdMs) {
+    portENTER_CRITICAL(&s_mux);
+    NetAction action = netLeaseAcquire(&s_core, job, holdMs, esp_timer_get_time());
+    if (action != NET_ACT_NONE) s_pendingAction = action;
+    portEXIT_CRITICAL(&s_mux);
+}
+
+void netServiceRelease(NetJob job) {
+    portENTER_CRITICAL(&s_mux);
+    netLeaseRelease(&s_core, job, esp_timer_get_time());
+    portEXIT_CRITICAL(&s_mux);
+}
+
+void netServiceTouch(void) {
+    portENTER_CRITICAL(&s_mux);
+    netLeaseTouch(&s_core, esp_timer_get_time());
+    portEXIT_CRITICAL(&s_mux);
+}
+
+void netServiceWake(void) {
+    netServiceAcquire(NET_JOB_WEB, 0);
+    netServiceRelease(NET_JOB_WEB);
+}
+
+/* 生效策略取配置与下限中更省电的一档（枚举按省电程度递增） */
+static void applyPolicy(void) {
+    portENTER_CRITICAL(&s_mux);
+    netLeaseSetPolicy(&s_core, s_policy > s_policyFloor ? s_policy : s_policyFloor);
+    portEXIT_CRITICAL(&s_mux);
+}
+
+void netServiceSetPolicy(NetPolicy policy) {
+    if ((int)policy < 0 || policy >= NET_POLICY_COUNT) return;
+    s_policy = policy;
+    applyPolicy();
+}
+
+void netServiceSetPolicyFloor(NetPolicy floor) {
+    if ((int)floor < 0 || floor >= NET_POLICY_COUNT) return;
+    s_policyFloor = floor;
+    applyPolicy();
+}
+
+NetPolicy netServicePolicy(void) {
+    return s_policy;
+}
+
+const char* netServicePolicyName(NetPolicy policy) {
+    return ((int)policy >= 0 && policy < NET_POLICY_COUNT) ? POLICY_NAMES[policy] : "";
+}
+
+int netServiceFindPolicy(const char* name) {
+    for (int i = 0; i < NET_POLICY_COUNT; i++)
+        if (strcmp(name, POLICY_NAMES[i]) == 0) return i;
+    return -1;
+}
+
+/* 拿到地址后把本次连接写回缓存；在 loop 中执行，避免在事件任务里写 NVS */
+static void saveAssoc(void) {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    WifiAssoc a;
+    memset(&a, 0, sizeof(a));
+    portENTER_CRITICAL(&s_mux);
+    s_assocDirty = false;
+    memcpy(a.bssid, s_gotBssid, sizeof(a.bssid));
+    a.channel = s_gotChannel;
+    a.gateway = s_gotGateway;
+    a.netmask = s_gotNetmask;
+    /* 复用的静态地址不代表续了租约，沿用原来的时间 */
+    a.leaseEpochS = s_staticIp ? s_assoc.leaseEpochS : (int64_t)tv.tv_sec;
+    portEXIT_CRITICAL(&s_mux);
+    a.ip = s_ip;
+    a.hasIp = a.ip != 0;
+    a.dns = (uint32_t)WiFi.dnsIP();
+    wifiAssocSeal(&a);
+    if (!wifiAssocValid(&a)) return;  /* 信道无效（事件没带上），不缓存 */
+    wifiAssocSave(&a);
+    portENTER_CRITICAL(&s_mux);
+    s_assoc = a;
+    s_haveAssoc = true;
+    portEXIT_CRITICAL(&s_mux);
+}
+
+void netServiceLoop(void) {
+    bool connected = netServiceIsConnected();
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&s_mux);
+    NetAction pending = s_pendingAction;
+    s_pendingAction = NET_ACT_NONE;
+    NetAction action = netLeaseTick(&s_core, connected, now);
+    bool dirty = s_assocDirty;
+    /* 锁定 BSSID 后迟迟连不上（运行中开射频，或掉线后驱动按锁定配置重连）：退回全信道扫描；
+       开机那一次由联网任务自己处理 */
+    bool fallback = s_bssidLocked && !connected && s_stats.bootPath >= 0 &&
+                    s_core.radio != NET_RADIO_OFF && now - s_downSinceUs > (int64_t)NET_FAST_TIMEOUT_MS * 1000;
+    portEXIT_CRITICAL(&s_mux);
+    runAction(pending);
+    if (dirty && connected) saveAssoc();
+    if (fallback) {
+        abandonFast();
+        startAttempt(NET_PATH_SLOW);
+        WiFi.begin();
+    }
+    if (action == NET_ACT_RADIO_OFF) LOG_I("WiFi: radio off (no leases)");
+    runAction(action);
+}
+
+uint64_t netServiceRadioOnUs(void) {
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&s_mux);
+    uint64_t us = netLeaseRadioOnUs(&s_core, now);
+    portEXIT_CRITICAL(&s_mux);
+    return us;
+}
+
+void netServiceWritePrometheus(Print& out) {
+    NetLeaseCore c;
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&s_mux);
+    c = s_core;
+    portEXIT_CRITICAL(&s_mux);
+    out.printf("# TYPE oled_net_policy gauge\noled_net_policy{policy=\"%s\"} %d\n",
+               POLICY_NAMES[c.policy], (int)c.policy);
+    out.printf("# TYPE oled_net_radio_on_seconds counter\noled_net_radio_on_seconds %.3f\n",
+               netLeaseRadioOnUs(&c, now) / 1e6);
+    out.printf("# TYPE oled_net_radio_on_total counter\noled_net_radio_on_total %lu\n",
+               (unsigned long)c.radioOnCount);
+    out.printf("# TYPE oled_net_leases_held gauge\noled_net_leases_held %u\n", (unsigned)c.total);
+    out.print("# TYPE oled_net_lease_total counter\n");
+    for (int j = 0; j < NET_JOB_COUNT; j++)
+        out.printf("oled_net_lease_total{job=\"%s\"} %lu\n", JOB_NAMES[j], (unsigned long)c.jobs[j].leases);
+    out.print("# TYPE oled_net_lease_expired_total counter\n");
+    for (int j = 0; j < NET_JOB_COUNT; j++)
+        out.printf("oled_net_lease_expired_total{job=\"%s\"} %lu\n", JOB_NAMES[j], (unsigned long)c.jobs[j].expired);
+    out.print("# HELP oled_net_lease_held_seconds Time each job kept the radio on\n"
+              "# TYPE oled_net_lease_held_seconds counter\n");
+    for (int j = 0; j < NET_JOB_COUNT; j++)
+        out.printf("oled_net_lease_held_seconds{job=\"%s\"} %.3f\n", JOB_NAMES[j],
+                   netLeaseHeldUs(&c, (NetJob)j, now) / 1e6);
+    out.print("# HELP oled_net_connect_ms Lease request to association, for leases that had to wait\n"
+              "# TYPE oled_net_connect_ms summary\n");
+    for (int j = 0; j < NET_JOB_COUNT; j++) {
+        out.printf("oled_net_connect_ms_sum{job=\"%s\"} %llu\n", JOB_NAMES[j],
+                   (unsigned long long)c.jobs[j].sumConnectMs);
+        out.printf("oled_net_connect_ms_count{job=\"%s\"} %lu\n", JOB_NAMES[j],
+                   (unsigned long)c.jobs[j].waits);
+    }
+    portENTER_CRITICAL(&s_mux);
+    NetConnectStats st = s_stats;
+    portEXIT_CRITICAL(&s_mux);
+    out.print("# HELP oled_net_boot_connect_ms Boot to first IP, labelled with the path that succeeded\n"
+              "# TYPE oled_net_boot_connect_ms gauge\n");
+    if (st.bootPath >= 0)
+        out.printf("oled_net_boot_connect_ms{path=\"%s\"} %lu\n", PATH_NAMES[st.bootPath], (unsigned long)st.bootMs);
+    out.print("# TYPE oled_net_last_connect_ms gauge\n");
+    for (int p = 0; p < NET_PATH_COUNT; p++)
+        out.printf("oled_net_last_connect_ms{path=\"%s\"} %lu\n", PATH_NAMES[p], (unsigned long)st.lastMs[p]);
+    out.print("# TYPE oled_net_fast_connect_total counter\n");
+    out.printf("oled_net_fast_connect_total{result=\"ok\"} %lu\n", (unsigned long)st.fastOk);
+    out.printf("oled_net_fast_connect_total{result=\"fail\"} %lu\n", (unsigned long)st.fastFail);
+    out.printf("# TYPE oled_net_slow_connect_total counter\noled_net_slow_connect_total %lu\n",
+               (unsigned long)st.slowOk);
+    out.print("# TYPE oled_net_connect_max_ms gauge\n");
+    for (int j = 0; j < NET_JOB_COUNT; j++)
+        out.printf("oled_net_connect_max_ms{job=\"%s\"} %lu\n", JOB_NAMES[j],
+                   (unsigned long)c.jobs[j].maxConnectMs);
+}
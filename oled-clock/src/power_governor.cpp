@@ -0,0 +1,116 @@
+/**
+ * @file power_governor.cpp
+ * @brief 电源调节实现：电量采样与平滑、档位应用、驻留统计
+ */
+#include "power_governor.h"
+#include "log_service.h"
+#include "display.h"
+#include "net_service.h"
+#include <esp_timer.h>
+
+/* 电量平滑：百分比 ×16 的指数平均，每次采样收敛 1/4；WiFi 发射时的电压跌落不会立即触发降档 */
+#define BATTERY_FIX_SHIFT  4
+#define BATTERY_EMA_SHIFT  2
+
+static PowerGovernorCore s_core = { BATTERY_LEVEL_HIGH, POWER_PROFILE_PERFORMANCE, -1, 0 };
+static int32_t s_batteryFix = -1;
+static uint32_t s_lastSampleMs = 0;
+static uint32_t s_lastInputMs = 0;
+static int64_t s_profileSinceUs = 0;
+static uint64_t s_residencyUs[POWER_PROFILE_COUNT];
+
+static void sampleBattery(void) {
+    int32_t p = (int32_t)displayGetBatteryPercent() << BATTERY_FIX_SHIFT;
+    if (s_batteryFix < 0) s_batteryFix = p;
+    else s_batteryFix += (p - s_batteryFix) >> BATTERY_EMA_SHIFT;
+    s_lastSampleMs = millis();
+}
+
+static void applyProfile(void) {
+    const PowerProfileSpec* spec = powerProfileSpec((PowerProfile)s_core.profile);
+    u8g2.setContrast(spec->contrast);
+    int floor = powerGovernorNetFloor(&s_core);
+    netServiceSetPolicyFloor(floor < 0 ? NET_POLICY_ALWAYS_ON : (NetPolicy)floor);
+    LOG_I("Power profile: %s (battery %d%%)", spec->name, powerGovernorBatteryPercent());
+}
+
+void powerGovernorBegin(void) {
+    sampleBattery();
+    s_lastInputMs = millis();
+    int8_t forced = s_core.forced;    /* webConfigLoad 已恢复的固定档位 */
+    powerGovernorInit(&s_core, powerGovernorBatteryPercent());
+    s_core.forced = forced;
+    if (forced >= 0) s_core.profile = (uint8_t)forced;
+    s_profileSinceUs = esp_timer_get_time();
+    applyProfile();
+}
+
+void powerGovernorNoteInput(void) {
+    s_lastInputMs = millis();
+}
+
+void powerGovernorLoop(void) {
+    uint32_t now = millis();
+    if ((uint32_t)(now - s_lastSampleMs) >= GOVERNOR_SAMPLE_MS) sampleBattery();
+    uint8_t before = s_core.profile;
+    powerGovernorSelect(&s_core, powerGovernorBatteryPercent(), now - s_lastInputMs);
+    if (s_core.profile == before) return;
+    int64_t t = esp_timer_get_time();
+    s_residencyUs[before] += (uint64_t)(t - s_profileSinceUs);
+    s_profileSinceUs = t;
+    applyProfile();
+}
+
+PowerProfile powerGovernorProfile(void) {
+    return (PowerProfile)s_core.profile;
+}
+
+const PowerProfileSpec* powerGovernorSpec(void) {
+    return powerProfileSpec((PowerProfile)s_core.profile);
+}
+
+int powerGovernorBatteryPercent(void) {
+    if (s_batteryFix < 0) return -1;
+    return (int)((s_batteryFix + (1 << (BATTERY_FIX_SHIFT - 1))) >> BATTERY_FIX_SHIFT);
+}
+
+uint32_t powerGovernorFrameMs(uint32_t screenMs) {
+    uint32_t floorMs = powerGovernorSpec()->frameMinMs;
+    return screenMs > floorMs ? screenMs : floorMs;
+}
+
+uint64_t powerGovernorPanelUs(void) {
+    int64_t now = esp_timer_get_time();
+    uint64_t sum = 0;
+    for (int i = 0; i < POWER_PROFILE_COUNT; i++) {
+        uint64_t us = s_residencyUs[i];
+        if (i == s_core.profile) us += (uint64_t)(now - s_profileSinceUs);
+        sum += us * powerProfileSpec((PowerProfile)i)->contrast / 255;
+    }
+    return sum;
+}
+
+void powerGovernorSetForced(int profile) {
+    if (profile >= POWER_PROFILE_COUNT) return;
+    s_core.forced = (int8_t)(profile < 0 ? -1 : profile);
+}
+
+int powerGovernorForced(void) {
+    return s_core.forced;
+}
+
+void powerGovernorWritePrometheus(Print& out) {
+    int64_t now = esp_timer_get_time();
+    out.printf("# TYPE oled_battery_percent gauge\noled_battery_percent %d\n", powerGovernorBatteryPercent());
+    out.printf("# TYPE oled_power_profile gauge\noled_power_profile{profile=\"%s\"} %d\n",
+               powerGovernorSpec()->name, (int)s_core.profile);
+    out.printf("# TYPE oled_power_profile_switches_total counter\noled_power_profile_switches_total %lu\n",
+               (unsigned long)s_core.switches);
+    out.print("# TYPE oled_power_profile_seconds counter\n");
+    for (int i = 0; i < POWER_PROFILE_COUNT; i++) {
+        uint64_t us = s_residencyUs[i];
+        if (i == s_core.profile) us += (uint64_t)(now - s_profileSinceUs);
+        out.printf("oled_power_profile_seconds{profile=\"%s\"} %.3f\n",
+                   powerProfileSpec((PowerProfile)i)->name, us / 1e6);
+    }
+}
@@ -0,0 +1,77 @@
+/**
+ * @file power_profile.cpp
+ * @brief 电源档位表与选择逻辑
+ */
+#include "power_profile.h"
+#include <string.h>
+
+/* 联网策略下限的取值对应 NetPolicy：1 = 空闲深度 modem sleep，2 = 空闲关闭射频 */
+static const PowerProfileSpec PROFILES[POWER_PROFILE_COUNT] = {
+    { "performance", 'P', 0,   true,  200, 10UL * 60 * 1000,  -1 },
+    { "balanced",    'B', 100, true,  128, 20UL * 60 * 1000,  -1 },
+    { "saver",       'S', 250, false, 48,  60UL * 60 * 1000,  1 },
+    { "critical",    'C', 500, false, 8,   180UL * 60 * 1000, 2 },
+};
+
+/* 按电量级别与是否在用排出的档位 */
+static const uint8_t SELECT[3][2] = {
+    /* 空闲                      在用 */
+    { POWER_PROFILE_BALANCED, POWER_PROFILE_PERFORMANCE },   /* 高电量 */
+    { POWER_PROFILE_SAVER,    POWER_PROFILE_BALANCED },      /* 低电量 */
+    { POWER_PROFILE_CRITICAL, POWER_PROFILE_SAVER },         /* 极低电量 */
+};
+
+const PowerProfileSpec* powerProfileSpec(PowerProfile profile) {
+    if ((int)profile < 0 || profile >= POWER_PROFILE_COUNT) profile = POWER_PROFILE_PERFORMANCE;
+    return &PROFILES[profile];
+}
+
+int powerProfileFind(const char* name) {
+    for (int i = 0; i < POWER_PROFILE_COUNT; i++)
+        if (strcmp(name, PROFILES[i].name) == 0) return i;
+    return -1;
+}
+
+BatteryLevel powerGovernorLevel(BatteryLevel level, int batteryPct) {
+    if (batteryPct < 0) return level;
+    switch (level) {
+        case BATTERY_LEVEL_HIGH:
+            if (batteryPct < GOVERNOR_CRIT_ENTER_PCT) return BATTERY_LEVEL_CRITICAL;
+            if (batteryPct < GOVERNOR_LOW_ENTER_PCT) return BATTERY_LEVEL_LOW;
+            return BATTERY_LEVEL_HIGH;
+        case BATTERY_LEVEL_LOW:
+            if (batteryPct < GOVERNOR_CRIT_ENTER_PCT) return BATTERY_LEVEL_CRITICAL;
+            if (batteryPct >= GOVERNOR_LOW_EXIT_PCT) return BATTERY_LEVEL_HIGH;
+            return BATTERY_LEVEL_LOW;
+        default:
+            if (batteryPct >= GOVERNOR_LOW_EXIT_PCT) return BATTERY_LEVEL_HIGH;
+            if (batteryPct >= GOVERNOR_CRIT_EXIT_PCT) return BATTERY_LEVEL_LOW;
+            return BATTERY_LEVEL_CRITICAL;
+    }
+}
+
+void powerGovernorInit(PowerGovernorCore* g, int batteryPct) {
+    memset(g, 0, sizeof(*g));
+    g->forced = -1;
+    /* 开机直接按阈值归级，不经过滞回区 */
+    g->level = (uint8_t)(batteryPct < 0 ? BATTERY_LEVEL_HIGH
+                         : batteryPct < GOVERNOR_CRIT_ENTER_PCT ? BATTERY_LEVEL_CRITICAL
+                         : batteryPct < GOVERNOR_LOW_ENTER_PCT ? BATTERY_LEVEL_LOW
+                         : BATTERY_LEVEL_HIGH);
+    g->profile = SELECT[g->level][1];
+}
+
+int powerGovernorNetFloor(const PowerGovernorCore* g) {
+    uint8_t profile = g->forced >= 0 ? (uint8_t)g->forced : SELECT[g->level][0];
+    return PROFILES[profile].netPolicyFloor;
+}
+
+PowerProfile powerGovernorSelect(PowerGovernorCore* g, int batteryPct, uint32_t idleMs) {
+    g->level = (uint8_t)powerGovernorLevel((BatteryLevel)g->level, batteryPct);
+    uint8_t profile = g->forced >= 0 ? (uint8_t)g->forced : SELECT[g->level][idleMs < GOVERNOR_ACTIVE_MS];
+    if (profile != g->profile) {
+        g->profile = profile;
+        g->switches++;
+    }
+    return (PowerProfile)g->profile;
+}
@@ -0,0 +1,196 @@
+/**
+ * @file power_service.cpp
+ * @brief 帧间空闲省电实现
+ *
+ * 电源管理是否可用取决于框架的 sdkconfig：CONFIG_PM_ENABLE 决定能否调频与持锁，
+ * CONFIG_FREERTOS_USE_TICKLESS_IDLE 决定 esp_pm_configure 能否打开自动浅睡（否则返回
+ * ESP_ERR_NOT_SUPPORTED，退回只调频）。没有自动浅睡时，空闲等待在 WiFi 关闭、
+ * 无忙锁时手动 esp_light_sleep_start，定时器唤醒取等待结束与最近 esp_timer 到期中较早者。
+ *
+ * 驻留统计以 loop 任务为准：active = 帧工作时间，light_sleep = 手动浅睡实测时间，
+ * idle = 其余等待时间（自动浅睡模式下自动浅睡也计在 idle 里，框架不提供单独计数）。
+ */
+#include "power_service.h"
+#include "log_service.h"
+#include "buttons.h"
+#include <WiFi.h>
+#include <esp_timer.h>
+#include <esp_sleep.h>
+#if CONFIG_PM_ENABLE
+#include <esp_pm.h>
+#endif
+
+/* 浅睡定时器比最近的 esp_timer 提前这么多醒来，留出恢复时间 */
+#define POWER_WAKE_LEAD_US   1000
+
+struct PowerResidency {
+    uint64_t activeUs;
+    uint64_t idleUs;
+    uint64_t lightSleepUs;
+    uint32_t wakeGpio;
+    uint32_t wakeTimer;
+    uint32_t blocked[POWER_BLOCK_COUNT];
+};
+
+static PowerMode s_mode = POWER_MODE_NONE;
+static portMUX_TYPE s_mux = portMUX_INITIALIZER_UNLOCKED;
+static int s_busyCount = 0;
+static PowerResidency s_res;
+static int64_t s_activeSinceUs = 0;
+#if CONFIG_PM_ENABLE
+static esp_pm_lock_handle_t s_cpuLock = NULL;
+static esp_pm_lock_handle_t s_noSleepLock = NULL;
+#endif
+
+void powerBusyAcquire(void) {
+    portENTER_CRITICAL(&s_mux);
+    bool first = s_busyCount++ == 0;
+    portEXIT_CRITICAL(&s_mux);
+#if CONFIG_PM_ENABLE
+    /* esp_pm 锁自身带计数，这里只在 0→1 时取一次 */
+    if (first && s_cpuLock) {
+        esp_pm_lock_acquire(s_cpuLock);
+        esp_pm_lock_acquire(s_noSleepLock);
+    }
+#else
+    (void)first;
+#endif
+}
+
+void powerBusyRelease(void) {
+    portENTER_CRITICAL(&s_mux);
+    bool last = s_busyCount > 0 && --s_busyCount == 0;
+    portEXIT_CRITICAL(&s_mux);
+#if CONFIG_PM_ENABLE
+    if (last && s_cpuLock) {
+        esp_pm_lock_release(s_noSleepLock);
+        esp_pm_lock_release(s_cpuLock);
+    }
+#else
+    (void)last;
+#endif
+}
+
+static void configurePm(void) {
+#if CONFIG_PM_ENABLE
+    esp_pm_config_esp32_t cfg;
+    cfg.max_freq_mhz = POWER_MAX_MHZ;
+    cfg.min_freq_mhz = POWER_MIN_MHZ;
+    cfg.light_sleep_enable = true;
+    esp_err_t err = esp_pm_configure(&cfg);
+    if (err == ESP_ERR_NOT_SUPPORTED) {
+        cfg.light_sleep_enable = false;
+        err = esp_pm_configure(&cfg);
+    }
+    if (err != ESP_OK) {
+        LOG_E("Power: esp_pm_configure failed (%d)", (int)err);
+        return;
+    }
+    esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "busy", &s_cpuLock);
+    esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, "busy_nosleep", &s_noSleepLock);
+    s_mode = cfg.light_sleep_enable ? POWER_MODE_AUTO_SLEEP : POWER_MODE_DFS;
+#endif
+}
+
+void powerServiceBegin(void) {
+    memset(&s_res, 0, sizeof(s_res));
+    configurePm();
+    /* 按键引脚的唤醒电平由 buttons 维护；自动与手动浅睡都用这一唤醒源 */
+    esp_sleep_enable_gpio_wakeup();
+    powerBusyAcquire();
+    s_activeSinceUs = esp_timer_get_time();
+    static const char* const MODE_NAMES[] = { "none", "dfs", "auto light sleep" };
+    LOG_I("Power: %s, %d-%d MHz", MODE_NAMES[s_mode], POWER_MIN_MHZ, POWER_MAX_MHZ);
+}
+
+PowerMode powerServiceMode(void) {
+    return s_mode;
+}
+
+/* 手动浅睡的前提；返回 POWER_BLOCK_COUNT 表示可以睡 */
+static PowerSleepBlock sleepBlocker(int64_t now, int64_t untilUs) {
+    if (untilUs - now < (int64_t)POWER_SLEEP_MIN_MS * 1000) return POWER_BLOCK_SHORT;
+    portENTER_CRITICAL(&s_mux);
+    int busy = s_busyCount;
+    portEXIT_CRITICAL(&s_mux);
+    if (busy > 0) return POWER_BLOCK_BUSY;
+    if (WiFi.getMode() != WIFI_OFF) return POWER_BLOCK_WIFI;
+    return POWER_BLOCK_COUNT;
+}
+
+/* 手动浅睡到 untilUs（或被按键唤醒） */
+static void lightSleepUntil(int64_t now, int64_t untilUs) {
+    Serial.flush();
+    esp_sleep_enable_timer_wakeup((uint64_t)(untilUs - now));
+    int64_t before = esp_timer_get_time();
+    esp_light_sleep_start();
+    int64_t slept = esp_timer_get_time() - before;
+    bool gpio = esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_GPIO;
+    s_res.lightSleepUs += (uint64_t)slept;
+    if (gpio) s_res.wakeGpio++;
+    else s_res.wakeTimer++;
+}
+
+void powerServiceIdle(uint32_t waitMs) {
+    int64_t start = esp_timer_get_time();
+    s_res.activeUs += (uint64_t)(start - s_activeSinceUs);
+    uint64_t sleptBefore = s_res.lightSleepUs;
+    int64_t endUs = start + (int64_t)waitMs * 1000;
+    bool counted = false;
+    powerBusyRelease();
+
+    for (;;) {
+        buttonsUpdate();
+        if (buttonsPending()) break;
+        int64_t now = esp_timer_get_time();
+        if (now >= endUs) break;
+        uint32_t leftMs = (uint32_t)((endUs - now + 999) / 1000);
+        if (buttonsBusy()) {
+            vTaskDelay(pdMS_TO_TICKS(leftMs < POWER_BUTTON_POLL_MS ? leftMs : POWER_BUTTON_POLL_MS));
+            continue;
+        }
+        if (s_mode != POWER_MODE_AUTO_SLEEP) {
+            /* 最近的 esp_timer（倒计时、闹钟、蜂鸣器节奏）在手动浅睡中不会执行，须提前醒来 */
+            int64_t until = endUs;
+            int64_t next = esp_timer_get_next_alarm() - POWER_WAKE_LEAD_US;
+            if (next < until) until = next;
+            PowerSleepBlock block = sleepBlocker(now, until);
+            if (block == POWER_BLOCK_COUNT) {
+                lightSleepUntil(now, until);
+                continue;
+            }
+            if (!counted) s_res.blocked[block]++;
+            counted = true;
+            /* 只是 esp_timer 马上到期：等它执行完再重新判断 */
+            if (block == POWER_BLOCK_SHORT && leftMs > POWER_SLEEP_MIN_MS) leftMs = POWER_SLEEP_MIN_MS;
+        }
+        buttonsWaitEdge(leftMs);
+    }
+
+    powerBusyAcquire();
+    s_activeSinceUs = esp_timer_get_time();
+    s_res.idleUs += (uint64_t)(s_activeSinceUs - start) - (s_res.lightSleepUs - sleptBefore);
+}
+
+void powerServiceResidency(uint64_t* activeUs, uint64_t* idleUs, uint64_t* lightSleepUs) {
+    *activeUs = s_res.activeUs + (uint64_t)(esp_timer_get_time() - s_activeSinceUs);
+    *idleUs = s_res.idleUs;
+    *lightSleepUs = s_res.lightSleepUs;
+}
+
+void powerServiceWritePrometheus(Print& out) {
+    static const char* const BLOCK_NAMES[POWER_BLOCK_COUNT] = { "short", "busy", "wifi" };
+    out.printf("# TYPE oled_power_mode gauge\noled_power_mode %d\n", (int)s_mode);
+    out.print("# HELP oled_power_residency_seconds Loop task time split by power state\n"
+              "# TYPE oled_power_residency_seconds counter\n");
+    out.printf("oled_power_residency_seconds{state=\"active\"} %.3f\n", s_res.activeUs / 1e6);
+    out.printf("oled_power_residency_seconds{state=\"idle\"} %.3f\n", s_res.idleUs / 1e6);
+    out.printf("oled_power_residency_seconds{state=\"light_sleep\"} %.3f\n", s_res.lightSleepUs / 1e6);
+    out.print("# TYPE oled_power_light_sleep_total counter\n");
+    out.printf("oled_power_light_sleep_total{wake=\"gpio\"} %lu\n", (unsigned long)s_res.wakeGpio);
+    out.printf("oled_power_light_sleep_total{wake=\"timer\"} %lu\n", (unsigned long)s_res.wakeTimer);
+    out.print("# TYPE oled_power_sleep_blocked_total counter\n");
+    for (int i = 0; i < POWER_BLOCK_COUNT; i++)
+        out.printf("oled_power_sleep_blocked_total{reason=\"%s\"} %lu\n",
+                   BLOCK_NAMES[i], (unsigned long)s_res.blocked[i]);
+}
@@ -0,0 +1,192 @@
+/**
+ * @file sleep_clock.cpp
+ * @brief 深睡时钟模式实现
+ *
+ * 屏幕布局按 8×8 页块对齐：四个大数字（3×4 块）与冒号在块行 3..6，
+ * 唤醒后 RAM 中的帧缓冲是空的，只画变化的数字并用 updateDisplayArea 发出对应的块。
+ * 墙钟在深睡期间由 IDF 用 RTC 定时器继续推进。
+ *
+ * 续航估算的各电流为手册 / 典型值，不是实测（见 README）。
+ */
+#include "sleep_clock.h"
+#include "log_service.h"
+#include "sleep_state.h"
+#include "display.h"
+#include "bitmap.h"
+#include "buttons.h"
+#include "tz_engine.h"
+#include "alarm_service.h"
+#include "config_store.h"
+#include "timer_engine.h"
+#include "app_state.h"
+#include <Wire.h>
+#include <WiFi.h>
+#include <esp_sleep.h>
+#include <esp_timer.h>
+#include <sys/time.h>
+
+#define SLEEP_CLOCK_VALID_EPOCH  1577836800    /* 2020-01-01 */
+#define SLEEP_CLOCK_MARGIN_US    20000         /* 整分后再醒，RTC 慢时钟偏快时也不早于整分 */
+#define SLEEP_CLOCK_BUDGET_US    30000         /* 每次唤醒应用部分的时间预算 */
+#define SLEEP_CLOCK_CONTRAST     16            /* 省电模式降低亮度 */
+#define SLEEP_CLOCK_TILE_ROW     3
+#define SLEEP_CLOCK_Y            (SLEEP_CLOCK_TILE_ROW * 8)
+#define SLEEP_CLOCK_DOT_X        56
+
+/* 续航估算模型（按 1000mAh 电池） */
+#define SLEEP_MODEL_BATTERY_MAH  1000.0f
+#define SLEEP_MODEL_SLEEP_UA     10.0f         /* ESP32 深睡，RTC 定时器 + RTC 慢速内存 */
+#define SLEEP_MODEL_DISPLAY_UA   2500.0f       /* SH1106 低亮度、约 15% 像素点亮 */
+#define SLEEP_MODEL_AWAKE_MA     45.0f         /* 唤醒期间（无射频） */
+#define SLEEP_MODEL_BOOT_US      250000.0f     /* ROM + 二级引导（含镜像校验） */
+
+static const uint8_t DIGIT_X[4] = { 8, 32, 64, 88 };     /* 都是 8 的倍数 */
+
+static RTC_DATA_ATTR SleepState s_state;
+static const SleepPowerModel SLEEP_MODEL = {
+    SLEEP_MODEL_BATTERY_MAH, SLEEP_MODEL_SLEEP_UA, SLEEP_MODEL_DISPLAY_UA,
+    SLEEP_MODEL_AWAKE_MA, SLEEP_MODEL_BOOT_US
+};
+
+static int64_t wallNowUs(void) {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+static void localDigits(int64_t wallUs, uint8_t out[4]) {
+    struct tm t;
+    tzLocalTime(wallUs / 1000000, &t, NULL);
+    sleepStateDigits(t.tm_hour, t.tm_min, out);
+}
+
+static void deepSleepUntilNextMinute(void) {
+    /* 主循环空闲浅睡用的按键 GPIO 唤醒不适用于深睡 */
+    esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_GPIO);
+    esp_sleep_enable_timer_wakeup(sleepUsToNextMinute(wallNowUs(), SLEEP_CLOCK_MARGIN_US));
+#if SLEEP_CLOCK_EXT1_MASK
+    esp_sleep_enable_ext1_wakeup(SLEEP_CLOCK_EXT1_MASK, ESP_EXT1_WAKEUP_ALL_LOW);
+#endif
+    esp_deep_sleep_start();
+}
+
+/* 只在缓冲区中重画 mask 指定的数字，并只发送这些数字占的块 */
+static void updateDigits(const uint8_t digits[4], uint8_t mask) {
+    for (int i = 0; i < 4; i++) {
+        if (!(mask & (1u << i))) continue;
+        u8g2.setDrawColor(0);
+        u8g2.drawBox(DIGIT_X[i], SLEEP_CLOCK_Y, BIG_W, BIG_H);
+        u8g2.setDrawColor(1);
+        displayDrawBigDigit(DIGIT_X[i], SLEEP_CLOCK_Y, digits[i]);
+        u8g2.updateDisplayArea(DIGIT_X[i] / 8, SLEEP_CLOCK_TILE_ROW, BIG_W / 8, BIG_H / 8);
+    }
+}
+
+static void endMode(SleepExitReason reason) {
+    sleepStateEnd(&s_state, reason);
+}
+
+void sleepClockOnBoot(void) {
+    if (!sleepStateValid(&s_state) || !s_state.active) return;
+    esp_sleep_wakeup_cause_t cause = esp_sleep_get_wakeup_cause();
+    if (cause != ESP_SLEEP_WAKEUP_TIMER) {
+        endMode(cause == ESP_SLEEP_WAKEUP_EXT1 ? SLEEP_EXIT_BUTTON : SLEEP_EXIT_NONE);
+        return;
+    }
+    pinMode(BTN_CENTER_PIN, INPUT_PULLUP);
+    if (digitalRead(BTN_CENTER_PIN) == LOW) {
+        endMode(SLEEP_EXIT_BUTTON);
+        return;
+    }
+    int64_t wall = wallNowUs();
+    if (wall / 1000000 < SLEEP_CLOCK_VALID_EPOCH) {
+        endMode(SLEEP_EXIT_INVALID_TIME);
+        return;
+    }
+    if (s_state.alarmUtc >= 0 && wall / 1000000 >= s_state.alarmUtc) {
+        endMode(SLEEP_EXIT_ALARM);
+        return;
+    }
+
+    tzSelect(s_state.zone);
+    uint8_t digits[4];
+    localDigits(wall, digits);
+    uint8_t mask = sleepStateDirtyMask(&s_state, digits);
+    if (mask) {
+        /* 只初始化 I2C 接口，不发初始化序列，屏幕内容与亮度保持不变 */
+        Wire.begin(I2C_SDA, I2C_SCL);
+        u8g2.setBusClock(400000);
+        u8g2.initInterface();
+        updateDigits(digits, mask);
+        sleepStateCommit(&s_state, digits);
+    }
+    sleepStateRecordWake(&s_state, (uint32_t)esp_timer_get_time(), SLEEP_CLOCK_BUDGET_US);
+    deepSleepUntilNextMinute();
+}
+
+bool sleepClockEnter(void) {
+    bool stopwatchRunning = g_stopwatch.view<bool>([](const StopwatchState& sw) { return sw.core.running; });
+    if (timerEngineRunningCount() > 0 || stopwatchRunning) return false;
+    int64_t wall = wallNowUs();
+    if (wall / 1000000 < SLEEP_CLOCK_VALID_EPOCH) return false;
+    int64_t alarmUtc = -1;
+    int alarmIndex = -1;
+    if (!alarmServiceNextFire(&alarmUtc, &alarmIndex)) alarmUtc = -1;
+    sleepStateBegin(&s_state, tzSelected(), wall, alarmUtc, alarmIndex);
+    configStoreFlush();
+
+    WiFi.disconnect(true);
+    WiFi.mode(WIFI_OFF);
+
+    u8g2.clearBuffer();
+    u8g2.setFont(u8g2_font_wqy12_t_gb2312);
+    const char* title = SLEEP_CLOCK_EXT1_MASK ? u8"省电模式 按键退出" : u8"省电模式 按住中键退出";
+    u8g2.drawUTF8((SCREEN_W - u8g2.getUTF8Width(title)) / 2, DATE_Y_TOP, title);
+    u8g2.drawBitmap(SLEEP_CLOCK_DOT_X, SLEEP_CLOCK_Y, 1, DOT_H, IMAGE_DOT);
+    uint8_t digits[4];
+    localDigits(wall, digits);
+    for (int i = 0; i < 4; i++)
+        displayDrawBigDigit(DIGIT_X[i], SLEEP_CLOCK_Y, digits[i]);
+    u8g2.sendBuffer();
+    u8g2.setContrast(SLEEP_CLOCK_CONTRAST);
+    sleepStateCommit(&s_state, digits);
+
+    LOG_I("Sleep clock: est. %.0fuA avg, %.0fh on %.0fmAh",
+          sleepAverageCurrentUa(&SLEEP_MODEL, SLEEP_CLOCK_BUDGET_US, 60.0f),
+          sleepProjectedHours(&SLEEP_MODEL, SLEEP_CLOCK_BUDGET_US, 60.0f),
+          SLEEP_MODEL_BATTERY_MAH);
+    logServiceFlush();
+    deepSleepUntilNextMinute();
+    return true;
+}
+
+void sleepClockHandleExit(void) {
+    if (!sleepStateValid(&s_state) || s_state.active || s_state.wakeReason == SLEEP_EXIT_NONE) return;
+    uint32_t avg = s_state.wakes ? (uint32_t)(s_state.totalAwakeUs / s_state.wakes) : 0;
+    LOG_I("Sleep clock: exit reason %u after %lu wakes, awake avg %luus max %luus, over budget %lu",
+          s_state.wakeReason, (unsigned long)s_state.wakes, (unsigned long)avg,
+          (unsigned long)s_state.maxAwakeUs, (unsigned long)s_state.overBudget);
+    if (s_state.wakeReason == SLEEP_EXIT_ALARM)
+        alarmServiceFireMissed(s_state.alarmIndex, s_state.alarmUtc);
+    s_state.wakeReason = SLEEP_EXIT_NONE;
+    sleepStateSeal(&s_state);
+}
+
+void sleepClockWritePrometheus(Print& out) {
+    if (!sleepStateValid(&s_state)) return;
+    uint32_t avg = s_state.wakes ? (uint32_t)(s_state.totalAwakeUs / s_state.wakes) : 0;
+    out.printf("# HELP oled_sleep_clock_wakes Timer wakes in the last deep-sleep clock session\n"
+               "# TYPE oled_sleep_clock_wakes gauge\noled_sleep_clock_wakes %lu\n",
+               (unsigned long)s_state.wakes);
+    out.printf("# HELP oled_sleep_clock_awake_us App time per wake (excludes ROM/bootloader)\n"
+               "# TYPE oled_sleep_clock_awake_us gauge\n"
+               "oled_sleep_clock_awake_us{stat=\"avg\"} %lu\n"
+               "oled_sleep_clock_awake_us{stat=\"max\"} %lu\n"
+               "oled_sleep_clock_awake_us{stat=\"budget\"} %u\n",
+               (unsigned long)avg, (unsigned long)s_state.maxAwakeUs, SLEEP_CLOCK_BUDGET_US);
+    out.printf("# TYPE oled_sleep_clock_over_budget gauge\noled_sleep_clock_over_budget %lu\n",
+               (unsigned long)s_state.overBudget);
+    out.printf("# HELP oled_sleep_clock_projected_hours Modelled battery life in deep-sleep clock mode\n"
+               "# TYPE oled_sleep_clock_projected_hours gauge\noled_sleep_clock_projected_hours %.0f\n",
+               sleepProjectedHours(&SLEEP_MODEL, s_state.wakes ? (float)avg : SLEEP_CLOCK_BUDGET_US, 60.0f));
+}
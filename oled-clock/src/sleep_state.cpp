@@ -0,0 +1,87 @@
+/**
+ * @file sleep_state.cpp
+ * @brief 深睡时钟模式状态
+ */
+#include "sleep_state.h"
+#include <stddef.h>
+#include <string.h>
+
+static uint32_t stateCheck(const SleepState* s) {
+    /* FNV-1a，覆盖 check 之前的全部字段 */
+    const uint8_t* p = (const uint8_t*)s;
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < offsetof(SleepState, check); i++) {
+        h ^= p[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+void sleepStateBegin(SleepState* s, int zone, int64_t wallUs, int64_t alarmUtc, int alarmIndex) {
+    memset(s, 0, sizeof(*s));
+    s->magic = SLEEP_STATE_MAGIC;
+    s->active = 1;
+    s->zone = (uint8_t)zone;
+    memset(s->shown, SLEEP_DIGIT_UNKNOWN, sizeof(s->shown));
+    s->enteredUs = wallUs;
+    s->alarmUtc = alarmUtc;
+    s->alarmIndex = (int8_t)alarmIndex;
+    sleepStateSeal(s);
+}
+
+bool sleepStateValid(const SleepState* s) {
+    return s->magic == SLEEP_STATE_MAGIC && s->check == stateCheck(s);
+}
+
+void sleepStateSeal(SleepState* s) {
+    s->check = stateCheck(s);
+}
+
+void sleepStateEnd(SleepState* s, SleepExitReason reason) {
+    s->active = 0;
+    s->wakeReason = (uint8_t)reason;
+    sleepStateSeal(s);
+}
+
+void sleepStateDigits(int hour, int minute, uint8_t out[4]) {
+    out[0] = (uint8_t)(hour / 10);
+    out[1] = (uint8_t)(hour % 10);
+    out[2] = (uint8_t)(minute / 10);
+    out[3] = (uint8_t)(minute % 10);
+}
+
+uint8_t sleepStateDirtyMask(const SleepState* s, const uint8_t want[4]) {
+    uint8_t mask = 0;
+    for (int i = 0; i < 4; i++)
+        if (s->shown[i] != want[i]) mask |= (uint8_t)(1u << i);
+    return mask;
+}
+
+void sleepStateCommit(SleepState* s, const uint8_t digits[4]) {
+    memcpy(s->shown, digits, sizeof(s->shown));
+    sleepStateSeal(s);
+}
+
+void sleepStateRecordWake(SleepState* s, uint32_t awakeUs, uint32_t budgetUs) {
+    s->wakes++;
+    s->lastAwakeUs = awakeUs;
+    if (awakeUs > s->maxAwakeUs) s->maxAwakeUs = awakeUs;
+    if (awakeUs > budgetUs) s->overBudget++;
+    s->totalAwakeUs += awakeUs;
+    sleepStateSeal(s);
+}
+
+uint64_t sleepUsToNextMinute(int64_t wallUs, uint32_t marginUs) {
+    int64_t intoMinute = wallUs % 60000000;
+    if (intoMinute < 0) intoMinute += 60000000;
+    return (uint64_t)(60000000 - intoMinute) + marginUs;
+}
+
+float sleepAverageCurrentUa(const SleepPowerModel* m, float avgAwakeUs, float wakesPerHour) {
+    float dutyAwake = (m->bootUs + avgAwakeUs) * wakesPerHour / 3.6e9f;
+    return m->sleepUa * (1.0f - dutyAwake) + m->awakeMa * 1000.0f * dutyAwake + m->displayUa;
+}
+
+float sleepProjectedHours(const SleepPowerModel* m, float avgAwakeUs, float wakesPerHour) {
+    return m->batteryMah * 1000.0f / sleepAverageCurrentUa(m, avgAwakeUs, wakesPerHour);
+}
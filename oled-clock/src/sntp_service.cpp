@@ -0,0 +1,253 @@
+/**
+ * @file sntp_service.cpp
+ * @brief SNTP 对时服务实现
+ *
+ * 偏差测量：发起请求时记下墙钟、esp_timer 与尚未完成的 adjtime 调整量，回调时
+ *   本地预期时间 = 请求时墙钟 + 未完成调整量 + esp_timer 经过时间
+ *   偏差 = 服务器时间 - 本地预期时间
+ * 与 IMMED / SMOOTH 模式下 IDF 是否已改写墙钟无关。每次对时后停掉 lwIP 的 SNTP，
+ * 由本模块按漂移估计决定何时再次发起。到期时申请 SNTP 联网租约，对时完成、
+ * 一轮服务器都失败或等不到连接时释放。
+ */
+#include "sntp_service.h"
+#include "log_service.h"
+#include "drift_estimator.h"
+#include "app_state.h"
+#include "metrics.h"
+#include "net_service.h"
+#include "time_persist.h"
+#include "time_service.h"
+#include "alarm_service.h"
+#include <esp_sntp.h>
+#include <sys/time.h>
+#include <time.h>
+
+#define SNTP_TIMEOUT_MS         15000            /* 单个服务器无响应则换下一个 */
+#define SNTP_ROUND_RETRY_S      (5 * 60)         /* 所有服务器都失败后，等待再试 */
+#define SNTP_MIN_INTERVAL_S     (15 * 60)
+#define SNTP_MAX_INTERVAL_S     (24 * 3600)
+#define SNTP_DEFAULT_INTERVAL_S 3600
+#define SNTP_TARGET_ERR_MS      100              /* 两次对时之间允许累计的漂移 */
+#define SNTP_BASE_ERR_MS        10               /* 偏差测量的固定误差（另加延迟的一半） */
+#define SNTP_CONNECT_WAIT_MS    30000            /* 申请租约后等连接的上限 */
+
+static const char* const SNTP_SERVERS[] = {
+    "ntp.aliyun.com", "ntp.tencent.com", "ntp.ntsc.ac.cn", "pool.ntp.org"
+};
+#define SNTP_SERVER_COUNT  (sizeof(SNTP_SERVERS) / sizeof(SNTP_SERVERS[0]))
+
+/* 回调（lwIP 任务）写、loop 读 */
+static portMUX_TYPE s_mux = portMUX_INITIALIZER_UNLOCKED;
+static volatile bool s_resultReady = false;
+static int64_t s_resultServerUs = 0;
+static int64_t s_resultMonoUs = 0;
+
+static DriftEstimator s_drift;
+static bool s_inFlight = false;
+static bool s_wasConnected = false;
+static uint32_t s_serverIdx = 0;
+static uint32_t s_triedInRound = 0;
+static int64_t s_reqMonoUs = 0;
+static int64_t s_reqWallUs = 0;
+static int64_t s_reqPendingUs = 0;
+static int64_t s_lastSyncMonoUs = 0;
+static int64_t s_nextDueMonoUs = 0;     /* 0 表示联网后立即对时 */
+static int32_t s_offsetMs = 0;
+static uint32_t s_delayMs = 0;
+static uint32_t s_syncCount = 0;
+static uint32_t s_failCount = 0;
+static bool s_leased = false;
+static int64_t s_leaseMonoUs = 0;
+
+static void onTimeSync(struct timeval* tv) {
+    int64_t mono = esp_timer_get_time();
+    portENTER_CRITICAL(&s_mux);
+    s_resultServerUs = (int64_t)tv->tv_sec * 1000000 + tv->tv_usec;
+    s_resultMonoUs = mono;
+    s_resultReady = true;
+    portEXIT_CRITICAL(&s_mux);
+}
+
+static int64_t wallNowUs(void) {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+static int64_t pendingAdjUs(void) {
+    struct timeval left;
+    if (adjtime(NULL, &left) != 0) return 0;
+    return (int64_t)left.tv_sec * 1000000 + left.tv_usec;
+}
+
+static void sendRequest(void) {
+    if (sntp_enabled()) sntp_stop();
+    sntp_setservername(0, SNTP_SERVERS[s_serverIdx]);
+    sntp_set_sync_mode(s_syncCount == 0 ? SNTP_SYNC_MODE_IMMED : SNTP_SYNC_MODE_SMOOTH);
+    s_reqPendingUs = pendingAdjUs();
+    s_reqWallUs = wallNowUs();
+    s_reqMonoUs = esp_timer_get_time();
+    /*
+     * 每次都重新 sntp_init：结果、超时、断网后都已 sntp_stop，而 sntp_restart 只在
+     * SNTP 仍在运行时才生效，停掉后调用什么也不发。
+     * 本模块自己安排再对时，lwIP 内部轮询间隔设为最长
+     */
+    sntp_setoperatingmode(SNTP_OPMODE_POLL);
+    sntp_set_sync_interval(SNTP_MAX_INTERVAL_S * 1000UL);
+    sntp_init();
+    s_inFlight = true;
+}
+
+static void handleResult(int64_t serverUs, int64_t cbMonoUs) {
+    int64_t expectedUs = s_reqWallUs + s_reqPendingUs + (cbMonoUs - s_reqMonoUs);
+    s_offsetMs = (int32_t)((serverUs - expectedUs) / 1000);
+    s_delayMs = (uint32_t)((cbMonoUs - s_reqMonoUs) / 1000);
+
+    /* 首次对时的偏差来自恢复的估计时间，不能当作漂移样本 */
+    if (s_syncCount > 0) {
+        float intervalS = (float)(cbMonoUs - s_lastSyncMonoUs) / 1e6f;
+        bool used = driftEstimatorAdd(&s_drift, intervalS, (float)s_offsetMs,
+                                      (float)(SNTP_BASE_ERR_MS + s_delayMs / 2));
+        if (!used && intervalS >= DRIFT_MIN_INTERVAL_S)
+            LOG_W("SNTP: offset %ldms rejected as outlier", (long)s_offsetMs);
+    }
+    s_syncCount++;
+    s_lastSyncMonoUs = cbMonoUs;
+    s_triedInRound = 0;
+    uint32_t nextS = driftNextIntervalS(&s_drift, SNTP_TARGET_ERR_MS,
+                                        SNTP_MIN_INTERVAL_S, SNTP_MAX_INTERVAL_S,
+                                        SNTP_DEFAULT_INTERVAL_S);
+    s_nextDueMonoUs = cbMonoUs + (int64_t)nextS * 1000000;
+
+    g_ntpSynced = true;
+    timeServiceInvalidate();
+    alarmServiceReschedule();
+    timePersistMarkSynced();
+    metricsBootMark(BOOT_TIME_SYNC);
+    LOG_I("SNTP: %s offset %+ldms delay %lums drift %.2fppm next %lus",
+          SNTP_SERVERS[s_serverIdx], (long)s_offsetMs, (unsigned long)s_delayMs,
+          driftEstimatorPpm(&s_drift), (unsigned long)nextS);
+}
+
+void sntpServiceBegin(void) {
+    driftEstimatorReset(&s_drift);
+    sntp_set_time_sync_notification_cb(onTimeSync);
+}
+
+static void releaseLease(void) {
+    if (!s_leased) return;
+    netServiceRelease(NET_JOB_SNTP);
+    s_leased = false;
+}
+
+void sntpServiceLoop(void) {
+    bool ready = false;
+    int64_t serverUs = 0, cbMonoUs = 0;
+    portENTER_CRITICAL(&s_mux);
+    if (s_resultReady) {
+        ready = true;
+        s_resultReady = false;
+        serverUs = s_resultServerUs;
+        cbMonoUs = s_resultMonoUs;
+    }
+    portEXIT_CRITICAL(&s_mux);
+
+    if (ready && s_inFlight) {
+        s_inFlight = false;
+        sntp_stop();
+        handleResult(serverUs, cbMonoUs);
+        releaseLease();
+    }
+
+    int64_t now = esp_timer_get_time();
+    bool due = s_nextDueMonoUs == 0 || now >= s_nextDueMonoUs;
+    if (due && !s_leased) {
+        netServiceAcquire(NET_JOB_SNTP, 0);
+        s_leased = true;
+        s_leaseMonoUs = now;
+    }
+
+    bool connected = netServiceIsConnected();
+    bool justConnected = connected && !s_wasConnected;
+    s_wasConnected = connected;
+    if (!connected) {
+        /* 断网期间的超时不算服务器失败，重连后重新发起 */
+        if (s_inFlight) {
+            s_inFlight = false;
+            sntp_stop();
+            s_nextDueMonoUs = 0;
+        }
+        if (s_leased && now - s_leaseMonoUs >= (int64_t)SNTP_CONNECT_WAIT_MS * 1000) {
+            LOG_W("SNTP: no connection, retry later");
+            releaseLease();
+            s_nextDueMonoUs = now + (int64_t)SNTP_ROUND_RETRY_S * 1000000;
+        }
+        return;
+    }
+
+    if (s_inFlight) {
+        if (now - s_reqMonoUs < (int64_t)SNTP_TIMEOUT_MS * 1000) return;
+        s_inFlight = false;
+        sntp_stop();
+        s_failCount++;
+        LOG_W("SNTP: %s timed out", SNTP_SERVERS[s_serverIdx]);
+        s_serverIdx = (s_serverIdx + 1) % SNTP_SERVER_COUNT;
+        if (++s_triedInRound >= SNTP_SERVER_COUNT) {
+            s_triedInRound = 0;
+            s_nextDueMonoUs = now + (int64_t)SNTP_ROUND_RETRY_S * 1000000;
+            releaseLease();
+            return;
+        }
+        sendRequest();
+        return;
+    }
+
+    /* 重连后（含其他任务的租约把射频打开）若距上次对时已超过最短间隔，顺带补一次 */
+    if (justConnected && s_syncCount > 0 &&
+        now - s_lastSyncMonoUs >= (int64_t)SNTP_MIN_INTERVAL_S * 1000000)
+        s_nextDueMonoUs = 0;
+    if (s_nextDueMonoUs == 0 || now >= s_nextDueMonoUs) {
+        if (!s_leased) {
+            netServiceAcquire(NET_JOB_SNTP, 0);
+            s_leased = true;
+            s_leaseMonoUs = now;
+        }
+        sendRequest();
+    }
+}
+
+void sntpServiceGetStatus(SntpStatus* out) {
+    int64_t now = esp_timer_get_time();
+    out->synced = s_syncCount > 0;
+    out->offsetMs = s_offsetMs;
+    out->delayMs = s_delayMs;
+    out->driftPpm = driftEstimatorPpm(&s_drift);
+    out->driftSigmaPpm = driftEstimatorSigmaPpm(&s_drift);
+    out->driftSamples = s_drift.samples;
+    out->ageS = s_syncCount > 0 ? (uint32_t)((now - s_lastSyncMonoUs) / 1000000) : 0;
+    out->nextInS = (s_nextDueMonoUs > now) ? (uint32_t)((s_nextDueMonoUs - now) / 1000000) : 0;
+    out->server = SNTP_SERVERS[s_serverIdx];
+    out->syncCount = s_syncCount;
+    out->failCount = s_failCount;
+}
+
+void sntpServiceWritePrometheus(Print& out) {
+    SntpStatus st;
+    sntpServiceGetStatus(&st);
+    out.printf("# TYPE oled_sntp_syncs_total counter\noled_sntp_syncs_total %lu\n",
+               (unsigned long)st.syncCount);
+    out.printf("# TYPE oled_sntp_failures_total counter\noled_sntp_failures_total %lu\n",
+               (unsigned long)st.failCount);
+    if (!st.synced) return;
+    out.printf("# TYPE oled_sntp_offset_ms gauge\noled_sntp_offset_ms{server=\"%s\"} %ld\n",
+               st.server, (long)st.offsetMs);
+    out.printf("# TYPE oled_sntp_delay_ms gauge\noled_sntp_delay_ms %lu\n",
+               (unsigned long)st.delayMs);
+    out.printf("# TYPE oled_sntp_drift_ppm gauge\noled_sntp_drift_ppm %.3f\n", st.driftPpm);
+    out.printf("# TYPE oled_sntp_drift_samples gauge\noled_sntp_drift_samples %lu\n",
+               (unsigned long)st.driftSamples);
+    out.printf("# TYPE oled_sntp_sync_age_seconds gauge\noled_sntp_sync_age_seconds %lu\n",
+               (unsigned long)st.ageS);
+    out.printf("# TYPE oled_sntp_next_sync_seconds gauge\noled_sntp_next_sync_seconds %lu\n",
+               (unsigned long)st.nextInS);
+}
@@ -0,0 +1,75 @@
+/**
+ * @file stall_core.cpp
+ * @brief loop 卡顿判定与卡顿记录环实现
+ */
+#include "stall_core.h"
+
+void stallDetectorInit(StallDetector* d, uint32_t beat, int64_t nowUs) {
+    d->lastBeat = beat;
+    d->lastProgressUs = nowUs;
+    d->active = false;
+}
+
+StallEvent stallDetectorSample(StallDetector* d, uint32_t beat, uint8_t stage, int64_t nowUs,
+                               uint32_t thresholdMs, uint32_t* stalledMs) {
+    uint32_t ms = (uint32_t)((nowUs - d->lastProgressUs) / 1000);
+    if (beat != d->lastBeat || stage == STALL_IDLE) {
+        bool ended = d->active;
+        d->lastBeat = beat;
+        d->lastProgressUs = nowUs;
+        d->active = false;
+        if (stalledMs) *stalledMs = ended ? ms : 0;
+        return ended ? STALL_EVENT_END : STALL_EVENT_NONE;
+    }
+    if (stalledMs) *stalledMs = ms;
+    if (d->active) return STALL_EVENT_CONTINUE;
+    if (ms < thresholdMs) return STALL_EVENT_NONE;
+    d->active = true;
+    return STALL_EVENT_BEGIN;
+}
+
+void stallHistoryBoot(StallHistory* h, uint32_t magic) {
+    if (h->magic != magic || h->next >= STALL_HISTORY || h->count > STALL_HISTORY) {
+        memset(h, 0, sizeof(*h));
+        h->magic = magic;
+    }
+    h->boots++;
+    for (int i = 0; i < STALL_HISTORY; i++) {
+        StallRecord* r = &h->records[i];
+        if (r->end == STALL_END_ONGOING && r->boot != 0) r->end = STALL_END_RESET;
+        if (r->depth > STALL_BT_DEPTH) r->depth = STALL_BT_DEPTH;
+        r->detail[STALL_DETAIL_MAX - 1] = '\0';
+    }
+}
+
+StallRecord* stallHistoryAdd(StallHistory* h) {
+    StallRecord* r = &h->records[h->next];
+    memset(r, 0, sizeof(*r));
+    r->boot = h->boots;
+    h->next = (uint8_t)((h->next + 1) % STALL_HISTORY);
+    if (h->count < STALL_HISTORY) h->count++;
+    h->total++;
+    return r;
+}
+
+const StallRecord* stallHistoryAt(const StallHistory* h, int i) {
+    if (i < 0 || i >= h->count) return NULL;
+    return &h->records[(h->next + STALL_HISTORY - h->count + i) % STALL_HISTORY];
+}
+
+const char* stallStageName(uint8_t stage) {
+    static const char* const NAMES[STALL_STAGE_COUNT] = {
+        "setup", "idle", "time", "http", "input", "draw", "weather_fetch", "metrics",
+        "energy", "heap", "config", "time_persist", "sntp", "alarm", "power", "net"
+    };
+    return stage < STALL_STAGE_COUNT ? NAMES[stage] : "unknown";
+}
+
+const char* stallEndName(uint8_t end) {
+    switch (end) {
+    case STALL_END_ONGOING:   return "ongoing";
+    case STALL_END_RECOVERED: return "recovered";
+    case STALL_END_RESET:     return "reset";
+    default:                  return "unknown";
+    }
+}
@@ -0,0 +1,187 @@
+/**
+ * @file stall_watch.cpp
+ * @brief loop 卡顿监测实现：监测任务、loop 任务调用回溯、RTC 卡顿记录
+ */
+#include "stall_watch.h"
+#include "log_service.h"
+#include "metrics.h"
+#include <esp_system.h>
+#include <esp_timer.h>
+#include <esp_debug_helpers.h>
+#include <freertos/xtensa_context.h>
+
+#define STALL_RTC_MAGIC     0x53544C4Cu   /* "STLL" */
+
+static RTC_NOINIT_ATTR StallHistory s_history;
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t s_loopTask = NULL;
+static StallRecord* s_current = NULL;      /* 进行中的卡顿，只在监测任务中使用 */
+static volatile bool s_active = false;
+static uint32_t s_count = 0;
+static uint32_t s_maxMs = 0;
+
+/* 回溯中的返回地址：高两位是窗口增量，换回代码地址后减 3 指向调用指令 */
+static uint32_t callSite(uint32_t pc) {
+    if (pc & 0x80000000u) pc = (pc & 0x3FFFFFFFu) | 0x40000000u;
+    return pc - 3;
+}
+
+/*
+ * 按任务切出时保存的现场回溯：TCB 的第一个成员 pxTopOfStack 指向现场帧，
+ * exit 为 0 是主动让出（阻塞、延时）的精简帧，否则是被中断切出的完整帧。
+ * 切出时寄存器窗口已全部溢出到栈上，按窗口 ABI 逐帧取 a0 / a1 即可；每一步都限制在 loop 任务的栈内。
+ */
+static int walkSavedFrame(const void* top, uint32_t* pcs) {
+    const uint8_t* lo = (const uint8_t*)pxTaskGetStackStart(s_loopTask);
+    const uint8_t* hi = lo + getArduinoLoopTaskStackSize();
+    const uint8_t* p = (const uint8_t*)top;
+    if (p < lo || p + sizeof(XtExcFrame) > hi) return 0;
+    esp_backtrace_frame_t frame;
+    const XtExcFrame* exc = (const XtExcFrame*)top;
+    if (exc->exit == 0) {
+        const XtSolFrame* sol = (const XtSolFrame*)top;
+        frame.pc = sol->pc;
+        frame.sp = sol->a1;
+        frame.next_pc = sol->a0;
+    } else {
+        frame.pc = exc->pc;
+        frame.sp = exc->a1;
+        frame.next_pc = exc->a0;
+    }
+    int depth = 0;
+    pcs[depth++] = callSite(frame.pc);
+    while (depth < STALL_BT_DEPTH && frame.next_pc != 0) {
+        const uint8_t* sp = (const uint8_t*)(uintptr_t)frame.sp;
+        if (sp < lo + 16 || sp > hi) break;
+        if (!esp_backtrace_get_next_frame(&frame)) break;
+        pcs[depth++] = callSite(frame.pc);
+    }
+    return depth;
+}
+
+/*
+ * loop 任务阻塞或被抢占时现场已在栈上，直接读，读完确认它期间没有切回来；
+ * 正在 core 1 上运行（忙循环）时先挂起，等现场保存好再读，读完立即恢复。
+ * 两种情况都取不到时返回 0，记录仍保留阶段与时长
+ */
+static int captureBacktrace(uint32_t* pcs) {
+    void* const volatile* topOfStack = (void* const volatile*)s_loopTask;
+    void* before = *topOfStack;
+    if (eTaskGetState(s_loopTask) != eRunning) {
+        int depth = walkSavedFrame(before, pcs);
+        if (*topOfStack != before || eTaskGetState(s_loopTask) == eRunning) return 0;
+        return depth;
+    }
+    vTaskSuspend(s_loopTask);
+    int64_t start = esp_timer_get_time();
+    while (*topOfStack == before && esp_timer_get_time() - start < STALL_SUSPEND_WAIT_US) {
+    }
+    void* top = *topOfStack;
+    int depth = top != before ? walkSavedFrame(top, pcs) : 0;
+    vTaskResume(s_loopTask);
+    return depth;
+}
+
+static void beginRecord(uint32_t stalledMs) {
+    uint8_t stage = g_loopBeat.stage;
+    const char* detail = g_loopBeat.detail;
+    uint32_t pcs[STALL_BT_DEPTH];
+    int depth = captureBacktrace(pcs);
+    char detailBuf[STALL_DETAIL_MAX];
+    snprintf(detailBuf, sizeof(detailBuf), "%s", detail ? detail : "");
+    portENTER_CRITICAL(&s_lock);
+    StallRecord* r = stallHistoryAdd(&s_history);
+    r->uptimeMs = (uint32_t)(esp_timer_get_time() / 1000) - stalledMs;
+    r->durationMs = stalledMs;
+    r->stage = stage;
+    r->end = STALL_END_ONGOING;
+    r->page = (uint8_t)g_state;
+    r->depth = (uint8_t)depth;
+    memcpy(r->detail, detailBuf, sizeof(r->detail));
+    memcpy(r->pcs, pcs, sizeof(uint32_t) * depth);
+    portEXIT_CRITICAL(&s_lock);
+    s_current = r;
+    s_active = true;
+    s_count++;
+    if (stalledMs > s_maxMs) s_maxMs = stalledMs;
+    LOG_W("Stall: loop stuck in %s%s%s (page %d) for %lu ms", stallStageName(stage), detail ? " " : "",
+          detail ? detail : "", (int)r->page, (unsigned long)stalledMs);
+    for (int i = 0; i < depth; i += 4)
+        LOG_W("Stall: backtrace 0x%08lx 0x%08lx 0x%08lx 0x%08lx", (unsigned long)pcs[i],
+              (unsigned long)(i + 1 < depth ? pcs[i + 1] : 0), (unsigned long)(i + 2 < depth ? pcs[i + 2] : 0),
+              (unsigned long)(i + 3 < depth ? pcs[i + 3] : 0));
+}
+
+static void updateRecord(uint32_t stalledMs, uint8_t end) {
+    if (s_current == NULL) return;
+    portENTER_CRITICAL(&s_lock);
+    s_current->durationMs = stalledMs;
+    s_current->end = end;
+    portEXIT_CRITICAL(&s_lock);
+    if (stalledMs > s_maxMs) s_maxMs = stalledMs;
+}
+
+static void monitorTask(void* arg) {
+    StallDetector d;
+    stallDetectorInit(&d, g_loopBeat.beat, esp_timer_get_time());
+    TickType_t wake = xTaskGetTickCount();
+    for (;;) {
+        vTaskDelayUntil(&wake, pdMS_TO_TICKS(STALL_CHECK_MS));
+        uint32_t stalledMs = 0;
+        StallEvent ev = stallDetectorSample(&d, g_loopBeat.beat, g_loopBeat.stage, esp_timer_get_time(),
+                                            STALL_THRESHOLD_MS, &stalledMs);
+        if (ev == STALL_EVENT_BEGIN) {
+            beginRecord(stalledMs);
+        } else if (ev == STALL_EVENT_CONTINUE) {
+            updateRecord(stalledMs, STALL_END_ONGOING);
+        } else if (ev == STALL_EVENT_END) {
+            updateRecord(stalledMs, STALL_END_RECOVERED);
+            s_current = NULL;
+            s_active = false;
+            LOG_W("Stall: loop recovered after %lu ms", (unsigned long)stalledMs);
+        }
+    }
+}
+
+void stallWatchBegin(void) {
+    s_loopTask = xTaskGetCurrentTaskHandle();
+    /* 上电后 RTC 内容是随机的，不能只靠魔数判断 */
+    if (esp_reset_reason() == ESP_RST_POWERON) s_history.magic = 0;
+    stallHistoryBoot(&s_history, STALL_RTC_MAGIC);
+    TaskHandle_t task = NULL;
+    xTaskCreatePinnedToCore(monitorTask, "stall", STALL_TASK_STACK, NULL, STALL_TASK_PRIO, &task, STALL_TASK_CORE);
+    metricsRegisterTask("stall", task);
+}
+
+uint32_t stallWatchCount(void) {
+    return s_count;
+}
+
+void stallWatchWriteJson(Print& out) {
+    portENTER_CRITICAL(&s_lock);
+    StallHistory h = s_history;
+    portEXIT_CRITICAL(&s_lock);
+    out.printf("{\"threshold_ms\":%d,\"check_ms\":%d,\"boot\":%u,\"total\":%lu,\"this_boot\":%lu,"
+               "\"max_ms\":%lu,\"active\":%s,\"records\":[",
+               STALL_THRESHOLD_MS, STALL_CHECK_MS, (unsigned)h.boots, (unsigned long)h.total,
+               (unsigned long)s_count, (unsigned long)s_maxMs, s_active ? "true" : "false");
+    for (int i = 0; i < h.count; i++) {
+        const StallRecord* r = stallHistoryAt(&h, i);
+        out.printf("%s{\"boot\":%u,\"uptime_ms\":%lu,\"duration_ms\":%lu,\"stage\":\"%s\",\"detail\":\"%s\","
+                   "\"page\":%u,\"end\":\"%s\",\"backtrace\":[",
+                   i ? "," : "", (unsigned)r->boot, (unsigned long)r->uptimeMs, (unsigned long)r->durationMs,
+                   stallStageName(r->stage), r->detail, (unsigned)r->page, stallEndName(r->end));
+        for (int j = 0; j < r->depth; j++) out.printf("%s\"0x%08lx\"", j ? "," : "", (unsigned long)r->pcs[j]);
+        out.print("]}");
+    }
+    out.print("]}");
+}
+
+void stallWatchWritePrometheus(Print& out) {
+    out.printf("# HELP oled_stall_total Main-loop stalls longer than the threshold since boot\n"
+               "# TYPE oled_stall_total counter\noled_stall_total %lu\n",
+               (unsigned long)s_count);
+    out.printf("# TYPE oled_stall_max_ms gauge\noled_stall_max_ms %lu\n", (unsigned long)s_maxMs);
+    out.printf("# TYPE oled_stall_active gauge\noled_stall_active %d\n", s_active ? 1 : 0);
+    out.printf("# TYPE oled_stall_threshold_ms gauge\noled_stall_threshold_ms %d\n", STALL_THRESHOLD_MS);
+}
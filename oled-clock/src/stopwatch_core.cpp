@@ -0,0 +1,69 @@
+/**
+ * @file stopwatch_core.cpp
+ * @brief 秒表计时与圈速环形缓冲
+ */
+#include "stopwatch_core.h"
+#include <stdio.h>
+
+void stopwatchCoreReset(StopwatchCore* c) {
+    c->running = false;
+    c->startUs = 0;
+    c->accumUs = 0;
+    c->lastSplitUs = 0;
+    c->lapCount = 0;
+}
+
+bool stopwatchCoreStart(StopwatchCore* c, int64_t nowUs) {
+    if (c->running) return false;
+    c->startUs = nowUs;
+    c->running = true;
+    return true;
+}
+
+bool stopwatchCoreStop(StopwatchCore* c, int64_t nowUs) {
+    if (!c->running) return false;
+    c->accumUs = stopwatchCoreElapsedUs(c, nowUs);
+    c->running = false;
+    return true;
+}
+
+int64_t stopwatchCoreElapsedUs(const StopwatchCore* c, int64_t nowUs) {
+    if (!c->running) return c->accumUs;
+    int64_t run = nowUs - c->startUs;
+    return c->accumUs + (run > 0 ? run : 0);
+}
+
+const StopwatchLap* stopwatchCoreLap(StopwatchCore* c, int64_t nowUs) {
+    if (!c->running) return NULL;
+    int64_t split = stopwatchCoreElapsedUs(c, nowUs);
+    /* 按键时刻可能略早于上一次记圈时读到的时刻，圈时不为负 */
+    if (split < c->lastSplitUs) split = c->lastSplitUs;
+    StopwatchLap* lap = &c->laps[c->lapCount % STOPWATCH_LAP_CAPACITY];
+    lap->number = ++c->lapCount;
+    lap->lapUs = split - c->lastSplitUs;
+    lap->splitUs = split;
+    c->lastSplitUs = split;
+    return lap;
+}
+
+uint32_t stopwatchCoreLapsStored(const StopwatchCore* c) {
+    return c->lapCount < STOPWATCH_LAP_CAPACITY ? c->lapCount : STOPWATCH_LAP_CAPACITY;
+}
+
+const StopwatchLap* stopwatchCoreLapAt(const StopwatchCore* c, uint32_t i) {
+    uint32_t first = c->lapCount - stopwatchCoreLapsStored(c);
+    return &c->laps[(first + i) % STOPWATCH_LAP_CAPACITY];
+}
+
+int stopwatchFormat(int64_t us, char* buf, size_t cap) {
+    if (us < 0) us = 0;
+    uint64_t ms = (uint64_t)us / 1000;
+    unsigned milli = (unsigned)(ms % 1000);
+    uint64_t sec = ms / 1000;
+    unsigned s = (unsigned)(sec % 60);
+    unsigned m = (unsigned)((sec / 60) % 60);
+    unsigned long long h = sec / 3600;
+    if (h > 0)
+        return snprintf(buf, cap, "%llu:%02u:%02u.%03u", h, m, s, milli);
+    return snprintf(buf, cap, "%u:%02u.%03u", m, s, milli);
+}
@@ -1,48 +1,119 @@
 /**
  * @file stopwatch_screen.cpp
- * @brief 秒表：三位大数字秒 + 三位小数字毫秒
+ * @brief 秒表：不足 1 小时为大数字 MM:SS + 小数字毫秒，之后为 HH:MM + 小数字秒；
+ *        底部一行为最近一圈，左键切换圈速列表
  */
 #include "stopwatch_screen.h"
 #include "display.h"
 #include "app_state.h"
-#include <WiFi.h>
+#include "metrics.h"
+#include "bitmap.h"
+#include "net_service.h"
+#include <esp_timer.h>
+
+#define DOT_BYTES  1
+#define DOT_H      32
 
 #define STOPWATCH_TIME_Y   TIME_Y_TOP
 #define STOPWATCH_MINI_Y   (STOPWATCH_TIME_Y + BIG_H - MINI_H)
-#define STOPWATCH_TOTAL_W  (3 * BIG_W + 3 * MINI_W)
-#define STOPWATCH_START_X  ((SCREEN_W - STOPWATCH_TOTAL_W) / 2)
+#define STOPWATCH_BIG_W    (4 * BIG_W + DOT_W)
+#define STOPWATCH_LAP_Y    (SCREEN_H - 1)
+#define STOPWATCH_LIST_Y0  (TOP_BAR_H + 6)
+#define STOPWATCH_LIST_DY  7
+#define STOPWATCH_LIST_ROWS  7
+#define STOPWATCH_MAX_US   ((int64_t)(100LL * 3600 - 1) * 1000000)
 
-void stopwatchScreenDraw(void) {
-    uint32_t totalMs = g_stopwatchAccumulatedMs;
-    if (g_stopwatchRunStartMillis != 0)
-        totalMs += (uint32_t)(millis() - g_stopwatchRunStartMillis);
-    uint32_t sec = totalMs / 1000;
-    uint32_t ms = totalMs % 1000;
-    if (sec > 999) sec = 999;
-    int s1 = (int)(sec / 100), s2 = (int)((sec / 10) % 10), s3 = (int)(sec % 10);
-    int m1 = (int)(ms / 100), m2 = (int)((ms / 10) % 10), m3 = (int)(ms % 10);
+/* 本帧绘制用的秒表快照（约 1.6KB，放静态区不占 loop 栈） */
+static StopwatchState s_sw;
 
+static void drawTopBar(const char* title) {
     u8g2.clearBuffer();
     displayTopBarBackground();
-    displayWiFiIcon(WIFI_ICON_X, WIFI_ICON_Y, WiFi.status() == WL_CONNECTED);
+    displayWiFiIcon(WIFI_ICON_X, WIFI_ICON_Y, netServiceIsConnected());
+    displayPowerStatus();
     u8g2.setFont(u8g2_font_wqy12_t_gb2312);
-    const char* title = u8"秒表";
     int tw = u8g2.getUTF8Width(title);
     u8g2.drawUTF8((SCREEN_W - tw) / 2, DATE_Y_TOP, title);
-    displayBatteryIcon(BATTERY_ICON_X, BATTERY_ICON_Y, displayGetBatteryPercent());
-
-    int x = STOPWATCH_START_X;
-    displayDrawBigDigit(x, STOPWATCH_TIME_Y, s1);  x += BIG_W;
-    displayDrawBigDigit(x, STOPWATCH_TIME_Y, s2);  x += BIG_W;
-    displayDrawBigDigit(x, STOPWATCH_TIME_Y, s3);  x += BIG_W;
-    int miniBlockCenterX = x + (3 * MINI_W) / 2;
-    const char* msLabel = u8"毫秒";
-    int labelW = u8g2.getUTF8Width(msLabel);
+}
+
+/* 两位大数字 + 冒号 + 两位大数字，右侧 n 位小数字（上方带单位） */
+static void drawBigTime(int a, int b, const uint8_t* mini, int miniCount, const char* unit) {
+    int x = (SCREEN_W - STOPWATCH_BIG_W - miniCount * MINI_W) / 2;
+    displayDrawBigDigit(x, STOPWATCH_TIME_Y, a / 10);  x += BIG_W;
+    displayDrawBigDigit(x, STOPWATCH_TIME_Y, a % 10);  x += BIG_W;
+    u8g2.drawBitmap(x, STOPWATCH_TIME_Y, DOT_BYTES, DOT_H, IMAGE_DOT);
+    x += DOT_W;
+    displayDrawBigDigit(x, STOPWATCH_TIME_Y, b / 10);  x += BIG_W;
+    displayDrawBigDigit(x, STOPWATCH_TIME_Y, b % 10);  x += BIG_W;
+
+    int miniBlockCenterX = x + (miniCount * MINI_W) / 2;
+    int labelW = u8g2.getUTF8Width(unit);
     int labelY = STOPWATCH_TIME_Y + u8g2.getAscent() + 6;
-    u8g2.drawUTF8(miniBlockCenterX - labelW / 2, labelY, msLabel);
-    displayDrawMiniDigit(x, STOPWATCH_MINI_Y, m1);  x += MINI_W;
-    displayDrawMiniDigit(x, STOPWATCH_MINI_Y, m2);  x += MINI_W;
-    displayDrawMiniDigit(x, STOPWATCH_MINI_Y, m3);
+    u8g2.drawUTF8(miniBlockCenterX - labelW / 2, labelY, unit);
+    for (int i = 0; i < miniCount; i++) {
+        displayDrawMiniDigit(x, STOPWATCH_MINI_Y, mini[i]);
+        x += MINI_W;
+    }
+}
 
-    u8g2.sendBuffer();
+static void drawMain(int64_t elapsedUs) {
+    drawTopBar(u8"秒表");
+    if (elapsedUs > STOPWATCH_MAX_US) elapsedUs = STOPWATCH_MAX_US;
+    uint64_t ms = (uint64_t)elapsedUs / 1000;
+    uint32_t sec = (uint32_t)(ms / 1000);
+    if (sec < 3600) {
+        uint32_t milli = (uint32_t)(ms % 1000);
+        uint8_t mini[3] = { (uint8_t)(milli / 100), (uint8_t)((milli / 10) % 10), (uint8_t)(milli % 10) };
+        drawBigTime((int)(sec / 60), (int)(sec % 60), mini, 3, u8"毫秒");
+    } else {
+        uint32_t s = sec % 60;
+        uint8_t mini[2] = { (uint8_t)(s / 10), (uint8_t)(s % 10) };
+        drawBigTime((int)(sec / 3600), (int)((sec / 60) % 60), mini, 2, u8"秒");
+    }
+
+    uint32_t stored = stopwatchCoreLapsStored(&s_sw.core);
+    if (stored > 0) {
+        const StopwatchLap* lap = stopwatchCoreLapAt(&s_sw.core, stored - 1);
+        char lapBuf[16], splitBuf[16], line[40];
+        stopwatchFormat(lap->lapUs, lapBuf, sizeof(lapBuf));
+        stopwatchFormat(lap->splitUs, splitBuf, sizeof(splitBuf));
+        snprintf(line, sizeof(line), "L%lu %s", (unsigned long)lap->number, lapBuf);
+        u8g2.setFont(u8g2_font_4x6_tf);
+        u8g2.drawStr(0, STOPWATCH_LAP_Y, line);
+        u8g2.drawStr(SCREEN_W - u8g2.getStrWidth(splitBuf), STOPWATCH_LAP_Y, splitBuf);
+    }
+}
+
+/* 圈速列表：最新在上，每行 圈号 / 本圈 / 累计 */
+static void drawLaps(void) {
+    drawTopBar(u8"圈速");
+    uint32_t stored = stopwatchCoreLapsStored(&s_sw.core);
+    if (stored == 0) {
+        const char* empty = u8"暂无圈速";
+        int w = u8g2.getUTF8Width(empty);
+        u8g2.drawUTF8((SCREEN_W - w) / 2, TOP_BAR_H + 28, empty);
+        return;
+    }
+    u8g2.setFont(u8g2_font_4x6_tf);
+    for (uint32_t row = 0; row < STOPWATCH_LIST_ROWS && row < stored; row++) {
+        const StopwatchLap* lap = stopwatchCoreLapAt(&s_sw.core, stored - 1 - row);
+        char lapBuf[16], splitBuf[16], num[12];
+        stopwatchFormat(lap->lapUs, lapBuf, sizeof(lapBuf));
+        stopwatchFormat(lap->splitUs, splitBuf, sizeof(splitBuf));
+        snprintf(num, sizeof(num), "%3lu", (unsigned long)lap->number);
+        int y = STOPWATCH_LIST_Y0 + (int)row * STOPWATCH_LIST_DY;
+        u8g2.drawStr(0, y, num);
+        u8g2.drawStr(16, y, lapBuf);
+        u8g2.drawStr(SCREEN_W - u8g2.getStrWidth(splitBuf), y, splitBuf);
+    }
+}
+
+void stopwatchScreenDraw(void) {
+    METRICS_SCOPE(MET_DRAW_STOPWATCH);
+    g_stopwatch.read(&s_sw);
+    if (s_sw.showLaps)
+        drawLaps();
+    else
+        drawMain(stopwatchCoreElapsedUs(&s_sw.core, esp_timer_get_time()));
+    displaySendBuffer();
 }
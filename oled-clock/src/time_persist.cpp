@@ -0,0 +1,176 @@
+/**
+ * @file time_persist.cpp
+ * @brief RTC 内存 / NVS 时间快照与误差上界
+ *
+ * 运行中系统时间由 40MHz 晶振推进（TIME_XTAL_PPM）；复位 / 深睡期间由 RTC 慢时钟推进
+ * （内部 RC，校准后仍有较大温漂，TIME_RTC_PPM）。冷启动只能用 NVS 检查点，断电时长未知。
+ */
+#include "time_persist.h"
+#include "log_service.h"
+#include <Arduino.h>
+#include <Preferences.h>
+#include <esp32/rtc.h>
+#include <sys/time.h>
+
+#define TIME_RTC_MAGIC          0x54494D45u   /* "TIME" */
+#define TIME_XTAL_PPM           20
+#define TIME_RTC_PPM            1500
+#define TIME_RESET_GAP_ERR_MS   50            /* 读 RTC 计数的延迟、复位后再次初始化等固定误差 */
+#define TIME_NTP_ERR_MS         50
+#define TIME_SNAPSHOT_MS        1000
+#define TIME_NVS_CHECKPOINT_S   (6 * 3600)
+#define TIME_NVS_AFTER_SYNC_S   3600          /* 对时后若上次检查点已超 1 小时则补写一次 */
+#define TIME_VALID_EPOCH        1577836800    /* 2020-01-01 */
+
+#define PREF_NAMESPACE   "vibe"
+#define PREF_KEY_TCKPT   "tckpt"
+
+struct RtcTimeSnapshot {
+    uint32_t magic;
+    int64_t epochUs;        /* 快照时刻的墙钟时间 */
+    uint64_t rtcUs;         /* 同一时刻的 RTC 慢时钟计数（微秒） */
+    uint32_t errMs;         /* 快照时刻的误差上界 */
+    uint8_t source;
+    uint32_t check;
+};
+
+struct NvsTimeCheckpoint {
+    int64_t epochS;
+    uint32_t errMs;
+};
+
+static RTC_NOINIT_ATTR RtcTimeSnapshot s_rtc;
+
+static TimeSource s_source = TIME_SRC_NONE;
+static uint32_t s_anchorErrMs = 0;     /* 锚点（恢复 / 对时）时的误差 */
+static int64_t s_anchorMonoUs = 0;     /* 锚点时的 esp_timer 时间 */
+static volatile bool s_syncPending = false;
+static uint32_t s_lastSnapshotMs = 0;
+static int64_t s_lastCheckpointMonoUs = 0;
+static bool s_haveCheckpoint = false;
+
+uint32_t timeErrorBoundMs(uint32_t baseErrMs, uint64_t elapsedUs, uint32_t ppm) {
+    uint64_t driftMs = elapsedUs / 1000 * ppm / 1000000;
+    uint64_t total = (uint64_t)baseErrMs + driftMs;
+    return total > 0xFFFFFFFFu ? 0xFFFFFFFFu : (uint32_t)total;
+}
+
+static uint32_t snapshotCheck(const RtcTimeSnapshot* s) {
+    /* 简单校验：防止上电后 RTC 内存的随机内容被当成有效快照 */
+    uint32_t h = s->magic ^ 0xA5A5A5A5u;
+    h = h * 31 + (uint32_t)s->epochUs;
+    h = h * 31 + (uint32_t)(s->epochUs >> 32);
+    h = h * 31 + (uint32_t)s->rtcUs;
+    h = h * 31 + (uint32_t)(s->rtcUs >> 32);
+    h = h * 31 + s->errMs;
+    h = h * 31 + s->source;
+    return h;
+}
+
+static int64_t wallNowUs(void) {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+static void setWallUs(int64_t us) {
+    struct timeval tv;
+    tv.tv_sec = (time_t)(us / 1000000);
+    tv.tv_usec = (suseconds_t)(us % 1000000);
+    settimeofday(&tv, NULL);
+}
+
+static void setAnchor(TimeSource src, uint32_t errMs) {
+    s_source = src;
+    s_anchorErrMs = errMs;
+    s_anchorMonoUs = esp_timer_get_time();
+}
+
+static uint32_t currentErrMs(void) {
+    return timeErrorBoundMs(s_anchorErrMs, (uint64_t)(esp_timer_get_time() - s_anchorMonoUs), TIME_XTAL_PPM);
+}
+
+static void writeRtcSnapshot(void) {
+    s_rtc.magic = TIME_RTC_MAGIC;
+    s_rtc.epochUs = wallNowUs();
+    s_rtc.rtcUs = esp_rtc_get_time_us();
+    s_rtc.errMs = currentErrMs();
+    s_rtc.source = (uint8_t)s_source;
+    s_rtc.check = snapshotCheck(&s_rtc);
+}
+
+static void writeNvsCheckpoint(void) {
+    NvsTimeCheckpoint c;
+    c.epochS = wallNowUs() / 1000000;
+    c.errMs = currentErrMs();
+    Preferences prefs;
+    prefs.begin(PREF_NAMESPACE, false);
+    prefs.putBytes(PREF_KEY_TCKPT, &c, sizeof(c));
+    prefs.end();
+    s_lastCheckpointMonoUs = esp_timer_get_time();
+    s_haveCheckpoint = true;
+}
+
+void timePersistRestore(void) {
+    if (s_rtc.magic == TIME_RTC_MAGIC && s_rtc.check == snapshotCheck(&s_rtc) &&
+        s_rtc.source != TIME_SRC_NONE) {
+        uint64_t rtcNow = esp_rtc_get_time_us();
+        if (rtcNow >= s_rtc.rtcUs) {
+            uint64_t gapUs = rtcNow - s_rtc.rtcUs;
+            setWallUs(s_rtc.epochUs + (int64_t)gapUs);
+            uint32_t err = timeErrorBoundMs(s_rtc.errMs + TIME_RESET_GAP_ERR_MS, gapUs, TIME_RTC_PPM);
+            /* 快照本身来自冷启动检查点时，误差仍无上界 */
+            setAnchor(s_rtc.source == TIME_SRC_NVS ? TIME_SRC_NVS : TIME_SRC_RTC, err);
+            LOG_I("Time: restored from RTC, gap %llums, err <= %lums",
+                  (unsigned long long)(gapUs / 1000), (unsigned long)err);
+            return;
+        }
+    }
+    Preferences prefs;
+    NvsTimeCheckpoint c;
+    prefs.begin(PREF_NAMESPACE, true);
+    size_t n = prefs.getBytes(PREF_KEY_TCKPT, &c, sizeof(c));
+    prefs.end();
+    if (n == sizeof(c) && c.epochS >= TIME_VALID_EPOCH) {
+        setWallUs(c.epochS * 1000000);
+        setAnchor(TIME_SRC_NVS, c.errMs);
+        s_haveCheckpoint = true;
+        LOG_I("Time: restored from NVS checkpoint (power-off time unknown)");
+    }
+}
+
+void timePersistMarkSynced(void) {
+    s_syncPending = true;
+}
+
+void timePersistService(void) {
+    if (s_syncPending) {
+        s_syncPending = false;
+        bool firstSync = (s_source != TIME_SRC_NTP);
+        setAnchor(TIME_SRC_NTP, TIME_NTP_ERR_MS);
+        writeRtcSnapshot();
+        if (firstSync || !s_haveCheckpoint ||
+            esp_timer_get_time() - s_lastCheckpointMonoUs >= (int64_t)TIME_NVS_AFTER_SYNC_S * 1000000)
+            writeNvsCheckpoint();
+    }
+    if (s_source == TIME_SRC_NONE) return;
+
+    uint32_t now = millis();
+    if ((uint32_t)(now - s_lastSnapshotMs) >= TIME_SNAPSHOT_MS) {
+        s_lastSnapshotMs = now;
+        writeRtcSnapshot();
+    }
+    if (s_source == TIME_SRC_NTP &&
+        esp_timer_get_time() - s_lastCheckpointMonoUs >= (int64_t)TIME_NVS_CHECKPOINT_S * 1000000)
+        writeNvsCheckpoint();
+}
+
+TimeSource timePersistSource(void) {
+    return s_source;
+}
+
+bool timePersistErrorBoundMs(uint32_t* outMs) {
+    if (s_source == TIME_SRC_NONE || s_source == TIME_SRC_NVS) return false;
+    *outMs = currentErrMs();
+    return true;
+}
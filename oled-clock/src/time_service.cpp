@@ -0,0 +1,58 @@
+/**
+ * @file time_service.cpp
+ * @brief 本地时间缓存与增量推进
+ */
+#include "time_service.h"
+#include "tz_engine.h"
+
+#define TIME_VALID_EPOCH   1577836800    /* 2020-01-01，之前视为系统时间未设置 */
+
+static struct tm s_tm;
+static time_t s_epoch = 0;
+static time_t s_nextFullEpoch = 0;     /* 到达此刻（下一个本地零点或时区偏移变化）时完整重算 */
+static bool s_valid = false;
+static bool s_dirty = true;
+
+static void recomputeFull(time_t now) {
+    int64_t nextChange;
+    tzLocalTime(now, &s_tm, &nextChange);
+    s_epoch = now;
+    int secOfDay = s_tm.tm_hour * 3600 + s_tm.tm_min * 60 + s_tm.tm_sec;
+    s_nextFullEpoch = now + (86400 - secOfDay);
+    if (nextChange < (int64_t)s_nextFullEpoch)
+        s_nextFullEpoch = (time_t)nextChange;
+    s_dirty = false;
+}
+
+/* 同一天内前进 delta 秒（调用方保证不跨零点） */
+static void advance(time_t delta) {
+    int sec = s_tm.tm_sec + (int)delta;
+    int min = s_tm.tm_min + sec / 60;
+    s_tm.tm_sec = sec % 60;
+    s_tm.tm_hour += min / 60;
+    s_tm.tm_min = min % 60;
+}
+
+void timeServiceTick(void) {
+    time_t now = time(NULL);
+    s_valid = (now >= TIME_VALID_EPOCH);
+    if (s_dirty || now < s_epoch || now >= s_nextFullEpoch) {
+        recomputeFull(now);
+    } else if (now != s_epoch) {
+        advance(now - s_epoch);
+        s_epoch = now;
+    }
+}
+
+void timeServiceInvalidate(void) {
+    s_dirty = true;
+}
+
+bool timeServiceNow(struct tm* out) {
+    *out = s_tm;
+    return s_valid;
+}
+
+time_t timeServiceEpoch(void) {
+    return s_epoch;
+}
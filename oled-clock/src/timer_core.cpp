@@ -0,0 +1,125 @@
+/**
+ * @file timer_core.cpp
+ * @brief 多路倒计时：槽位状态机与截止时刻最小堆
+ */
+#include "timer_core.h"
+#include <string.h>
+
+static void heapSwap(TimerCore* c, int i, int j) {
+    TimerHeapNode t = c->heap[i];
+    c->heap[i] = c->heap[j];
+    c->heap[j] = t;
+    c->heapPos[c->heap[i].slot] = (int8_t)i;
+    c->heapPos[c->heap[j].slot] = (int8_t)j;
+}
+
+static void siftUp(TimerCore* c, int i) {
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!timerDeadlineBefore(c->heap[i].deadlineUs, c->heap[parent].deadlineUs)) break;
+        heapSwap(c, i, parent);
+        i = parent;
+    }
+}
+
+static void siftDown(TimerCore* c, int i) {
+    for (;;) {
+        int l = 2 * i + 1, r = l + 1, m = i;
+        if (l < c->heapLen && timerDeadlineBefore(c->heap[l].deadlineUs, c->heap[m].deadlineUs)) m = l;
+        if (r < c->heapLen && timerDeadlineBefore(c->heap[r].deadlineUs, c->heap[m].deadlineUs)) m = r;
+        if (m == i) break;
+        heapSwap(c, i, m);
+        i = m;
+    }
+}
+
+static void heapPush(TimerCore* c, int slot, uint64_t deadlineUs) {
+    int i = c->heapLen++;
+    c->heap[i].deadlineUs = deadlineUs;
+    c->heap[i].slot = (uint8_t)slot;
+    c->heapPos[slot] = (int8_t)i;
+    siftUp(c, i);
+}
+
+static void heapRemove(TimerCore* c, int slot) {
+    int i = c->heapPos[slot];
+    if (i < 0) return;
+    int last = --c->heapLen;
+    if (i != last) {
+        heapSwap(c, i, last);
+        siftDown(c, i);
+        siftUp(c, i);
+    }
+    c->heapPos[slot] = -1;
+}
+
+void timerCoreInit(TimerCore* c) {
+    memset(c, 0, sizeof(*c));
+    for (int i = 0; i < TIMER_SLOTS; i++) c->heapPos[i] = -1;
+}
+
+bool timerCoreSetDuration(TimerCore* c, int slot, uint32_t seconds) {
+    if (c->slots[slot].state != TIMER_IDLE) return false;
+    c->slots[slot].durationS = seconds > TIMER_MAX_SECONDS ? TIMER_MAX_SECONDS : seconds;
+    return true;
+}
+
+bool timerCoreStart(TimerCore* c, int slot, uint64_t nowUs) {
+    TimerSlot* s = &c->slots[slot];
+    if (s->durationS == 0 || s->state == TIMER_RUNNING || s->state == TIMER_PAUSED) return false;
+    s->deadlineUs = nowUs + (uint64_t)s->durationS * 1000000;
+    s->state = TIMER_RUNNING;
+    heapPush(c, slot, s->deadlineUs);
+    return true;
+}
+
+bool timerCorePause(TimerCore* c, int slot, uint64_t nowUs) {
+    TimerSlot* s = &c->slots[slot];
+    if (s->state != TIMER_RUNNING) return false;
+    s->remainUs = timerDeadlineBefore(nowUs, s->deadlineUs) ? s->deadlineUs - nowUs : 0;
+    s->state = TIMER_PAUSED;
+    heapRemove(c, slot);
+    return true;
+}
+
+bool timerCoreResume(TimerCore* c, int slot, uint64_t nowUs) {
+    TimerSlot* s = &c->slots[slot];
+    if (s->state != TIMER_PAUSED) return false;
+    s->deadlineUs = nowUs + s->remainUs;
+    s->state = TIMER_RUNNING;
+    heapPush(c, slot, s->deadlineUs);
+    return true;
+}
+
+void timerCoreCancel(TimerCore* c, int slot) {
+    heapRemove(c, slot);
+    c->slots[slot].state = TIMER_IDLE;
+}
+
+int timerCorePopExpired(TimerCore* c, uint64_t nowUs) {
+    if (c->heapLen == 0 || timerDeadlineBefore(nowUs, c->heap[0].deadlineUs)) return -1;
+    int slot = c->heap[0].slot;
+    heapRemove(c, slot);
+    c->slots[slot].state = TIMER_RINGING;
+    return slot;
+}
+
+bool timerCoreNextDeadline(const TimerCore* c, uint64_t* outUs) {
+    if (c->heapLen == 0) return false;
+    *outUs = c->heap[0].deadlineUs;
+    return true;
+}
+
+uint64_t timerCoreRemainingUs(const TimerCore* c, int slot, uint64_t nowUs) {
+    const TimerSlot* s = &c->slots[slot];
+    switch (s->state) {
+        case TIMER_RUNNING:
+            return timerDeadlineBefore(nowUs, s->deadlineUs) ? s->deadlineUs - nowUs : 0;
+        case TIMER_PAUSED:
+            return s->remainUs;
+        case TIMER_RINGING:
+            return 0;
+        default:
+            return (uint64_t)s->durationS * 1000000;
+    }
+}
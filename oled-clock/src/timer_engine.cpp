@@ -0,0 +1,134 @@
+/**
+ * @file timer_engine.cpp
+ * @brief 多路倒计时引擎实现
+ *
+ * 任何改动堆的操作之后都按新的堆顶重新装填 esp_timer；回调中先取出所有已到时的
+ * 槽位并重新装填，再在锁外逐个调用 onFired。
+ */
+#include "timer_engine.h"
+#include <Arduino.h>
+#include <esp_timer.h>
+
+static portMUX_TYPE s_mux = portMUX_INITIALIZER_UNLOCKED;
+static TimerCore s_core;
+static esp_timer_handle_t s_timer = NULL;
+static TimerFiredCb s_onFired = NULL;
+
+static inline uint64_t nowUs(void) {
+    return (uint64_t)esp_timer_get_time();
+}
+
+/* 持锁调用：按堆顶重新装填（esp_timer 自身的锁可嵌套在 portMUX 内） */
+static void rearmLocked(uint64_t now) {
+    esp_timer_stop(s_timer);
+    uint64_t deadline;
+    if (!timerCoreNextDeadline(&s_core, &deadline)) return;
+    uint64_t delayUs = timerDeadlineBefore(now, deadline) ? deadline - now : 0;
+    esp_timer_start_once(s_timer, delayUs);
+}
+
+static void onTimer(void* arg) {
+    int fired[TIMER_SLOTS];
+    int n = 0;
+    portENTER_CRITICAL(&s_mux);
+    uint64_t now = nowUs();
+    int slot;
+    while (n < TIMER_SLOTS && (slot = timerCorePopExpired(&s_core, now)) >= 0)
+        fired[n++] = slot;
+    rearmLocked(now);
+    portEXIT_CRITICAL(&s_mux);
+
+    if (s_onFired) {
+        for (int i = 0; i < n; i++) s_onFired(fired[i]);
+    }
+}
+
+void timerEngineBegin(TimerFiredCb onFired) {
+    timerCoreInit(&s_core);
+    s_onFired = onFired;
+    esp_timer_create_args_t args = {};
+    args.callback = onTimer;
+    args.dispatch_method = ESP_TIMER_TASK;
+    args.name = "countdown";
+    esp_timer_create(&args, &s_timer);
+}
+
+static bool validSlot(int slot) {
+    return s_timer != NULL && slot >= 0 && slot < TIMER_SLOTS;
+}
+
+bool timerEngineSetDuration(int slot, uint32_t seconds) {
+    if (!validSlot(slot)) return false;
+    portENTER_CRITICAL(&s_mux);
+    bool ok = timerCoreSetDuration(&s_core, slot, seconds);
+    portEXIT_CRITICAL(&s_mux);
+    return ok;
+}
+
+bool timerEngineStart(int slot) {
+    if (!validSlot(slot)) return false;
+    portENTER_CRITICAL(&s_mux);
+    uint64_t now = nowUs();
+    bool ok = timerCoreStart(&s_core, slot, now);
+    if (ok) rearmLocked(now);
+    portEXIT_CRITICAL(&s_mux);
+    return ok;
+}
+
+bool timerEnginePause(int slot) {
+    if (!validSlot(slot)) return false;
+    portENTER_CRITICAL(&s_mux);
+    uint64_t now = nowUs();
+    bool ok = timerCorePause(&s_core, slot, now);
+    if (ok) rearmLocked(now);
+    portEXIT_CRITICAL(&s_mux);
+    return ok;
+}
+
+bool timerEngineResume(int slot) {
+    if (!validSlot(slot)) return false;
+    portENTER_CRITICAL(&s_mux);
+    uint64_t now = nowUs();
+    bool ok = timerCoreResume(&s_core, slot, now);
+    if (ok) rearmLocked(now);
+    portEXIT_CRITICAL(&s_mux);
+    return ok;
+}
+
+void timerEngineCancel(int slot) {
+    if (!validSlot(slot)) return;
+    portENTER_CRITICAL(&s_mux);
+    timerCoreCancel(&s_core, slot);
+    rearmLocked(nowUs());
+    portEXIT_CRITICAL(&s_mux);
+}
+
+int timerEngineDismissRinging(void) {
+    int n = 0;
+    portENTER_CRITICAL(&s_mux);
+    for (int i = 0; i < TIMER_SLOTS; i++) {
+        if (s_core.slots[i].state == TIMER_RINGING) {
+            timerCoreCancel(&s_core, i);
+            n++;
+        }
+    }
+    portEXIT_CRITICAL(&s_mux);
+    return n;
+}
+
+void timerEngineGet(int slot, TimerView* out) {
+    portENTER_CRITICAL(&s_mux);
+    out->state = s_core.slots[slot].state;
+    out->durationS = s_core.slots[slot].durationS;
+    uint64_t remainUs = timerCoreRemainingUs(&s_core, slot, nowUs());
+    portEXIT_CRITICAL(&s_mux);
+    /* 向上取整到毫秒，显示上 00:01 在真正到时前不会提前变 00:00 */
+    out->remainMs = (uint32_t)((remainUs + 999) / 1000);
+}
+
+int timerEngineRunningCount(void) {
+    portENTER_CRITICAL(&s_mux);
+    int n = s_core.heapLen;
+    portEXIT_CRITICAL(&s_mux);
+    return n;
+}
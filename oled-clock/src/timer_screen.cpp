@@ -1,16 +1,16 @@
 /**
  * @file timer_screen.cpp
- * @brief 倒计时：位图 MM:SS、三角指示当前位、结束蜂鸣
+ * @brief 倒计时：位图 MM:SS（当前选中的一路）、底部各路状态条、编辑时三角指示当前位
  */
 #include "timer_screen.h"
 #include "display.h"
 #include "app_state.h"
+#include "metrics.h"
 #include "bitmap.h"
+#include "net_service.h"
+#include "timer_engine.h"
 #include <Arduino.h>
-#include <WiFi.h>
 
-#define BUZZER_PIN  23
-#define TIMER_LEDC_CHANNEL  0
 #define DOT_BYTES  1
 #define DOT_H      32
 
@@ -20,6 +20,9 @@
 #define TIMER_START_X   ((SCREEN_W - TIMER_TOTAL_W) / 2)
 #define TIMER_TRI_TIP_Y   (TIMER_TIME_Y + BIG_H + 1)
 #define TIMER_TRI_BASE_Y  (TIMER_TIME_Y + BIG_H + 7)
+#define TIMER_TAB_Y       (TIMER_TIME_Y + BIG_H + 1)
+#define TIMER_TAB_W       (SCREEN_W / TIMER_SLOTS)
+#define TIMER_TAB_H       7
 
 static int timerDigitCenterX(int pos) {
     if (pos <= 1)
@@ -27,59 +30,97 @@ static int timerDigitCenterX(int pos) {
     return TIMER_START_X + 2 * BIG_W + TIMER_COLON_W + (pos - 2) * BIG_W + BIG_W / 2;
 }
 
-void timerScreenPlayBeep(void) {
-    const uint32_t totalMs = 10000;
-    const int freq = 2000;
-    const int beepOnMs = 180;
-    const int beepOffMs = 120;
-    const int pauseBetweenPairsMs = 480;
-    uint32_t t0 = millis();
-    while ((uint32_t)(millis() - t0) < totalMs) {
-        ledcWriteTone(TIMER_LEDC_CHANNEL, freq);
-        delay(beepOnMs);
-        ledcWriteTone(TIMER_LEDC_CHANNEL, 0);
-        delay(beepOffMs);
-        ledcWriteTone(TIMER_LEDC_CHANNEL, freq);
-        delay(beepOnMs);
-        ledcWriteTone(TIMER_LEDC_CHANNEL, 0);
-        delay(pauseBetweenPairsMs);
+/* 显示用秒数：运行 / 暂停按剩余时间向上取整，空闲为设定时长，响铃为 0 */
+static uint32_t viewSeconds(const TimerView* v) {
+    if (v->state == TIMER_IDLE) return v->durationS;
+    return (v->remainMs + 999) / 1000;
+}
+
+void timerScreenBeginEdit(void) {
+    SeqWrite<TimerPageState> tp(g_timerPage);
+    TimerView v;
+    timerEngineGet(tp->sel, &v);
+    uint32_t min = v.durationS / 60, sec = v.durationS % 60;
+    tp->digits[0] = (uint8_t)(min / 10);
+    tp->digits[1] = (uint8_t)(min % 10);
+    tp->digits[2] = (uint8_t)(sec / 10);
+    tp->digits[3] = (uint8_t)(sec % 10);
+    tp->digitPos = 0;
+    tp->editing = true;
+}
+
+void timerScreenCommitEdit(void) {
+    SeqWrite<TimerPageState> tp(g_timerPage);
+    uint32_t totalSec = (tp->digits[0] * 10U + tp->digits[1]) * 60U
+        + (tp->digits[2] * 10U + tp->digits[3]);
+    timerEngineSetDuration(tp->sel, totalSec);
+    if (totalSec > 0) timerEngineStart(tp->sel);
+    tp->editing = false;
+}
+
+static void drawTabs(int sel) {
+    u8g2.setFont(u8g2_font_4x6_tf);
+    for (int i = 0; i < TIMER_SLOTS; i++) {
+        TimerView v;
+        timerEngineGet(i, &v);
+        uint32_t sec = viewSeconds(&v);
+        static const char STATE_MARK[] = { ' ', '>', '=', '!' };
+        char buf[12];
+        snprintf(buf, sizeof(buf), "%d%c%02u:%02u", i + 1, STATE_MARK[v.state],
+                 (unsigned)(sec / 60), (unsigned)(sec % 60));
+        int x = i * TIMER_TAB_W;
+        if (i == sel) {
+            u8g2.drawBox(x, TIMER_TAB_Y, TIMER_TAB_W - 1, TIMER_TAB_H);
+            u8g2.setDrawColor(0);
+        }
+        u8g2.drawStr(x + 2, TIMER_TAB_Y + TIMER_TAB_H - 1, buf);
+        u8g2.setDrawColor(1);
     }
-    ledcWriteTone(TIMER_LEDC_CHANNEL, 0);
 }
 
 void timerScreenDraw(void) {
+    METRICS_SCOPE(MET_DRAW_TIMER);
+    TimerPageState tp = g_timerPage.get();
     u8g2.clearBuffer();
     displayTopBarBackground();
-    displayWiFiIcon(WIFI_ICON_X, WIFI_ICON_Y, WiFi.status() == WL_CONNECTED);
+    displayWiFiIcon(WIFI_ICON_X, WIFI_ICON_Y, netServiceIsConnected());
+    displayPowerStatus();
     u8g2.setFont(u8g2_font_wqy12_t_gb2312);
-    const char* title = u8"倒计时";
+    const char* title = tp.editing ? u8"设置倒计时" : u8"倒计时";
     int tw = u8g2.getUTF8Width(title);
     u8g2.drawUTF8((SCREEN_W - tw) / 2, DATE_Y_TOP, title);
-    displayBatteryIcon(BATTERY_ICON_X, BATTERY_ICON_Y, displayGetBatteryPercent());
 
-    int m1 = g_timerDigits[0], m2 = g_timerDigits[1];
-    int s1 = g_timerDigits[2], s2 = g_timerDigits[3];
-    if (g_timerRunning) {
-        uint32_t remain = (g_timerEndMillis > millis()) ? (g_timerEndMillis - millis()) : 0;
-        uint32_t sec = remain / 1000;
+    int m1 = tp.digits[0], m2 = tp.digits[1];
+    int s1 = tp.digits[2], s2 = tp.digits[3];
+    bool blank = false;
+    if (!tp.editing) {
+        TimerView v;
+        timerEngineGet(tp.sel, &v);
+        uint32_t sec = viewSeconds(&v);
         m1 = (int)(sec / 60) / 10;
         m2 = (int)(sec / 60) % 10;
         s1 = (int)(sec % 60) / 10;
         s2 = (int)(sec % 60) % 10;
+        /* 暂停与响铃时数字闪烁 */
+        blank = (v.state == TIMER_PAUSED || v.state == TIMER_RINGING) && ((millis() / 500) & 1);
     }
 
-    int x = TIMER_START_X;
-    displayDrawBigDigit(x, TIMER_TIME_Y, m1);  x += BIG_W;
-    displayDrawBigDigit(x, TIMER_TIME_Y, m2);  x += BIG_W;
-    u8g2.drawBitmap(x, TIMER_TIME_Y, DOT_BYTES, DOT_H, IMAGE_DOT);
-    x += TIMER_COLON_W;
-    displayDrawBigDigit(x, TIMER_TIME_Y, s1);  x += BIG_W;
-    displayDrawBigDigit(x, TIMER_TIME_Y, s2);
+    if (!blank) {
+        int x = TIMER_START_X;
+        displayDrawBigDigit(x, TIMER_TIME_Y, m1);  x += BIG_W;
+        displayDrawBigDigit(x, TIMER_TIME_Y, m2);  x += BIG_W;
+        u8g2.drawBitmap(x, TIMER_TIME_Y, DOT_BYTES, DOT_H, IMAGE_DOT);
+        x += TIMER_COLON_W;
+        displayDrawBigDigit(x, TIMER_TIME_Y, s1);  x += BIG_W;
+        displayDrawBigDigit(x, TIMER_TIME_Y, s2);
+    }
 
-    if (!g_timerRunning) {
-        int cx = timerDigitCenterX(g_timerDigitPos);
+    if (tp.editing) {
+        int cx = timerDigitCenterX(tp.digitPos);
         u8g2.drawTriangle(cx - 5, TIMER_TRI_BASE_Y, cx, TIMER_TRI_TIP_Y, cx + 5, TIMER_TRI_BASE_Y);
+    } else {
+        drawTabs(tp.sel);
     }
 
-    u8g2.sendBuffer();
+    displaySendBuffer();
 }
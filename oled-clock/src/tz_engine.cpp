@@ -0,0 +1,106 @@
+/**
+ * @file tz_engine.cpp
+ * @brief 时区表查询与本地时间拆分
+ */
+#include "tz_engine.h"
+#include "tz_table.h"
+#include <string.h>
+
+static int s_zone = TZ_DEFAULT_ZONE;
+/* 缓存：[s_validFrom, s_validTo) 内偏移为 s_offset */
+static int64_t s_validFrom = 1;
+static int64_t s_validTo = 0;
+static int32_t s_offset = 0;
+static bool s_isDst = false;
+
+int tzZoneCount(void) {
+    return TZ_ZONE_COUNT;
+}
+
+const char* tzZoneName(int zone) {
+    return TZ_ZONES[zone].name;
+}
+
+int tzFindZone(const char* name) {
+    for (int i = 0; i < TZ_ZONE_COUNT; i++)
+        if (strcmp(TZ_ZONES[i].name, name) == 0) return i;
+    return -1;
+}
+
+void tzSelect(int zone) {
+    s_zone = (zone >= 0 && zone < TZ_ZONE_COUNT) ? zone : TZ_DEFAULT_ZONE;
+    s_validFrom = 1;
+    s_validTo = 0;
+}
+
+int tzSelected(void) {
+    return s_zone;
+}
+
+/* 返回 utc 时刻之前（含）最后一个变化点的下标，没有则为 -1 */
+static int findTransition(const TzZoneEntry* z, int64_t utc) {
+    int lo = 0, hi = z->count;     /* 第一个 > utc 的位置 */
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if ((int64_t)TZ_TRANS_UTC[z->first + mid] <= utc)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo - 1;
+}
+
+static int32_t offsetOf(const TzZoneEntry* z, int idx) {
+    return (int32_t)(idx < 0 ? z->firstQuarters : TZ_TRANS_OFFSET[z->first + idx]) * 900;
+}
+
+int32_t tzOffsetAt(int zone, int64_t utc) {
+    const TzZoneEntry* z = &TZ_ZONES[zone];
+    return offsetOf(z, findTransition(z, utc));
+}
+
+static void refreshCache(int64_t utc) {
+    const TzZoneEntry* z = &TZ_ZONES[s_zone];
+    int idx = findTransition(z, utc);
+    s_offset = offsetOf(z, idx);
+    s_isDst = (s_offset != (int32_t)z->stdQuarters * 900);
+    s_validFrom = idx < 0 ? INT64_MIN : (int64_t)TZ_TRANS_UTC[z->first + idx];
+    s_validTo = idx + 1 < z->count ? (int64_t)TZ_TRANS_UTC[z->first + idx + 1] : INT64_MAX;
+}
+
+void tzLocalTime(int64_t utc, struct tm* out, int64_t* nextChange) {
+    if (utc < s_validFrom || utc >= s_validTo)
+        refreshCache(utc);
+    tzCivilFromSeconds(utc + s_offset, out);
+    out->tm_isdst = s_isDst ? 1 : 0;
+    if (nextChange) *nextChange = s_validTo;
+}
+
+void tzCivilFromSeconds(int64_t localSec, struct tm* out) {
+    int64_t days = localSec / 86400;
+    int32_t sod = (int32_t)(localSec % 86400);
+    if (sod < 0) {
+        sod += 86400;
+        days--;
+    }
+    out->tm_hour = sod / 3600;
+    out->tm_min = sod / 60 % 60;
+    out->tm_sec = sod % 60;
+    out->tm_wday = (int)((days % 7 + 11) % 7);     /* 1970-01-01 为周四 */
+
+    /* Hinnant civil_from_days：以 3 月为年首，400 年一个周期 */
+    int64_t z = days + 719468;
+    int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+    int32_t doe = (int32_t)(z - era * 146097);
+    int32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    int32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    int32_t mp = (5 * doy + 2) / 153;
+    int32_t d = doy - (153 * mp + 2) / 5 + 1;
+    int32_t m = mp < 10 ? mp + 3 : mp - 9;
+    int64_t y = yoe + era * 400 + (m <= 2 ? 1 : 0);
+    out->tm_year = (int)(y - 1900);
+    out->tm_mon = m - 1;
+    out->tm_mday = d;
+    bool leap = (y % 4 == 0 && y % 100 != 0) || y % 400 == 0;
+    out->tm_yday = doy >= 306 ? doy - 306 : doy + 59 + (leap ? 1 : 0);
+}
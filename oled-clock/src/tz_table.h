@@ -0,0 +1,312 @@
+/*
+ * 由 tools/gen_tz_table.py 生成，勿手工修改。
+ * 时区 21 个，变化点 1098 个（2020..2080 年），偏移单位 15 分钟。
+ */
+#ifndef TZ_TABLE_H
+#define TZ_TABLE_H
+
+#include <stdint.h>
+
+#define TZ_TABLE_FIRST_UTC 1577836800u
+#define TZ_ZONE_COUNT 21
+
+struct TzZoneEntry {
+    const char* name;
+    int8_t firstQuarters;   /* 表首（2020-01-01）的偏移 */
+    int8_t stdQuarters;     /* 标准时偏移（非夏令时） */
+    uint16_t first;         /* 在变化点数组中的起始下标 */
+    uint16_t count;
+};
+
+static const uint32_t TZ_TRANS_UTC[1098] = {
+    /* Europe/London */
+    1585443600u, 1603587600u, 1616893200u, 1635642000u, 1648342800u, 1667091600u,
+    1679792400u, 1698541200u, 1711846800u, 1729990800u, 1743296400u, 1761440400u,
+    1774746000u, 1792890000u, 1806195600u, 1824944400u, 1837645200u, 1856394000u,
+    1869094800u, 1887843600u, 1901149200u, 1919293200u, 1932598800u, 1950742800u,
+    1964048400u, 1982797200u, 1995498000u, 2014246800u, 2026947600u, 2045696400u,
+    2058397200u, 2077146000u, 2090451600u, 2108595600u, 2121901200u, 2140045200u,
+    2153350800u, 2172099600u, 2184800400u, 2203549200u, 2216250000u, 2234998800u,
+    2248304400u, 2266448400u, 2279754000u, 2297898000u, 2311203600u, 2329347600u,
+    2342653200u, 2361402000u, 2374102800u, 2392851600u, 2405552400u, 2424301200u,
+    2437606800u, 2455750800u, 2469056400u, 2487200400u, 2500506000u, 2519254800u,
+    2531955600u, 2550704400u, 2563405200u, 2582154000u, 2595459600u, 2613603600u,
+    2626909200u, 2645053200u, 2658358800u, 2676502800u, 2689808400u, 2708557200u,
+    2721258000u, 2740006800u, 2752707600u, 2771456400u, 2784762000u, 2802906000u,
+    2816211600u, 2834355600u, 2847661200u, 2866410000u, 2879110800u, 2897859600u,
+    2910560400u, 2929309200u, 2942010000u, 2960758800u, 2974064400u, 2992208400u,
+    3005514000u, 3023658000u, 3036963600u, 3055712400u, 3068413200u, 3087162000u,
+    3099862800u, 3118611600u, 3131917200u, 3150061200u, 3163366800u, 3181510800u,
+    3194816400u, 3212960400u, 3226266000u, 3245014800u, 3257715600u, 3276464400u,
+    3289165200u, 3307914000u, 3321219600u, 3339363600u, 3352669200u, 3370813200u,
+    3384118800u, 3402867600u, 3415568400u, 3434317200u, 3447018000u, 3465766800u,
+    3479072400u, 3497216400u,
+    /* Europe/Berlin */
+    1585443600u, 1603587600u, 1616893200u, 1635642000u, 1648342800u, 1667091600u,
+    1679792400u, 1698541200u, 1711846800u, 1729990800u, 1743296400u, 1761440400u,
+    1774746000u, 1792890000u, 1806195600u, 1824944400u, 1837645200u, 1856394000u,
+    1869094800u, 1887843600u, 1901149200u, 1919293200u, 1932598800u, 1950742800u,
+    1964048400u, 1982797200u, 1995498000u, 2014246800u, 2026947600u, 2045696400u,
+    2058397200u, 2077146000u, 2090451600u, 2108595600u, 2121901200u, 2140045200u,
+    2153350800u, 2172099600u, 2184800400u, 2203549200u, 2216250000u, 2234998800u,
+    2248304400u, 2266448400u, 2279754000u, 2297898000u, 2311203600u, 2329347600u,
+    2342653200u, 2361402000u, 2374102800u, 2392851600u, 2405552400u, 2424301200u,
+    2437606800u, 2455750800u, 2469056400u, 2487200400u, 2500506000u, 2519254800u,
+    2531955600u, 2550704400u, 2563405200u, 2582154000u, 2595459600u, 2613603600u,
+    2626909200u, 2645053200u, 2658358800u, 2676502800u, 2689808400u, 2708557200u,
+    2721258000u, 2740006800u, 2752707600u, 2771456400u, 2784762000u, 2802906000u,
+    2816211600u, 2834355600u, 2847661200u, 2866410000u, 2879110800u, 2897859600u,
+    2910560400u, 2929309200u, 2942010000u, 2960758800u, 2974064400u, 2992208400u,
+    3005514000u, 3023658000u, 3036963600u, 3055712400u, 3068413200u, 3087162000u,
+    3099862800u, 3118611600u, 3131917200u, 3150061200u, 3163366800u, 3181510800u,
+    3194816400u, 3212960400u, 3226266000u, 3245014800u, 3257715600u, 3276464400u,
+    3289165200u, 3307914000u, 3321219600u, 3339363600u, 3352669200u, 3370813200u,
+    3384118800u, 3402867600u, 3415568400u, 3434317200u, 3447018000u, 3465766800u,
+    3479072400u, 3497216400u,
+    /* Europe/Paris */
+    1585443600u, 1603587600u, 1616893200u, 1635642000u, 1648342800u, 1667091600u,
+    1679792400u, 1698541200u, 1711846800u, 1729990800u, 1743296400u, 1761440400u,
+    1774746000u, 1792890000u, 1806195600u, 1824944400u, 1837645200u, 1856394000u,
+    1869094800u, 1887843600u, 1901149200u, 1919293200u, 1932598800u, 1950742800u,
+    1964048400u, 1982797200u, 1995498000u, 2014246800u, 2026947600u, 2045696400u,
+    2058397200u, 2077146000u, 2090451600u, 2108595600u, 2121901200u, 2140045200u,
+    2153350800u, 2172099600u, 2184800400u, 2203549200u, 2216250000u, 2234998800u,
+    2248304400u, 2266448400u, 2279754000u, 2297898000u, 2311203600u, 2329347600u,
+    2342653200u, 2361402000u, 2374102800u, 2392851600u, 2405552400u, 2424301200u,
+    2437606800u, 2455750800u, 2469056400u, 2487200400u, 2500506000u, 2519254800u,
+    2531955600u, 2550704400u, 2563405200u, 2582154000u, 2595459600u, 2613603600u,
+    2626909200u, 2645053200u, 2658358800u, 2676502800u, 2689808400u, 2708557200u,
+    2721258000u, 2740006800u, 2752707600u, 2771456400u, 2784762000u, 2802906000u,
+    2816211600u, 2834355600u, 2847661200u, 2866410000u, 2879110800u, 2897859600u,
+    2910560400u, 2929309200u, 2942010000u, 2960758800u, 2974064400u, 2992208400u,
+    3005514000u, 3023658000u, 3036963600u, 3055712400u, 3068413200u, 3087162000u,
+    3099862800u, 3118611600u, 3131917200u, 3150061200u, 3163366800u, 3181510800u,
+    3194816400u, 3212960400u, 3226266000u, 3245014800u, 3257715600u, 3276464400u,
+    3289165200u, 3307914000u, 3321219600u, 3339363600u, 3352669200u, 3370813200u,
+    3384118800u, 3402867600u, 3415568400u, 3434317200u, 3447018000u, 3465766800u,
+    3479072400u, 3497216400u,
+    /* America/New_York */
+    1583650800u, 1604210400u, 1615705200u, 1636264800u, 1647154800u, 1667714400u,
+    1678604400u, 1699164000u, 1710054000u, 1730613600u, 1741503600u, 1762063200u,
+    1772953200u, 1793512800u, 1805007600u, 1825567200u, 1836457200u, 1857016800u,
+    1867906800u, 1888466400u, 1899356400u, 1919916000u, 1930806000u, 1951365600u,
+    1962860400u, 1983420000u, 1994310000u, 2014869600u, 2025759600u, 2046319200u,
+    2057209200u, 2077768800u, 2088658800u, 2109218400u, 2120108400u, 2140668000u,
+    2152162800u, 2172722400u, 2183612400u, 2204172000u, 2215062000u, 2235621600u,
+    2246511600u, 2267071200u, 2277961200u, 2298520800u, 2309410800u, 2329970400u,
+    2341465200u, 2362024800u, 2372914800u, 2393474400u, 2404364400u, 2424924000u,
+    2435814000u, 2456373600u, 2467263600u, 2487823200u, 2499318000u, 2519877600u,
+    2530767600u, 2551327200u, 2562217200u, 2582776800u, 2593666800u, 2614226400u,
+    2625116400u, 2645676000u, 2656566000u, 2677125600u, 2688620400u, 2709180000u,
+    2720070000u, 2740629600u, 2751519600u, 2772079200u, 2782969200u, 2803528800u,
+    2814418800u, 2834978400u, 2846473200u, 2867032800u, 2877922800u, 2898482400u,
+    2909372400u, 2929932000u, 2940822000u, 2961381600u, 2972271600u, 2992831200u,
+    3003721200u, 3024280800u, 3035775600u, 3056335200u, 3067225200u, 3087784800u,
+    3098674800u, 3119234400u, 3130124400u, 3150684000u, 3161574000u, 3182133600u,
+    3193023600u, 3213583200u, 3225078000u, 3245637600u, 3256527600u, 3277087200u,
+    3287977200u, 3308536800u, 3319426800u, 3339986400u, 3350876400u, 3371436000u,
+    3382930800u, 3403490400u, 3414380400u, 3434940000u, 3445830000u, 3466389600u,
+    3477279600u, 3497839200u,
+    /* America/Chicago */
+    1583654400u, 1604214000u, 1615708800u, 1636268400u, 1647158400u, 1667718000u,
+    1678608000u, 1699167600u, 1710057600u, 1730617200u, 1741507200u, 1762066800u,
+    1772956800u, 1793516400u, 1805011200u, 1825570800u, 1836460800u, 1857020400u,
+    1867910400u, 1888470000u, 1899360000u, 1919919600u, 1930809600u, 1951369200u,
+    1962864000u, 1983423600u, 1994313600u, 2014873200u, 2025763200u, 2046322800u,
+    2057212800u, 2077772400u, 2088662400u, 2109222000u, 2120112000u, 2140671600u,
+    2152166400u, 2172726000u, 2183616000u, 2204175600u, 2215065600u, 2235625200u,
+    2246515200u, 2267074800u, 2277964800u, 2298524400u, 2309414400u, 2329974000u,
+    2341468800u, 2362028400u, 2372918400u, 2393478000u, 2404368000u, 2424927600u,
+    2435817600u, 2456377200u, 2467267200u, 2487826800u, 2499321600u, 2519881200u,
+    2530771200u, 2551330800u, 2562220800u, 2582780400u, 2593670400u, 2614230000u,
+    2625120000u, 2645679600u, 2656569600u, 2677129200u, 2688624000u, 2709183600u,
+    2720073600u, 2740633200u, 2751523200u, 2772082800u, 2782972800u, 2803532400u,
+    2814422400u, 2834982000u, 2846476800u, 2867036400u, 2877926400u, 2898486000u,
+    2909376000u, 2929935600u, 2940825600u, 2961385200u, 2972275200u, 2992834800u,
+    3003724800u, 3024284400u, 3035779200u, 3056338800u, 3067228800u, 3087788400u,
+    3098678400u, 3119238000u, 3130128000u, 3150687600u, 3161577600u, 3182137200u,
+    3193027200u, 3213586800u, 3225081600u, 3245641200u, 3256531200u, 3277090800u,
+    3287980800u, 3308540400u, 3319430400u, 3339990000u, 3350880000u, 3371439600u,
+    3382934400u, 3403494000u, 3414384000u, 3434943600u, 3445833600u, 3466393200u,
+    3477283200u, 3497842800u,
+    /* America/Denver */
+    1583658000u, 1604217600u, 1615712400u, 1636272000u, 1647162000u, 1667721600u,
+    1678611600u, 1699171200u, 1710061200u, 1730620800u, 1741510800u, 1762070400u,
+    1772960400u, 1793520000u, 1805014800u, 1825574400u, 1836464400u, 1857024000u,
+    1867914000u, 1888473600u, 1899363600u, 1919923200u, 1930813200u, 1951372800u,
+    1962867600u, 1983427200u, 1994317200u, 2014876800u, 2025766800u, 2046326400u,
+    2057216400u, 2077776000u, 2088666000u, 2109225600u, 2120115600u, 2140675200u,
+    2152170000u, 2172729600u, 2183619600u, 2204179200u, 2215069200u, 2235628800u,
+    2246518800u, 2267078400u, 2277968400u, 2298528000u, 2309418000u, 2329977600u,
+    2341472400u, 2362032000u, 2372922000u, 2393481600u, 2404371600u, 2424931200u,
+    2435821200u, 2456380800u, 2467270800u, 2487830400u, 2499325200u, 2519884800u,
+    2530774800u, 2551334400u, 2562224400u, 2582784000u, 2593674000u, 2614233600u,
+    2625123600u, 2645683200u, 2656573200u, 2677132800u, 2688627600u, 2709187200u,
+    2720077200u, 2740636800u, 2751526800u, 2772086400u, 2782976400u, 2803536000u,
+    2814426000u, 2834985600u, 2846480400u, 2867040000u, 2877930000u, 2898489600u,
+    2909379600u, 2929939200u, 2940829200u, 2961388800u, 2972278800u, 2992838400u,
+    3003728400u, 3024288000u, 3035782800u, 3056342400u, 3067232400u, 3087792000u,
+    3098682000u, 3119241600u, 3130131600u, 3150691200u, 3161581200u, 3182140800u,
+    3193030800u, 3213590400u, 3225085200u, 3245644800u, 3256534800u, 3277094400u,
+    3287984400u, 3308544000u, 3319434000u, 3339993600u, 3350883600u, 3371443200u,
+    3382938000u, 3403497600u, 3414387600u, 3434947200u, 3445837200u, 3466396800u,
+    3477286800u, 3497846400u,
+    /* America/Los_Angeles */
+    1583661600u, 1604221200u, 1615716000u, 1636275600u, 1647165600u, 1667725200u,
+    1678615200u, 1699174800u, 1710064800u, 1730624400u, 1741514400u, 1762074000u,
+    1772964000u, 1793523600u, 1805018400u, 1825578000u, 1836468000u, 1857027600u,
+    1867917600u, 1888477200u, 1899367200u, 1919926800u, 1930816800u, 1951376400u,
+    1962871200u, 1983430800u, 1994320800u, 2014880400u, 2025770400u, 2046330000u,
+    2057220000u, 2077779600u, 2088669600u, 2109229200u, 2120119200u, 2140678800u,
+    2152173600u, 2172733200u, 2183623200u, 2204182800u, 2215072800u, 2235632400u,
+    2246522400u, 2267082000u, 2277972000u, 2298531600u, 2309421600u, 2329981200u,
+    2341476000u, 2362035600u, 2372925600u, 2393485200u, 2404375200u, 2424934800u,
+    2435824800u, 2456384400u, 2467274400u, 2487834000u, 2499328800u, 2519888400u,
+    2530778400u, 2551338000u, 2562228000u, 2582787600u, 2593677600u, 2614237200u,
+    2625127200u, 2645686800u, 2656576800u, 2677136400u, 2688631200u, 2709190800u,
+    2720080800u, 2740640400u, 2751530400u, 2772090000u, 2782980000u, 2803539600u,
+    2814429600u, 2834989200u, 2846484000u, 2867043600u, 2877933600u, 2898493200u,
+    2909383200u, 2929942800u, 2940832800u, 2961392400u, 2972282400u, 2992842000u,
+    3003732000u, 3024291600u, 3035786400u, 3056346000u, 3067236000u, 3087795600u,
+    3098685600u, 3119245200u, 3130135200u, 3150694800u, 3161584800u, 3182144400u,
+    3193034400u, 3213594000u, 3225088800u, 3245648400u, 3256538400u, 3277098000u,
+    3287988000u, 3308547600u, 3319437600u, 3339997200u, 3350887200u, 3371446800u,
+    3382941600u, 3403501200u, 3414391200u, 3434950800u, 3445840800u, 3466400400u,
+    3477290400u, 3497850000u,
+    /* Australia/Sydney */
+    1586016000u, 1601740800u, 1617465600u, 1633190400u, 1648915200u, 1664640000u,
+    1680364800u, 1696089600u, 1712419200u, 1728144000u, 1743868800u, 1759593600u,
+    1775318400u, 1791043200u, 1806768000u, 1822492800u, 1838217600u, 1853942400u,
+    1869667200u, 1885996800u, 1901721600u, 1917446400u, 1933171200u, 1948896000u,
+    1964620800u, 1980345600u, 1996070400u, 2011795200u, 2027520000u, 2043244800u,
+    2058969600u, 2075299200u, 2091024000u, 2106748800u, 2122473600u, 2138198400u,
+    2153923200u, 2169648000u, 2185372800u, 2201097600u, 2216822400u, 2233152000u,
+    2248876800u, 2264601600u, 2280326400u, 2296051200u, 2311776000u, 2327500800u,
+    2343225600u, 2358950400u, 2374675200u, 2390400000u, 2406124800u, 2422454400u,
+    2438179200u, 2453904000u, 2469628800u, 2485353600u, 2501078400u, 2516803200u,
+    2532528000u, 2548252800u, 2563977600u, 2579702400u, 2596032000u, 2611756800u,
+    2627481600u, 2643206400u, 2658931200u, 2674656000u, 2690380800u, 2706105600u,
+    2721830400u, 2737555200u, 2753280000u, 2769609600u, 2785334400u, 2801059200u,
+    2816784000u, 2832508800u, 2848233600u, 2863958400u, 2879683200u, 2895408000u,
+    2911132800u, 2926857600u, 2942582400u, 2958912000u, 2974636800u, 2990361600u,
+    3006086400u, 3021811200u, 3037536000u, 3053260800u, 3068985600u, 3084710400u,
+    3100435200u, 3116764800u, 3132489600u, 3148214400u, 3163939200u, 3179664000u,
+    3195388800u, 3211113600u, 3226838400u, 3242563200u, 3258288000u, 3274012800u,
+    3289737600u, 3306067200u, 3321792000u, 3337516800u, 3353241600u, 3368966400u,
+    3384691200u, 3400416000u, 3416140800u, 3431865600u, 3447590400u, 3463315200u,
+    3479644800u, 3495369600u,
+    /* Pacific/Auckland */
+    1586008800u, 1601128800u, 1617458400u, 1632578400u, 1648908000u, 1664028000u,
+    1680357600u, 1695477600u, 1712412000u, 1727532000u, 1743861600u, 1758981600u,
+    1775311200u, 1790431200u, 1806760800u, 1821880800u, 1838210400u, 1853330400u,
+    1869660000u, 1885384800u, 1901714400u, 1916834400u, 1933164000u, 1948284000u,
+    1964613600u, 1979733600u, 1996063200u, 2011183200u, 2027512800u, 2042632800u,
+    2058962400u, 2074687200u, 2091016800u, 2106136800u, 2122466400u, 2137586400u,
+    2153916000u, 2169036000u, 2185365600u, 2200485600u, 2216815200u, 2232540000u,
+    2248869600u, 2263989600u, 2280319200u, 2295439200u, 2311768800u, 2326888800u,
+    2343218400u, 2358338400u, 2374668000u, 2389788000u, 2406117600u, 2421842400u,
+    2438172000u, 2453292000u, 2469621600u, 2484741600u, 2501071200u, 2516191200u,
+    2532520800u, 2547640800u, 2563970400u, 2579090400u, 2596024800u, 2611144800u,
+    2627474400u, 2642594400u, 2658924000u, 2674044000u, 2690373600u, 2705493600u,
+    2721823200u, 2736943200u, 2753272800u, 2768997600u, 2785327200u, 2800447200u,
+    2816776800u, 2831896800u, 2848226400u, 2863346400u, 2879676000u, 2894796000u,
+    2911125600u, 2926245600u, 2942575200u, 2958300000u, 2974629600u, 2989749600u,
+    3006079200u, 3021199200u, 3037528800u, 3052648800u, 3068978400u, 3084098400u,
+    3100428000u, 3116152800u, 3132482400u, 3147602400u, 3163932000u, 3179052000u,
+    3195381600u, 3210501600u, 3226831200u, 3241951200u, 3258280800u, 3273400800u,
+    3289730400u, 3305455200u, 3321784800u, 3336904800u, 3353234400u, 3368354400u,
+    3384684000u, 3399804000u, 3416133600u, 3431253600u, 3447583200u, 3462703200u,
+    3479637600u, 3494757600u,
+};
+
+static const int8_t TZ_TRANS_OFFSET[1098] = {
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,  /* Europe/London */
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0,
+    8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4,  /* Europe/Berlin */
+    8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4,
+    8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4,
+    8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4,
+    8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4,
+    8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4,
+    8, 4,
+    8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4,  /* Europe/Paris */
+    8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4,
+    8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4,
+    8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4,
+    8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4,
+    8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4,
+    8, 4,
+    -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20,  /* America/New_York */
+    -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20,
+    -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20,
+    -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20,
+    -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20,
+    -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20,
+    -16, -20,
+    -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24,  /* America/Chicago */
+    -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24,
+    -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24,
+    -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24,
+    -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24,
+    -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24,
+    -20, -24,
+    -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28,  /* America/Denver */
+    -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28,
+    -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28,
+    -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28,
+    -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28,
+    -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28,
+    -24, -28,
+    -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32,  /* America/Los_Angeles */
+    -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32,
+    -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32,
+    -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32,
+    -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32,
+    -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32,
+    -28, -32,
+    40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44,  /* Australia/Sydney */
+    40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44,
+    40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44,
+    40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44,
+    40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44,
+    40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44,
+    40, 44,
+    48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52,  /* Pacific/Auckland */
+    48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52,
+    48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52,
+    48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52,
+    48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52,
+    48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52,
+    48, 52,
+};
+
+static const TzZoneEntry TZ_ZONES[TZ_ZONE_COUNT] = {
+    { "Asia/Shanghai", 32, 32, 0, 0 },
+    { "Asia/Hong_Kong", 32, 32, 0, 0 },
+    { "Asia/Taipei", 32, 32, 0, 0 },
+    { "Asia/Tokyo", 36, 36, 0, 0 },
+    { "Asia/Seoul", 36, 36, 0, 0 },
+    { "Asia/Singapore", 32, 32, 0, 0 },
+    { "Asia/Bangkok", 28, 28, 0, 0 },
+    { "Asia/Kolkata", 22, 22, 0, 0 },
+    { "Asia/Dubai", 16, 16, 0, 0 },
+    { "Europe/London", 0, 0, 0, 122 },
+    { "Europe/Berlin", 4, 4, 122, 122 },
+    { "Europe/Paris", 4, 4, 244, 122 },
+    { "Europe/Moscow", 12, 12, 366, 0 },
+    { "America/New_York", -20, -20, 366, 122 },
+    { "America/Chicago", -24, -24, 488, 122 },
+    { "America/Denver", -28, -28, 610, 122 },
+    { "America/Los_Angeles", -32, -32, 732, 122 },
+    { "America/Sao_Paulo", -12, -12, 854, 0 },
+    { "Australia/Sydney", 44, 40, 854, 122 },
+    { "Pacific/Auckland", 52, 48, 976, 122 },
+    { "UTC", 0, 0, 1098, 0 },
+};
+
+#endif
@@ -3,14 +3,27 @@
  * @brief 天气：心知 API 拉取、左图标右城市/温度，底部 IP 条
  */
 #include "weather_screen.h"
+#include "log_service.h"
 #include "display.h"
 #include "app_state.h"
+#include "metrics.h"
+#include "power_service.h"
+#include "net_service.h"
+#include "power_governor.h"
+#include "energy_service.h"
+#include "heap_monitor.h"
+#include "fixed_string.h"
+#include "stall_watch.h"
 #include <WiFi.h>
 #include <HTTPClient.h>
 #include <WiFiClientSecure.h>
 
 #define SENIVERE_API_KEY  "SHOEXKwNcHrAxuw09"
-#define WEATHER_CACHE_MS  (10 * 60 * 1000)
+#define WEATHER_CONNECT_WAIT_MS  20000     /* 申请租约后等连接的上限 */
+#define WEATHER_LEASE_MS         45000     /* 租约自动收回：离开天气页也不会一直占着射频 */
+#define WEATHER_RETRY_MS         60000     /* 拉取失败或连不上后的重试间隔 */
+#define WEATHER_URL_MAX          160
+#define WEATHER_BODY_MAX         1024      /* now.json 响应约 400 字节；超过即视为异常响应 */
 #define WEATHER_LEFT_W     64
 #define WEATHER_DIVIDER_X  66
 #define WEATHER_ICON_SIZE  32
@@ -55,59 +68,105 @@ static void mapWeatherToDisplay(const char* apiText, char* outTwoChars, int* out
     *outIconCode = 69;
 }
 
+/* HTTP 响应体写进临时区域里的定长缓冲区，超出容量时 write 返回 0，writeToStream 随即报错 */
+class BodySink : public Stream {
+public:
+    explicit BodySink(StrBuilder& buf) : m_buf(buf) {}
+    size_t write(uint8_t c) override {
+        m_buf.append((char)c);
+        return m_buf.truncated() ? 0 : 1;
+    }
+    size_t write(const uint8_t* data, size_t size) override {
+        size_t before = m_buf.length();
+        m_buf.append((const char*)data, size);
+        return m_buf.length() - before;
+    }
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+private:
+    StrBuilder& m_buf;
+};
+
+/* 在 from 之后找 "key":"value"，把 value 复制到 out；找不到或放不下返回 false */
+static bool jsonStringField(const char* from, const char* key, char* out, size_t cap) {
+    FixedString<24> pattern;
+    pattern.appendf("\"%s\":\"", key);
+    const char* start = strstr(from, pattern.c_str());
+    if (!start) return false;
+    start += pattern.length();
+    const char* end = strchr(start, '"');
+    if (!end || end == start || (size_t)(end - start) >= cap) return false;
+    memcpy(out, start, end - start);
+    out[end - start] = '\0';
+    return true;
+}
+
 static bool fetchWeather(void) {
-    if (WiFi.status() != WL_CONNECTED) return false;
+    POWER_BUSY_SCOPE();
+    METRICS_SCOPE(MET_WEATHER_FETCH);
+    STALL_STAGE(STALL_WEATHER_FETCH);
+    ARENA_SCOPE(&g_scratchArena);
+    if (!netServiceIsConnected()) return false;
+    heapMonitorCheck("weather");
+    char* urlBuf = (char*)arenaAlloc(&g_scratchArena, WEATHER_URL_MAX);
+    char* bodyBuf = (char*)arenaAlloc(&g_scratchArena, WEATHER_BODY_MAX);
+    if (!urlBuf || !bodyBuf) {
+        LOG_W("Weather: scratch arena exhausted");
+        return false;
+    }
+    ConfigState cfg = g_config.get();
+    StrBuilder url(urlBuf, WEATHER_URL_MAX);
+    url.appendf("https://api.seniverse.com/v3/weather/now.json?key=%s&location=%s&language=zh-Hans&unit=c",
+                SENIVERE_API_KEY, cfg.weatherLocation);
+    if (url.truncated()) {
+        LOG_W("Weather: URL longer than %d bytes", WEATHER_URL_MAX);
+        return false;
+    }
     WiFiClientSecure client;
     client.setInsecure();
     client.setTimeout(10);
-    String url = "https://api.seniverse.com/v3/weather/now.json?key=";
-    url += SENIVERE_API_KEY;
-    url += "&location=";
-    url += g_weatherLocation;
-    url += "&language=zh-Hans&unit=c";
     HTTPClient http;
     http.setTimeout(8000);
-    if (!http.begin(client, url)) return false;
+    if (!http.begin(client, url.c_str())) {
+        LOG_W("Weather: HTTP begin failed");
+        return false;
+    }
+    energyCountTls();               /* 每次拉取都是新连接，GET 时完成一次完整握手 */
     int code = http.GET();
     if (code != HTTP_CODE_OK) {
         http.end();
+        LOG_W("Weather: HTTP %d", code);     /* 负数为连接 / TLS 错误，见 HTTPClient.h */
         return false;
     }
-    String body = http.getString();
+    StrBuilder bodyStr(bodyBuf, WEATHER_BODY_MAX);
+    BodySink sink(bodyStr);
+    int n = http.writeToStream(&sink);
     http.end();
-    int ti = body.indexOf("\"temperature\":\"");
-    int tei = body.indexOf("\"text\":\"");
-    int locIdx = body.indexOf("\"location\"");
-    if (locIdx >= 0) {
-        int nameKey = body.indexOf("\"name\":\"", locIdx);
-        if (nameKey >= 0) {
-            int start = nameKey + 8;
-            int end = body.indexOf('"', start);
-            if (end > start && end - start < (int)sizeof(g_weatherCityName)) {
-                body.substring(start, end).toCharArray(g_weatherCityName, sizeof(g_weatherCityName));
-                g_weatherCityName[sizeof(g_weatherCityName) - 1] = '\0';
-            }
-        }
-    }
-    if (ti >= 0) {
-        int start = ti + 15;
-        int end = body.indexOf('"', start);
-        if (end > start && end - start < 7) {
-            body.substring(start, end).toCharArray(g_weatherTemp, sizeof(g_weatherTemp));
-        }
-    }
-    if (tei >= 0) {
-        int start = tei + 8;
-        int end = body.indexOf('"', start);
-        if (end > start) {
-            String text = body.substring(start, end);
-            char two[8];
-            mapWeatherToDisplay(text.c_str(), two, &g_weatherIconCode);
-            strncpy(g_weatherText, two, sizeof(g_weatherText) - 1);
-            g_weatherText[sizeof(g_weatherText) - 1] = '\0';
-        }
-    }
-    g_weatherLastFetch = millis();
+    if (n <= 0 || bodyStr.truncated()) {
+        LOG_W("Weather: body %d bytes%s", n, bodyStr.truncated() ? " (truncated)" : "");
+        return false;
+    }
+    const char* body = bodyStr.c_str();
+    const char* loc = strstr(body, "\"location\"");
+    /* 在副本上改完再整块发布，页面不会看到新城市配旧温度 */
+    WeatherState w = g_weather.get();
+    if (loc) jsonStringField(loc, "name", w.cityName, sizeof(w.cityName));
+    char temp[7];
+    if (jsonStringField(body, "temperature", temp, sizeof(temp))) {
+        strncpy(w.temp, temp, sizeof(w.temp) - 1);
+        w.temp[sizeof(w.temp) - 1] = '\0';
+    }
+    char text[48];
+    if (jsonStringField(body, "text", text, sizeof(text))) {
+        char two[8];
+        mapWeatherToDisplay(text, two, &w.iconCode);
+        strncpy(w.text, two, sizeof(w.text) - 1);
+        w.text[sizeof(w.text) - 1] = '\0';
+    }
+    w.lastFetchMs = millis();
+    g_weather.publish(w);
+    LOG_I("Weather: updated, icon %d, %d bytes", w.iconCode, n);
     return true;
 }
 
@@ -129,23 +188,53 @@ static void drawWeatherLoadingScreen(void) {
     int w = u8g2.getUTF8Width(msg);
     int textBaseline = iconY + iconH + gap + textH - 2;
     u8g2.drawUTF8(cx - w / 2, textBaseline, msg);
-    u8g2.sendBuffer();
+    displaySendBuffer();
 }
 
-void weatherScreenDraw(void) {
-    bool needFetch = (g_weatherLastFetch == 0 || (uint32_t)(millis() - g_weatherLastFetch) > WEATHER_CACHE_MS);
-    if (needFetch && WiFi.status() == WL_CONNECTED) {
+static bool s_leased = false;
+static uint32_t s_leaseMs = 0;
+static uint32_t s_retryAtMs = 0;    /* 0 表示不在退避中 */
+
+/* 缓存过期（有效期随电源档位）时申请天气租约：等到连接后拉取，拉取完成或等不到连接时释放 */
+static void refreshWeather(void) {
+    uint32_t now = millis();
+    uint32_t lastFetch = g_weather.view<uint32_t>([](const WeatherState& w) { return w.lastFetchMs; });
+    bool stale = lastFetch == 0 || (uint32_t)(now - lastFetch) > powerGovernorSpec()->weatherRefreshMs;
+    if (!stale || (s_retryAtMs != 0 && (int32_t)(now - s_retryAtMs) < 0)) return;
+    if (s_leased && (uint32_t)(now - s_leaseMs) >= WEATHER_LEASE_MS)
+        s_leased = false;           /* 离开天气页期间已被自动收回 */
+    if (!s_leased) {
+        netServiceAcquire(NET_JOB_WEATHER, WEATHER_LEASE_MS);
+        s_leased = true;
+        s_leaseMs = now;
+    }
+    bool ok = false;
+    if (netServiceIsConnected()) {
         drawWeatherLoadingScreen();
-        fetchWeather();
+        ok = fetchWeather();
+    } else if ((uint32_t)(now - s_leaseMs) < WEATHER_CONNECT_WAIT_MS) {
+        return;
     }
+    netServiceRelease(NET_JOB_WEATHER);
+    s_leased = false;
+    s_retryAtMs = ok ? 0 : millis() + WEATHER_RETRY_MS;
+}
+
+void weatherScreenRefresh(void) {
+    refreshWeather();
+}
+
+void weatherScreenDraw(void) {
+    METRICS_SCOPE(MET_DRAW_WEATHER);
+    WeatherState w = g_weather.get();
     u8g2.clearBuffer();
     displayTopBarBackground();
-    displayWiFiIcon(WIFI_ICON_X, WIFI_ICON_Y, WiFi.status() == WL_CONNECTED);
+    displayWiFiIcon(WIFI_ICON_X, WIFI_ICON_Y, netServiceIsConnected());
+    displayPowerStatus();
     u8g2.setFont(u8g2_font_wqy12_t_gb2312);
     const char* title = u8"实时天气";
     int tw = u8g2.getUTF8Width(title);
     u8g2.drawUTF8((SCREEN_W - tw) / 2, DATE_Y_TOP, title);
-    displayBatteryIcon(BATTERY_ICON_X, BATTERY_ICON_Y, displayGetBatteryPercent());
 
     int contentTop = WEATHER_CONTENT_TOP;
     int contentH = SCREEN_H - contentTop;
@@ -156,14 +245,16 @@ void weatherScreenDraw(void) {
     u8g2.drawVLine(WEATHER_DIVIDER_X, contentTop, contentH);
     u8g2.setBitmapMode(1);
     u8g2.setFont(u8g2_font_open_iconic_weather_4x_t);
-    u8g2.drawGlyph(leftCenterX - WEATHER_ICON_SIZE / 2, iconBottom, g_weatherIconCode);
+    u8g2.drawGlyph(leftCenterX - WEATHER_ICON_SIZE / 2, iconBottom, w.iconCode);
     u8g2.setBitmapMode(0);
 
-    if (WiFi.status() == WL_CONNECTED) {
+    if (netServiceIsConnected()) {
         const int ipBarH = 8;
         const int ipBarY = SCREEN_H - ipBarH;
         u8g2.drawRBox(0, ipBarY, WEATHER_LEFT_W, ipBarH, 1);
-        String ipStr = WiFi.localIP().toString();
+        IPAddress ip = netServiceLocalIp();
+        FixedString<16> ipStr;
+        ipStr.appendf("%u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
         u8g2.setFont(u8g2_font_4x6_tf);
         int ipW = u8g2.getStrWidth(ipStr.c_str());
         int ipBaseline = SCREEN_H - 2;
@@ -175,28 +266,28 @@ void weatherScreenDraw(void) {
         u8g2.setDrawColor(1);
     }
     u8g2.setFont(u8g2_font_wqy12_t_gb2312);
-    int cityW = u8g2.getUTF8Width(g_weatherCityName);
+    int cityW = u8g2.getUTF8Width(w.cityName);
     int cityX = WEATHER_RIGHT_CX - cityW / 2;
     int cityY = contentTop + WEATHER_LINE_H - 2;
     u8g2.drawRBox(cityX - 2, cityY - 11, cityW + 4, 14, 2);
     u8g2.setDrawColor(0);
-    u8g2.drawUTF8(cityX, cityY, g_weatherCityName);
+    u8g2.drawUTF8(cityX, cityY, w.cityName);
     u8g2.setDrawColor(1);
 
     int ry = contentTop + WEATHER_LINE_H + 18;
-    int textW = u8g2.getUTF8Width(g_weatherText);
+    int textW = u8g2.getUTF8Width(w.text);
     int gap = 6;
     const char* celsiusStr = u8"℃";
     int celsiusW = u8g2.getUTF8Width(celsiusStr);
     u8g2.setFont(u8g2_font_7x13B_tf);
-    int tempNumW = u8g2.getStrWidth(g_weatherTemp);
+    int tempNumW = u8g2.getStrWidth(w.temp);
     int totalW = textW + gap + tempNumW + celsiusW;
     int lineX = WEATHER_RIGHT_CX - totalW / 2;
     u8g2.setFont(u8g2_font_wqy12_t_gb2312);
-    u8g2.drawUTF8(lineX, ry, g_weatherText);
+    u8g2.drawUTF8(lineX, ry, w.text);
     u8g2.setFont(u8g2_font_7x13B_tf);
-    u8g2.drawStr(lineX + textW + gap, ry, g_weatherTemp);
+    u8g2.drawStr(lineX + textW + gap, ry, w.temp);
     u8g2.setFont(u8g2_font_wqy12_t_gb2312);
     u8g2.drawUTF8(lineX + textW + gap + tempNumW, ry, celsiusStr);
-    u8g2.sendBuffer();
+    displaySendBuffer();
 }
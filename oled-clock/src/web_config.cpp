@@ -1,50 +1,344 @@
 /**
  * @file web_config.cpp
- * @brief 天气城市 Web 配置、WiFi 重新配网
+ * @brief 天气城市 / 时区 / 闹钟 Web 配置、WiFi 重新配网、秒表圈速导出；页面为构建时压缩的静态资源
  */
 #include "web_config.h"
 #include "app_state.h"
+#include "web_assets.h"
+#include "metrics.h"
+#include "sntp_service.h"
+#include "time_service.h"
+#include "tz_engine.h"
+#include "alarm_service.h"
+#include "sleep_clock.h"
+#include "power_service.h"
+#include "net_service.h"
+#include "power_governor.h"
+#include "energy_service.h"
+#include "wifi_assoc.h"
+#include "heap_monitor.h"
+#include "fixed_string.h"
+#include "config_store.h"
+#include "log_service.h"
+#include "stall_watch.h"
 #include <WebServer.h>
-#include <Preferences.h>
 #include <WiFi.h>
 #include <WiFiManager.h>
 #include <ESP.h>
-
-#define PREF_NAMESPACE  "vibe"
-#define PREF_KEY_LOC   "wloc"
-#define WEATHER_LOCATION_DEFAULT  "kunming"
+#include <esp_timer.h>
 
 static WebServer webServer(80);
-static Preferences preferences;
 
+static const char* WEB_HEADER_KEYS[] = { "If-None-Match", "Accept-Encoding" };
+
+/* 当前请求进入处理函数的时刻，响应发完后在调试日志里给出服务端耗时 */
+static int64_t s_requestStartUs = 0;
+
+/* Accept-Encoding 里有 gzip 且 q 不为 0；没带这个头的（如不加 --compressed 的 curl）按不接受处理 */
+static bool acceptsGzip(void) {
+    if (!webServer.hasHeader("Accept-Encoding")) return false;
+    String enc = webServer.header("Accept-Encoding");
+    const char* gz = strstr(enc.c_str(), "gzip");
+    if (!gz) return false;
+    const char* q = strstr(gz, "q=");
+    const char* comma = strchr(gz, ',');
+    return !q || (comma && q > comma) || atof(q + 2) > 0.0;
+}
+
+/*
+ * 静态页面：构建时 gzip 进 Flash，带强 ETag；浏览器带 If-None-Match 命中则回 304。
+ * 不接受 gzip 的客户端拿原文（ETag 不同）；返回响应体字节数
+ */
+static size_t sendAsset(const WebAsset* asset) {
+    bool gzip = acceptsGzip();
+    const char* etag = gzip ? asset->etag : asset->rawEtag;
+    webServer.sendHeader("Vary", "Accept-Encoding");
+    webServer.sendHeader("ETag", etag);
+    webServer.sendHeader("Cache-Control", "no-cache");
+    if (webServer.hasHeader("If-None-Match") &&
+        strstr(webServer.header("If-None-Match").c_str(), etag) != NULL) {
+        webServer.send(304);
+        return 0;
+    }
+    if (!gzip) {
+        webServer.send_P(200, asset->mime, (PGM_P)asset->raw, asset->rawLen);
+        return asset->rawLen;
+    }
+    webServer.sendHeader("Content-Encoding", "gzip");
+    webServer.send_P(200, asset->mime, (PGM_P)asset->data, asset->len);
+    return asset->len;
+}
+
+/* 把 src 写成 JSON 字符串（含两侧引号），超长截断；返回写入长度 */
+static size_t jsonQuote(char* out, size_t cap, const char* src) {
+    size_t n = 0;
+    if (cap < 3) return 0;
+    out[n++] = '"';
+    for (; *src && n + 3 < cap; src++) {
+        unsigned char c = (unsigned char)*src;
+        if (c == '"' || c == '\\') {
+            out[n++] = '\\';
+            out[n++] = (char)c;
+        } else if (c >= 0x20) {
+            out[n++] = (char)c;
+        }
+    }
+    out[n++] = '"';
+    out[n] = '\0';
+    return n;
+}
+
+/* 设置项之间复制字符串；两边容量不一致时截断而不越界 */
+static void setName(char* dst, size_t cap, const char* name) {
+    StrBuilder(dst, cap).append(name);
+}
+
+/* 一次提交的几项设置只改内存，由设置存储防抖后合并成一次写入 */
 static void handleWebRoot(void) {
-    if (webServer.method() == HTTP_POST) {
-        if (webServer.hasArg("location")) {
-            String loc = webServer.arg("location");
-            loc.trim();
-            if (loc.length() > 0 && loc.length() < sizeof(g_weatherLocation)) {
-                loc.toCharArray(g_weatherLocation, sizeof(g_weatherLocation));
-                g_weatherLocation[sizeof(g_weatherLocation) - 1] = '\0';
-                preferences.begin(PREF_NAMESPACE, false);
-                preferences.putString(PREF_KEY_LOC, g_weatherLocation);
-                preferences.end();
-                g_weatherLastFetch = 0;
+    if (webServer.hasArg("location")) {
+        FixedString<WEATHER_LOCATION_MAX> loc(webServer.arg("location").c_str());
+        loc.trim();
+        if (!loc.empty() && !loc.truncated()) {
+            ConfigState cfg;
+            memcpy(cfg.weatherLocation, loc.c_str(), loc.length() + 1);
+            g_config.publish(cfg);
+            setName(configStoreEdit()->weatherLocation, sizeof(ConfigData::weatherLocation), cfg.weatherLocation);
+            SeqWrite<WeatherState> w(g_weather);
+            w->lastFetchMs = 0;
+        }
+    }
+    if (webServer.hasArg("tz")) {
+        int zone = tzFindZone(webServer.arg("tz").c_str());
+        if (zone >= 0 && zone != tzSelected()) {
+            tzSelect(zone);
+            timeServiceInvalidate();
+            alarmServiceReschedule();
+            setName(configStoreEdit()->tzName, sizeof(ConfigData::tzName), tzZoneName(zone));
+        }
+    }
+    if (webServer.hasArg("netpol")) {
+        int policy = netServiceFindPolicy(webServer.arg("netpol").c_str());
+        if (policy >= 0 && policy != netServicePolicy()) {
+            netServiceSetPolicy((NetPolicy)policy);
+            setName(configStoreEdit()->netPolicy, sizeof(ConfigData::netPolicy),
+                    netServicePolicyName((NetPolicy)policy));
+        }
+    }
+    if (webServer.hasArg("pprof")) {
+        /* "auto" 或档位名；找不到按自动处理 */
+        int profile = powerProfileFind(webServer.arg("pprof").c_str());
+        if (profile != powerGovernorForced()) {
+            powerGovernorSetForced(profile);
+            setName(configStoreEdit()->powerProfile, sizeof(ConfigData::powerProfile),
+                    profile < 0 ? "auto" : powerProfileSpec((PowerProfile)profile)->name);
+        }
+    }
+    webServer.sendHeader("Location", "/");
+    webServer.send(302, "text/plain", "");
+}
+
+#define WEB_CHUNK_BYTES  512
+
+/*
+ * 分块发送：文本先攒到小缓冲区，满了再作为一个 HTTP chunk 发出，避免拼整页 String。
+ * 缓冲区取自本次请求的临时区域（onRoute 开的作用域）；区域不够时逐次直接发送，输出不变、只是 chunk 更碎
+ */
+class ChunkedPrint : public Print {
+public:
+    explicit ChunkedPrint(WebServer& server)
+        : m_server(server), m_buf((char*)arenaAlloc(&g_scratchArena, WEB_CHUNK_BYTES)), m_len(0) {}
+    size_t write(uint8_t c) override {
+        return write(&c, 1);
+    }
+    size_t write(const uint8_t* data, size_t size) override {
+        if (!m_buf) {
+            m_server.sendContent((const char*)data, size);
+            return size;
+        }
+        for (size_t i = 0; i < size; i++) {
+            if (m_len == WEB_CHUNK_BYTES) flush();
+            m_buf[m_len++] = (char)data[i];
+        }
+        return size;
+    }
+    void flush() {
+        if (m_len == 0) return;
+        m_server.sendContent(m_buf, m_len);
+        m_len = 0;
+    }
+private:
+    WebServer& m_server;
+    char* m_buf;
+    size_t m_len;
+};
+
+/* 动态配置：城市、当前时区与可选时区列表、联网策略、电源档位（固定值与当前生效值） */
+static void handleApiConfig(void) {
+    ConfigState cfg = g_config.get();
+    char loc[WEATHER_LOCATION_MAX * 2 + 3];
+    jsonQuote(loc, sizeof(loc), cfg.weatherLocation);
+    webServer.sendHeader("Cache-Control", "no-store");
+    webServer.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    webServer.send(200, "application/json", "");
+    ChunkedPrint out(webServer);
+    out.printf("{\"location\":%s,\"tz\":\"%s\",\"zones\":[", loc, tzZoneName(tzSelected()));
+    for (int i = 0; i < tzZoneCount(); i++)
+        out.printf(i ? ",\"%s\"" : "\"%s\"", tzZoneName(i));
+    out.printf("],\"net_policy\":\"%s\"", netServicePolicyName(netServicePolicy()));
+    int forced = powerGovernorForced();
+    out.printf(",\"power_profile\":\"%s\",\"power_active\":\"%s\",\"battery\":%d,\"config_writes\":%lu}",
+               forced < 0 ? "auto" : powerProfileSpec((PowerProfile)forced)->name,
+               powerGovernorSpec()->name, powerGovernorBatteryPercent(), (unsigned long)configStoreWrites());
+    out.flush();
+    webServer.sendContent("");
+}
+
+/*
+ * 闹钟增改删（表单 POST，完成后回到配置页）：
+ *   i=下标（省略或等于个数为新增）、time=HH:MM、d0..d6=周日..周六勾选、enabled=1、delete=1
+ */
+static void handleAlarms(void) {
+    int index = webServer.hasArg("i") ? webServer.arg("i").toInt() : alarmServiceCount();
+    if (webServer.hasArg("delete")) {
+        alarmServiceRemove(index);
+    } else {
+        Alarm a;
+        if (!alarmServiceGet(index, &a)) {
+            a.enabled = 1;
+            a.hour = 7;
+            a.minute = 0;
+            a.weekdays = ALARM_EVERY_DAY;
+        }
+        int h, m;
+        if (webServer.hasArg("time") && sscanf(webServer.arg("time").c_str(), "%d:%d", &h, &m) == 2 &&
+            h >= 0 && h < 24 && m >= 0 && m < 60) {
+            a.hour = (uint8_t)h;
+            a.minute = (uint8_t)m;
+            a.weekdays = 0;
+            for (int d = 0; d < 7; d++) {
+                char key[3] = { 'd', (char)('0' + d), '\0' };
+                if (webServer.hasArg(key)) a.weekdays |= (uint8_t)(1u << d);
             }
         }
-        webServer.sendHeader("Location", "/");
-        webServer.send(302, "text/plain", "");
+        a.enabled = webServer.hasArg("enabled") ? 1 : 0;
+        alarmServiceSet(index, &a);
+    }
+    webServer.sendHeader("Location", "/");
+    webServer.send(302, "text/plain", "");
+}
+
+static void handleApiAlarms(void) {
+    webServer.sendHeader("Cache-Control", "no-store");
+    webServer.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    webServer.send(200, "application/json", "");
+    ChunkedPrint out(webServer);
+    alarmServiceWriteJson(out);
+    out.flush();
+    webServer.sendContent("");
+}
+
+/* 能耗估算：开机以来与上一个结算窗口，各子系统 mAh 与平均电流 */
+static void handleApiEnergy(void) {
+    webServer.sendHeader("Cache-Control", "no-store");
+    webServer.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    webServer.send(200, "application/json", "");
+    ChunkedPrint out(webServer);
+    energyServiceWriteJson(out);
+    out.flush();
+    webServer.sendContent("");
+}
+
+/* 秒表圈速导出：?format=csv 为 CSV（带下载文件名），否则 JSON；时间单位为微秒 */
+static void handleApiLaps(void) {
+    bool csv = webServer.arg("format") == "csv";
+    /* 一致快照放在本次请求的临时区域里，导出期间秒表继续走也不会读到半条圈速 */
+    StopwatchState* snap = (StopwatchState*)arenaAlloc(&g_scratchArena, sizeof(StopwatchState));
+    if (!snap) {
+        webServer.send(503, "text/plain", "Busy");
         return;
     }
-    String html = "<!DOCTYPE html><html><head><meta charset=\"UTF-8\"><meta name=\"viewport\" content=\"width=device-width,initial-scale=1\"><title>OLED 时钟配置</title></head><body style=\"font-family:sans-serif;padding:1em;\">";
-    html += "<h2>天气城市设置</h2><p>心知天气城市 ID（如 kunming、beijing、shanghai）</p>";
-    html += "<form method=\"post\" action=\"/\">";
-    html += "<input type=\"text\" name=\"location\" value=\"" + String(g_weatherLocation) + "\" maxlength=\"31\" size=\"20\"> ";
-    html += "<button type=\"submit\">保存</button></form>";
-    html += "<p><small>保存后进入设备「天气」页将自动拉取新城市数据。</small></p>";
-    html += "<hr><h3>WiFi 配网</h3><p>若更换路由器或需重新配网，点击下方按钮。设备将重启并开放热点 <strong>OLEDClock</strong>，用手机连接后选择新 WiFi 并输入密码。</p>";
-    html += "<form method=\"post\" action=\"/resetwifi\" onsubmit=\"return confirm('确定清除当前 WiFi 并重新配网？');\">";
-    html += "<button type=\"submit\">清除 WiFi 并重新配网</button></form></body></html>";
-    webServer.send(200, "text/html; charset=utf-8", html);
+    g_stopwatch.read(snap);
+    const StopwatchCore* sw = &snap->core;
+    uint32_t stored = stopwatchCoreLapsStored(sw);
+    webServer.sendHeader("Cache-Control", "no-store");
+    if (csv) webServer.sendHeader("Content-Disposition", "attachment; filename=\"laps.csv\"");
+    webServer.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    webServer.send(200, csv ? "text/csv" : "application/json", "");
+    ChunkedPrint out(webServer);
+    char lapBuf[24], splitBuf[24];
+    if (csv) {
+        out.print("lap,lap_us,split_us,lap_text,split_text\n");
+    } else {
+        out.printf("{\"running\":%s,\"elapsed_us\":%lld,\"lap_count\":%lu,\"laps\":[",
+                   sw->running ? "true" : "false",
+                   (long long)stopwatchCoreElapsedUs(sw, esp_timer_get_time()),
+                   (unsigned long)sw->lapCount);
+    }
+    for (uint32_t i = 0; i < stored; i++) {
+        const StopwatchLap* lap = stopwatchCoreLapAt(sw, i);
+        stopwatchFormat(lap->lapUs, lapBuf, sizeof(lapBuf));
+        stopwatchFormat(lap->splitUs, splitBuf, sizeof(splitBuf));
+        if (csv) {
+            out.printf("%lu,%lld,%lld,%s,%s\n", (unsigned long)lap->number,
+                       (long long)lap->lapUs, (long long)lap->splitUs, lapBuf, splitBuf);
+        } else {
+            out.printf("%s{\"lap\":%lu,\"lap_us\":%lld,\"split_us\":%lld,\"lap_text\":\"%s\",\"split_text\":\"%s\"}",
+                       i ? "," : "", (unsigned long)lap->number,
+                       (long long)lap->lapUs, (long long)lap->splitUs, lapBuf, splitBuf);
+        }
+    }
+    if (!csv) out.print("]}");
+    out.flush();
+    webServer.sendContent("");
+}
+
+static void handleApiHeap(void) {
+    webServer.sendHeader("Cache-Control", "no-store");
+    webServer.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    webServer.send(200, "application/json", "");
+    ChunkedPrint out(webServer);
+    heapMonitorWriteJson(out);
+    out.flush();
+    webServer.sendContent("");
+}
+
+static void handleApiLog(void) {
+    webServer.sendHeader("Cache-Control", "no-store");
+    webServer.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    webServer.send(200, "text/plain; charset=utf-8", "");
+    ChunkedPrint out(webServer);
+    logServiceWriteText(out);
+    out.flush();
+    webServer.sendContent("");
+}
+
+static void handleApiStalls(void) {
+    webServer.sendHeader("Cache-Control", "no-store");
+    webServer.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    webServer.send(200, "application/json", "");
+    ChunkedPrint out(webServer);
+    stallWatchWriteJson(out);
+    out.flush();
+    webServer.sendContent("");
+}
+
+static void handleMetrics(void) {
+    webServer.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    webServer.send(200, "text/plain; version=0.0.4", "");
+    ChunkedPrint out(webServer);
+    metricsWritePrometheus(out);
+    heapMonitorWritePrometheus(out);
+    sntpServiceWritePrometheus(out);
+    sleepClockWritePrometheus(out);
+    powerServiceWritePrometheus(out);
+    powerGovernorWritePrometheus(out);
+    energyServiceWritePrometheus(out);
+    netServiceWritePrometheus(out);
+    configStoreWritePrometheus(out);
+    logServiceWritePrometheus(out);
+    stallWatchWritePrometheus(out);
+    out.flush();
+    webServer.sendContent("");
 }
 
 static void handleResetWifi(void) {
@@ -58,21 +352,60 @@ static void handleResetWifi(void) {
     delay(200);
     WiFiManager wm;
     wm.resetSettings();
+    wifiAssocForget();
+    configStoreFlush();
+    logServiceFlush();
     delay(500);
     ESP.restart();
 }
 
+void webConfigLoad(void) {
+    const ConfigData* c = configStoreGet();
+    if (c->weatherLocation[0]) {
+        ConfigState cfg;
+        setName(cfg.weatherLocation, sizeof(cfg.weatherLocation), c->weatherLocation);
+        g_config.publish(cfg);
+    }
+    tzSelect(c->tzName[0] ? tzFindZone(c->tzName) : TZ_DEFAULT_ZONE);
+    if (c->netPolicy[0]) netServiceSetPolicy((NetPolicy)netServiceFindPolicy(c->netPolicy));
+    if (c->powerProfile[0]) powerGovernorSetForced(powerProfileFind(c->powerProfile));
+}
+
+/* 每个请求都顺延联网空闲尾巴，有人在用配置页时射频不会关掉；请求的临时内存在返回时一次归还 */
+static void onRoute(const char* path, HTTPMethod method, void (*handler)(void)) {
+    webServer.on(path, method, [path, handler]() {
+        ARENA_SCOPE(&g_scratchArena);
+        STALL_STAGE(STALL_HTTP, path);
+        s_requestStartUs = esp_timer_get_time();
+        netServiceTouch();
+        handler();
+        LOG_D("HTTP: %s %lu us", path, (unsigned long)(esp_timer_get_time() - s_requestStartUs));
+    });
+}
+
 void webConfigBegin(void) {
-    preferences.begin(PREF_NAMESPACE, true);
-    String saved = preferences.getString(PREF_KEY_LOC, WEATHER_LOCATION_DEFAULT);
-    preferences.end();
-    if (saved.length() > 0 && saved.length() < sizeof(g_weatherLocation)) {
-        saved.toCharArray(g_weatherLocation, sizeof(g_weatherLocation));
-        g_weatherLocation[sizeof(g_weatherLocation) - 1] = '\0';
-    }
-    webServer.on("/", HTTP_GET, handleWebRoot);
-    webServer.on("/", HTTP_POST, handleWebRoot);
-    webServer.on("/resetwifi", HTTP_POST, handleResetWifi);
+    for (size_t i = 0; i < WEB_ASSET_COUNT; i++) {
+        const WebAsset* asset = &WEB_ASSETS[i];
+        webServer.on(asset->path, HTTP_GET, [asset]() {
+            s_requestStartUs = esp_timer_get_time();
+            netServiceTouch();
+            size_t bytes = sendAsset(asset);
+            LOG_D("HTTP: %s %u B %lu us", asset->path, (unsigned)bytes,
+                  (unsigned long)(esp_timer_get_time() - s_requestStartUs));
+        });
+    }
+    onRoute("/api/config", HTTP_GET, handleApiConfig);
+    onRoute("/api/laps", HTTP_GET, handleApiLaps);
+    onRoute("/api/alarms", HTTP_GET, handleApiAlarms);
+    onRoute("/api/energy", HTTP_GET, handleApiEnergy);
+    onRoute("/api/heap", HTTP_GET, handleApiHeap);
+    onRoute("/api/log", HTTP_GET, handleApiLog);
+    onRoute("/api/stalls", HTTP_GET, handleApiStalls);
+    onRoute("/alarms", HTTP_POST, handleAlarms);
+    onRoute("/metrics", HTTP_GET, handleMetrics);
+    onRoute("/", HTTP_POST, handleWebRoot);
+    onRoute("/resetwifi", HTTP_POST, handleResetWifi);
+    webServer.collectHeaders(WEB_HEADER_KEYS, sizeof(WEB_HEADER_KEYS) / sizeof(WEB_HEADER_KEYS[0]));
     webServer.begin();
 }
 
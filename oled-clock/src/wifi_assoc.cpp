@@ -0,0 +1,83 @@
+/**
+ * @file wifi_assoc.cpp
+ * @brief 连接缓存的校验与 RTC 内存 / NVS 存取
+ */
+#include "wifi_assoc.h"
+#include <Arduino.h>
+#include <Preferences.h>
+#include <stddef.h>
+
+#define WIFI_ASSOC_MAGIC    0x57415343u   /* "WASC" */
+#define WIFI_VALID_EPOCH    1577836800    /* 2020-01-01 */
+
+#define PREF_NAMESPACE      "vibe"
+#define PREF_KEY_WASSOC     "wassoc"
+
+static RTC_NOINIT_ATTR WifiAssoc s_rtc;
+
+static uint32_t assocCheck(const WifiAssoc* a) {
+    /* FNV-1a，覆盖 check 之前的全部字节 */
+    const uint8_t* p = (const uint8_t*)a;
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < offsetof(WifiAssoc, check); i++) {
+        h ^= p[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+bool wifiAssocValid(const WifiAssoc* a) {
+    return a->magic == WIFI_ASSOC_MAGIC && a->check == assocCheck(a) &&
+           a->channel >= 1 && a->channel <= 14;
+}
+
+void wifiAssocSeal(WifiAssoc* a) {
+    a->magic = WIFI_ASSOC_MAGIC;
+    a->check = assocCheck(a);
+}
+
+bool wifiAssocLeaseUsable(const WifiAssoc* a, int64_t nowEpochS) {
+    if (!a->hasIp || a->ip == 0 || nowEpochS < WIFI_VALID_EPOCH || a->leaseEpochS < WIFI_VALID_EPOCH)
+        return false;
+    return nowEpochS >= a->leaseEpochS && nowEpochS - a->leaseEpochS < WIFI_ASSOC_LEASE_MAX_S;
+}
+
+bool wifiAssocLoad(WifiAssoc* out) {
+    if (wifiAssocValid(&s_rtc)) {
+        *out = s_rtc;
+        return true;
+    }
+    Preferences prefs;
+    prefs.begin(PREF_NAMESPACE, true);
+    size_t n = prefs.getBytesLength(PREF_KEY_WASSOC) == sizeof(*out)
+                   ? prefs.getBytes(PREF_KEY_WASSOC, out, sizeof(*out)) : 0;
+    prefs.end();
+    if (n != sizeof(*out) || !wifiAssocValid(out)) return false;
+    s_rtc = *out;
+    return true;
+}
+
+/* 只比较会影响下次连接的字段：租约时间变化不值得写 Flash */
+static bool sameTarget(const WifiAssoc* a, const WifiAssoc* b) {
+    return memcmp(a->bssid, b->bssid, sizeof(a->bssid)) == 0 && a->channel == b->channel &&
+           a->hasIp == b->hasIp && a->ip == b->ip && a->gateway == b->gateway &&
+           a->netmask == b->netmask && a->dns == b->dns;
+}
+
+void wifiAssocSave(const WifiAssoc* a) {
+    bool changed = !wifiAssocValid(&s_rtc) || !sameTarget(&s_rtc, a);
+    s_rtc = *a;
+    if (!changed) return;
+    Preferences prefs;
+    prefs.begin(PREF_NAMESPACE, false);
+    prefs.putBytes(PREF_KEY_WASSOC, a, sizeof(*a));
+    prefs.end();
+}
+
+void wifiAssocForget(void) {
+    memset(&s_rtc, 0, sizeof(s_rtc));
+    Preferences prefs;
+    prefs.begin(PREF_NAMESPACE, false);
+    prefs.remove(PREF_KEY_WASSOC);
+    prefs.end();
+}
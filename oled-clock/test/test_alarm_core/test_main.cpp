@@ -0,0 +1,160 @@
+/**
+ * @file test_main.cpp
+ * @brief alarm_core 主机测试：夏令时跳过 / 重复的本地时刻、跨月跨年、星期掩码
+ */
+#include <unity.h>
+#include <time.h>
+#include "alarm_core.h"
+#include "tz_engine.h"
+
+static int s_ny;
+static int s_london;
+static int s_shanghai;
+
+void setUp(void) {
+    s_ny = tzFindZone("America/New_York");
+    s_london = tzFindZone("Europe/London");
+    s_shanghai = tzFindZone("Asia/Shanghai");
+}
+
+void tearDown(void) {}
+
+/* 公历日期 → 自 1970-01-01 起的天数 */
+static int64_t daysFromCivil(int y, int m, int d) {
+    y -= m <= 2;
+    int64_t era = (y >= 0 ? y : y - 399) / 400;
+    int64_t yoe = y - era * 400;
+    int64_t doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+static int64_t utcAt(int y, int mo, int d, int h, int mi) {
+    return daysFromCivil(y, mo, d) * 86400 + h * 3600 + mi * 60;
+}
+
+static Alarm daily(int h, int m) {
+    Alarm a = { 1, (uint8_t)h, (uint8_t)m, ALARM_EVERY_DAY };
+    return a;
+}
+
+static void test_zones_present(void) {
+    TEST_ASSERT_TRUE(s_ny >= 0);
+    TEST_ASSERT_TRUE(s_london >= 0);
+    TEST_ASSERT_TRUE(s_shanghai >= 0);
+}
+
+/* 纽约 2026-03-08 02:00 EST → 03:00 EDT：02:30 不存在，按 EST 换算即 03:30 EDT */
+static void test_new_york_spring_gap(void) {
+    int64_t now = utcAt(2026, 3, 8, 5, 0);              /* 当地 00:00 EST */
+    Alarm a = daily(2, 30);
+    TEST_ASSERT_EQUAL_INT64(utcAt(2026, 3, 8, 7, 30), alarmNextFireOne(&a, s_ny, now));
+    a = daily(1, 59);
+    TEST_ASSERT_EQUAL_INT64(utcAt(2026, 3, 8, 6, 59), alarmNextFireOne(&a, s_ny, now));
+    a = daily(3, 0);
+    TEST_ASSERT_EQUAL_INT64(utcAt(2026, 3, 8, 7, 0), alarmNextFireOne(&a, s_ny, now));
+    /* 跳过的时刻刚响过，次日按 EDT 正常换算 */
+    a = daily(2, 30);
+    TEST_ASSERT_EQUAL_INT64(utcAt(2026, 3, 9, 6, 30), alarmNextFireOne(&a, s_ny, utcAt(2026, 3, 8, 7, 30)));
+    TEST_ASSERT_EQUAL_INT64(utcAt(2026, 3, 8, 7, 30), alarmLocalToUtc(s_ny, utcAt(2026, 3, 8, 2, 30)));
+}
+
+/* 纽约 2026-11-01 02:00 EDT → 01:00 EST：01:30 出现两次，只在第一次（EDT）响 */
+static void test_new_york_fall_overlap(void) {
+    Alarm a = daily(1, 30);
+    int64_t first = utcAt(2026, 11, 1, 5, 30);          /* 01:30 EDT */
+    TEST_ASSERT_EQUAL_INT64(first, alarmNextFireOne(&a, s_ny, utcAt(2026, 11, 1, 4, 0)));
+    TEST_ASSERT_EQUAL_INT64(first, alarmLocalToUtc(s_ny, utcAt(2026, 11, 1, 1, 30)));
+    /* 响过之后、以及回拨后的第二个 01:00–02:00 里，下一次都是次日 01:30 EST */
+    int64_t next = utcAt(2026, 11, 2, 6, 30);
+    TEST_ASSERT_EQUAL_INT64(next, alarmNextFireOne(&a, s_ny, first));
+    TEST_ASSERT_EQUAL_INT64(next, alarmNextFireOne(&a, s_ny, utcAt(2026, 11, 1, 6, 0)));
+    TEST_ASSERT_EQUAL_INT64(next, alarmNextFireOne(&a, s_ny, utcAt(2026, 11, 1, 6, 31)));
+    /* 重复区间之外不受影响 */
+    a = daily(2, 0);
+    TEST_ASSERT_EQUAL_INT64(utcAt(2026, 11, 1, 7, 0), alarmNextFireOne(&a, s_ny, first));
+}
+
+/* 伦敦：2026-03-29 01:00 GMT → 02:00 BST；2026-10-25 02:00 BST → 01:00 GMT */
+static void test_london_transitions(void) {
+    Alarm a = daily(1, 30);
+    TEST_ASSERT_EQUAL_INT64(utcAt(2026, 3, 29, 1, 30), alarmNextFireOne(&a, s_london, utcAt(2026, 3, 28, 12, 0)));
+    a = daily(2, 0);
+    TEST_ASSERT_EQUAL_INT64(utcAt(2026, 3, 29, 1, 0), alarmNextFireOne(&a, s_london, utcAt(2026, 3, 28, 12, 0)));
+    a = daily(1, 30);
+    int64_t first = utcAt(2026, 10, 25, 0, 30);         /* 01:30 BST */
+    TEST_ASSERT_EQUAL_INT64(first, alarmNextFireOne(&a, s_london, utcAt(2026, 10, 24, 12, 0)));
+    TEST_ASSERT_EQUAL_INT64(utcAt(2026, 10, 26, 1, 30), alarmNextFireOne(&a, s_london, first));
+}
+
+static void test_month_and_year_rollover(void) {
+    /* 上海 1 月 31 日 08:00，07:00 已过 → 2 月 1 日 07:00 */
+    Alarm a = daily(7, 0);
+    TEST_ASSERT_EQUAL_INT64(utcAt(2026, 1, 31, 23, 0), alarmNextFireOne(&a, s_shanghai, utcAt(2026, 1, 31, 0, 0)));
+    /* 闰年 2 月底 */
+    TEST_ASSERT_EQUAL_INT64(utcAt(2028, 2, 28, 23, 0), alarmNextFireOne(&a, s_shanghai, utcAt(2028, 2, 28, 0, 0)));
+    TEST_ASSERT_EQUAL_INT64(utcAt(2028, 2, 29, 23, 0), alarmNextFireOne(&a, s_shanghai, utcAt(2028, 2, 29, 0, 0)));
+    /* 纽约跨年：12 月 31 日 23:30 EST → 1 月 1 日 06:00 EST */
+    a = daily(6, 0);
+    TEST_ASSERT_EQUAL_INT64(utcAt(2027, 1, 1, 11, 0), alarmNextFireOne(&a, s_ny, utcAt(2027, 1, 1, 4, 30)));
+    /* 只在周一：2026-12-31（周四）之后是 2027-01-04 */
+    Alarm mon = { 1, 6, 0, 1u << 1 };
+    TEST_ASSERT_EQUAL_INT64(utcAt(2027, 1, 4, 11, 0), alarmNextFireOne(&mon, s_ny, utcAt(2027, 1, 1, 4, 30)));
+    /* 2026-02-28（周六）之后的周一是 3 月 2 日 */
+    TEST_ASSERT_EQUAL_INT64(utcAt(2026, 3, 2, 11, 0), alarmNextFireOne(&mon, s_ny, utcAt(2026, 2, 28, 17, 0)));
+    /* 上海本地已到新的一年（1 月 1 日 04:00）、UTC 仍在前一年 */
+    TEST_ASSERT_EQUAL_INT64(utcAt(2026, 12, 31, 22, 0), alarmNextFireOne(&a, s_shanghai, utcAt(2026, 12, 31, 20, 0)));
+}
+
+static void test_weekday_mask_and_one_shot(void) {
+    /* 2026-06-10 是周三；只在周末 */
+    Alarm weekend = { 1, 9, 0, (1u << 0) | (1u << 6) };
+    TEST_ASSERT_EQUAL_INT64(utcAt(2026, 6, 13, 1, 0), alarmNextFireOne(&weekend, s_shanghai, utcAt(2026, 6, 10, 0, 0)));
+    /* 一次性：今天还没到就是今天，已过就是明天 */
+    Alarm once = { 1, 9, 0, 0 };
+    TEST_ASSERT_EQUAL_INT64(utcAt(2026, 6, 10, 1, 0), alarmNextFireOne(&once, s_shanghai, utcAt(2026, 6, 10, 0, 0)));
+    TEST_ASSERT_EQUAL_INT64(utcAt(2026, 6, 11, 1, 0), alarmNextFireOne(&once, s_shanghai, utcAt(2026, 6, 10, 1, 0)));
+    Alarm off = { 0, 9, 0, ALARM_EVERY_DAY };
+    TEST_ASSERT_EQUAL_INT64(-1, alarmNextFireOne(&off, s_shanghai, 0));
+    Alarm list[3] = { weekend, off, once };
+    int idx = -9;
+    TEST_ASSERT_EQUAL_INT64(utcAt(2026, 6, 10, 1, 0), alarmNextFire(list, 3, s_shanghai, utcAt(2026, 6, 10, 0, 0), &idx));
+    TEST_ASSERT_EQUAL_INT(2, idx);
+    TEST_ASSERT_EQUAL_INT64(utcAt(2026, 6, 13, 1, 0), alarmNextFire(list, 2, s_shanghai, utcAt(2026, 6, 10, 0, 0), &idx));
+    TEST_ASSERT_EQUAL_INT(0, idx);
+    TEST_ASSERT_EQUAL_INT64(-1, alarmNextFire(&off, 1, s_shanghai, 0, &idx));
+    TEST_ASSERT_EQUAL_INT(-1, idx);
+}
+
+/*
+ * 纽约 2026 全年每 3 小时一个起点、每 15 分钟一个闹钟：结果晚于起点、不超过一天，
+ * 本地时分等于闹钟时刻；只有落在跳过区间里的才晚一小时
+ */
+static void test_new_york_year_sweep(void) {
+    int64_t gapUtc = utcAt(2026, 3, 8, 7, 0);
+    for (int64_t now = utcAt(2026, 1, 1, 0, 0); now < utcAt(2027, 1, 1, 0, 0); now += 3 * 3600) {
+        for (int m = 0; m < 24 * 60; m += 15) {
+            Alarm a = daily(m / 60, m % 60);
+            int64_t t = alarmNextFireOne(&a, s_ny, now);
+            TEST_ASSERT_TRUE(t > now);
+            TEST_ASSERT_TRUE(t - now <= 25 * 3600);
+            struct tm lt;
+            tzCivilFromSeconds(t + tzOffsetAt(s_ny, t), &lt);
+            int got = lt.tm_hour * 60 + lt.tm_min;
+            bool inGap = t >= gapUtc && t < gapUtc + 3600 && m >= 120 && m < 180;
+            TEST_ASSERT_EQUAL_INT(inGap ? m + 60 : m, got);
+        }
+    }
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_zones_present);
+    RUN_TEST(test_new_york_spring_gap);
+    RUN_TEST(test_new_york_fall_overlap);
+    RUN_TEST(test_london_transitions);
+    RUN_TEST(test_month_and_year_rollover);
+    RUN_TEST(test_weekday_mask_and_one_shot);
+    RUN_TEST(test_new_york_year_sweep);
+    return UNITY_END();
+}
@@ -0,0 +1,341 @@
+/**
+ * @file test_main.cpp
+ * @brief config_blob 主机测试：编解码往返、CRC 与长度校验、未知标签跳过、旧设置与版本迁移
+ */
+#include <unity.h>
+#include <string.h>
+#include "config_blob.h"
+
+static ConfigData c;
+static ConfigData d;
+static uint8_t blob[CONFIG_BLOB_MAX];
+
+void setUp(void) {
+    configDefaults(&c);
+    configDefaults(&d);
+    memset(blob, 0, sizeof(blob));
+}
+
+void tearDown(void) {}
+
+static void fillFull(ConfigData* x) {
+    configDefaults(x);
+    memset(x->weatherLocation, 'w', CONFIG_STR_MAX - 1);
+    memset(x->tzName, 't', CONFIG_STR_MAX - 1);
+    memset(x->netPolicy, 'n', CONFIG_NAME_MAX - 1);
+    memset(x->powerProfile, 'p', CONFIG_NAME_MAX - 1);
+    x->alarmCount = ALARM_MAX;
+    for (int i = 0; i < ALARM_MAX; i++) {
+        Alarm a = { (uint8_t)(i % 2), (uint8_t)(i * 3), (uint8_t)(i * 7), (uint8_t)(i * 15 % 128) };
+        x->alarms[i] = a;
+    }
+}
+
+static void fillTypical(ConfigData* x) {
+    configDefaults(x);
+    strcpy(x->weatherLocation, "WX4FBXXFKE4F");
+    strcpy(x->tzName, "America/New_York");
+    strcpy(x->netPolicy, "radio_off");
+    x->alarmCount = 2;
+    Alarm a0 = { 1, 7, 0, 0x3E };
+    Alarm a1 = { 0, 9, 30, 0 };
+    x->alarms[0] = a0;
+    x->alarms[1] = a1;
+}
+
+static void assertSame(const ConfigData* a, const ConfigData* b) {
+    TEST_ASSERT_EQUAL_STRING(a->weatherLocation, b->weatherLocation);
+    TEST_ASSERT_EQUAL_STRING(a->tzName, b->tzName);
+    TEST_ASSERT_EQUAL_STRING(a->netPolicy, b->netPolicy);
+    TEST_ASSERT_EQUAL_STRING(a->powerProfile, b->powerProfile);
+    TEST_ASSERT_EQUAL_UINT8(a->alarmCount, b->alarmCount);
+    TEST_ASSERT_EQUAL_MEMORY(a->alarms, b->alarms, sizeof(Alarm) * a->alarmCount);
+}
+
+static void assertDefaults(const ConfigData* x) {
+    ConfigData def;
+    configDefaults(&def);
+    TEST_ASSERT_EQUAL_MEMORY(&def, x, sizeof(def));
+}
+
+/* 按给定版本与负载拼一个 CRC 正确的块，模拟其他版本固件写的数据 */
+static size_t buildBlob(uint16_t version, const uint8_t* payload, size_t payloadLen, uint32_t writes) {
+    uint8_t* h = blob;
+    uint32_t magic = CONFIG_BLOB_MAGIC;
+    for (int i = 0; i < 4; i++) h[i] = (uint8_t)(magic >> (8 * i));
+    h[4] = (uint8_t)version;
+    h[5] = (uint8_t)(version >> 8);
+    h[6] = (uint8_t)payloadLen;
+    h[7] = (uint8_t)(payloadLen >> 8);
+    for (int i = 0; i < 4; i++) h[8 + i] = (uint8_t)(writes >> (8 * i));
+    memcpy(blob + CONFIG_HEADER_BYTES, payload, payloadLen);
+    uint8_t tmp[CONFIG_BLOB_MAX];
+    memcpy(tmp, blob, CONFIG_HEADER_BYTES - 4);
+    memcpy(tmp + CONFIG_HEADER_BYTES - 4, payload, payloadLen);
+    uint32_t crc = configCrc32(tmp, CONFIG_HEADER_BYTES - 4 + payloadLen);
+    for (int i = 0; i < 4; i++) h[12 + i] = (uint8_t)(crc >> (8 * i));
+    return CONFIG_HEADER_BYTES + payloadLen;
+}
+
+static void test_crc32_check_value(void) {
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926u, configCrc32((const uint8_t*)"123456789", 9));
+}
+
+static void test_round_trip(void) {
+    fillTypical(&c);
+    size_t n = configEncode(&c, 17, blob, sizeof(blob));
+    TEST_ASSERT_TRUE(n > CONFIG_HEADER_BYTES);
+    uint32_t writes = 0;
+    TEST_ASSERT_EQUAL_INT(CONFIG_LOAD_OK, configDecode(blob, n, &d, &writes));
+    TEST_ASSERT_EQUAL_UINT32(17, writes);
+    assertSame(&c, &d);
+    TEST_ASSERT_EQUAL_STRING("", d.powerProfile);
+}
+
+/* 全部字段取最大长度：150 字节，CONFIG_BLOB_MAX 有余量 */
+static void test_round_trip_full(void) {
+    fillFull(&c);
+    size_t n = configEncode(&c, 0xFFFFFFFFu, blob, sizeof(blob));
+    TEST_ASSERT_EQUAL_size_t(150, n);
+    uint32_t writes = 0;
+    TEST_ASSERT_EQUAL_INT(CONFIG_LOAD_OK, configDecode(blob, n, &d, &writes));
+    TEST_ASSERT_EQUAL_UINT32(0xFFFFFFFFu, writes);
+    assertSame(&c, &d);
+    TEST_ASSERT_EQUAL_size_t(0, configEncode(&c, 0, blob, n - 1));
+    TEST_ASSERT_EQUAL_size_t(0, configEncode(&c, 0, blob, CONFIG_HEADER_BYTES - 1));
+}
+
+/* 默认值不写字段：只有头部 */
+static void test_defaults_header_only(void) {
+    size_t n = configEncode(&c, 1, blob, sizeof(blob));
+    TEST_ASSERT_EQUAL_size_t(CONFIG_HEADER_BYTES, n);
+    TEST_ASSERT_EQUAL_INT(CONFIG_LOAD_OK, configDecode(blob, n, &d, NULL));
+    assertDefaults(&d);
+}
+
+/* 任意一个字节损坏都被拒绝，且结果为默认值 */
+static void test_corruption_rejected(void) {
+    fillTypical(&c);
+    size_t n = configEncode(&c, 5, blob, sizeof(blob));
+    for (size_t i = 0; i < n; i++) {
+        for (int bit = 0; bit < 8; bit++) {
+            blob[i] ^= (uint8_t)(1u << bit);
+            fillFull(&d);
+            ConfigLoadResult r = configDecode(blob, n, &d, NULL);
+            TEST_ASSERT_TRUE(r != CONFIG_LOAD_OK && r != CONFIG_LOAD_MIGRATED);
+            assertDefaults(&d);
+            blob[i] ^= (uint8_t)(1u << bit);
+        }
+    }
+    blob[CONFIG_HEADER_BYTES + 3] ^= 0x40;
+    TEST_ASSERT_EQUAL_INT(CONFIG_LOAD_BAD_CRC, configDecode(blob, n, &d, NULL));
+    blob[CONFIG_HEADER_BYTES + 3] ^= 0x40;
+    blob[9] ^= 1;                                       /* 写入次数也在 CRC 内 */
+    TEST_ASSERT_EQUAL_INT(CONFIG_LOAD_BAD_CRC, configDecode(blob, n, &d, NULL));
+    blob[9] ^= 1;
+    blob[0] ^= 1;
+    TEST_ASSERT_EQUAL_INT(CONFIG_LOAD_BAD_MAGIC, configDecode(blob, n, &d, NULL));
+    blob[0] ^= 1;
+    TEST_ASSERT_EQUAL_INT(CONFIG_LOAD_OK, configDecode(blob, n, &d, NULL));
+}
+
+/* 负载损坏时仍给出头部的写入次数（磨损记录不归零）；魔数或长度不对时不改动 */
+static void test_writes_survive_bad_payload(void) {
+    fillTypical(&c);
+    size_t n = configEncode(&c, 41, blob, sizeof(blob));
+    uint32_t writes = 0;
+    blob[CONFIG_HEADER_BYTES + 3] ^= 0x40;
+    TEST_ASSERT_EQUAL_INT(CONFIG_LOAD_BAD_CRC, configDecode(blob, n, &d, &writes));
+    TEST_ASSERT_EQUAL_UINT32(41, writes);
+    blob[CONFIG_HEADER_BYTES + 3] ^= 0x40;
+    writes = 7;
+    TEST_ASSERT_EQUAL_INT(CONFIG_LOAD_BAD_LENGTH, configDecode(blob, n - 1, &d, &writes));
+    TEST_ASSERT_EQUAL_UINT32(7, writes);
+    blob[0] ^= 1;
+    TEST_ASSERT_EQUAL_INT(CONFIG_LOAD_BAD_MAGIC, configDecode(blob, n, &d, &writes));
+    TEST_ASSERT_EQUAL_UINT32(7, writes);
+    blob[0] ^= 1;
+    const uint8_t payload[] = { 1, 3, 'a', 'b', 'c', 2, 9, 'x' };
+    n = buildBlob(CONFIG_SCHEMA_VERSION, payload, sizeof(payload), 123);
+    TEST_ASSERT_EQUAL_INT(CONFIG_LOAD_BAD_RECORD, configDecode(blob, n, &d, &writes));
+    TEST_ASSERT_EQUAL_UINT32(123, writes);
+}
+
+static void test_length_rejected(void) {
+    fillTypical(&c);
+    size_t n = configEncode(&c, 5, blob, sizeof(blob));
+    TEST_ASSERT_EQUAL_INT(CONFIG_LOAD_BAD_LENGTH, configDecode(blob, n - 1, &d, NULL));   /* 截断 */
+    TEST_ASSERT_EQUAL_INT(CONFIG_LOAD_BAD_LENGTH, configDecode(blob, n + 1, &d, NULL));   /* 多读了尾部 */
+    TEST_ASSERT_EQUAL_INT(CONFIG_LOAD_BAD_LENGTH, configDecode(blob, CONFIG_HEADER_BYTES - 1, &d, NULL));
+    TEST_ASSERT_EQUAL_INT(CONFIG_LOAD_BAD_LENGTH, configDecode(blob, 0, &d, NULL));
+    assertDefaults(&d);
+}
+
+/* CRC 正确但记录越过负载末尾（写入方有缺陷） */
+static void test_record_overrun_rejected(void) {
+    const uint8_t payload[] = { 1, 3, 'a', 'b', 'c', 2, 9, 'x' };
+    size_t n = buildBlob(CONFIG_SCHEMA_VERSION, payload, sizeof(payload), 0);
+    fillFull(&d);
+    TEST_ASSERT_EQUAL_INT(CONFIG_LOAD_BAD_RECORD, configDecode(blob, n, &d, NULL));
+    assertDefaults(&d);
+    const uint8_t dangling[] = { 1, 3, 'a', 'b', 'c', 2 };
+    n = buildBlob(CONFIG_SCHEMA_VERSION, dangling, sizeof(dangling), 0);
+    TEST_ASSERT_EQUAL_INT(CONFIG_LOAD_BAD_RECORD, configDecode(blob, n, &d, NULL));
+}
+
+/* 新固件写的设置：不认识的标签跳过，其余字段照常读出；更高的版本号也按此处理 */
+static void test_unknown_tags_skipped(void) {
+    const uint8_t payload[] = {
+        200, 4, 0xDE, 0xAD, 0xBE, 0xEF,
+        2, 13, 'E', 'u', 'r', 'o', 'p', 'e', '/', 'L', 'o', 'n', 'd', 'o', 'n',
+        77, 0,
+        5, 4, 1, 6, 45, 0x7F,
+        99, 255, 0
+    };
+    /* 最后一条长度 255 会越界；先用不含它的部分 */
+    size_t n = buildBlob(CONFIG_SCHEMA_VERSION, payload, sizeof(payload) - 3, 9);
+    uint32_t writes = 0;
+    TEST_ASSERT_EQUAL_INT(CONFIG_LOAD_OK, configDecode(blob, n, &d, &writes));
+    TEST_ASSERT_EQUAL_UINT32(9, writes);
+    TEST_ASSERT_EQUAL_STRING("Europe/London", d.tzName);
+    TEST_ASSERT_EQUAL_STRING("", d.weatherLocation);
+    TEST_ASSERT_EQUAL_UINT8(1, d.alarmCount);
+    TEST_ASSERT_EQUAL_UINT8(6, d.alarms[0].hour);
+    TEST_ASSERT_EQUAL_UINT8(45, d.alarms[0].minute);
+    n = buildBlob(CONFIG_SCHEMA_VERSION + 3, payload, sizeof(payload) - 3, 9);
+    TEST_ASSERT_EQUAL_INT(CONFIG_LOAD_OK, configDecode(blob, n, &d, NULL));
+    TEST_ASSERT_EQUAL_STRING("Europe/London", d.tzName);
+    /* 未知标签的长度仍要检查 */
+    n = buildBlob(CONFIG_SCHEMA_VERSION, payload, sizeof(payload), 9);
+    TEST_ASSERT_EQUAL_INT(CONFIG_LOAD_BAD_RECORD, configDecode(blob, n, &d, NULL));
+}
+
+/* 认识的标签内容不合法：只丢该字段 / 该条 */
+static void test_bad_field_content(void) {
+    uint8_t payload[2 + CONFIG_NAME_MAX + 2 + 3 + 2 + 8 + 2 + 3];
+    size_t k = 0;
+    payload[k++] = 3;                                   /* netPolicy 放不下（>= 16） */
+    payload[k++] = CONFIG_NAME_MAX;
+    memset(payload + k, 'z', CONFIG_NAME_MAX);
+    k += CONFIG_NAME_MAX;
+    payload[k++] = 4;
+    payload[k++] = 3;
+    memcpy(payload + k, "eco", 3);
+    k += 3;
+    payload[k++] = 5;                                   /* 两条闹钟，第二条时间越界 */
+    payload[k++] = 8;
+    const uint8_t alarms[8] = { 1, 6, 30, 0x41, 1, 24, 0, 0x7F };
+    memcpy(payload + k, alarms, 8);
+    k += 8;
+    payload[k++] = 1;
+    payload[k++] = 3;
+    memcpy(payload + k, "abc", 3);
+    k += 3;
+    size_t n = buildBlob(CONFIG_SCHEMA_VERSION, payload, k, 0);
+    TEST_ASSERT_EQUAL_INT(CONFIG_LOAD_OK, configDecode(blob, n, &d, NULL));
+    TEST_ASSERT_EQUAL_STRING("", d.netPolicy);
+    TEST_ASSERT_EQUAL_STRING("eco", d.powerProfile);
+    TEST_ASSERT_EQUAL_STRING("abc", d.weatherLocation);
+    TEST_ASSERT_EQUAL_UINT8(1, d.alarmCount);
+    TEST_ASSERT_EQUAL_UINT8(30, d.alarms[0].minute);
+    /* 闹钟字节数不是 4 的倍数：整个字段忽略 */
+    const uint8_t ragged[] = { 5, 5, 1, 6, 30, 0x41, 1 };
+    n = buildBlob(CONFIG_SCHEMA_VERSION, ragged, sizeof(ragged), 0);
+    TEST_ASSERT_EQUAL_INT(CONFIG_LOAD_OK, configDecode(blob, n, &d, NULL));
+    TEST_ASSERT_EQUAL_UINT8(0, d.alarmCount);
+}
+
+static void test_version_zero_and_migrate(void) {
+    /* 第 0 版没有设置块（逐键保存），头部写 0 的不是合法数据 */
+    const uint8_t payload[] = { 2, 3, 'U', 'T', 'C' };
+    size_t n = buildBlob(0, payload, sizeof(payload), 0);
+    TEST_ASSERT_EQUAL_INT(CONFIG_LOAD_BAD_MAGIC, configDecode(blob, n, &d, NULL));
+    assertDefaults(&d);
+    /* 当前版本没有迁移步骤：迁移前后字段不变 */
+    fillTypical(&c);
+    memcpy(&d, &c, sizeof(c));
+    configMigrate(&d, CONFIG_SCHEMA_VERSION);
+    TEST_ASSERT_EQUAL_MEMORY(&c, &d, sizeof(c));
+    configMigrate(&d, 1);
+    TEST_ASSERT_EQUAL_MEMORY(&c, &d, sizeof(c));
+}
+
+static void test_legacy_full(void) {
+    Alarm alarms[2] = { { 1, 6, 30, 0x3E }, { 1, 8, 0, 0 } };
+    ConfigLegacy legacy = { "WX4FBXXFKE4F", "Asia/Tokyo", "modem_sleep", "auto",
+                            (const uint8_t*)alarms, sizeof(alarms) };
+    configFromLegacy(&legacy, &c);
+    TEST_ASSERT_EQUAL_STRING("WX4FBXXFKE4F", c.weatherLocation);
+    TEST_ASSERT_EQUAL_STRING("Asia/Tokyo", c.tzName);
+    TEST_ASSERT_EQUAL_STRING("modem_sleep", c.netPolicy);
+    TEST_ASSERT_EQUAL_STRING("auto", c.powerProfile);
+    TEST_ASSERT_EQUAL_UINT8(2, c.alarmCount);
+    TEST_ASSERT_EQUAL_MEMORY(alarms, c.alarms, sizeof(alarms));
+    /* 迁移后按当前格式存，再读回一致 */
+    size_t n = configEncode(&c, 1, blob, sizeof(blob));
+    TEST_ASSERT_EQUAL_INT(CONFIG_LOAD_OK, configDecode(blob, n, &d, NULL));
+    assertSame(&c, &d);
+}
+
+static void test_legacy_partial_and_bad(void) {
+    ConfigLegacy none = { NULL, NULL, NULL, NULL, NULL, 0 };
+    configFromLegacy(&none, &c);
+    assertDefaults(&c);
+    /* 放不下的字符串取默认；闹钟字节数不整齐整体丢弃 */
+    char longName[CONFIG_NAME_MAX + 4];
+    memset(longName, 'x', sizeof(longName) - 1);
+    longName[sizeof(longName) - 1] = '\0';
+    Alarm alarms[3] = { { 1, 6, 30, 0x3E }, { 1, 8, 0, 0 }, { 1, 9, 0, 0 } };
+    ConfigLegacy bad = { "abc", NULL, longName, NULL, (const uint8_t*)alarms, sizeof(Alarm) * 2 + 1 };
+    configFromLegacy(&bad, &c);
+    TEST_ASSERT_EQUAL_STRING("abc", c.weatherLocation);
+    TEST_ASSERT_EQUAL_STRING("", c.netPolicy);
+    TEST_ASSERT_EQUAL_UINT8(0, c.alarmCount);
+    /* 越界的条目只丢该条 */
+    alarms[1].minute = 60;
+    alarms[2].enabled = 7;
+    ConfigLegacy mixed = { NULL, NULL, NULL, NULL, (const uint8_t*)alarms, sizeof(alarms) };
+    configFromLegacy(&mixed, &c);
+    TEST_ASSERT_EQUAL_UINT8(1, c.alarmCount);
+    TEST_ASSERT_EQUAL_UINT8(6, c.alarms[0].hour);
+    /* 超过 ALARM_MAX 条：整体丢弃 */
+    Alarm many[ALARM_MAX + 1];
+    memset(many, 0, sizeof(many));
+    ConfigLegacy tooMany = { NULL, NULL, NULL, NULL, (const uint8_t*)many, sizeof(many) };
+    configFromLegacy(&tooMany, &c);
+    TEST_ASSERT_EQUAL_UINT8(0, c.alarmCount);
+}
+
+static void test_same_payload(void) {
+    fillTypical(&c);
+    uint8_t other[CONFIG_BLOB_MAX];
+    size_t a = configEncode(&c, 1, blob, sizeof(blob));
+    size_t b = configEncode(&c, 2, other, sizeof(other));
+    TEST_ASSERT_TRUE(configSamePayload(blob, a, other, b));        /* 只差写入次数与 CRC */
+    c.alarms[1].minute = 31;
+    b = configEncode(&c, 1, other, sizeof(other));
+    TEST_ASSERT_FALSE(configSamePayload(blob, a, other, b));
+    strcpy(c.powerProfile, "eco");
+    b = configEncode(&c, 1, other, sizeof(other));
+    TEST_ASSERT_FALSE(configSamePayload(blob, a, other, b));
+    TEST_ASSERT_FALSE(configSamePayload(blob, 4, blob, 4));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_crc32_check_value);
+    RUN_TEST(test_round_trip);
+    RUN_TEST(test_round_trip_full);
+    RUN_TEST(test_defaults_header_only);
+    RUN_TEST(test_corruption_rejected);
+    RUN_TEST(test_writes_survive_bad_payload);
+    RUN_TEST(test_length_rejected);
+    RUN_TEST(test_record_overrun_rejected);
+    RUN_TEST(test_unknown_tags_skipped);
+    RUN_TEST(test_bad_field_content);
+    RUN_TEST(test_version_zero_and_migrate);
+    RUN_TEST(test_legacy_full);
+    RUN_TEST(test_legacy_partial_and_bad);
+    RUN_TEST(test_same_payload);
+    return UNITY_END();
+}
@@ -0,0 +1,131 @@
+/**
+ * @file test_main.cpp
+ * @brief drift_estimator 主机测试：合成偏差序列下的斜率估计、异常样本剔除、再对时间隔限幅
+ */
+#include <unity.h>
+#include <stdlib.h>
+#include "drift_estimator.h"
+
+#define TARGET_ERR_MS   100
+#define MIN_S           (15 * 60)
+#define MAX_S           (24 * 3600)
+#define DEFAULT_S       3600
+
+static DriftEstimator d;
+
+void setUp(void) {
+    driftEstimatorReset(&d);
+}
+
+void tearDown(void) {}
+
+/* 均匀分布的测量噪声，幅度 ±amp 毫秒 */
+static float noiseMs(float amp) {
+    return amp * (2.0f * (float)rand() / (float)RAND_MAX - 1.0f);
+}
+
+/* 以 ppm 的漂移、每 intervalS 对时一次，喂 n 个样本 */
+static int feed(float ppm, float intervalS, int n, float noiseAmpMs, float errMs) {
+    int used = 0;
+    for (int i = 0; i < n; i++) {
+        float offsetMs = ppm * intervalS / 1000.0f + noiseMs(noiseAmpMs);
+        if (driftEstimatorAdd(&d, intervalS, offsetMs, errMs)) used++;
+    }
+    return used;
+}
+
+static void test_constant_slope(void) {
+    srand(1);
+    TEST_ASSERT_EQUAL_INT(20, feed(23.5f, 3600, 20, 5, 15));
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, 23.5f, driftEstimatorPpm(&d));
+    TEST_ASSERT_TRUE(driftEstimatorSigmaPpm(&d) >= 0.0f);
+    TEST_ASSERT_TRUE(driftEstimatorSigmaPpm(&d) < 2.0f);
+    /* 负漂移（本地偏快） */
+    driftEstimatorReset(&d);
+    feed(-8.0f, 7200, 10, 5, 15);
+    TEST_ASSERT_FLOAT_WITHIN(0.3f, -8.0f, driftEstimatorPpm(&d));
+}
+
+static void test_short_interval_ignored(void) {
+    TEST_ASSERT_FALSE(driftEstimatorAdd(&d, DRIFT_MIN_INTERVAL_S - 1, 50, 10));
+    TEST_ASSERT_EQUAL_UINT32(0, d.samples);
+    TEST_ASSERT_EQUAL_UINT32(0, d.rejected);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.0f, driftEstimatorPpm(&d));
+    TEST_ASSERT_TRUE(driftEstimatorSigmaPpm(&d) < 0.0f);
+}
+
+/* 稳定序列中的一次跳变（如服务器异常或挂起期间的时间跳）被剔除，不影响估计 */
+static void test_outlier_rejected(void) {
+    srand(2);
+    feed(15.0f, 3600, 8, 3, 12);
+    float before = driftEstimatorPpm(&d);
+    TEST_ASSERT_FALSE(driftEstimatorAdd(&d, 3600, 2000.0f, 12));
+    TEST_ASSERT_EQUAL_UINT32(1, d.rejected);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, before, driftEstimatorPpm(&d));
+    TEST_ASSERT_EQUAL_INT(5, feed(15.0f, 3600, 5, 3, 12));
+    TEST_ASSERT_FLOAT_WITHIN(0.3f, 15.0f, driftEstimatorPpm(&d));
+}
+
+/* 前几个样本还没有离散度估计，不做剔除 */
+static void test_no_rejection_before_min_samples(void) {
+    for (int i = 0; i < DRIFT_MIN_SAMPLES_FOR_OUTLIER; i++)
+        TEST_ASSERT_TRUE(driftEstimatorAdd(&d, 3600, i == 1 ? 500.0f : 36.0f, 12));
+    TEST_ASSERT_EQUAL_UINT32(0, d.rejected);
+}
+
+/* 温度变化引起的缓慢漂移变化：指数遗忘让估计跟上 */
+static void test_tracks_gradual_change(void) {
+    srand(3);
+    feed(10.0f, 3600, 10, 3, 12);
+    for (int step = 1; step <= 10; step++) feed(10.0f + step, 3600, 2, 3, 12);
+    feed(20.0f, 3600, 6, 3, 12);
+    TEST_ASSERT_FLOAT_WITHIN(1.0f, 20.0f, driftEstimatorPpm(&d));
+    TEST_ASSERT_EQUAL_UINT32(0, d.rejected);
+}
+
+static void test_interval_from_drift(void) {
+    TEST_ASSERT_EQUAL_UINT32(DEFAULT_S, driftNextIntervalS(&d, TARGET_ERR_MS, MIN_S, MAX_S, DEFAULT_S));
+    /* 20ppm 无噪声：100ms / 20ppm = 5000 秒 */
+    feed(20.0f, 3600, 6, 0, 10);
+    uint32_t s = driftNextIntervalS(&d, TARGET_ERR_MS, MIN_S, MAX_S, DEFAULT_S);
+    TEST_ASSERT_INT_WITHIN(50, 5000, s);
+}
+
+static void test_interval_clamped(void) {
+    /* 大漂移：算出的间隔短于下限 */
+    feed(500.0f, 3600, 5, 0, 10);
+    TEST_ASSERT_EQUAL_UINT32(MIN_S, driftNextIntervalS(&d, TARGET_ERR_MS, MIN_S, MAX_S, DEFAULT_S));
+    /* 几乎没有漂移：取上限 */
+    driftEstimatorReset(&d);
+    feed(0.0f, 3600, 5, 0, 10);
+    TEST_ASSERT_EQUAL_UINT32(MAX_S, driftNextIntervalS(&d, TARGET_ERR_MS, MIN_S, MAX_S, DEFAULT_S));
+    /* 小漂移：100ms / 1ppm = 100000 秒，超过上限 */
+    driftEstimatorReset(&d);
+    feed(1.0f, 3600, 5, 0, 10);
+    TEST_ASSERT_EQUAL_UINT32(MAX_S, driftNextIntervalS(&d, TARGET_ERR_MS, MIN_S, MAX_S, DEFAULT_S));
+}
+
+/* 离散度大时按估计上沿安排，间隔比只看均值短 */
+static void test_interval_conservative_with_noise(void) {
+    srand(4);
+    feed(20.0f, 3600, 12, 40, 50);
+    float ppm = driftEstimatorPpm(&d);
+    float sigma = driftEstimatorSigmaPpm(&d);
+    TEST_ASSERT_TRUE(sigma > 0.0f);
+    uint32_t s = driftNextIntervalS(&d, TARGET_ERR_MS, MIN_S, MAX_S, DEFAULT_S);
+    TEST_ASSERT_TRUE(s < (uint32_t)(TARGET_ERR_MS * 1000.0f / ppm));
+    TEST_ASSERT_INT_WITHIN(2, (int)(TARGET_ERR_MS * 1000.0f / (ppm + sigma)), (int)s);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_constant_slope);
+    RUN_TEST(test_short_interval_ignored);
+    RUN_TEST(test_outlier_rejected);
+    RUN_TEST(test_no_rejection_before_min_samples);
+    RUN_TEST(test_tracks_gradual_change);
+    RUN_TEST(test_interval_from_drift);
+    RUN_TEST(test_interval_clamped);
+    RUN_TEST(test_interval_conservative_with_noise);
+    return UNITY_END();
+}
@@ -0,0 +1,139 @@
+/**
+ * @file test_main.cpp
+ * @brief frame_codec 主机测试：关键帧 / 差分帧往返、最坏长度、畸形消息拒绝
+ */
+#include <unity.h>
+#include <stdlib.h>
+#include <string.h>
+#include "frame_codec.h"
+
+static uint8_t cur[FRAME_BYTES];
+static uint8_t prev[FRAME_BYTES];
+static uint8_t fb[FRAME_BYTES];
+static uint8_t msg[FRAME_CODEC_MAX_OUT];
+
+void setUp(void) {
+    memset(cur, 0, sizeof(cur));
+    memset(prev, 0, sizeof(prev));
+    memset(fb, 0, sizeof(fb));
+}
+
+void tearDown(void) {}
+
+/* 稀疏随机画面：大片空白夹着短游程和零散字节，接近真实界面 */
+static void fillSparse(uint8_t* f, int density) {
+    for (int i = 0; i < FRAME_BYTES; i++) f[i] = (rand() % 100 < density) ? (uint8_t)rand() : 0;
+}
+
+static void test_key_round_trip(void) {
+    srand(1);
+    fillSparse(cur, 30);
+    memset(fb, 0x5A, sizeof(fb));                   /* 关键帧不依赖原有内容 */
+    size_t n = frameEncode(cur, NULL, msg, sizeof(msg));
+    TEST_ASSERT_TRUE(n > 2);
+    TEST_ASSERT_EQUAL_UINT8(FRAME_MSG_KEY, msg[0]);
+    TEST_ASSERT_TRUE(frameDecode(msg, n, fb));
+    TEST_ASSERT_EQUAL_MEMORY(cur, fb, FRAME_BYTES);
+}
+
+/* 一串差分帧依次应用，每帧都与编码端一致 */
+static void test_delta_sequence_round_trip(void) {
+    srand(2);
+    fillSparse(cur, 20);
+    size_t n = frameEncode(cur, NULL, msg, sizeof(msg));
+    TEST_ASSERT_TRUE(frameDecode(msg, n, fb));
+    for (int f = 0; f < 500; f++) {
+        memcpy(prev, cur, FRAME_BYTES);
+        int edits = rand() % 40;
+        for (int e = 0; e < edits; e++) cur[rand() % FRAME_BYTES] = (uint8_t)rand();
+        n = frameEncode(cur, prev, msg, sizeof(msg));
+        if (n == 0) {
+            TEST_ASSERT_EQUAL_MEMORY(prev, cur, FRAME_BYTES);
+            continue;
+        }
+        TEST_ASSERT_EQUAL_UINT8(FRAME_MSG_DELTA, msg[0]);
+        for (int p = 0; p < FRAME_PAGES; p++) {
+            bool changed = memcmp(cur + p * FRAME_W, prev + p * FRAME_W, FRAME_W) != 0;
+            TEST_ASSERT_EQUAL_INT(changed ? 1 : 0, (msg[1] >> p) & 1);
+        }
+        TEST_ASSERT_TRUE(frameDecode(msg, n, fb));
+        TEST_ASSERT_EQUAL_MEMORY(cur, fb, FRAME_BYTES);
+    }
+}
+
+static void test_unchanged_delta_is_empty(void) {
+    srand(3);
+    fillSparse(cur, 50);
+    memcpy(prev, cur, FRAME_BYTES);
+    TEST_ASSERT_EQUAL_size_t(0, frameEncode(cur, prev, msg, sizeof(msg)));
+    /* 全黑关键帧仍要发送：每页一个游程 */
+    memset(cur, 0, sizeof(cur));
+    size_t n = frameEncode(cur, NULL, msg, sizeof(msg));
+    TEST_ASSERT_EQUAL_size_t(2 + FRAME_PAGES * 2, n);
+    TEST_ASSERT_EQUAL_UINT8(0xFF, msg[1]);
+}
+
+/* 噪声画面与“两字节一变”的短游程交错都不超过 FRAME_CODEC_MAX_OUT，且仍能往返 */
+static void test_worst_case_fits(void) {
+    srand(4);
+    for (int round = 0; round < 200; round++) {
+        for (int i = 0; i < FRAME_BYTES; i++) {
+            switch (round % 3) {
+                case 0:  cur[i] = (uint8_t)rand(); break;
+                case 1:  cur[i] = (uint8_t)((i / 3) % 2 ? rand() % 2 : 0xFF); break;
+                default: cur[i] = (uint8_t)(i % 5 < 3 ? 0xAA : rand()); break;
+            }
+        }
+        size_t n = frameEncode(cur, NULL, msg, sizeof(msg));
+        TEST_ASSERT_TRUE(n > 0);
+        TEST_ASSERT_TRUE(n <= FRAME_CODEC_MAX_OUT);
+        TEST_ASSERT_TRUE(frameDecode(msg, n, fb));
+        TEST_ASSERT_EQUAL_MEMORY(cur, fb, FRAME_BYTES);
+    }
+}
+
+static void test_small_capacity_fails(void) {
+    srand(5);
+    fillSparse(cur, 80);
+    size_t n = frameEncode(cur, NULL, msg, sizeof(msg));
+    TEST_ASSERT_TRUE(n > 0);
+    TEST_ASSERT_EQUAL_size_t(0, frameEncode(cur, NULL, msg, n - 1));
+    TEST_ASSERT_EQUAL_size_t(0, frameEncode(cur, NULL, msg, 1));
+    TEST_ASSERT_EQUAL_size_t(n, frameEncode(cur, NULL, msg, n));
+}
+
+static void test_malformed_rejected(void) {
+    srand(6);
+    fillSparse(cur, 30);
+    size_t n = frameEncode(cur, NULL, msg, sizeof(msg));
+    TEST_ASSERT_FALSE(frameDecode(msg, 1, fb));
+    TEST_ASSERT_FALSE(frameDecode(msg, n - 1, fb));          /* 截断 */
+    uint8_t longer[FRAME_CODEC_MAX_OUT + 1];
+    memcpy(longer, msg, n);
+    longer[n] = 0;
+    TEST_ASSERT_FALSE(frameDecode(longer, n + 1, fb));       /* 多余字节 */
+    msg[0] = 0x7E;
+    TEST_ASSERT_FALSE(frameDecode(msg, n, fb));              /* 未知类型 */
+    /* 游程越过页尾 */
+    const uint8_t overrun[] = { FRAME_MSG_DELTA, 0x01, 0xFF, 0x00 };
+    TEST_ASSERT_FALSE(frameDecode(overrun, sizeof(overrun), fb));
+    /* 原样字节越过页尾：126 个 0 之后再来 3 个原样字节 */
+    const uint8_t litOverrun[] = { FRAME_MSG_DELTA, 0x01, 0x80 | 124, 0x00, 0x02, 1, 2, 3 };
+    TEST_ASSERT_FALSE(frameDecode(litOverrun, sizeof(litOverrun), fb));
+    /* 空差分帧：掩码为 0、没有页数据，合法但不改变画面 */
+    memcpy(fb, cur, FRAME_BYTES);
+    const uint8_t empty[] = { FRAME_MSG_DELTA, 0x00 };
+    TEST_ASSERT_TRUE(frameDecode(empty, sizeof(empty), fb));
+    TEST_ASSERT_EQUAL_MEMORY(cur, fb, FRAME_BYTES);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_key_round_trip);
+    RUN_TEST(test_delta_sequence_round_trip);
+    RUN_TEST(test_unchanged_delta_is_empty);
+    RUN_TEST(test_worst_case_fits);
+    RUN_TEST(test_small_capacity_fails);
+    RUN_TEST(test_malformed_rejected);
+    return UNITY_END();
+}
@@ -0,0 +1,644 @@
+/*
+ * 由 tools/gen_lunar_reference.cpp 生成（ICU 72.1 ChineseCalendar，Asia/Shanghai），勿手工修改。
+ * 公历 1900..2100 年内每个农历月的月首：公历日期 YYYYMMDD、农历年、月、是否闰月。
+ */
+#ifndef LUNAR_REFERENCE_H
+#define LUNAR_REFERENCE_H
+
+#include <stdint.h>
+
+struct LunarRefMonth {
+    int32_t start;
+    int16_t year;
+    int8_t month;
+    int8_t leap;
+};
+
+static const LunarRefMonth LUNAR_REF_MONTHS[] = {
+    { 19000101, 1899, 12, 0 }, { 19000131, 1900, 1, 0 }, { 19000301, 1900, 2, 0 }, { 19000331, 1900, 3, 0 },
+    { 19000429, 1900, 4, 0 }, { 19000528, 1900, 5, 0 }, { 19000627, 1900, 6, 0 }, { 19000726, 1900, 7, 0 },
+    { 19000825, 1900, 8, 0 }, { 19000924, 1900, 8, 1 }, { 19001023, 1900, 9, 0 }, { 19001122, 1900, 10, 0 },
+    { 19001222, 1900, 11, 0 }, { 19010120, 1900, 12, 0 }, { 19010219, 1901, 1, 0 }, { 19010320, 1901, 2, 0 },
+    { 19010419, 1901, 3, 0 }, { 19010518, 1901, 4, 0 }, { 19010616, 1901, 5, 0 }, { 19010716, 1901, 6, 0 },
+    { 19010814, 1901, 7, 0 }, { 19010913, 1901, 8, 0 }, { 19011012, 1901, 9, 0 }, { 19011111, 1901, 10, 0 },
+    { 19011211, 1901, 11, 0 }, { 19020110, 1901, 12, 0 }, { 19020208, 1902, 1, 0 }, { 19020310, 1902, 2, 0 },
+    { 19020408, 1902, 3, 0 }, { 19020508, 1902, 4, 0 }, { 19020606, 1902, 5, 0 }, { 19020705, 1902, 6, 0 },
+    { 19020804, 1902, 7, 0 }, { 19020902, 1902, 8, 0 }, { 19021002, 1902, 9, 0 }, { 19021031, 1902, 10, 0 },
+    { 19021130, 1902, 11, 0 }, { 19021230, 1902, 12, 0 }, { 19030129, 1903, 1, 0 }, { 19030227, 1903, 2, 0 },
+    { 19030329, 1903, 3, 0 }, { 19030427, 1903, 4, 0 }, { 19030527, 1903, 5, 0 }, { 19030625, 1903, 5, 1 },
+    { 19030724, 1903, 6, 0 }, { 19030823, 1903, 7, 0 }, { 19030921, 1903, 8, 0 }, { 19031020, 1903, 9, 0 },
+    { 19031119, 1903, 10, 0 }, { 19031219, 1903, 11, 0 }, { 19040117, 1903, 12, 0 }, { 19040216, 1904, 1, 0 },
+    { 19040317, 1904, 2, 0 }, { 19040416, 1904, 3, 0 }, { 19040515, 1904, 4, 0 }, { 19040614, 1904, 5, 0 },
+    { 19040713, 1904, 6, 0 }, { 19040811, 1904, 7, 0 }, { 19040910, 1904, 8, 0 }, { 19041009, 1904, 9, 0 },
+    { 19041107, 1904, 10, 0 }, { 19041207, 1904, 11, 0 }, { 19050106, 1904, 12, 0 }, { 19050204, 1905, 1, 0 },
+    { 19050306, 1905, 2, 0 }, { 19050405, 1905, 3, 0 }, { 19050504, 1905, 4, 0 }, { 19050603, 1905, 5, 0 },
+    { 19050703, 1905, 6, 0 }, { 19050801, 1905, 7, 0 }, { 19050830, 1905, 8, 0 }, { 19050929, 1905, 9, 0 },
+    { 19051028, 1905, 10, 0 }, { 19051127, 1905, 11, 0 }, { 19051226, 1905, 12, 0 }, { 19060125, 1906, 1, 0 },
+    { 19060223, 1906, 2, 0 }, { 19060325, 1906, 3, 0 }, { 19060424, 1906, 4, 0 }, { 19060523, 1906, 4, 1 },
+    { 19060622, 1906, 5, 0 }, { 19060721, 1906, 6, 0 }, { 19060820, 1906, 7, 0 }, { 19060918, 1906, 8, 0 },
+    { 19061018, 1906, 9, 0 }, { 19061116, 1906, 10, 0 }, { 19061216, 1906, 11, 0 }, { 19070114, 1906, 12, 0 },
+    { 19070213, 1907, 1, 0 }, { 19070314, 1907, 2, 0 }, { 19070413, 1907, 3, 0 }, { 19070512, 1907, 4, 0 },
+    { 19070611, 1907, 5, 0 }, { 19070710, 1907, 6, 0 }, { 19070809, 1907, 7, 0 }, { 19070908, 1907, 8, 0 },
+    { 19071007, 1907, 9, 0 }, { 19071106, 1907, 10, 0 }, { 19071205, 1907, 11, 0 }, { 19080104, 1907, 12, 0 },
+    { 19080202, 1908, 1, 0 }, { 19080303, 1908, 2, 0 }, { 19080401, 1908, 3, 0 }, { 19080430, 1908, 4, 0 },
+    { 19080530, 1908, 5, 0 }, { 19080629, 1908, 6, 0 }, { 19080728, 1908, 7, 0 }, { 19080827, 1908, 8, 0 },
+    { 19080925, 1908, 9, 0 }, { 19081025, 1908, 10, 0 }, { 19081124, 1908, 11, 0 }, { 19081223, 1908, 12, 0 },
+    { 19090122, 1909, 1, 0 }, { 19090220, 1909, 2, 0 }, { 19090322, 1909, 2, 1 }, { 19090420, 1909, 3, 0 },
+    { 19090519, 1909, 4, 0 }, { 19090618, 1909, 5, 0 }, { 19090717, 1909, 6, 0 }, { 19090816, 1909, 7, 0 },
+    { 19090914, 1909, 8, 0 }, { 19091014, 1909, 9, 0 }, { 19091113, 1909, 10, 0 }, { 19091213, 1909, 11, 0 },
+    { 19100111, 1909, 12, 0 }, { 19100210, 1910, 1, 0 }, { 19100311, 1910, 2, 0 }, { 19100410, 1910, 3, 0 },
+    { 19100509, 1910, 4, 0 }, { 19100607, 1910, 5, 0 }, { 19100707, 1910, 6, 0 }, { 19100805, 1910, 7, 0 },
+    { 19100904, 1910, 8, 0 }, { 19101003, 1910, 9, 0 }, { 19101102, 1910, 10, 0 }, { 19101202, 1910, 11, 0 },
+    { 19110101, 1910, 12, 0 }, { 19110130, 1911, 1, 0 }, { 19110301, 1911, 2, 0 }, { 19110330, 1911, 3, 0 },
+    { 19110429, 1911, 4, 0 }, { 19110528, 1911, 5, 0 }, { 19110626, 1911, 6, 0 }, { 19110726, 1911, 6, 1 },
+    { 19110824, 1911, 7, 0 }, { 19110922, 1911, 8, 0 }, { 19111022, 1911, 9, 0 }, { 19111121, 1911, 10, 0 },
+    { 19111220, 1911, 11, 0 }, { 19120119, 1911, 12, 0 }, { 19120218, 1912, 1, 0 }, { 19120319, 1912, 2, 0 },
+    { 19120417, 1912, 3, 0 }, { 19120517, 1912, 4, 0 }, { 19120615, 1912, 5, 0 }, { 19120714, 1912, 6, 0 },
+    { 19120813, 1912, 7, 0 }, { 19120911, 1912, 8, 0 }, { 19121010, 1912, 9, 0 }, { 19121109, 1912, 10, 0 },
+    { 19121209, 1912, 11, 0 }, { 19130107, 1912, 12, 0 }, { 19130206, 1913, 1, 0 }, { 19130308, 1913, 2, 0 },
+    { 19130407, 1913, 3, 0 }, { 19130506, 1913, 4, 0 }, { 19130605, 1913, 5, 0 }, { 19130704, 1913, 6, 0 },
+    { 19130802, 1913, 7, 0 }, { 19130901, 1913, 8, 0 }, { 19130930, 1913, 9, 0 }, { 19131029, 1913, 10, 0 },
+    { 19131128, 1913, 11, 0 }, { 19131227, 1913, 12, 0 }, { 19140126, 1914, 1, 0 }, { 19140225, 1914, 2, 0 },
+    { 19140327, 1914, 3, 0 }, { 19140425, 1914, 4, 0 }, { 19140525, 1914, 5, 0 }, { 19140623, 1914, 5, 1 },
+    { 19140723, 1914, 6, 0 }, { 19140821, 1914, 7, 0 }, { 19140920, 1914, 8, 0 }, { 19141019, 1914, 9, 0 },
+    { 19141117, 1914, 10, 0 }, { 19141217, 1914, 11, 0 }, { 19150115, 1914, 12, 0 }, { 19150214, 1915, 1, 0 },
+    { 19150316, 1915, 2, 0 }, { 19150414, 1915, 3, 0 }, { 19150514, 1915, 4, 0 }, { 19150613, 1915, 5, 0 },
+    { 19150712, 1915, 6, 0 }, { 19150811, 1915, 7, 0 }, { 19150909, 1915, 8, 0 }, { 19151009, 1915, 9, 0 },
+    { 19151107, 1915, 10, 0 }, { 19151207, 1915, 11, 0 }, { 19160105, 1915, 12, 0 }, { 19160203, 1916, 1, 0 },
+    { 19160304, 1916, 2, 0 }, { 19160403, 1916, 3, 0 }, { 19160502, 1916, 4, 0 }, { 19160601, 1916, 5, 0 },
+    { 19160630, 1916, 6, 0 }, { 19160730, 1916, 7, 0 }, { 19160829, 1916, 8, 0 }, { 19160927, 1916, 9, 0 },
+    { 19161027, 1916, 10, 0 }, { 19161125, 1916, 11, 0 }, { 19161225, 1916, 12, 0 }, { 19170123, 1917, 1, 0 },
+    { 19170222, 1917, 2, 0 }, { 19170323, 1917, 3, 0 }, { 19170421, 1917, 3, 1 }, { 19170521, 1917, 4, 0 },
+    { 19170619, 1917, 5, 0 }, { 19170719, 1917, 6, 0 }, { 19170818, 1917, 7, 0 }, { 19170916, 1917, 8, 0 },
+    { 19171016, 1917, 9, 0 }, { 19171115, 1917, 10, 0 }, { 19171214, 1917, 11, 0 }, { 19180113, 1917, 12, 0 },
+    { 19180211, 1918, 1, 0 }, { 19180313, 1918, 2, 0 }, { 19180411, 1918, 3, 0 }, { 19180510, 1918, 4, 0 },
+    { 19180609, 1918, 5, 0 }, { 19180708, 1918, 6, 0 }, { 19180807, 1918, 7, 0 }, { 19180905, 1918, 8, 0 },
+    { 19181005, 1918, 9, 0 }, { 19181104, 1918, 10, 0 }, { 19181203, 1918, 11, 0 }, { 19190102, 1918, 12, 0 },
+    { 19190201, 1919, 1, 0 }, { 19190302, 1919, 2, 0 }, { 19190401, 1919, 3, 0 }, { 19190430, 1919, 4, 0 },
+    { 19190529, 1919, 5, 0 }, { 19190628, 1919, 6, 0 }, { 19190727, 1919, 7, 0 }, { 19190825, 1919, 7, 1 },
+    { 19190924, 1919, 8, 0 }, { 19191024, 1919, 9, 0 }, { 19191122, 1919, 10, 0 }, { 19191222, 1919, 11, 0 },
+    { 19200121, 1919, 12, 0 }, { 19200220, 1920, 1, 0 }, { 19200320, 1920, 2, 0 }, { 19200419, 1920, 3, 0 },
+    { 19200518, 1920, 4, 0 }, { 19200616, 1920, 5, 0 }, { 19200716, 1920, 6, 0 }, { 19200814, 1920, 7, 0 },
+    { 19200912, 1920, 8, 0 }, { 19201012, 1920, 9, 0 }, { 19201110, 1920, 10, 0 }, { 19201210, 1920, 11, 0 },
+    { 19210109, 1920, 12, 0 }, { 19210208, 1921, 1, 0 }, { 19210310, 1921, 2, 0 }, { 19210408, 1921, 3, 0 },
+    { 19210508, 1921, 4, 0 }, { 19210606, 1921, 5, 0 }, { 19210705, 1921, 6, 0 }, { 19210804, 1921, 7, 0 },
+    { 19210902, 1921, 8, 0 }, { 19211001, 1921, 9, 0 }, { 19211031, 1921, 10, 0 }, { 19211129, 1921, 11, 0 },
+    { 19211229, 1921, 12, 0 }, { 19220128, 1922, 1, 0 }, { 19220227, 1922, 2, 0 }, { 19220328, 1922, 3, 0 },
+    { 19220427, 1922, 4, 0 }, { 19220527, 1922, 5, 0 }, { 19220625, 1922, 6, 0 }, { 19220724, 1922, 6, 1 },
+    { 19220823, 1922, 7, 0 }, { 19220921, 1922, 8, 0 }, { 19221020, 1922, 9, 0 }, { 19221119, 1922, 10, 0 },
+    { 19221218, 1922, 11, 0 }, { 19230117, 1922, 12, 0 }, { 19230216, 1923, 1, 0 }, { 19230317, 1923, 2, 0 },
+    { 19230416, 1923, 3, 0 }, { 19230516, 1923, 4, 0 }, { 19230614, 1923, 5, 0 }, { 19230714, 1923, 6, 0 },
+    { 19230812, 1923, 7, 0 }, { 19230911, 1923, 8, 0 }, { 19231010, 1923, 9, 0 }, { 19231108, 1923, 10, 0 },
+    { 19231208, 1923, 11, 0 }, { 19240106, 1923, 12, 0 }, { 19240205, 1924, 1, 0 }, { 19240305, 1924, 2, 0 },
+    { 19240404, 1924, 3, 0 }, { 19240504, 1924, 4, 0 }, { 19240602, 1924, 5, 0 }, { 19240702, 1924, 6, 0 },
+    { 19240801, 1924, 7, 0 }, { 19240830, 1924, 8, 0 }, { 19240929, 1924, 9, 0 }, { 19241028, 1924, 10, 0 },
+    { 19241127, 1924, 11, 0 }, { 19241226, 1924, 12, 0 }, { 19250124, 1925, 1, 0 }, { 19250223, 1925, 2, 0 },
+    { 19250324, 1925, 3, 0 }, { 19250423, 1925, 4, 0 }, { 19250522, 1925, 4, 1 }, { 19250621, 1925, 5, 0 },
+    { 19250721, 1925, 6, 0 }, { 19250819, 1925, 7, 0 }, { 19250918, 1925, 8, 0 }, { 19251018, 1925, 9, 0 },
+    { 19251116, 1925, 10, 0 }, { 19251216, 1925, 11, 0 }, { 19260114, 1925, 12, 0 }, { 19260213, 1926, 1, 0 },
+    { 19260314, 1926, 2, 0 }, { 19260412, 1926, 3, 0 }, { 19260512, 1926, 4, 0 }, { 19260610, 1926, 5, 0 },
+    { 19260710, 1926, 6, 0 }, { 19260808, 1926, 7, 0 }, { 19260907, 1926, 8, 0 }, { 19261007, 1926, 9, 0 },
+    { 19261105, 1926, 10, 0 }, { 19261205, 1926, 11, 0 }, { 19270104, 1926, 12, 0 }, { 19270202, 1927, 1, 0 },
+    { 19270304, 1927, 2, 0 }, { 19270402, 1927, 3, 0 }, { 19270501, 1927, 4, 0 }, { 19270531, 1927, 5, 0 },
+    { 19270629, 1927, 6, 0 }, { 19270729, 1927, 7, 0 }, { 19270827, 1927, 8, 0 }, { 19270926, 1927, 9, 0 },
+    { 19271025, 1927, 10, 0 }, { 19271124, 1927, 11, 0 }, { 19271224, 1927, 12, 0 }, { 19280123, 1928, 1, 0 },
+    { 19280221, 1928, 2, 0 }, { 19280322, 1928, 2, 1 }, { 19280420, 1928, 3, 0 }, { 19280519, 1928, 4, 0 },
+    { 19280618, 1928, 5, 0 }, { 19280717, 1928, 6, 0 }, { 19280815, 1928, 7, 0 }, { 19280914, 1928, 8, 0 },
+    { 19281013, 1928, 9, 0 }, { 19281112, 1928, 10, 0 }, { 19281212, 1928, 11, 0 }, { 19290111, 1928, 12, 0 },
+    { 19290210, 1929, 1, 0 }, { 19290311, 1929, 2, 0 }, { 19290410, 1929, 3, 0 }, { 19290509, 1929, 4, 0 },
+    { 19290607, 1929, 5, 0 }, { 19290707, 1929, 6, 0 }, { 19290805, 1929, 7, 0 }, { 19290903, 1929, 8, 0 },
+    { 19291003, 1929, 9, 0 }, { 19291101, 1929, 10, 0 }, { 19291201, 1929, 11, 0 }, { 19291231, 1929, 12, 0 },
+    { 19300130, 1930, 1, 0 }, { 19300228, 1930, 2, 0 }, { 19300330, 1930, 3, 0 }, { 19300429, 1930, 4, 0 },
+    { 19300528, 1930, 5, 0 }, { 19300626, 1930, 6, 0 }, { 19300726, 1930, 6, 1 }, { 19300824, 1930, 7, 0 },
+    { 19300922, 1930, 8, 0 }, { 19301022, 1930, 9, 0 }, { 19301120, 1930, 10, 0 }, { 19301220, 1930, 11, 0 },
+    { 19310119, 1930, 12, 0 }, { 19310217, 1931, 1, 0 }, { 19310319, 1931, 2, 0 }, { 19310418, 1931, 3, 0 },
+    { 19310517, 1931, 4, 0 }, { 19310616, 1931, 5, 0 }, { 19310715, 1931, 6, 0 }, { 19310814, 1931, 7, 0 },
+    { 19310912, 1931, 8, 0 }, { 19311011, 1931, 9, 0 }, { 19311110, 1931, 10, 0 }, { 19311209, 1931, 11, 0 },
+    { 19320108, 1931, 12, 0 }, { 19320206, 1932, 1, 0 }, { 19320307, 1932, 2, 0 }, { 19320406, 1932, 3, 0 },
+    { 19320506, 1932, 4, 0 }, { 19320604, 1932, 5, 0 }, { 19320704, 1932, 6, 0 }, { 19320802, 1932, 7, 0 },
+    { 19320901, 1932, 8, 0 }, { 19320930, 1932, 9, 0 }, { 19321029, 1932, 10, 0 }, { 19321128, 1932, 11, 0 },
+    { 19321227, 1932, 12, 0 }, { 19330126, 1933, 1, 0 }, { 19330224, 1933, 2, 0 }, { 19330326, 1933, 3, 0 },
+    { 19330425, 1933, 4, 0 }, { 19330524, 1933, 5, 0 }, { 19330623, 1933, 5, 1 }, { 19330723, 1933, 6, 0 },
+    { 19330821, 1933, 7, 0 }, { 19330920, 1933, 8, 0 }, { 19331019, 1933, 9, 0 }, { 19331118, 1933, 10, 0 },
+    { 19331217, 1933, 11, 0 }, { 19340115, 1933, 12, 0 }, { 19340214, 1934, 1, 0 }, { 19340315, 1934, 2, 0 },
+    { 19340414, 1934, 3, 0 }, { 19340513, 1934, 4, 0 }, { 19340612, 1934, 5, 0 }, { 19340712, 1934, 6, 0 },
+    { 19340810, 1934, 7, 0 }, { 19340909, 1934, 8, 0 }, { 19341008, 1934, 9, 0 }, { 19341107, 1934, 10, 0 },
+    { 19341207, 1934, 11, 0 }, { 19350105, 1934, 12, 0 }, { 19350204, 1935, 1, 0 }, { 19350305, 1935, 2, 0 },
+    { 19350403, 1935, 3, 0 }, { 19350503, 1935, 4, 0 }, { 19350601, 1935, 5, 0 }, { 19350701, 1935, 6, 0 },
+    { 19350730, 1935, 7, 0 }, { 19350829, 1935, 8, 0 }, { 19350928, 1935, 9, 0 }, { 19351027, 1935, 10, 0 },
+    { 19351126, 1935, 11, 0 }, { 19351226, 1935, 12, 0 }, { 19360124, 1936, 1, 0 }, { 19360223, 1936, 2, 0 },
+    { 19360323, 1936, 3, 0 }, { 19360421, 1936, 3, 1 }, { 19360521, 1936, 4, 0 }, { 19360619, 1936, 5, 0 },
+    { 19360718, 1936, 6, 0 }, { 19360817, 1936, 7, 0 }, { 19360916, 1936, 8, 0 }, { 19361015, 1936, 9, 0 },
+    { 19361114, 1936, 10, 0 }, { 19361214, 1936, 11, 0 }, { 19370113, 1936, 12, 0 }, { 19370211, 1937, 1, 0 },
+    { 19370313, 1937, 2, 0 }, { 19370411, 1937, 3, 0 }, { 19370510, 1937, 4, 0 }, { 19370609, 1937, 5, 0 },
+    { 19370708, 1937, 6, 0 }, { 19370806, 1937, 7, 0 }, { 19370905, 1937, 8, 0 }, { 19371004, 1937, 9, 0 },
+    { 19371103, 1937, 10, 0 }, { 19371203, 1937, 11, 0 }, { 19380102, 1937, 12, 0 }, { 19380131, 1938, 1, 0 },
+    { 19380302, 1938, 2, 0 }, { 19380401, 1938, 3, 0 }, { 19380430, 1938, 4, 0 }, { 19380529, 1938, 5, 0 },
+    { 19380628, 1938, 6, 0 }, { 19380727, 1938, 7, 0 }, { 19380825, 1938, 7, 1 }, { 19380924, 1938, 8, 0 },
+    { 19381023, 1938, 9, 0 }, { 19381122, 1938, 10, 0 }, { 19381222, 1938, 11, 0 }, { 19390120, 1938, 12, 0 },
+    { 19390219, 1939, 1, 0 }, { 19390321, 1939, 2, 0 }, { 19390420, 1939, 3, 0 }, { 19390519, 1939, 4, 0 },
+    { 19390617, 1939, 5, 0 }, { 19390717, 1939, 6, 0 }, { 19390815, 1939, 7, 0 }, { 19390913, 1939, 8, 0 },
+    { 19391013, 1939, 9, 0 }, { 19391111, 1939, 10, 0 }, { 19391211, 1939, 11, 0 }, { 19400109, 1939, 12, 0 },
+    { 19400208, 1940, 1, 0 }, { 19400309, 1940, 2, 0 }, { 19400408, 1940, 3, 0 }, { 19400507, 1940, 4, 0 },
+    { 19400606, 1940, 5, 0 }, { 19400705, 1940, 6, 0 }, { 19400804, 1940, 7, 0 }, { 19400902, 1940, 8, 0 },
+    { 19401001, 1940, 9, 0 }, { 19401031, 1940, 10, 0 }, { 19401129, 1940, 11, 0 }, { 19401229, 1940, 12, 0 },
+    { 19410127, 1941, 1, 0 }, { 19410226, 1941, 2, 0 }, { 19410328, 1941, 3, 0 }, { 19410426, 1941, 4, 0 },
+    { 19410526, 1941, 5, 0 }, { 19410625, 1941, 6, 0 }, { 19410724, 1941, 6, 1 }, { 19410823, 1941, 7, 0 },
+    { 19410921, 1941, 8, 0 }, { 19411020, 1941, 9, 0 }, { 19411119, 1941, 10, 0 }, { 19411218, 1941, 11, 0 },
+    { 19420117, 1941, 12, 0 }, { 19420215, 1942, 1, 0 }, { 19420317, 1942, 2, 0 }, { 19420415, 1942, 3, 0 },
+    { 19420515, 1942, 4, 0 }, { 19420614, 1942, 5, 0 }, { 19420713, 1942, 6, 0 }, { 19420812, 1942, 7, 0 },
+    { 19420910, 1942, 8, 0 }, { 19421010, 1942, 9, 0 }, { 19421108, 1942, 10, 0 }, { 19421208, 1942, 11, 0 },
+    { 19430106, 1942, 12, 0 }, { 19430205, 1943, 1, 0 }, { 19430306, 1943, 2, 0 }, { 19430405, 1943, 3, 0 },
+    { 19430504, 1943, 4, 0 }, { 19430603, 1943, 5, 0 }, { 19430702, 1943, 6, 0 }, { 19430801, 1943, 7, 0 },
+    { 19430831, 1943, 8, 0 }, { 19430929, 1943, 9, 0 }, { 19431029, 1943, 10, 0 }, { 19431127, 1943, 11, 0 },
+    { 19431227, 1943, 12, 0 }, { 19440125, 1944, 1, 0 }, { 19440224, 1944, 2, 0 }, { 19440324, 1944, 3, 0 },
+    { 19440423, 1944, 4, 0 }, { 19440522, 1944, 4, 1 }, { 19440621, 1944, 5, 0 }, { 19440720, 1944, 6, 0 },
+    { 19440819, 1944, 7, 0 }, { 19440917, 1944, 8, 0 }, { 19441017, 1944, 9, 0 }, { 19441116, 1944, 10, 0 },
+    { 19441215, 1944, 11, 0 }, { 19450114, 1944, 12, 0 }, { 19450213, 1945, 1, 0 }, { 19450314, 1945, 2, 0 },
+    { 19450412, 1945, 3, 0 }, { 19450512, 1945, 4, 0 }, { 19450610, 1945, 5, 0 }, { 19450709, 1945, 6, 0 },
+    { 19450808, 1945, 7, 0 }, { 19450906, 1945, 8, 0 }, { 19451006, 1945, 9, 0 }, { 19451105, 1945, 10, 0 },
+    { 19451205, 1945, 11, 0 }, { 19460103, 1945, 12, 0 }, { 19460202, 1946, 1, 0 }, { 19460304, 1946, 2, 0 },
+    { 19460402, 1946, 3, 0 }, { 19460501, 1946, 4, 0 }, { 19460531, 1946, 5, 0 }, { 19460629, 1946, 6, 0 },
+    { 19460728, 1946, 7, 0 }, { 19460827, 1946, 8, 0 }, { 19460925, 1946, 9, 0 }, { 19461025, 1946, 10, 0 },
+    { 19461124, 1946, 11, 0 }, { 19461223, 1946, 12, 0 }, { 19470122, 1947, 1, 0 }, { 19470221, 1947, 2, 0 },
+    { 19470323, 1947, 2, 1 }, { 19470421, 1947, 3, 0 }, { 19470520, 1947, 4, 0 }, { 19470619, 1947, 5, 0 },
+    { 19470718, 1947, 6, 0 }, { 19470816, 1947, 7, 0 }, { 19470915, 1947, 8, 0 }, { 19471014, 1947, 9, 0 },
+    { 19471113, 1947, 10, 0 }, { 19471212, 1947, 11, 0 }, { 19480111, 1947, 12, 0 }, { 19480210, 1948, 1, 0 },
+    { 19480311, 1948, 2, 0 }, { 19480409, 1948, 3, 0 }, { 19480509, 1948, 4, 0 }, { 19480607, 1948, 5, 0 },
+    { 19480707, 1948, 6, 0 }, { 19480805, 1948, 7, 0 }, { 19480903, 1948, 8, 0 }, { 19481003, 1948, 9, 0 },
+    { 19481101, 1948, 10, 0 }, { 19481201, 1948, 11, 0 }, { 19481230, 1948, 12, 0 }, { 19490129, 1949, 1, 0 },
+    { 19490228, 1949, 2, 0 }, { 19490329, 1949, 3, 0 }, { 19490428, 1949, 4, 0 }, { 19490528, 1949, 5, 0 },
+    { 19490626, 1949, 6, 0 }, { 19490726, 1949, 7, 0 }, { 19490824, 1949, 7, 1 }, { 19490922, 1949, 8, 0 },
+    { 19491022, 1949, 9, 0 }, { 19491120, 1949, 10, 0 }, { 19491220, 1949, 11, 0 }, { 19500118, 1949, 12, 0 },
+    { 19500217, 1950, 1, 0 }, { 19500318, 1950, 2, 0 }, { 19500417, 1950, 3, 0 }, { 19500517, 1950, 4, 0 },
+    { 19500615, 1950, 5, 0 }, { 19500715, 1950, 6, 0 }, { 19500814, 1950, 7, 0 }, { 19500912, 1950, 8, 0 },
+    { 19501011, 1950, 9, 0 }, { 19501110, 1950, 10, 0 }, { 19501209, 1950, 11, 0 }, { 19510108, 1950, 12, 0 },
+    { 19510206, 1951, 1, 0 }, { 19510308, 1951, 2, 0 }, { 19510406, 1951, 3, 0 }, { 19510506, 1951, 4, 0 },
+    { 19510605, 1951, 5, 0 }, { 19510704, 1951, 6, 0 }, { 19510803, 1951, 7, 0 }, { 19510901, 1951, 8, 0 },
+    { 19511001, 1951, 9, 0 }, { 19511030, 1951, 10, 0 }, { 19511129, 1951, 11, 0 }, { 19511228, 1951, 12, 0 },
+    { 19520127, 1952, 1, 0 }, { 19520225, 1952, 2, 0 }, { 19520326, 1952, 3, 0 }, { 19520424, 1952, 4, 0 },
+    { 19520524, 1952, 5, 0 }, { 19520622, 1952, 5, 1 }, { 19520722, 1952, 6, 0 }, { 19520820, 1952, 7, 0 },
+    { 19520919, 1952, 8, 0 }, { 19521019, 1952, 9, 0 }, { 19521117, 1952, 10, 0 }, { 19521217, 1952, 11, 0 },
+    { 19530115, 1952, 12, 0 }, { 19530214, 1953, 1, 0 }, { 19530315, 1953, 2, 0 }, { 19530414, 1953, 3, 0 },
+    { 19530513, 1953, 4, 0 }, { 19530611, 1953, 5, 0 }, { 19530711, 1953, 6, 0 }, { 19530810, 1953, 7, 0 },
+    { 19530908, 1953, 8, 0 }, { 19531008, 1953, 9, 0 }, { 19531107, 1953, 10, 0 }, { 19531206, 1953, 11, 0 },
+    { 19540105, 1953, 12, 0 }, { 19540204, 1954, 1, 0 }, { 19540305, 1954, 2, 0 }, { 19540403, 1954, 3, 0 },
+    { 19540503, 1954, 4, 0 }, { 19540601, 1954, 5, 0 }, { 19540630, 1954, 6, 0 }, { 19540730, 1954, 7, 0 },
+    { 19540828, 1954, 8, 0 }, { 19540927, 1954, 9, 0 }, { 19541027, 1954, 10, 0 }, { 19541125, 1954, 11, 0 },
+    { 19541225, 1954, 12, 0 }, { 19550124, 1955, 1, 0 }, { 19550223, 1955, 2, 0 }, { 19550324, 1955, 3, 0 },
+    { 19550422, 1955, 3, 1 }, { 19550522, 1955, 4, 0 }, { 19550620, 1955, 5, 0 }, { 19550719, 1955, 6, 0 },
+    { 19550818, 1955, 7, 0 }, { 19550916, 1955, 8, 0 }, { 19551016, 1955, 9, 0 }, { 19551114, 1955, 10, 0 },
+    { 19551214, 1955, 11, 0 }, { 19560113, 1955, 12, 0 }, { 19560212, 1956, 1, 0 }, { 19560312, 1956, 2, 0 },
+    { 19560411, 1956, 3, 0 }, { 19560510, 1956, 4, 0 }, { 19560609, 1956, 5, 0 }, { 19560708, 1956, 6, 0 },
+    { 19560806, 1956, 7, 0 }, { 19560905, 1956, 8, 0 }, { 19561004, 1956, 9, 0 }, { 19561103, 1956, 10, 0 },
+    { 19561202, 1956, 11, 0 }, { 19570101, 1956, 12, 0 }, { 19570131, 1957, 1, 0 }, { 19570302, 1957, 2, 0 },
+    { 19570331, 1957, 3, 0 }, { 19570430, 1957, 4, 0 }, { 19570529, 1957, 5, 0 }, { 19570628, 1957, 6, 0 },
+    { 19570727, 1957, 7, 0 }, { 19570825, 1957, 8, 0 }, { 19570924, 1957, 8, 1 }, { 19571023, 1957, 9, 0 },
+    { 19571122, 1957, 10, 0 }, { 19571221, 1957, 11, 0 }, { 19580120, 1957, 12, 0 }, { 19580218, 1958, 1, 0 },
+    { 19580320, 1958, 2, 0 }, { 19580419, 1958, 3, 0 }, { 19580519, 1958, 4, 0 }, { 19580617, 1958, 5, 0 },
+    { 19580717, 1958, 6, 0 }, { 19580815, 1958, 7, 0 }, { 19580913, 1958, 8, 0 }, { 19581013, 1958, 9, 0 },
+    { 19581111, 1958, 10, 0 }, { 19581211, 1958, 11, 0 }, { 19590109, 1958, 12, 0 }, { 19590208, 1959, 1, 0 },
+    { 19590309, 1959, 2, 0 }, { 19590408, 1959, 3, 0 }, { 19590508, 1959, 4, 0 }, { 19590606, 1959, 5, 0 },
+    { 19590706, 1959, 6, 0 }, { 19590804, 1959, 7, 0 }, { 19590903, 1959, 8, 0 }, { 19591002, 1959, 9, 0 },
+    { 19591101, 1959, 10, 0 }, { 19591130, 1959, 11, 0 }, { 19591230, 1959, 12, 0 }, { 19600128, 1960, 1, 0 },
+    { 19600227, 1960, 2, 0 }, { 19600327, 1960, 3, 0 }, { 19600426, 1960, 4, 0 }, { 19600525, 1960, 5, 0 },
+    { 19600624, 1960, 6, 0 }, { 19600724, 1960, 6, 1 }, { 19600822, 1960, 7, 0 }, { 19600921, 1960, 8, 0 },
+    { 19601020, 1960, 9, 0 }, { 19601119, 1960, 10, 0 }, { 19601218, 1960, 11, 0 }, { 19610117, 1960, 12, 0 },
+    { 19610215, 1961, 1, 0 }, { 19610317, 1961, 2, 0 }, { 19610415, 1961, 3, 0 }, { 19610515, 1961, 4, 0 },
+    { 19610613, 1961, 5, 0 }, { 19610713, 1961, 6, 0 }, { 19610811, 1961, 7, 0 }, { 19610910, 1961, 8, 0 },
+    { 19611010, 1961, 9, 0 }, { 19611108, 1961, 10, 0 }, { 19611208, 1961, 11, 0 }, { 19620106, 1961, 12, 0 },
+    { 19620205, 1962, 1, 0 }, { 19620306, 1962, 2, 0 }, { 19620405, 1962, 3, 0 }, { 19620504, 1962, 4, 0 },
+    { 19620602, 1962, 5, 0 }, { 19620702, 1962, 6, 0 }, { 19620731, 1962, 7, 0 }, { 19620830, 1962, 8, 0 },
+    { 19620929, 1962, 9, 0 }, { 19621028, 1962, 10, 0 }, { 19621127, 1962, 11, 0 }, { 19621227, 1962, 12, 0 },
+    { 19630125, 1963, 1, 0 }, { 19630224, 1963, 2, 0 }, { 19630325, 1963, 3, 0 }, { 19630424, 1963, 4, 0 },
+    { 19630523, 1963, 4, 1 }, { 19630621, 1963, 5, 0 }, { 19630721, 1963, 6, 0 }, { 19630819, 1963, 7, 0 },
+    { 19630918, 1963, 8, 0 }, { 19631017, 1963, 9, 0 }, { 19631116, 1963, 10, 0 }, { 19631216, 1963, 11, 0 },
+    { 19640115, 1963, 12, 0 }, { 19640213, 1964, 1, 0 }, { 19640314, 1964, 2, 0 }, { 19640412, 1964, 3, 0 },
+    { 19640512, 1964, 4, 0 }, { 19640610, 1964, 5, 0 }, { 19640709, 1964, 6, 0 }, { 19640808, 1964, 7, 0 },
+    { 19640906, 1964, 8, 0 }, { 19641006, 1964, 9, 0 }, { 19641104, 1964, 10, 0 }, { 19641204, 1964, 11, 0 },
+    { 19650103, 1964, 12, 0 }, { 19650202, 1965, 1, 0 }, { 19650303, 1965, 2, 0 }, { 19650402, 1965, 3, 0 },
+    { 19650501, 1965, 4, 0 }, { 19650531, 1965, 5, 0 }, { 19650629, 1965, 6, 0 }, { 19650728, 1965, 7, 0 },
+    { 19650827, 1965, 8, 0 }, { 19650925, 1965, 9, 0 }, { 19651024, 1965, 10, 0 }, { 19651123, 1965, 11, 0 },
+    { 19651223, 1965, 12, 0 }, { 19660121, 1966, 1, 0 }, { 19660220, 1966, 2, 0 }, { 19660322, 1966, 3, 0 },
+    { 19660421, 1966, 3, 1 }, { 19660520, 1966, 4, 0 }, { 19660619, 1966, 5, 0 }, { 19660718, 1966, 6, 0 },
+    { 19660816, 1966, 7, 0 }, { 19660915, 1966, 8, 0 }, { 19661014, 1966, 9, 0 }, { 19661112, 1966, 10, 0 },
+    { 19661212, 1966, 11, 0 }, { 19670111, 1966, 12, 0 }, { 19670209, 1967, 1, 0 }, { 19670311, 1967, 2, 0 },
+    { 19670410, 1967, 3, 0 }, { 19670509, 1967, 4, 0 }, { 19670608, 1967, 5, 0 }, { 19670708, 1967, 6, 0 },
+    { 19670806, 1967, 7, 0 }, { 19670904, 1967, 8, 0 }, { 19671004, 1967, 9, 0 }, { 19671102, 1967, 10, 0 },
+    { 19671202, 1967, 11, 0 }, { 19671231, 1967, 12, 0 }, { 19680130, 1968, 1, 0 }, { 19680228, 1968, 2, 0 },
+    { 19680329, 1968, 3, 0 }, { 19680427, 1968, 4, 0 }, { 19680527, 1968, 5, 0 }, { 19680626, 1968, 6, 0 },
+    { 19680725, 1968, 7, 0 }, { 19680824, 1968, 7, 1 }, { 19680922, 1968, 8, 0 }, { 19681022, 1968, 9, 0 },
+    { 19681120, 1968, 10, 0 }, { 19681220, 1968, 11, 0 }, { 19690118, 1968, 12, 0 }, { 19690217, 1969, 1, 0 },
+    { 19690318, 1969, 2, 0 }, { 19690417, 1969, 3, 0 }, { 19690516, 1969, 4, 0 }, { 19690615, 1969, 5, 0 },
+    { 19690714, 1969, 6, 0 }, { 19690813, 1969, 7, 0 }, { 19690912, 1969, 8, 0 }, { 19691011, 1969, 9, 0 },
+    { 19691110, 1969, 10, 0 }, { 19691209, 1969, 11, 0 }, { 19700108, 1969, 12, 0 }, { 19700206, 1970, 1, 0 },
+    { 19700308, 1970, 2, 0 }, { 19700406, 1970, 3, 0 }, { 19700505, 1970, 4, 0 }, { 19700604, 1970, 5, 0 },
+    { 19700703, 1970, 6, 0 }, { 19700802, 1970, 7, 0 }, { 19700901, 1970, 8, 0 }, { 19700930, 1970, 9, 0 },
+    { 19701030, 1970, 10, 0 }, { 19701129, 1970, 11, 0 }, { 19701228, 1970, 12, 0 }, { 19710127, 1971, 1, 0 },
+    { 19710225, 1971, 2, 0 }, { 19710327, 1971, 3, 0 }, { 19710425, 1971, 4, 0 }, { 19710524, 1971, 5, 0 },
+    { 19710623, 1971, 5, 1 }, { 19710722, 1971, 6, 0 }, { 19710821, 1971, 7, 0 }, { 19710919, 1971, 8, 0 },
+    { 19711019, 1971, 9, 0 }, { 19711118, 1971, 10, 0 }, { 19711218, 1971, 11, 0 }, { 19720116, 1971, 12, 0 },
+    { 19720215, 1972, 1, 0 }, { 19720315, 1972, 2, 0 }, { 19720414, 1972, 3, 0 }, { 19720513, 1972, 4, 0 },
+    { 19720611, 1972, 5, 0 }, { 19720711, 1972, 6, 0 }, { 19720809, 1972, 7, 0 }, { 19720908, 1972, 8, 0 },
+    { 19721007, 1972, 9, 0 }, { 19721106, 1972, 10, 0 }, { 19721206, 1972, 11, 0 }, { 19730104, 1972, 12, 0 },
+    { 19730203, 1973, 1, 0 }, { 19730305, 1973, 2, 0 }, { 19730403, 1973, 3, 0 }, { 19730503, 1973, 4, 0 },
+    { 19730601, 1973, 5, 0 }, { 19730630, 1973, 6, 0 }, { 19730730, 1973, 7, 0 }, { 19730828, 1973, 8, 0 },
+    { 19730926, 1973, 9, 0 }, { 19731026, 1973, 10, 0 }, { 19731125, 1973, 11, 0 }, { 19731224, 1973, 12, 0 },
+    { 19740123, 1974, 1, 0 }, { 19740222, 1974, 2, 0 }, { 19740324, 1974, 3, 0 }, { 19740422, 1974, 4, 0 },
+    { 19740522, 1974, 4, 1 }, { 19740620, 1974, 5, 0 }, { 19740719, 1974, 6, 0 }, { 19740818, 1974, 7, 0 },
+    { 19740916, 1974, 8, 0 }, { 19741015, 1974, 9, 0 }, { 19741114, 1974, 10, 0 }, { 19741214, 1974, 11, 0 },
+    { 19750112, 1974, 12, 0 }, { 19750211, 1975, 1, 0 }, { 19750313, 1975, 2, 0 }, { 19750412, 1975, 3, 0 },
+    { 19750511, 1975, 4, 0 }, { 19750610, 1975, 5, 0 }, { 19750709, 1975, 6, 0 }, { 19750807, 1975, 7, 0 },
+    { 19750906, 1975, 8, 0 }, { 19751005, 1975, 9, 0 }, { 19751103, 1975, 10, 0 }, { 19751203, 1975, 11, 0 },
+    { 19760101, 1975, 12, 0 }, { 19760131, 1976, 1, 0 }, { 19760301, 1976, 2, 0 }, { 19760331, 1976, 3, 0 },
+    { 19760429, 1976, 4, 0 }, { 19760529, 1976, 5, 0 }, { 19760627, 1976, 6, 0 }, { 19760727, 1976, 7, 0 },
+    { 19760825, 1976, 8, 0 }, { 19760924, 1976, 8, 1 }, { 19761023, 1976, 9, 0 }, { 19761121, 1976, 10, 0 },
+    { 19761221, 1976, 11, 0 }, { 19770119, 1976, 12, 0 }, { 19770218, 1977, 1, 0 }, { 19770320, 1977, 2, 0 },
+    { 19770418, 1977, 3, 0 }, { 19770518, 1977, 4, 0 }, { 19770617, 1977, 5, 0 }, { 19770716, 1977, 6, 0 },
+    { 19770815, 1977, 7, 0 }, { 19770913, 1977, 8, 0 }, { 19771013, 1977, 9, 0 }, { 19771111, 1977, 10, 0 },
+    { 19771211, 1977, 11, 0 }, { 19780109, 1977, 12, 0 }, { 19780207, 1978, 1, 0 }, { 19780309, 1978, 2, 0 },
+    { 19780407, 1978, 3, 0 }, { 19780507, 1978, 4, 0 }, { 19780606, 1978, 5, 0 }, { 19780705, 1978, 6, 0 },
+    { 19780804, 1978, 7, 0 }, { 19780903, 1978, 8, 0 }, { 19781002, 1978, 9, 0 }, { 19781101, 1978, 10, 0 },
+    { 19781130, 1978, 11, 0 }, { 19781230, 1978, 12, 0 }, { 19790128, 1979, 1, 0 }, { 19790227, 1979, 2, 0 },
+    { 19790328, 1979, 3, 0 }, { 19790426, 1979, 4, 0 }, { 19790526, 1979, 5, 0 }, { 19790624, 1979, 6, 0 },
+    { 19790724, 1979, 6, 1 }, { 19790823, 1979, 7, 0 }, { 19790921, 1979, 8, 0 }, { 19791021, 1979, 9, 0 },
+    { 19791120, 1979, 10, 0 }, { 19791219, 1979, 11, 0 }, { 19800118, 1979, 12, 0 }, { 19800216, 1980, 1, 0 },
+    { 19800317, 1980, 2, 0 }, { 19800415, 1980, 3, 0 }, { 19800514, 1980, 4, 0 }, { 19800613, 1980, 5, 0 },
+    { 19800712, 1980, 6, 0 }, { 19800811, 1980, 7, 0 }, { 19800909, 1980, 8, 0 }, { 19801009, 1980, 9, 0 },
+    { 19801108, 1980, 10, 0 }, { 19801207, 1980, 11, 0 }, { 19810106, 1980, 12, 0 }, { 19810205, 1981, 1, 0 },
+    { 19810306, 1981, 2, 0 }, { 19810405, 1981, 3, 0 }, { 19810504, 1981, 4, 0 }, { 19810602, 1981, 5, 0 },
+    { 19810702, 1981, 6, 0 }, { 19810731, 1981, 7, 0 }, { 19810829, 1981, 8, 0 }, { 19810928, 1981, 9, 0 },
+    { 19811028, 1981, 10, 0 }, { 19811126, 1981, 11, 0 }, { 19811226, 1981, 12, 0 }, { 19820125, 1982, 1, 0 },
+    { 19820224, 1982, 2, 0 }, { 19820325, 1982, 3, 0 }, { 19820424, 1982, 4, 0 }, { 19820523, 1982, 4, 1 },
+    { 19820621, 1982, 5, 0 }, { 19820721, 1982, 6, 0 }, { 19820819, 1982, 7, 0 }, { 19820917, 1982, 8, 0 },
+    { 19821017, 1982, 9, 0 }, { 19821115, 1982, 10, 0 }, { 19821215, 1982, 11, 0 }, { 19830114, 1982, 12, 0 },
+    { 19830213, 1983, 1, 0 }, { 19830315, 1983, 2, 0 }, { 19830413, 1983, 3, 0 }, { 19830513, 1983, 4, 0 },
+    { 19830611, 1983, 5, 0 }, { 19830710, 1983, 6, 0 }, { 19830809, 1983, 7, 0 }, { 19830907, 1983, 8, 0 },
+    { 19831006, 1983, 9, 0 }, { 19831105, 1983, 10, 0 }, { 19831204, 1983, 11, 0 }, { 19840103, 1983, 12, 0 },
+    { 19840202, 1984, 1, 0 }, { 19840303, 1984, 2, 0 }, { 19840401, 1984, 3, 0 }, { 19840501, 1984, 4, 0 },
+    { 19840531, 1984, 5, 0 }, { 19840629, 1984, 6, 0 }, { 19840728, 1984, 7, 0 }, { 19840827, 1984, 8, 0 },
+    { 19840925, 1984, 9, 0 }, { 19841024, 1984, 10, 0 }, { 19841123, 1984, 10, 1 }, { 19841222, 1984, 11, 0 },
+    { 19850121, 1984, 12, 0 }, { 19850220, 1985, 1, 0 }, { 19850321, 1985, 2, 0 }, { 19850420, 1985, 3, 0 },
+    { 19850520, 1985, 4, 0 }, { 19850618, 1985, 5, 0 }, { 19850718, 1985, 6, 0 }, { 19850816, 1985, 7, 0 },
+    { 19850915, 1985, 8, 0 }, { 19851014, 1985, 9, 0 }, { 19851112, 1985, 10, 0 }, { 19851212, 1985, 11, 0 },
+    { 19860110, 1985, 12, 0 }, { 19860209, 1986, 1, 0 }, { 19860310, 1986, 2, 0 }, { 19860409, 1986, 3, 0 },
+    { 19860509, 1986, 4, 0 }, { 19860607, 1986, 5, 0 }, { 19860707, 1986, 6, 0 }, { 19860806, 1986, 7, 0 },
+    { 19860904, 1986, 8, 0 }, { 19861004, 1986, 9, 0 }, { 19861102, 1986, 10, 0 }, { 19861202, 1986, 11, 0 },
+    { 19861231, 1986, 12, 0 }, { 19870129, 1987, 1, 0 }, { 19870228, 1987, 2, 0 }, { 19870329, 1987, 3, 0 },
+    { 19870428, 1987, 4, 0 }, { 19870527, 1987, 5, 0 }, { 19870626, 1987, 6, 0 }, { 19870726, 1987, 7, 0 },
+    { 19870824, 1987, 7, 1 }, { 19870923, 1987, 8, 0 }, { 19871023, 1987, 9, 0 }, { 19871121, 1987, 10, 0 },
+    { 19871221, 1987, 11, 0 }, { 19880119, 1987, 12, 0 }, { 19880217, 1988, 1, 0 }, { 19880318, 1988, 2, 0 },
+    { 19880416, 1988, 3, 0 }, { 19880516, 1988, 4, 0 }, { 19880614, 1988, 5, 0 }, { 19880714, 1988, 6, 0 },
+    { 19880812, 1988, 7, 0 }, { 19880911, 1988, 8, 0 }, { 19881011, 1988, 9, 0 }, { 19881109, 1988, 10, 0 },
+    { 19881209, 1988, 11, 0 }, { 19890108, 1988, 12, 0 }, { 19890206, 1989, 1, 0 }, { 19890308, 1989, 2, 0 },
+    { 19890406, 1989, 3, 0 }, { 19890505, 1989, 4, 0 }, { 19890604, 1989, 5, 0 }, { 19890703, 1989, 6, 0 },
+    { 19890802, 1989, 7, 0 }, { 19890831, 1989, 8, 0 }, { 19890930, 1989, 9, 0 }, { 19891029, 1989, 10, 0 },
+    { 19891128, 1989, 11, 0 }, { 19891228, 1989, 12, 0 }, { 19900127, 1990, 1, 0 }, { 19900225, 1990, 2, 0 },
+    { 19900327, 1990, 3, 0 }, { 19900425, 1990, 4, 0 }, { 19900524, 1990, 5, 0 }, { 19900623, 1990, 5, 1 },
+    { 19900722, 1990, 6, 0 }, { 19900820, 1990, 7, 0 }, { 19900919, 1990, 8, 0 }, { 19901018, 1990, 9, 0 },
+    { 19901117, 1990, 10, 0 }, { 19901217, 1990, 11, 0 }, { 19910116, 1990, 12, 0 }, { 19910215, 1991, 1, 0 },
+    { 19910316, 1991, 2, 0 }, { 19910415, 1991, 3, 0 }, { 19910514, 1991, 4, 0 }, { 19910612, 1991, 5, 0 },
+    { 19910712, 1991, 6, 0 }, { 19910810, 1991, 7, 0 }, { 19910908, 1991, 8, 0 }, { 19911008, 1991, 9, 0 },
+    { 19911106, 1991, 10, 0 }, { 19911206, 1991, 11, 0 }, { 19920105, 1991, 12, 0 }, { 19920204, 1992, 1, 0 },
+    { 19920304, 1992, 2, 0 }, { 19920403, 1992, 3, 0 }, { 19920503, 1992, 4, 0 }, { 19920601, 1992, 5, 0 },
+    { 19920630, 1992, 6, 0 }, { 19920730, 1992, 7, 0 }, { 19920828, 1992, 8, 0 }, { 19920926, 1992, 9, 0 },
+    { 19921026, 1992, 10, 0 }, { 19921124, 1992, 11, 0 }, { 19921224, 1992, 12, 0 }, { 19930123, 1993, 1, 0 },
+    { 19930221, 1993, 2, 0 }, { 19930323, 1993, 3, 0 }, { 19930422, 1993, 3, 1 }, { 19930521, 1993, 4, 0 },
+    { 19930620, 1993, 5, 0 }, { 19930719, 1993, 6, 0 }, { 19930818, 1993, 7, 0 }, { 19930916, 1993, 8, 0 },
+    { 19931015, 1993, 9, 0 }, { 19931114, 1993, 10, 0 }, { 19931213, 1993, 11, 0 }, { 19940112, 1993, 12, 0 },
+    { 19940210, 1994, 1, 0 }, { 19940312, 1994, 2, 0 }, { 19940411, 1994, 3, 0 }, { 19940511, 1994, 4, 0 },
+    { 19940609, 1994, 5, 0 }, { 19940709, 1994, 6, 0 }, { 19940807, 1994, 7, 0 }, { 19940906, 1994, 8, 0 },
+    { 19941005, 1994, 9, 0 }, { 19941103, 1994, 10, 0 }, { 19941203, 1994, 11, 0 }, { 19950101, 1994, 12, 0 },
+    { 19950131, 1995, 1, 0 }, { 19950301, 1995, 2, 0 }, { 19950331, 1995, 3, 0 }, { 19950430, 1995, 4, 0 },
+    { 19950529, 1995, 5, 0 }, { 19950628, 1995, 6, 0 }, { 19950727, 1995, 7, 0 }, { 19950826, 1995, 8, 0 },
+    { 19950925, 1995, 8, 1 }, { 19951024, 1995, 9, 0 }, { 19951122, 1995, 10, 0 }, { 19951222, 1995, 11, 0 },
+    { 19960120, 1995, 12, 0 }, { 19960219, 1996, 1, 0 }, { 19960319, 1996, 2, 0 }, { 19960418, 1996, 3, 0 },
+    { 19960517, 1996, 4, 0 }, { 19960616, 1996, 5, 0 }, { 19960716, 1996, 6, 0 }, { 19960814, 1996, 7, 0 },
+    { 19960913, 1996, 8, 0 }, { 19961012, 1996, 9, 0 }, { 19961111, 1996, 10, 0 }, { 19961211, 1996, 11, 0 },
+    { 19970109, 1996, 12, 0 }, { 19970207, 1997, 1, 0 }, { 19970309, 1997, 2, 0 }, { 19970407, 1997, 3, 0 },
+    { 19970507, 1997, 4, 0 }, { 19970605, 1997, 5, 0 }, { 19970705, 1997, 6, 0 }, { 19970803, 1997, 7, 0 },
+    { 19970902, 1997, 8, 0 }, { 19971002, 1997, 9, 0 }, { 19971031, 1997, 10, 0 }, { 19971130, 1997, 11, 0 },
+    { 19971230, 1997, 12, 0 }, { 19980128, 1998, 1, 0 }, { 19980227, 1998, 2, 0 }, { 19980328, 1998, 3, 0 },
+    { 19980426, 1998, 4, 0 }, { 19980526, 1998, 5, 0 }, { 19980624, 1998, 5, 1 }, { 19980723, 1998, 6, 0 },
+    { 19980822, 1998, 7, 0 }, { 19980921, 1998, 8, 0 }, { 19981020, 1998, 9, 0 }, { 19981119, 1998, 10, 0 },
+    { 19981219, 1998, 11, 0 }, { 19990118, 1998, 12, 0 }, { 19990216, 1999, 1, 0 }, { 19990318, 1999, 2, 0 },
+    { 19990416, 1999, 3, 0 }, { 19990515, 1999, 4, 0 }, { 19990614, 1999, 5, 0 }, { 19990713, 1999, 6, 0 },
+    { 19990811, 1999, 7, 0 }, { 19990910, 1999, 8, 0 }, { 19991009, 1999, 9, 0 }, { 19991108, 1999, 10, 0 },
+    { 19991208, 1999, 11, 0 }, { 20000107, 1999, 12, 0 }, { 20000205, 2000, 1, 0 }, { 20000306, 2000, 2, 0 },
+    { 20000405, 2000, 3, 0 }, { 20000504, 2000, 4, 0 }, { 20000602, 2000, 5, 0 }, { 20000702, 2000, 6, 0 },
+    { 20000731, 2000, 7, 0 }, { 20000829, 2000, 8, 0 }, { 20000928, 2000, 9, 0 }, { 20001027, 2000, 10, 0 },
+    { 20001126, 2000, 11, 0 }, { 20001226, 2000, 12, 0 }, { 20010124, 2001, 1, 0 }, { 20010223, 2001, 2, 0 },
+    { 20010325, 2001, 3, 0 }, { 20010423, 2001, 4, 0 }, { 20010523, 2001, 4, 1 }, { 20010621, 2001, 5, 0 },
+    { 20010721, 2001, 6, 0 }, { 20010819, 2001, 7, 0 }, { 20010917, 2001, 8, 0 }, { 20011017, 2001, 9, 0 },
+    { 20011115, 2001, 10, 0 }, { 20011215, 2001, 11, 0 }, { 20020113, 2001, 12, 0 }, { 20020212, 2002, 1, 0 },
+    { 20020314, 2002, 2, 0 }, { 20020413, 2002, 3, 0 }, { 20020512, 2002, 4, 0 }, { 20020611, 2002, 5, 0 },
+    { 20020710, 2002, 6, 0 }, { 20020809, 2002, 7, 0 }, { 20020907, 2002, 8, 0 }, { 20021006, 2002, 9, 0 },
+    { 20021105, 2002, 10, 0 }, { 20021204, 2002, 11, 0 }, { 20030103, 2002, 12, 0 }, { 20030201, 2003, 1, 0 },
+    { 20030303, 2003, 2, 0 }, { 20030402, 2003, 3, 0 }, { 20030501, 2003, 4, 0 }, { 20030531, 2003, 5, 0 },
+    { 20030630, 2003, 6, 0 }, { 20030729, 2003, 7, 0 }, { 20030828, 2003, 8, 0 }, { 20030926, 2003, 9, 0 },
+    { 20031025, 2003, 10, 0 }, { 20031124, 2003, 11, 0 }, { 20031223, 2003, 12, 0 }, { 20040122, 2004, 1, 0 },
+    { 20040220, 2004, 2, 0 }, { 20040321, 2004, 2, 1 }, { 20040419, 2004, 3, 0 }, { 20040519, 2004, 4, 0 },
+    { 20040618, 2004, 5, 0 }, { 20040717, 2004, 6, 0 }, { 20040816, 2004, 7, 0 }, { 20040914, 2004, 8, 0 },
+    { 20041014, 2004, 9, 0 }, { 20041112, 2004, 10, 0 }, { 20041212, 2004, 11, 0 }, { 20050110, 2004, 12, 0 },
+    { 20050209, 2005, 1, 0 }, { 20050310, 2005, 2, 0 }, { 20050409, 2005, 3, 0 }, { 20050508, 2005, 4, 0 },
+    { 20050607, 2005, 5, 0 }, { 20050706, 2005, 6, 0 }, { 20050805, 2005, 7, 0 }, { 20050904, 2005, 8, 0 },
+    { 20051003, 2005, 9, 0 }, { 20051102, 2005, 10, 0 }, { 20051201, 2005, 11, 0 }, { 20051231, 2005, 12, 0 },
+    { 20060129, 2006, 1, 0 }, { 20060228, 2006, 2, 0 }, { 20060329, 2006, 3, 0 }, { 20060428, 2006, 4, 0 },
+    { 20060527, 2006, 5, 0 }, { 20060626, 2006, 6, 0 }, { 20060725, 2006, 7, 0 }, { 20060824, 2006, 7, 1 },
+    { 20060922, 2006, 8, 0 }, { 20061022, 2006, 9, 0 }, { 20061121, 2006, 10, 0 }, { 20061220, 2006, 11, 0 },
+    { 20070119, 2006, 12, 0 }, { 20070218, 2007, 1, 0 }, { 20070319, 2007, 2, 0 }, { 20070417, 2007, 3, 0 },
+    { 20070517, 2007, 4, 0 }, { 20070615, 2007, 5, 0 }, { 20070714, 2007, 6, 0 }, { 20070813, 2007, 7, 0 },
+    { 20070911, 2007, 8, 0 }, { 20071011, 2007, 9, 0 }, { 20071110, 2007, 10, 0 }, { 20071210, 2007, 11, 0 },
+    { 20080108, 2007, 12, 0 }, { 20080207, 2008, 1, 0 }, { 20080308, 2008, 2, 0 }, { 20080406, 2008, 3, 0 },
+    { 20080505, 2008, 4, 0 }, { 20080604, 2008, 5, 0 }, { 20080703, 2008, 6, 0 }, { 20080801, 2008, 7, 0 },
+    { 20080831, 2008, 8, 0 }, { 20080929, 2008, 9, 0 }, { 20081029, 2008, 10, 0 }, { 20081128, 2008, 11, 0 },
+    { 20081227, 2008, 12, 0 }, { 20090126, 2009, 1, 0 }, { 20090225, 2009, 2, 0 }, { 20090327, 2009, 3, 0 },
+    { 20090425, 2009, 4, 0 }, { 20090524, 2009, 5, 0 }, { 20090623, 2009, 5, 1 }, { 20090722, 2009, 6, 0 },
+    { 20090820, 2009, 7, 0 }, { 20090919, 2009, 8, 0 }, { 20091018, 2009, 9, 0 }, { 20091117, 2009, 10, 0 },
+    { 20091216, 2009, 11, 0 }, { 20100115, 2009, 12, 0 }, { 20100214, 2010, 1, 0 }, { 20100316, 2010, 2, 0 },
+    { 20100414, 2010, 3, 0 }, { 20100514, 2010, 4, 0 }, { 20100612, 2010, 5, 0 }, { 20100712, 2010, 6, 0 },
+    { 20100810, 2010, 7, 0 }, { 20100908, 2010, 8, 0 }, { 20101008, 2010, 9, 0 }, { 20101106, 2010, 10, 0 },
+    { 20101206, 2010, 11, 0 }, { 20110104, 2010, 12, 0 }, { 20110203, 2011, 1, 0 }, { 20110305, 2011, 2, 0 },
+    { 20110403, 2011, 3, 0 }, { 20110503, 2011, 4, 0 }, { 20110602, 2011, 5, 0 }, { 20110701, 2011, 6, 0 },
+    { 20110731, 2011, 7, 0 }, { 20110829, 2011, 8, 0 }, { 20110927, 2011, 9, 0 }, { 20111027, 2011, 10, 0 },
+    { 20111125, 2011, 11, 0 }, { 20111225, 2011, 12, 0 }, { 20120123, 2012, 1, 0 }, { 20120222, 2012, 2, 0 },
+    { 20120322, 2012, 3, 0 }, { 20120421, 2012, 4, 0 }, { 20120521, 2012, 4, 1 }, { 20120619, 2012, 5, 0 },
+    { 20120719, 2012, 6, 0 }, { 20120818, 2012, 7, 0 }, { 20120916, 2012, 8, 0 }, { 20121015, 2012, 9, 0 },
+    { 20121114, 2012, 10, 0 }, { 20121213, 2012, 11, 0 }, { 20130112, 2012, 12, 0 }, { 20130210, 2013, 1, 0 },
+    { 20130312, 2013, 2, 0 }, { 20130410, 2013, 3, 0 }, { 20130510, 2013, 4, 0 }, { 20130608, 2013, 5, 0 },
+    { 20130708, 2013, 6, 0 }, { 20130807, 2013, 7, 0 }, { 20130905, 2013, 8, 0 }, { 20131005, 2013, 9, 0 },
+    { 20131103, 2013, 10, 0 }, { 20131203, 2013, 11, 0 }, { 20140101, 2013, 12, 0 }, { 20140131, 2014, 1, 0 },
+    { 20140301, 2014, 2, 0 }, { 20140331, 2014, 3, 0 }, { 20140429, 2014, 4, 0 }, { 20140529, 2014, 5, 0 },
+    { 20140627, 2014, 6, 0 }, { 20140727, 2014, 7, 0 }, { 20140825, 2014, 8, 0 }, { 20140924, 2014, 9, 0 },
+    { 20141024, 2014, 9, 1 }, { 20141122, 2014, 10, 0 }, { 20141222, 2014, 11, 0 }, { 20150120, 2014, 12, 0 },
+    { 20150219, 2015, 1, 0 }, { 20150320, 2015, 2, 0 }, { 20150419, 2015, 3, 0 }, { 20150518, 2015, 4, 0 },
+    { 20150616, 2015, 5, 0 }, { 20150716, 2015, 6, 0 }, { 20150814, 2015, 7, 0 }, { 20150913, 2015, 8, 0 },
+    { 20151013, 2015, 9, 0 }, { 20151112, 2015, 10, 0 }, { 20151211, 2015, 11, 0 }, { 20160110, 2015, 12, 0 },
+    { 20160208, 2016, 1, 0 }, { 20160309, 2016, 2, 0 }, { 20160407, 2016, 3, 0 }, { 20160507, 2016, 4, 0 },
+    { 20160605, 2016, 5, 0 }, { 20160704, 2016, 6, 0 }, { 20160803, 2016, 7, 0 }, { 20160901, 2016, 8, 0 },
+    { 20161001, 2016, 9, 0 }, { 20161031, 2016, 10, 0 }, { 20161129, 2016, 11, 0 }, { 20161229, 2016, 12, 0 },
+    { 20170128, 2017, 1, 0 }, { 20170226, 2017, 2, 0 }, { 20170328, 2017, 3, 0 }, { 20170426, 2017, 4, 0 },
+    { 20170526, 2017, 5, 0 }, { 20170624, 2017, 6, 0 }, { 20170723, 2017, 6, 1 }, { 20170822, 2017, 7, 0 },
+    { 20170920, 2017, 8, 0 }, { 20171020, 2017, 9, 0 }, { 20171118, 2017, 10, 0 }, { 20171218, 2017, 11, 0 },
+    { 20180117, 2017, 12, 0 }, { 20180216, 2018, 1, 0 }, { 20180317, 2018, 2, 0 }, { 20180416, 2018, 3, 0 },
+    { 20180515, 2018, 4, 0 }, { 20180614, 2018, 5, 0 }, { 20180713, 2018, 6, 0 }, { 20180811, 2018, 7, 0 },
+    { 20180910, 2018, 8, 0 }, { 20181009, 2018, 9, 0 }, { 20181107, 2018, 10, 0 }, { 20181207, 2018, 11, 0 },
+    { 20190106, 2018, 12, 0 }, { 20190205, 2019, 1, 0 }, { 20190307, 2019, 2, 0 }, { 20190405, 2019, 3, 0 },
+    { 20190505, 2019, 4, 0 }, { 20190603, 2019, 5, 0 }, { 20190703, 2019, 6, 0 }, { 20190801, 2019, 7, 0 },
+    { 20190830, 2019, 8, 0 }, { 20190929, 2019, 9, 0 }, { 20191028, 2019, 10, 0 }, { 20191126, 2019, 11, 0 },
+    { 20191226, 2019, 12, 0 }, { 20200125, 2020, 1, 0 }, { 20200223, 2020, 2, 0 }, { 20200324, 2020, 3, 0 },
+    { 20200423, 2020, 4, 0 }, { 20200523, 2020, 4, 1 }, { 20200621, 2020, 5, 0 }, { 20200721, 2020, 6, 0 },
+    { 20200819, 2020, 7, 0 }, { 20200917, 2020, 8, 0 }, { 20201017, 2020, 9, 0 }, { 20201115, 2020, 10, 0 },
+    { 20201215, 2020, 11, 0 }, { 20210113, 2020, 12, 0 }, { 20210212, 2021, 1, 0 }, { 20210313, 2021, 2, 0 },
+    { 20210412, 2021, 3, 0 }, { 20210512, 2021, 4, 0 }, { 20210610, 2021, 5, 0 }, { 20210710, 2021, 6, 0 },
+    { 20210808, 2021, 7, 0 }, { 20210907, 2021, 8, 0 }, { 20211006, 2021, 9, 0 }, { 20211105, 2021, 10, 0 },
+    { 20211204, 2021, 11, 0 }, { 20220103, 2021, 12, 0 }, { 20220201, 2022, 1, 0 }, { 20220303, 2022, 2, 0 },
+    { 20220401, 2022, 3, 0 }, { 20220501, 2022, 4, 0 }, { 20220530, 2022, 5, 0 }, { 20220629, 2022, 6, 0 },
+    { 20220729, 2022, 7, 0 }, { 20220827, 2022, 8, 0 }, { 20220926, 2022, 9, 0 }, { 20221025, 2022, 10, 0 },
+    { 20221124, 2022, 11, 0 }, { 20221223, 2022, 12, 0 }, { 20230122, 2023, 1, 0 }, { 20230220, 2023, 2, 0 },
+    { 20230322, 2023, 2, 1 }, { 20230420, 2023, 3, 0 }, { 20230519, 2023, 4, 0 }, { 20230618, 2023, 5, 0 },
+    { 20230718, 2023, 6, 0 }, { 20230816, 2023, 7, 0 }, { 20230915, 2023, 8, 0 }, { 20231015, 2023, 9, 0 },
+    { 20231113, 2023, 10, 0 }, { 20231213, 2023, 11, 0 }, { 20240111, 2023, 12, 0 }, { 20240210, 2024, 1, 0 },
+    { 20240310, 2024, 2, 0 }, { 20240409, 2024, 3, 0 }, { 20240508, 2024, 4, 0 }, { 20240606, 2024, 5, 0 },
+    { 20240706, 2024, 6, 0 }, { 20240804, 2024, 7, 0 }, { 20240903, 2024, 8, 0 }, { 20241003, 2024, 9, 0 },
+    { 20241101, 2024, 10, 0 }, { 20241201, 2024, 11, 0 }, { 20241231, 2024, 12, 0 }, { 20250129, 2025, 1, 0 },
+    { 20250228, 2025, 2, 0 }, { 20250329, 2025, 3, 0 }, { 20250428, 2025, 4, 0 }, { 20250527, 2025, 5, 0 },
+    { 20250625, 2025, 6, 0 }, { 20250725, 2025, 6, 1 }, { 20250823, 2025, 7, 0 }, { 20250922, 2025, 8, 0 },
+    { 20251021, 2025, 9, 0 }, { 20251120, 2025, 10, 0 }, { 20251220, 2025, 11, 0 }, { 20260119, 2025, 12, 0 },
+    { 20260217, 2026, 1, 0 }, { 20260319, 2026, 2, 0 }, { 20260417, 2026, 3, 0 }, { 20260517, 2026, 4, 0 },
+    { 20260615, 2026, 5, 0 }, { 20260714, 2026, 6, 0 }, { 20260813, 2026, 7, 0 }, { 20260911, 2026, 8, 0 },
+    { 20261010, 2026, 9, 0 }, { 20261109, 2026, 10, 0 }, { 20261209, 2026, 11, 0 }, { 20270108, 2026, 12, 0 },
+    { 20270207, 2027, 1, 0 }, { 20270308, 2027, 2, 0 }, { 20270407, 2027, 3, 0 }, { 20270506, 2027, 4, 0 },
+    { 20270605, 2027, 5, 0 }, { 20270704, 2027, 6, 0 }, { 20270802, 2027, 7, 0 }, { 20270901, 2027, 8, 0 },
+    { 20270930, 2027, 9, 0 }, { 20271029, 2027, 10, 0 }, { 20271128, 2027, 11, 0 }, { 20271228, 2027, 12, 0 },
+    { 20280126, 2028, 1, 0 }, { 20280225, 2028, 2, 0 }, { 20280326, 2028, 3, 0 }, { 20280425, 2028, 4, 0 },
+    { 20280524, 2028, 5, 0 }, { 20280623, 2028, 5, 1 }, { 20280722, 2028, 6, 0 }, { 20280820, 2028, 7, 0 },
+    { 20280919, 2028, 8, 0 }, { 20281018, 2028, 9, 0 }, { 20281116, 2028, 10, 0 }, { 20281216, 2028, 11, 0 },
+    { 20290115, 2028, 12, 0 }, { 20290213, 2029, 1, 0 }, { 20290315, 2029, 2, 0 }, { 20290414, 2029, 3, 0 },
+    { 20290513, 2029, 4, 0 }, { 20290612, 2029, 5, 0 }, { 20290711, 2029, 6, 0 }, { 20290810, 2029, 7, 0 },
+    { 20290908, 2029, 8, 0 }, { 20291008, 2029, 9, 0 }, { 20291106, 2029, 10, 0 }, { 20291205, 2029, 11, 0 },
+    { 20300104, 2029, 12, 0 }, { 20300202, 2030, 1, 0 }, { 20300304, 2030, 2, 0 }, { 20300403, 2030, 3, 0 },
+    { 20300502, 2030, 4, 0 }, { 20300601, 2030, 5, 0 }, { 20300701, 2030, 6, 0 }, { 20300730, 2030, 7, 0 },
+    { 20300829, 2030, 8, 0 }, { 20300927, 2030, 9, 0 }, { 20301027, 2030, 10, 0 }, { 20301125, 2030, 11, 0 },
+    { 20301225, 2030, 12, 0 }, { 20310123, 2031, 1, 0 }, { 20310221, 2031, 2, 0 }, { 20310323, 2031, 3, 0 },
+    { 20310422, 2031, 3, 1 }, { 20310521, 2031, 4, 0 }, { 20310620, 2031, 5, 0 }, { 20310719, 2031, 6, 0 },
+    { 20310818, 2031, 7, 0 }, { 20310917, 2031, 8, 0 }, { 20311016, 2031, 9, 0 }, { 20311115, 2031, 10, 0 },
+    { 20311214, 2031, 11, 0 }, { 20320113, 2031, 12, 0 }, { 20320211, 2032, 1, 0 }, { 20320312, 2032, 2, 0 },
+    { 20320410, 2032, 3, 0 }, { 20320509, 2032, 4, 0 }, { 20320608, 2032, 5, 0 }, { 20320707, 2032, 6, 0 },
+    { 20320806, 2032, 7, 0 }, { 20320905, 2032, 8, 0 }, { 20321004, 2032, 9, 0 }, { 20321103, 2032, 10, 0 },
+    { 20321203, 2032, 11, 0 }, { 20330101, 2032, 12, 0 }, { 20330131, 2033, 1, 0 }, { 20330301, 2033, 2, 0 },
+    { 20330331, 2033, 3, 0 }, { 20330429, 2033, 4, 0 }, { 20330528, 2033, 5, 0 }, { 20330627, 2033, 6, 0 },
+    { 20330726, 2033, 7, 0 }, { 20330825, 2033, 8, 0 }, { 20330923, 2033, 9, 0 }, { 20331023, 2033, 10, 0 },
+    { 20331122, 2033, 11, 0 }, { 20331222, 2033, 11, 1 }, { 20340120, 2033, 12, 0 }, { 20340219, 2034, 1, 0 },
+    { 20340320, 2034, 2, 0 }, { 20340419, 2034, 3, 0 }, { 20340518, 2034, 4, 0 }, { 20340616, 2034, 5, 0 },
+    { 20340716, 2034, 6, 0 }, { 20340814, 2034, 7, 0 }, { 20340913, 2034, 8, 0 }, { 20341012, 2034, 9, 0 },
+    { 20341111, 2034, 10, 0 }, { 20341211, 2034, 11, 0 }, { 20350109, 2034, 12, 0 }, { 20350208, 2035, 1, 0 },
+    { 20350310, 2035, 2, 0 }, { 20350408, 2035, 3, 0 }, { 20350508, 2035, 4, 0 }, { 20350606, 2035, 5, 0 },
+    { 20350705, 2035, 6, 0 }, { 20350804, 2035, 7, 0 }, { 20350902, 2035, 8, 0 }, { 20351001, 2035, 9, 0 },
+    { 20351031, 2035, 10, 0 }, { 20351130, 2035, 11, 0 }, { 20351229, 2035, 12, 0 }, { 20360128, 2036, 1, 0 },
+    { 20360227, 2036, 2, 0 }, { 20360328, 2036, 3, 0 }, { 20360426, 2036, 4, 0 }, { 20360526, 2036, 5, 0 },
+    { 20360624, 2036, 6, 0 }, { 20360723, 2036, 6, 1 }, { 20360822, 2036, 7, 0 }, { 20360920, 2036, 8, 0 },
+    { 20361019, 2036, 9, 0 }, { 20361118, 2036, 10, 0 }, { 20361217, 2036, 11, 0 }, { 20370116, 2036, 12, 0 },
+    { 20370215, 2037, 1, 0 }, { 20370317, 2037, 2, 0 }, { 20370416, 2037, 3, 0 }, { 20370515, 2037, 4, 0 },
+    { 20370614, 2037, 5, 0 }, { 20370713, 2037, 6, 0 }, { 20370811, 2037, 7, 0 }, { 20370910, 2037, 8, 0 },
+    { 20371009, 2037, 9, 0 }, { 20371107, 2037, 10, 0 }, { 20371207, 2037, 11, 0 }, { 20380105, 2037, 12, 0 },
+    { 20380204, 2038, 1, 0 }, { 20380306, 2038, 2, 0 }, { 20380405, 2038, 3, 0 }, { 20380504, 2038, 4, 0 },
+    { 20380603, 2038, 5, 0 }, { 20380702, 2038, 6, 0 }, { 20380801, 2038, 7, 0 }, { 20380830, 2038, 8, 0 },
+    { 20380929, 2038, 9, 0 }, { 20381028, 2038, 10, 0 }, { 20381126, 2038, 11, 0 }, { 20381226, 2038, 12, 0 },
+    { 20390124, 2039, 1, 0 }, { 20390223, 2039, 2, 0 }, { 20390325, 2039, 3, 0 }, { 20390423, 2039, 4, 0 },
+    { 20390523, 2039, 5, 0 }, { 20390622, 2039, 5, 1 }, { 20390721, 2039, 6, 0 }, { 20390820, 2039, 7, 0 },
+    { 20390918, 2039, 8, 0 }, { 20391018, 2039, 9, 0 }, { 20391116, 2039, 10, 0 }, { 20391216, 2039, 11, 0 },
+    { 20400114, 2039, 12, 0 }, { 20400212, 2040, 1, 0 }, { 20400313, 2040, 2, 0 }, { 20400411, 2040, 3, 0 },
+    { 20400511, 2040, 4, 0 }, { 20400610, 2040, 5, 0 }, { 20400709, 2040, 6, 0 }, { 20400808, 2040, 7, 0 },
+    { 20400906, 2040, 8, 0 }, { 20401006, 2040, 9, 0 }, { 20401105, 2040, 10, 0 }, { 20401204, 2040, 11, 0 },
+    { 20410103, 2040, 12, 0 }, { 20410201, 2041, 1, 0 }, { 20410302, 2041, 2, 0 }, { 20410401, 2041, 3, 0 },
+    { 20410430, 2041, 4, 0 }, { 20410530, 2041, 5, 0 }, { 20410628, 2041, 6, 0 }, { 20410728, 2041, 7, 0 },
+    { 20410827, 2041, 8, 0 }, { 20410925, 2041, 9, 0 }, { 20411025, 2041, 10, 0 }, { 20411124, 2041, 11, 0 },
+    { 20411223, 2041, 12, 0 }, { 20420122, 2042, 1, 0 }, { 20420220, 2042, 2, 0 }, { 20420322, 2042, 2, 1 },
+    { 20420420, 2042, 3, 0 }, { 20420519, 2042, 4, 0 }, { 20420618, 2042, 5, 0 }, { 20420717, 2042, 6, 0 },
+    { 20420816, 2042, 7, 0 }, { 20420914, 2042, 8, 0 }, { 20421014, 2042, 9, 0 }, { 20421113, 2042, 10, 0 },
+    { 20421212, 2042, 11, 0 }, { 20430111, 2042, 12, 0 }, { 20430210, 2043, 1, 0 }, { 20430311, 2043, 2, 0 },
+    { 20430410, 2043, 3, 0 }, { 20430509, 2043, 4, 0 }, { 20430607, 2043, 5, 0 }, { 20430707, 2043, 6, 0 },
+    { 20430805, 2043, 7, 0 }, { 20430903, 2043, 8, 0 }, { 20431003, 2043, 9, 0 }, { 20431102, 2043, 10, 0 },
+    { 20431201, 2043, 11, 0 }, { 20431231, 2043, 12, 0 }, { 20440130, 2044, 1, 0 }, { 20440229, 2044, 2, 0 },
+    { 20440329, 2044, 3, 0 }, { 20440428, 2044, 4, 0 }, { 20440527, 2044, 5, 0 }, { 20440625, 2044, 6, 0 },
+    { 20440725, 2044, 7, 0 }, { 20440823, 2044, 7, 1 }, { 20440921, 2044, 8, 0 }, { 20441021, 2044, 9, 0 },
+    { 20441119, 2044, 10, 0 }, { 20441219, 2044, 11, 0 }, { 20450118, 2044, 12, 0 }, { 20450217, 2045, 1, 0 },
+    { 20450319, 2045, 2, 0 }, { 20450417, 2045, 3, 0 }, { 20450517, 2045, 4, 0 }, { 20450615, 2045, 5, 0 },
+    { 20450714, 2045, 6, 0 }, { 20450813, 2045, 7, 0 }, { 20450911, 2045, 8, 0 }, { 20451010, 2045, 9, 0 },
+    { 20451109, 2045, 10, 0 }, { 20451208, 2045, 11, 0 }, { 20460107, 2045, 12, 0 }, { 20460206, 2046, 1, 0 },
+    { 20460308, 2046, 2, 0 }, { 20460406, 2046, 3, 0 }, { 20460506, 2046, 4, 0 }, { 20460604, 2046, 5, 0 },
+    { 20460704, 2046, 6, 0 }, { 20460802, 2046, 7, 0 }, { 20460901, 2046, 8, 0 }, { 20460930, 2046, 9, 0 },
+    { 20461029, 2046, 10, 0 }, { 20461128, 2046, 11, 0 }, { 20461227, 2046, 12, 0 }, { 20470126, 2047, 1, 0 },
+    { 20470225, 2047, 2, 0 }, { 20470326, 2047, 3, 0 }, { 20470425, 2047, 4, 0 }, { 20470525, 2047, 5, 0 },
+    { 20470623, 2047, 5, 1 }, { 20470723, 2047, 6, 0 }, { 20470821, 2047, 7, 0 }, { 20470920, 2047, 8, 0 },
+    { 20471019, 2047, 9, 0 }, { 20471117, 2047, 10, 0 }, { 20471217, 2047, 11, 0 }, { 20480115, 2047, 12, 0 },
+    { 20480214, 2048, 1, 0 }, { 20480314, 2048, 2, 0 }, { 20480413, 2048, 3, 0 }, { 20480513, 2048, 4, 0 },
+    { 20480611, 2048, 5, 0 }, { 20480711, 2048, 6, 0 }, { 20480810, 2048, 7, 0 }, { 20480908, 2048, 8, 0 },
+    { 20481008, 2048, 9, 0 }, { 20481106, 2048, 10, 0 }, { 20481205, 2048, 11, 0 }, { 20490104, 2048, 12, 0 },
+    { 20490202, 2049, 1, 0 }, { 20490304, 2049, 2, 0 }, { 20490402, 2049, 3, 0 }, { 20490502, 2049, 4, 0 },
+    { 20490531, 2049, 5, 0 }, { 20490630, 2049, 6, 0 }, { 20490730, 2049, 7, 0 }, { 20490828, 2049, 8, 0 },
+    { 20490927, 2049, 9, 0 }, { 20491027, 2049, 10, 0 }, { 20491125, 2049, 11, 0 }, { 20491225, 2049, 12, 0 },
+    { 20500123, 2050, 1, 0 }, { 20500221, 2050, 2, 0 }, { 20500323, 2050, 3, 0 }, { 20500421, 2050, 3, 1 },
+    { 20500521, 2050, 4, 0 }, { 20500619, 2050, 5, 0 }, { 20500719, 2050, 6, 0 }, { 20500817, 2050, 7, 0 },
+    { 20500916, 2050, 8, 0 }, { 20501016, 2050, 9, 0 }, { 20501114, 2050, 10, 0 }, { 20501214, 2050, 11, 0 },
+    { 20510113, 2050, 12, 0 }, { 20510211, 2051, 1, 0 }, { 20510313, 2051, 2, 0 }, { 20510411, 2051, 3, 0 },
+    { 20510510, 2051, 4, 0 }, { 20510609, 2051, 5, 0 }, { 20510708, 2051, 6, 0 }, { 20510806, 2051, 7, 0 },
+    { 20510905, 2051, 8, 0 }, { 20511005, 2051, 9, 0 }, { 20511103, 2051, 10, 0 }, { 20511203, 2051, 11, 0 },
+    { 20520102, 2051, 12, 0 }, { 20520201, 2052, 1, 0 }, { 20520301, 2052, 2, 0 }, { 20520331, 2052, 3, 0 },
+    { 20520429, 2052, 4, 0 }, { 20520528, 2052, 5, 0 }, { 20520627, 2052, 6, 0 }, { 20520726, 2052, 7, 0 },
+    { 20520824, 2052, 8, 0 }, { 20520923, 2052, 8, 1 }, { 20521022, 2052, 9, 0 }, { 20521121, 2052, 10, 0 },
+    { 20521221, 2052, 11, 0 }, { 20530120, 2052, 12, 0 }, { 20530219, 2053, 1, 0 }, { 20530320, 2053, 2, 0 },
+    { 20530419, 2053, 3, 0 }, { 20530518, 2053, 4, 0 }, { 20530616, 2053, 5, 0 }, { 20530716, 2053, 6, 0 },
+    { 20530814, 2053, 7, 0 }, { 20530912, 2053, 8, 0 }, { 20531012, 2053, 9, 0 }, { 20531110, 2053, 10, 0 },
+    { 20531210, 2053, 11, 0 }, { 20540109, 2053, 12, 0 }, { 20540208, 2054, 1, 0 }, { 20540309, 2054, 2, 0 },
+    { 20540408, 2054, 3, 0 }, { 20540508, 2054, 4, 0 }, { 20540606, 2054, 5, 0 }, { 20540705, 2054, 6, 0 },
+    { 20540804, 2054, 7, 0 }, { 20540902, 2054, 8, 0 }, { 20541001, 2054, 9, 0 }, { 20541031, 2054, 10, 0 },
+    { 20541129, 2054, 11, 0 }, { 20541229, 2054, 12, 0 }, { 20550128, 2055, 1, 0 }, { 20550226, 2055, 2, 0 },
+    { 20550328, 2055, 3, 0 }, { 20550427, 2055, 4, 0 }, { 20550526, 2055, 5, 0 }, { 20550625, 2055, 6, 0 },
+    { 20550724, 2055, 6, 1 }, { 20550823, 2055, 7, 0 }, { 20550921, 2055, 8, 0 }, { 20551020, 2055, 9, 0 },
+    { 20551119, 2055, 10, 0 }, { 20551218, 2055, 11, 0 }, { 20560117, 2055, 12, 0 }, { 20560215, 2056, 1, 0 },
+    { 20560316, 2056, 2, 0 }, { 20560415, 2056, 3, 0 }, { 20560515, 2056, 4, 0 }, { 20560613, 2056, 5, 0 },
+    { 20560713, 2056, 6, 0 }, { 20560811, 2056, 7, 0 }, { 20560910, 2056, 8, 0 }, { 20561009, 2056, 9, 0 },
+    { 20561107, 2056, 10, 0 }, { 20561207, 2056, 11, 0 }, { 20570105, 2056, 12, 0 }, { 20570204, 2057, 1, 0 },
+    { 20570305, 2057, 2, 0 }, { 20570404, 2057, 3, 0 }, { 20570504, 2057, 4, 0 }, { 20570602, 2057, 5, 0 },
+    { 20570702, 2057, 6, 0 }, { 20570731, 2057, 7, 0 }, { 20570830, 2057, 8, 0 }, { 20570929, 2057, 9, 0 },
+    { 20571028, 2057, 10, 0 }, { 20571126, 2057, 11, 0 }, { 20571226, 2057, 12, 0 }, { 20580124, 2058, 1, 0 },
+    { 20580223, 2058, 2, 0 }, { 20580324, 2058, 3, 0 }, { 20580423, 2058, 4, 0 }, { 20580522, 2058, 4, 1 },
+    { 20580621, 2058, 5, 0 }, { 20580720, 2058, 6, 0 }, { 20580819, 2058, 7, 0 }, { 20580918, 2058, 8, 0 },
+    { 20581017, 2058, 9, 0 }, { 20581116, 2058, 10, 0 }, { 20581216, 2058, 11, 0 }, { 20590114, 2058, 12, 0 },
+    { 20590212, 2059, 1, 0 }, { 20590314, 2059, 2, 0 }, { 20590412, 2059, 3, 0 }, { 20590512, 2059, 4, 0 },
+    { 20590610, 2059, 5, 0 }, { 20590710, 2059, 6, 0 }, { 20590808, 2059, 7, 0 }, { 20590907, 2059, 8, 0 },
+    { 20591006, 2059, 9, 0 }, { 20591105, 2059, 10, 0 }, { 20591205, 2059, 11, 0 }, { 20600104, 2059, 12, 0 },
+    { 20600202, 2060, 1, 0 }, { 20600303, 2060, 2, 0 }, { 20600401, 2060, 3, 0 }, { 20600430, 2060, 4, 0 },
+    { 20600530, 2060, 5, 0 }, { 20600628, 2060, 6, 0 }, { 20600727, 2060, 7, 0 }, { 20600826, 2060, 8, 0 },
+    { 20600924, 2060, 9, 0 }, { 20601024, 2060, 10, 0 }, { 20601123, 2060, 11, 0 }, { 20601223, 2060, 12, 0 },
+    { 20610121, 2061, 1, 0 }, { 20610220, 2061, 2, 0 }, { 20610322, 2061, 3, 0 }, { 20610420, 2061, 3, 1 },
+    { 20610519, 2061, 4, 0 }, { 20610618, 2061, 5, 0 }, { 20610717, 2061, 6, 0 }, { 20610815, 2061, 7, 0 },
+    { 20610914, 2061, 8, 0 }, { 20611013, 2061, 9, 0 }, { 20611112, 2061, 10, 0 }, { 20611212, 2061, 11, 0 },
+    { 20620111, 2061, 12, 0 }, { 20620209, 2062, 1, 0 }, { 20620311, 2062, 2, 0 }, { 20620410, 2062, 3, 0 },
+    { 20620509, 2062, 4, 0 }, { 20620607, 2062, 5, 0 }, { 20620707, 2062, 6, 0 }, { 20620805, 2062, 7, 0 },
+    { 20620903, 2062, 8, 0 }, { 20621003, 2062, 9, 0 }, { 20621101, 2062, 10, 0 }, { 20621201, 2062, 11, 0 },
+    { 20621231, 2062, 12, 0 }, { 20630129, 2063, 1, 0 }, { 20630228, 2063, 2, 0 }, { 20630330, 2063, 3, 0 },
+    { 20630428, 2063, 4, 0 }, { 20630528, 2063, 5, 0 }, { 20630626, 2063, 6, 0 }, { 20630726, 2063, 7, 0 },
+    { 20630824, 2063, 7, 1 }, { 20630922, 2063, 8, 0 }, { 20631022, 2063, 9, 0 }, { 20631120, 2063, 10, 0 },
+    { 20631220, 2063, 11, 0 }, { 20640118, 2063, 12, 0 }, { 20640217, 2064, 1, 0 }, { 20640318, 2064, 2, 0 },
+    { 20640417, 2064, 3, 0 }, { 20640516, 2064, 4, 0 }, { 20640615, 2064, 5, 0 }, { 20640714, 2064, 6, 0 },
+    { 20640813, 2064, 7, 0 }, { 20640911, 2064, 8, 0 }, { 20641010, 2064, 9, 0 }, { 20641109, 2064, 10, 0 },
+    { 20641208, 2064, 11, 0 }, { 20650107, 2064, 12, 0 }, { 20650205, 2065, 1, 0 }, { 20650307, 2065, 2, 0 },
+    { 20650406, 2065, 3, 0 }, { 20650505, 2065, 4, 0 }, { 20650604, 2065, 5, 0 }, { 20650704, 2065, 6, 0 },
+    { 20650802, 2065, 7, 0 }, { 20650901, 2065, 8, 0 }, { 20650930, 2065, 9, 0 }, { 20651029, 2065, 10, 0 },
+    { 20651128, 2065, 11, 0 }, { 20651227, 2065, 12, 0 }, { 20660126, 2066, 1, 0 }, { 20660224, 2066, 2, 0 },
+    { 20660326, 2066, 3, 0 }, { 20660424, 2066, 4, 0 }, { 20660524, 2066, 5, 0 }, { 20660623, 2066, 5, 1 },
+    { 20660722, 2066, 6, 0 }, { 20660821, 2066, 7, 0 }, { 20660919, 2066, 8, 0 }, { 20661019, 2066, 9, 0 },
+    { 20661117, 2066, 10, 0 }, { 20661217, 2066, 11, 0 }, { 20670115, 2066, 12, 0 }, { 20670214, 2067, 1, 0 },
+    { 20670315, 2067, 2, 0 }, { 20670414, 2067, 3, 0 }, { 20670513, 2067, 4, 0 }, { 20670612, 2067, 5, 0 },
+    { 20670711, 2067, 6, 0 }, { 20670810, 2067, 7, 0 }, { 20670909, 2067, 8, 0 }, { 20671008, 2067, 9, 0 },
+    { 20671107, 2067, 10, 0 }, { 20671206, 2067, 11, 0 }, { 20680105, 2067, 12, 0 }, { 20680203, 2068, 1, 0 },
+    { 20680304, 2068, 2, 0 }, { 20680402, 2068, 3, 0 }, { 20680502, 2068, 4, 0 }, { 20680531, 2068, 5, 0 },
+    { 20680629, 2068, 6, 0 }, { 20680729, 2068, 7, 0 }, { 20680828, 2068, 8, 0 }, { 20680926, 2068, 9, 0 },
+    { 20681026, 2068, 10, 0 }, { 20681125, 2068, 11, 0 }, { 20681224, 2068, 12, 0 }, { 20690123, 2069, 1, 0 },
+    { 20690221, 2069, 2, 0 }, { 20690323, 2069, 3, 0 }, { 20690421, 2069, 4, 0 }, { 20690521, 2069, 4, 1 },
+    { 20690619, 2069, 5, 0 }, { 20690718, 2069, 6, 0 }, { 20690817, 2069, 7, 0 }, { 20690915, 2069, 8, 0 },
+    { 20691015, 2069, 9, 0 }, { 20691114, 2069, 10, 0 }, { 20691214, 2069, 11, 0 }, { 20700112, 2069, 12, 0 },
+    { 20700211, 2070, 1, 0 }, { 20700313, 2070, 2, 0 }, { 20700411, 2070, 3, 0 }, { 20700510, 2070, 4, 0 },
+    { 20700609, 2070, 5, 0 }, { 20700708, 2070, 6, 0 }, { 20700806, 2070, 7, 0 }, { 20700905, 2070, 8, 0 },
+    { 20701004, 2070, 9, 0 }, { 20701103, 2070, 10, 0 }, { 20701203, 2070, 11, 0 }, { 20710101, 2070, 12, 0 },
+    { 20710131, 2071, 1, 0 }, { 20710302, 2071, 2, 0 }, { 20710331, 2071, 3, 0 }, { 20710430, 2071, 4, 0 },
+    { 20710529, 2071, 5, 0 }, { 20710628, 2071, 6, 0 }, { 20710727, 2071, 7, 0 }, { 20710825, 2071, 8, 0 },
+    { 20710924, 2071, 8, 1 }, { 20711023, 2071, 9, 0 }, { 20711122, 2071, 10, 0 }, { 20711221, 2071, 11, 0 },
+    { 20720120, 2071, 12, 0 }, { 20720219, 2072, 1, 0 }, { 20720320, 2072, 2, 0 }, { 20720418, 2072, 3, 0 },
+    { 20720518, 2072, 4, 0 }, { 20720616, 2072, 5, 0 }, { 20720716, 2072, 6, 0 }, { 20720814, 2072, 7, 0 },
+    { 20720912, 2072, 8, 0 }, { 20721012, 2072, 9, 0 }, { 20721110, 2072, 10, 0 }, { 20721210, 2072, 11, 0 },
+    { 20730108, 2072, 12, 0 }, { 20730207, 2073, 1, 0 }, { 20730309, 2073, 2, 0 }, { 20730407, 2073, 3, 0 },
+    { 20730507, 2073, 4, 0 }, { 20730606, 2073, 5, 0 }, { 20730705, 2073, 6, 0 }, { 20730804, 2073, 7, 0 },
+    { 20730902, 2073, 8, 0 }, { 20731001, 2073, 9, 0 }, { 20731031, 2073, 10, 0 }, { 20731129, 2073, 11, 0 },
+    { 20731229, 2073, 12, 0 }, { 20740127, 2074, 1, 0 }, { 20740226, 2074, 2, 0 }, { 20740327, 2074, 3, 0 },
+    { 20740426, 2074, 4, 0 }, { 20740526, 2074, 5, 0 }, { 20740624, 2074, 6, 0 }, { 20740724, 2074, 6, 1 },
+    { 20740822, 2074, 7, 0 }, { 20740921, 2074, 8, 0 }, { 20741020, 2074, 9, 0 }, { 20741119, 2074, 10, 0 },
+    { 20741218, 2074, 11, 0 }, { 20750117, 2074, 12, 0 }, { 20750215, 2075, 1, 0 }, { 20750317, 2075, 2, 0 },
+    { 20750415, 2075, 3, 0 }, { 20750515, 2075, 4, 0 }, { 20750613, 2075, 5, 0 }, { 20750713, 2075, 6, 0 },
+    { 20750812, 2075, 7, 0 }, { 20750910, 2075, 8, 0 }, { 20751010, 2075, 9, 0 }, { 20751108, 2075, 10, 0 },
+    { 20751208, 2075, 11, 0 }, { 20760106, 2075, 12, 0 }, { 20760205, 2076, 1, 0 }, { 20760305, 2076, 2, 0 },
+    { 20760404, 2076, 3, 0 }, { 20760503, 2076, 4, 0 }, { 20760602, 2076, 5, 0 }, { 20760701, 2076, 6, 0 },
+    { 20760731, 2076, 7, 0 }, { 20760829, 2076, 8, 0 }, { 20760928, 2076, 9, 0 }, { 20761028, 2076, 10, 0 },
+    { 20761126, 2076, 11, 0 }, { 20761226, 2076, 12, 0 }, { 20770124, 2077, 1, 0 }, { 20770223, 2077, 2, 0 },
+    { 20770324, 2077, 3, 0 }, { 20770423, 2077, 4, 0 }, { 20770522, 2077, 4, 1 }, { 20770620, 2077, 5, 0 },
+    { 20770720, 2077, 6, 0 }, { 20770818, 2077, 7, 0 }, { 20770917, 2077, 8, 0 }, { 20771017, 2077, 9, 0 },
+    { 20771116, 2077, 10, 0 }, { 20771215, 2077, 11, 0 }, { 20780114, 2077, 12, 0 }, { 20780212, 2078, 1, 0 },
+    { 20780314, 2078, 2, 0 }, { 20780412, 2078, 3, 0 }, { 20780512, 2078, 4, 0 }, { 20780610, 2078, 5, 0 },
+    { 20780709, 2078, 6, 0 }, { 20780808, 2078, 7, 0 }, { 20780906, 2078, 8, 0 }, { 20781006, 2078, 9, 0 },
+    { 20781105, 2078, 10, 0 }, { 20781204, 2078, 11, 0 }, { 20790103, 2078, 12, 0 }, { 20790202, 2079, 1, 0 },
+    { 20790303, 2079, 2, 0 }, { 20790402, 2079, 3, 0 }, { 20790501, 2079, 4, 0 }, { 20790531, 2079, 5, 0 },
+    { 20790629, 2079, 6, 0 }, { 20790728, 2079, 7, 0 }, { 20790827, 2079, 8, 0 }, { 20790925, 2079, 9, 0 },
+    { 20791025, 2079, 10, 0 }, { 20791123, 2079, 11, 0 }, { 20791223, 2079, 12, 0 }, { 20800122, 2080, 1, 0 },
+    { 20800221, 2080, 2, 0 }, { 20800321, 2080, 3, 0 }, { 20800420, 2080, 3, 1 }, { 20800519, 2080, 4, 0 },
+    { 20800618, 2080, 5, 0 }, { 20800717, 2080, 6, 0 }, { 20800815, 2080, 7, 0 }, { 20800914, 2080, 8, 0 },
+    { 20801013, 2080, 9, 0 }, { 20801111, 2080, 10, 0 }, { 20801211, 2080, 11, 0 }, { 20810110, 2080, 12, 0 },
+    { 20810209, 2081, 1, 0 }, { 20810310, 2081, 2, 0 }, { 20810409, 2081, 3, 0 }, { 20810509, 2081, 4, 0 },
+    { 20810607, 2081, 5, 0 }, { 20810707, 2081, 6, 0 }, { 20810805, 2081, 7, 0 }, { 20810903, 2081, 8, 0 },
+    { 20811003, 2081, 9, 0 }, { 20811101, 2081, 10, 0 }, { 20811130, 2081, 11, 0 }, { 20811230, 2081, 12, 0 },
+    { 20820129, 2082, 1, 0 }, { 20820227, 2082, 2, 0 }, { 20820329, 2082, 3, 0 }, { 20820428, 2082, 4, 0 },
+    { 20820528, 2082, 5, 0 }, { 20820626, 2082, 6, 0 }, { 20820725, 2082, 7, 0 }, { 20820824, 2082, 7, 1 },
+    { 20820922, 2082, 8, 0 }, { 20821022, 2082, 9, 0 }, { 20821120, 2082, 10, 0 }, { 20821219, 2082, 11, 0 },
+    { 20830118, 2082, 12, 0 }, { 20830217, 2083, 1, 0 }, { 20830318, 2083, 2, 0 }, { 20830417, 2083, 3, 0 },
+    { 20830517, 2083, 4, 0 }, { 20830615, 2083, 5, 0 }, { 20830715, 2083, 6, 0 }, { 20830813, 2083, 7, 0 },
+    { 20830912, 2083, 8, 0 }, { 20831011, 2083, 9, 0 }, { 20831110, 2083, 10, 0 }, { 20831209, 2083, 11, 0 },
+    { 20840108, 2083, 12, 0 }, { 20840206, 2084, 1, 0 }, { 20840307, 2084, 2, 0 }, { 20840405, 2084, 3, 0 },
+    { 20840505, 2084, 4, 0 }, { 20840603, 2084, 5, 0 }, { 20840703, 2084, 6, 0 }, { 20840802, 2084, 7, 0 },
+    { 20840831, 2084, 8, 0 }, { 20840930, 2084, 9, 0 }, { 20841029, 2084, 10, 0 }, { 20841128, 2084, 11, 0 },
+    { 20841227, 2084, 12, 0 }, { 20850126, 2085, 1, 0 }, { 20850224, 2085, 2, 0 }, { 20850326, 2085, 3, 0 },
+    { 20850424, 2085, 4, 0 }, { 20850523, 2085, 5, 0 }, { 20850622, 2085, 5, 1 }, { 20850722, 2085, 6, 0 },
+    { 20850820, 2085, 7, 0 }, { 20850919, 2085, 8, 0 }, { 20851019, 2085, 9, 0 }, { 20851117, 2085, 10, 0 },
+    { 20851217, 2085, 11, 0 }, { 20860115, 2085, 12, 0 }, { 20860214, 2086, 1, 0 }, { 20860315, 2086, 2, 0 },
+    { 20860414, 2086, 3, 0 }, { 20860513, 2086, 4, 0 }, { 20860611, 2086, 5, 0 }, { 20860711, 2086, 6, 0 },
+    { 20860809, 2086, 7, 0 }, { 20860908, 2086, 8, 0 }, { 20861008, 2086, 9, 0 }, { 20861106, 2086, 10, 0 },
+    { 20861206, 2086, 11, 0 }, { 20870105, 2086, 12, 0 }, { 20870203, 2087, 1, 0 }, { 20870305, 2087, 2, 0 },
+    { 20870403, 2087, 3, 0 }, { 20870503, 2087, 4, 0 }, { 20870601, 2087, 5, 0 }, { 20870630, 2087, 6, 0 },
+    { 20870730, 2087, 7, 0 }, { 20870828, 2087, 8, 0 }, { 20870927, 2087, 9, 0 }, { 20871026, 2087, 10, 0 },
+    { 20871125, 2087, 11, 0 }, { 20871225, 2087, 12, 0 }, { 20880124, 2088, 1, 0 }, { 20880222, 2088, 2, 0 },
+    { 20880323, 2088, 3, 0 }, { 20880421, 2088, 4, 0 }, { 20880521, 2088, 4, 1 }, { 20880619, 2088, 5, 0 },
+    { 20880718, 2088, 6, 0 }, { 20880817, 2088, 7, 0 }, { 20880915, 2088, 8, 0 }, { 20881014, 2088, 9, 0 },
+    { 20881113, 2088, 10, 0 }, { 20881213, 2088, 11, 0 }, { 20890112, 2088, 12, 0 }, { 20890210, 2089, 1, 0 },
+    { 20890312, 2089, 2, 0 }, { 20890411, 2089, 3, 0 }, { 20890510, 2089, 4, 0 }, { 20890609, 2089, 5, 0 },
+    { 20890708, 2089, 6, 0 }, { 20890806, 2089, 7, 0 }, { 20890904, 2089, 8, 0 }, { 20891004, 2089, 9, 0 },
+    { 20891102, 2089, 10, 0 }, { 20891202, 2089, 11, 0 }, { 20900101, 2089, 12, 0 }, { 20900130, 2090, 1, 0 },
+    { 20900301, 2090, 2, 0 }, { 20900331, 2090, 3, 0 }, { 20900430, 2090, 4, 0 }, { 20900529, 2090, 5, 0 },
+    { 20900628, 2090, 6, 0 }, { 20900727, 2090, 7, 0 }, { 20900825, 2090, 8, 0 }, { 20900924, 2090, 8, 1 },
+    { 20901023, 2090, 9, 0 }, { 20901121, 2090, 10, 0 }, { 20901221, 2090, 11, 0 }, { 20910120, 2090, 12, 0 },
+    { 20910218, 2091, 1, 0 }, { 20910320, 2091, 2, 0 }, { 20910419, 2091, 3, 0 }, { 20910518, 2091, 4, 0 },
+    { 20910617, 2091, 5, 0 }, { 20910716, 2091, 6, 0 }, { 20910815, 2091, 7, 0 }, { 20910913, 2091, 8, 0 },
+    { 20911013, 2091, 9, 0 }, { 20911111, 2091, 10, 0 }, { 20911210, 2091, 11, 0 }, { 20920109, 2091, 12, 0 },
+    { 20920207, 2092, 1, 0 }, { 20920308, 2092, 2, 0 }, { 20920407, 2092, 3, 0 }, { 20920506, 2092, 4, 0 },
+    { 20920605, 2092, 5, 0 }, { 20920705, 2092, 6, 0 }, { 20920803, 2092, 7, 0 }, { 20920902, 2092, 8, 0 },
+    { 20921001, 2092, 9, 0 }, { 20921031, 2092, 10, 0 }, { 20921129, 2092, 11, 0 }, { 20921229, 2092, 12, 0 },
+    { 20930127, 2093, 1, 0 }, { 20930225, 2093, 2, 0 }, { 20930327, 2093, 3, 0 }, { 20930426, 2093, 4, 0 },
+    { 20930525, 2093, 5, 0 }, { 20930624, 2093, 6, 0 }, { 20930723, 2093, 6, 1 }, { 20930822, 2093, 7, 0 },
+    { 20930921, 2093, 8, 0 }, { 20931020, 2093, 9, 0 }, { 20931119, 2093, 10, 0 }, { 20931218, 2093, 11, 0 },
+    { 20940117, 2093, 12, 0 }, { 20940215, 2094, 1, 0 }, { 20940316, 2094, 2, 0 }, { 20940415, 2094, 3, 0 },
+    { 20940514, 2094, 4, 0 }, { 20940613, 2094, 5, 0 }, { 20940712, 2094, 6, 0 }, { 20940811, 2094, 7, 0 },
+    { 20940910, 2094, 8, 0 }, { 20941009, 2094, 9, 0 }, { 20941108, 2094, 10, 0 }, { 20941208, 2094, 11, 0 },
+    { 20950106, 2094, 12, 0 }, { 20950205, 2095, 1, 0 }, { 20950306, 2095, 2, 0 }, { 20950405, 2095, 3, 0 },
+    { 20950504, 2095, 4, 0 }, { 20950602, 2095, 5, 0 }, { 20950702, 2095, 6, 0 }, { 20950731, 2095, 7, 0 },
+    { 20950830, 2095, 8, 0 }, { 20950928, 2095, 9, 0 }, { 20951028, 2095, 10, 0 }, { 20951127, 2095, 11, 0 },
+    { 20951227, 2095, 12, 0 }, { 20960125, 2096, 1, 0 }, { 20960224, 2096, 2, 0 }, { 20960324, 2096, 3, 0 },
+    { 20960423, 2096, 4, 0 }, { 20960522, 2096, 4, 1 }, { 20960620, 2096, 5, 0 }, { 20960720, 2096, 6, 0 },
+    { 20960818, 2096, 7, 0 }, { 20960916, 2096, 8, 0 }, { 20961016, 2096, 9, 0 }, { 20961115, 2096, 10, 0 },
+    { 20961215, 2096, 11, 0 }, { 20970113, 2096, 12, 0 }, { 20970212, 2097, 1, 0 }, { 20970314, 2097, 2, 0 },
+    { 20970412, 2097, 3, 0 }, { 20970512, 2097, 4, 0 }, { 20970610, 2097, 5, 0 }, { 20970709, 2097, 6, 0 },
+    { 20970807, 2097, 7, 0 }, { 20970906, 2097, 8, 0 }, { 20971005, 2097, 9, 0 }, { 20971104, 2097, 10, 0 },
+    { 20971204, 2097, 11, 0 }, { 20980102, 2097, 12, 0 }, { 20980201, 2098, 1, 0 }, { 20980303, 2098, 2, 0 },
+    { 20980402, 2098, 3, 0 }, { 20980501, 2098, 4, 0 }, { 20980531, 2098, 5, 0 }, { 20980629, 2098, 6, 0 },
+    { 20980728, 2098, 7, 0 }, { 20980826, 2098, 8, 0 }, { 20980925, 2098, 9, 0 }, { 20981024, 2098, 10, 0 },
+    { 20981123, 2098, 11, 0 }, { 20981222, 2098, 12, 0 }, { 20990121, 2099, 1, 0 }, { 20990220, 2099, 2, 0 },
+    { 20990322, 2099, 2, 1 }, { 20990420, 2099, 3, 0 }, { 20990520, 2099, 4, 0 }, { 20990619, 2099, 5, 0 },
+    { 20990718, 2099, 6, 0 }, { 20990816, 2099, 7, 0 }, { 20990915, 2099, 8, 0 }, { 20991014, 2099, 9, 0 },
+    { 20991112, 2099, 10, 0 }, { 20991212, 2099, 11, 0 }, { 21000110, 2099, 12, 0 }, { 21000209, 2100, 1, 0 },
+    { 21000311, 2100, 2, 0 }, { 21000410, 2100, 3, 0 }, { 21000509, 2100, 4, 0 }, { 21000608, 2100, 5, 0 },
+    { 21000707, 2100, 6, 0 }, { 21000806, 2100, 7, 0 }, { 21000904, 2100, 8, 0 }, { 21001004, 2100, 9, 0 },
+    { 21001102, 2100, 10, 0 }, { 21001201, 2100, 11, 0 }, { 21001231, 2100, 12, 0 },
+};
+
+#define LUNAR_REF_COUNT 2487
+
+#endif
@@ -0,0 +1,222 @@
+/**
+ * @file test_main.cpp
+ * @brief lunar_calendar 主机测试：1900–2100 逐日对照 ICU 参考数据，节气日期与置闰规则
+ */
+#include <unity.h>
+#include <string.h>
+#include "lunar_calendar.h"
+#include "lunar_reference.h"
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+static int64_t daysFromCivil(int y, int m, int d) {
+    y -= m <= 2;
+    int64_t era = (y >= 0 ? y : y - 399) / 400;
+    int64_t yoe = y - era * 400;
+    int64_t doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+static void civilFromDays(int64_t z, int* y, int* m, int* d) {
+    z += 719468;
+    int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+    int64_t doe = z - era * 146097;
+    int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    int64_t mp = (5 * doy + 2) / 153;
+    *d = (int)(doy - (153 * mp + 2) / 5 + 1);
+    *m = (int)(mp < 10 ? mp + 3 : mp - 9);
+    *y = (int)(yoe + era * 400 + (*m <= 2));
+}
+
+static int64_t ymdDays(int32_t ymd) {
+    return daysFromCivil(ymd / 10000, ymd / 100 % 100, ymd % 100);
+}
+
+/*
+ * 与 ICU 不同的 15 个月界：合朔或中气离东八区零点很近，ICU 的近似历表与生成农历表用的
+ * astropy / ERFA 落在零点两侧（本表一律按东八区，1929 年前也不用北京地方时）。
+ * 取值以农历表为准；其中 1954、2027、2030 年春节，1987 年闰六月，2057 年九月初一
+ * 与通行日历一致。每条：ICU 的月首，本表的月首、农历年、月、闰月
+ */
+struct LunarRefFix {
+    int32_t icuStart;
+    LunarRefMonth ours;
+};
+
+static const LunarRefFix ICU_DIFFS[] = {
+    { 19141117, { 19141118, 1914, 10, 0 } },
+    { 19160203, { 19160204, 1916, 1, 0 } },
+    { 19170323, { 19170323, 1917, 2, 1 } },
+    { 19170421, { 19170421, 1917, 3, 0 } },
+    { 19201110, { 19201111, 1920, 10, 0 } },
+    { 19220625, { 19220625, 1922, 5, 1 } },
+    { 19220724, { 19220724, 1922, 6, 0 } },
+    { 19540204, { 19540203, 1954, 1, 0 } },
+    { 19550223, { 19550222, 1955, 2, 0 } },
+    { 19870726, { 19870726, 1987, 6, 1 } },
+    { 19870824, { 19870824, 1987, 7, 0 } },
+    { 19990118, { 19990117, 1998, 12, 0 } },
+    { 20120818, { 20120817, 2012, 7, 0 } },
+    { 20181107, { 20181108, 2018, 10, 0 } },
+    { 20270207, { 20270206, 2027, 1, 0 } },
+    { 20300202, { 20300203, 2030, 1, 0 } },
+    { 20570929, { 20570928, 2057, 9, 0 } },
+    { 20700313, { 20700312, 2070, 2, 0 } },
+};
+#define ICU_DIFF_COUNT  (int)(sizeof(ICU_DIFFS) / sizeof(ICU_DIFFS[0]))
+
+static LunarRefMonth s_months[LUNAR_REF_COUNT];
+
+static void loadReference(void) {
+    memcpy(s_months, LUNAR_REF_MONTHS, sizeof(s_months));
+    int applied = 0;
+    for (int i = 0; i < LUNAR_REF_COUNT; i++) {
+        for (int k = 0; k < ICU_DIFF_COUNT; k++) {
+            if (s_months[i].start != ICU_DIFFS[k].icuStart) continue;
+            s_months[i] = ICU_DIFFS[k].ours;
+            applied++;
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(ICU_DIFF_COUNT, applied);
+}
+
+/* 公历 1900-01-01 .. 2100-12-31 共 73414 天逐日对照 */
+static void test_every_day_matches_reference(void) {
+    loadReference();
+    TEST_ASSERT_EQUAL_INT32(19000101, s_months[0].start);
+    int64_t first = daysFromCivil(1900, 1, 1);
+    int64_t last = daysFromCivil(2100, 12, 31);
+    TEST_ASSERT_EQUAL_INT64(73414, last - first + 1);
+    int idx = 0;
+    int checked = 0;
+    for (int64_t z = first; z <= last; z++) {
+        while (idx + 1 < LUNAR_REF_COUNT && ymdDays(s_months[idx + 1].start) <= z) idx++;
+        const LunarRefMonth* r = &s_months[idx];
+        int y, m, d;
+        civilFromDays(z, &y, &m, &d);
+        LunarDate l;
+        TEST_ASSERT_TRUE(lunarFromSolar(y, m, d, &l));
+        if (l.year != r->year || l.month != r->month || l.leap != (r->leap != 0) ||
+            l.day != (int)(z - ymdDays(r->start)) + 1) {
+            char msg[96];
+            snprintf(msg, sizeof(msg), "%04d-%02d-%02d: got %d-%s%d-%d, reference %d-%s%d-%d", y, m, d, l.year,
+                     l.leap ? "L" : "", l.month, l.day, r->year, r->leap ? "L" : "", r->month,
+                     (int)(z - ymdDays(r->start)) + 1);
+            TEST_FAIL_MESSAGE(msg);
+        }
+        checked++;
+    }
+    TEST_ASSERT_EQUAL_INT(73414, checked);
+}
+
+/* 每个月 29 或 30 天，月份按顺序，闰月紧跟同名月 */
+static void test_reference_month_structure(void) {
+    loadReference();
+    for (int i = 1; i < LUNAR_REF_COUNT; i++) {
+        const LunarRefMonth* a = &s_months[i - 1];
+        const LunarRefMonth* b = &s_months[i];
+        int64_t len = ymdDays(b->start) - ymdDays(a->start);
+        TEST_ASSERT_TRUE(len == 29 || len == 30);
+        if (b->leap) {
+            TEST_ASSERT_EQUAL_INT(a->month, b->month);
+            TEST_ASSERT_FALSE(a->leap);
+        } else {
+            TEST_ASSERT_EQUAL_INT(a->month % 12 + 1, b->month);
+            TEST_ASSERT_EQUAL_INT(b->month == 1 ? a->year + 1 : a->year, b->year);
+        }
+    }
+}
+
+static void test_out_of_range(void) {
+    LunarDate l;
+    TEST_ASSERT_FALSE(lunarFromSolar(1899, 12, 31, &l));
+    TEST_ASSERT_FALSE(lunarFromSolar(2101, 1, 1, &l));
+    TEST_ASSERT_TRUE(lunarFromSolar(1900, 1, 1, &l));
+    TEST_ASSERT_TRUE(lunarFromSolar(2100, 12, 31, &l));
+    TEST_ASSERT_EQUAL_INT(0, solarTermDay(1899, 0));
+    TEST_ASSERT_EQUAL_INT(0, solarTermDay(2101, 0));
+}
+
+/* 通行日历上的节气日期（东八区） */
+static void test_known_solar_terms(void) {
+    TEST_ASSERT_EQUAL_INT(21, solarTermDay(2000, 23));     /* 冬至 */
+    TEST_ASSERT_EQUAL_INT(22, solarTermDay(2023, 23));
+    TEST_ASSERT_EQUAL_INT(4, solarTermDay(2024, 2));       /* 立春 */
+    TEST_ASSERT_EQUAL_INT(4, solarTermDay(2024, 6));       /* 清明 */
+    TEST_ASSERT_EQUAL_INT(21, solarTermDay(2024, 11));     /* 夏至 */
+    TEST_ASSERT_EQUAL_INT(21, solarTermDay(2024, 23));
+    TEST_ASSERT_EQUAL_INT(3, solarTermDay(2025, 2));
+    TEST_ASSERT_EQUAL_INT(21, solarTermDay(2025, 23));
+    TEST_ASSERT_EQUAL_INT(4, solarTermDay(2026, 2));
+    TEST_ASSERT_EQUAL_INT(5, solarTermDay(2026, 6));
+    TEST_ASSERT_EQUAL_INT(22, solarTermDay(2026, 23));
+    TEST_ASSERT_EQUAL_STRING("冬至", solarTermName(23));
+    TEST_ASSERT_EQUAL_STRING("小寒", solarTermName(0));
+}
+
+/* 节在月初（3–9 日），中气在月中后（18–24 日），同年依次递增 */
+static void test_solar_term_ranges(void) {
+    for (int y = 1900; y <= 2100; y++) {
+        for (int k = 0; k < SOLAR_TERM_COUNT; k++) {
+            int d = solarTermDay(y, k);
+            if (k % 2 == 0) {
+                TEST_ASSERT_TRUE(d >= 3 && d <= 9);
+            } else {
+                TEST_ASSERT_TRUE(d >= 18 && d <= 24);
+            }
+        }
+    }
+}
+
+static bool hasMajorTerm(int64_t from, int64_t to) {
+    for (int64_t z = from; z < to; z++) {
+        int y, m, d;
+        civilFromDays(z, &y, &m, &d);
+        if (solarTermDay(y, (m - 1) * 2 + 1) == d) return true;
+    }
+    return false;
+}
+
+/* 置闰规则：闰月不含中气；冬至总在十一月 */
+static void test_leap_and_winter_solstice_rules(void) {
+    loadReference();
+    int leaps = 0;
+    for (int i = 0; i + 1 < LUNAR_REF_COUNT; i++) {
+        const LunarRefMonth* r = &s_months[i];
+        if (r->start < 19000201) continue;
+        if (r->leap) {
+            TEST_ASSERT_FALSE(hasMajorTerm(ymdDays(r->start), ymdDays(s_months[i + 1].start)));
+            leaps++;
+        }
+    }
+    TEST_ASSERT_TRUE(leaps >= 70 && leaps <= 76);              /* 19 年 7 闰 */
+    for (int y = 1900; y <= 2100; y++) {
+        LunarDate l;
+        TEST_ASSERT_TRUE(lunarFromSolar(y, 12, solarTermDay(y, 23), &l));
+        TEST_ASSERT_EQUAL_INT(11, l.month);
+        TEST_ASSERT_FALSE(l.leap);
+    }
+}
+
+static void test_names(void) {
+    TEST_ASSERT_EQUAL_STRING("正月", lunarMonthName(1));
+    TEST_ASSERT_EQUAL_STRING("腊月", lunarMonthName(12));
+    TEST_ASSERT_EQUAL_STRING("初一", lunarDayName(1));
+    TEST_ASSERT_EQUAL_STRING("三十", lunarDayName(30));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_every_day_matches_reference);
+    RUN_TEST(test_reference_month_structure);
+    RUN_TEST(test_out_of_range);
+    RUN_TEST(test_known_solar_terms);
+    RUN_TEST(test_solar_term_ranges);
+    RUN_TEST(test_leap_and_winter_solstice_rules);
+    RUN_TEST(test_names);
+    return UNITY_END();
+}
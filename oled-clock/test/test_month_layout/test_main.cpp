@@ -0,0 +1,103 @@
+/**
+ * @file test_main.cpp
+ * @brief month_layout 主机测试：1900–2100 每月每日与 C 库 mktime 对照星期、天数、行数与格位
+ */
+#include <unity.h>
+#include <stdlib.h>
+#include <time.h>
+#include "month_layout.h"
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+/* C 库换算：UTC 下的 mktime 给出星期，用来对照 */
+static bool libcDate(int year, int month, int day, struct tm* out) {
+    struct tm t = {};
+    t.tm_year = year - 1900;
+    t.tm_mon = month - 1;
+    t.tm_mday = day;
+    t.tm_hour = 12;
+    t.tm_isdst = 0;
+    if (mktime(&t) == (time_t)-1) return false;     /* 正午不会恰好是 -1 */
+    *out = t;
+    return true;
+}
+
+static void test_sweep_against_mktime(void) {
+    setenv("TZ", "UTC0", 1);
+    tzset();
+    int sixRows = 0;
+    for (int y = 1900; y <= 2100; y++) {
+        for (int m = 1; m <= 12; m++) {
+            MonthLayout l = monthLayoutCompute(y, m);
+            TEST_ASSERT_EQUAL_INT(y, l.year);
+            TEST_ASSERT_EQUAL_INT(m, l.month);
+            struct tm t;
+            TEST_ASSERT_TRUE(libcDate(y, m, 1, &t));
+            TEST_ASSERT_EQUAL_INT(t.tm_wday, l.firstWday);
+            /* 天数：下个月 1 日的前一天 */
+            TEST_ASSERT_TRUE(libcDate(y, m, l.days + 1, &t));
+            TEST_ASSERT_EQUAL_INT(1, t.tm_mday);
+            TEST_ASSERT_TRUE(libcDate(y, m, l.days, &t));
+            TEST_ASSERT_EQUAL_INT(l.days, t.tm_mday);
+            int lastRow = 0;
+            for (int d = 1; d <= l.days; d++) {
+                TEST_ASSERT_TRUE(libcDate(y, m, d, &t));
+                int row, col;
+                monthLayoutCell(&l, d, &row, &col);
+                TEST_ASSERT_EQUAL_INT(t.tm_wday, col);
+                TEST_ASSERT_EQUAL_INT(timeDayOfWeek(y, m, d), col);
+                TEST_ASSERT_TRUE(row >= 0 && row < l.rows);
+                lastRow = row;
+            }
+            TEST_ASSERT_EQUAL_INT(l.rows - 1, lastRow);
+            TEST_ASSERT_EQUAL_INT(monthLayoutRows(y, m), l.rows);
+            TEST_ASSERT_TRUE(l.rows >= 4 && l.rows <= 6);
+            if (l.rows == 6) sixRows++;
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(516, sixRows);
+}
+
+/* 只有平年 2 月、1 日是周日时才是 4 行 */
+static void test_four_row_months(void) {
+    for (int y = 1900; y <= 2100; y++) {
+        for (int m = 1; m <= 12; m++) {
+            MonthLayout l = monthLayoutCompute(y, m);
+            bool expect = m == 2 && !timeIsLeapYear(y) && l.firstWday == 0;
+            TEST_ASSERT_EQUAL_INT(expect ? 1 : 0, l.rows == 4 ? 1 : 0);
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(4, monthLayoutCompute(2026, 2).rows);
+    TEST_ASSERT_EQUAL_INT(5, monthLayoutCompute(2032, 2).rows);     /* 闰年 2 月从周日开始 */
+    TEST_ASSERT_FALSE(timeIsLeapYear(1900));
+    TEST_ASSERT_TRUE(timeIsLeapYear(2000));
+    TEST_ASSERT_FALSE(timeIsLeapYear(2100));
+}
+
+static void test_step(void) {
+    int y = 1900, m = 1;
+    for (int i = 0; i < 201 * 12; i++) monthLayoutStep(&y, &m, 1);
+    TEST_ASSERT_EQUAL_INT(2101, y);
+    TEST_ASSERT_EQUAL_INT(1, m);
+    for (int i = 0; i < 201 * 12; i++) monthLayoutStep(&y, &m, -1);
+    TEST_ASSERT_EQUAL_INT(1900, y);
+    TEST_ASSERT_EQUAL_INT(1, m);
+    y = 2026;
+    m = 12;
+    monthLayoutStep(&y, &m, 1);
+    TEST_ASSERT_EQUAL_INT(2027, y);
+    TEST_ASSERT_EQUAL_INT(1, m);
+    monthLayoutStep(&y, &m, -1);
+    TEST_ASSERT_EQUAL_INT(2026, y);
+    TEST_ASSERT_EQUAL_INT(12, m);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_sweep_against_mktime);
+    RUN_TEST(test_four_row_months);
+    RUN_TEST(test_step);
+    return UNITY_END();
+}
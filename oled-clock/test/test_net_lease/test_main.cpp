@@ -0,0 +1,281 @@
+/**
+ * @file test_main.cpp
+ * @brief net_lease 主机测试：假 WiFi 驱动执行租约动作，检查引用计数、超时收回、空闲尾巴、
+ *        掉线与连不上时的退路、策略切换，以及射频开启时间与各任务连接延迟的记账
+ */
+#include <unity.h>
+#include <stdlib.h>
+#include "net_lease.h"
+
+#define TAIL_MS     60000
+#define FRAME_US    10000       /* 每帧调用一次 netLeaseTick */
+#define CONNECT_US  1500000     /* 假驱动：打开射频到拿到地址 */
+
+/* 假驱动：只接受状态机发出的动作，动作与驱动状态不符即判失败；自己记射频开启时间 */
+struct FakeWifi {
+    bool on;
+    bool deep;
+    bool apUp;              /* 路由器在不在 */
+    int64_t linkAtUs;       /* 射频开着、路由器在时，此刻起算连上 */
+    int64_t onSinceUs;
+    uint64_t onUs;
+    int radioOns;
+    int deepSleeps;
+};
+
+static NetLeaseCore s_core;
+static FakeWifi s_wifi;
+static int64_t s_now;
+
+static bool fakeConnected(void) {
+    return s_wifi.on && s_wifi.apUp && s_now >= s_wifi.linkAtUs;
+}
+
+static void fakeApply(NetAction a) {
+    switch (a) {
+        case NET_ACT_RADIO_ON:
+            TEST_ASSERT_FALSE_MESSAGE(s_wifi.on, "radio on while on");
+            s_wifi.on = true;
+            s_wifi.deep = false;
+            s_wifi.linkAtUs = s_now + CONNECT_US;
+            s_wifi.onSinceUs = s_now;
+            s_wifi.radioOns++;
+            break;
+        case NET_ACT_RADIO_OFF:
+            TEST_ASSERT_TRUE_MESSAGE(s_wifi.on, "radio off while off");
+            s_wifi.on = false;
+            s_wifi.deep = false;
+            s_wifi.onUs += (uint64_t)(s_now - s_wifi.onSinceUs);
+            break;
+        case NET_ACT_SLEEP_DEEP:
+            TEST_ASSERT_TRUE_MESSAGE(fakeConnected() && !s_wifi.deep, "deep sleep without link");
+            s_wifi.deep = true;
+            s_wifi.deepSleeps++;
+            break;
+        case NET_ACT_SLEEP_LIGHT:
+            TEST_ASSERT_TRUE_MESSAGE(s_wifi.on && s_wifi.deep, "light sleep while not in deep sleep");
+            s_wifi.deep = false;
+            break;
+        default:
+            break;
+    }
+}
+
+static uint64_t fakeRadioOnUs(void) {
+    return s_wifi.onUs + (s_wifi.on ? (uint64_t)(s_now - s_wifi.onSinceUs) : 0);
+}
+
+static void acquire(NetJob job, uint32_t holdMs) {
+    fakeApply(netLeaseAcquire(&s_core, job, holdMs, s_now));
+}
+
+/* 按帧推进 ms 毫秒；任何时刻有租约就不能关射频 */
+static void runMs(int64_t ms) {
+    int64_t end = s_now + ms * 1000;
+    while (s_now < end) {
+        s_now += FRAME_US;
+        fakeApply(netLeaseTick(&s_core, fakeConnected(), s_now));
+        if (s_core.total > 0) TEST_ASSERT_TRUE(s_wifi.on);
+    }
+}
+
+/* 开机：射频已在连接中，SETUP 租约等连上后释放 */
+static void boot(NetPolicy policy) {
+    s_now = 0;
+    s_wifi = FakeWifi();
+    s_wifi.apUp = true;
+    s_wifi.on = true;
+    s_wifi.linkAtUs = CONNECT_US;
+    s_wifi.radioOns = 1;
+    netLeaseInit(&s_core, policy, TAIL_MS, true, s_now);
+    acquire(NET_JOB_SETUP, 0);
+    runMs(2000);
+    TEST_ASSERT_TRUE(s_core.connected);
+    netLeaseRelease(&s_core, NET_JOB_SETUP, s_now);
+}
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+/* 关射频策略：最后一个租约释放、空闲尾巴过后才关；再申请时重新打开 */
+static void test_radio_off_after_last_release_and_tail(void) {
+    boot(NET_POLICY_RADIO_OFF);
+    runMs(TAIL_MS - 100);
+    TEST_ASSERT_TRUE(s_wifi.on);
+    runMs(200);
+    TEST_ASSERT_FALSE(s_wifi.on);
+    TEST_ASSERT_EQUAL_INT(NET_RADIO_OFF, s_core.radio);
+
+    acquire(NET_JOB_WEATHER, 0);
+    TEST_ASSERT_TRUE(s_wifi.on);
+    acquire(NET_JOB_SNTP, 0);
+    acquire(NET_JOB_SNTP, 0);                    /* 同一任务嵌套申请 */
+    TEST_ASSERT_EQUAL_INT(2, s_wifi.radioOns);
+    TEST_ASSERT_EQUAL_UINT8(3, s_core.total);
+    runMs(2000);
+    netLeaseRelease(&s_core, NET_JOB_WEATHER, s_now);
+    netLeaseRelease(&s_core, NET_JOB_SNTP, s_now);
+    runMs(TAIL_MS * 2);
+    TEST_ASSERT_TRUE(s_wifi.on);                 /* SNTP 还有一个租约 */
+    netLeaseRelease(&s_core, NET_JOB_SNTP, s_now);
+    netLeaseRelease(&s_core, NET_JOB_SNTP, s_now);  /* 多余的释放被忽略 */
+    TEST_ASSERT_EQUAL_UINT8(0, s_core.total);
+    runMs(TAIL_MS + 100);
+    TEST_ASSERT_FALSE(s_wifi.on);
+    TEST_ASSERT_EQUAL_INT(2, s_wifi.radioOns);
+    TEST_ASSERT_EQUAL_UINT32(2, s_core.radioOnCount);
+}
+
+/* 租约有效期：到时未释放的被收回并计数，重复申请取更晚的到期时刻 */
+static void test_lease_expiry_reclaims(void) {
+    boot(NET_POLICY_RADIO_OFF);
+    runMs(TAIL_MS + 100);
+    acquire(NET_JOB_WEATHER, 45000);
+    runMs(30000);
+    acquire(NET_JOB_WEATHER, 45000);             /* 到期顺延到 75 秒 */
+    runMs(40000);
+    TEST_ASSERT_EQUAL_UINT8(2, s_core.held[NET_JOB_WEATHER]);
+    TEST_ASSERT_EQUAL_UINT32(0, s_core.jobs[NET_JOB_WEATHER].expired);
+    runMs(5100);
+    TEST_ASSERT_EQUAL_UINT8(0, s_core.held[NET_JOB_WEATHER]);
+    TEST_ASSERT_EQUAL_UINT8(0, s_core.total);
+    TEST_ASSERT_EQUAL_UINT32(1, s_core.jobs[NET_JOB_WEATHER].expired);
+    TEST_ASSERT_EQUAL_UINT32(2, s_core.jobs[NET_JOB_WEATHER].leases);
+    uint64_t held = netLeaseHeldUs(&s_core, NET_JOB_WEATHER, s_now);
+    TEST_ASSERT_TRUE(held >= 75000000ull && held <= 75000000ull + FRAME_US);
+    netLeaseRelease(&s_core, NET_JOB_WEATHER, s_now);   /* 收回后再释放无影响 */
+    TEST_ASSERT_EQUAL_UINT8(0, s_core.total);
+    runMs(TAIL_MS + 100);
+    TEST_ASSERT_FALSE(s_wifi.on);
+
+    /* 不带有效期的租约不会被收回 */
+    acquire(NET_JOB_WEB, 0);
+    runMs(10 * 60 * 1000);
+    TEST_ASSERT_TRUE(s_wifi.on);
+    TEST_ASSERT_EQUAL_UINT32(0, s_core.jobs[NET_JOB_WEB].expired);
+}
+
+/* 路由器不在：任务一直等；租约到期后射频按尾巴关闭，不会一直开着。路由器恢复后下一个任务正常连上 */
+static void test_unreachable_ap_falls_back_to_off(void) {
+    boot(NET_POLICY_RADIO_OFF);
+    runMs(TAIL_MS + 100);
+    s_wifi.apUp = false;
+    acquire(NET_JOB_SNTP, 30000);
+    runMs(30000 + TAIL_MS + 100);
+    TEST_ASSERT_FALSE(s_wifi.on);
+    TEST_ASSERT_EQUAL_UINT32(1, s_core.jobs[NET_JOB_SNTP].expired);
+    TEST_ASSERT_EQUAL_UINT32(0, s_core.jobs[NET_JOB_SNTP].waits);   /* 没连上，不计连接延迟 */
+    TEST_ASSERT_EQUAL_INT64(0, s_core.waitSinceUs[NET_JOB_SNTP]);
+
+    s_wifi.apUp = true;
+    acquire(NET_JOB_SNTP, 30000);
+    runMs(2000);
+    TEST_ASSERT_TRUE(s_core.connected);
+    TEST_ASSERT_EQUAL_UINT32(1, s_core.jobs[NET_JOB_SNTP].waits);
+    TEST_ASSERT_TRUE(s_core.jobs[NET_JOB_SNTP].lastConnectMs >= CONNECT_US / 1000 &&
+                     s_core.jobs[NET_JOB_SNTP].lastConnectMs <= CONNECT_US / 1000 + 10);
+}
+
+/* 持有租约时掉线：驱动自动重连，持有的任务重新计等待时间 */
+static void test_link_drop_while_held(void) {
+    boot(NET_POLICY_RADIO_OFF);
+    acquire(NET_JOB_WEATHER, 0);
+    TEST_ASSERT_EQUAL_INT64(0, s_core.waitSinceUs[NET_JOB_WEATHER]);  /* 已连着，不用等 */
+    runMs(1000);
+    s_wifi.apUp = false;
+    runMs(100);
+    TEST_ASSERT_FALSE(s_core.connected);
+    TEST_ASSERT_EQUAL_INT(NET_RADIO_CONNECTING, s_core.radio);
+    TEST_ASSERT_TRUE(s_core.waitSinceUs[NET_JOB_WEATHER] != 0);
+    TEST_ASSERT_EQUAL_INT64(0, s_core.waitSinceUs[NET_JOB_SNTP]);      /* 没持有的任务不等 */
+    runMs(4000);
+    s_wifi.apUp = true;
+    runMs(100);
+    TEST_ASSERT_TRUE(s_core.connected);
+    TEST_ASSERT_EQUAL_INT(NET_RADIO_UP, s_core.radio);
+    TEST_ASSERT_EQUAL_UINT32(1, s_core.jobs[NET_JOB_WEATHER].waits);
+    TEST_ASSERT_TRUE(s_core.jobs[NET_JOB_WEATHER].lastConnectMs >= 4000);
+    TEST_ASSERT_EQUAL_INT(1, s_wifi.radioOns);                          /* 掉线不关射频 */
+}
+
+/* modem sleep 策略：空闲尾巴后切深度睡眠，有新租约时恢复；射频始终开着 */
+static void test_modem_sleep_policy(void) {
+    boot(NET_POLICY_MODEM_SLEEP);
+    runMs(TAIL_MS + 100);
+    TEST_ASSERT_TRUE(s_wifi.on);
+    TEST_ASSERT_TRUE(s_wifi.deep);
+    acquire(NET_JOB_SNTP, 0);
+    TEST_ASSERT_FALSE(s_wifi.deep);
+    netLeaseRelease(&s_core, NET_JOB_SNTP, s_now);
+    runMs(TAIL_MS / 2);
+    netLeaseTouch(&s_core, s_now);               /* Web 请求顺延尾巴 */
+    runMs(TAIL_MS - 100);
+    TEST_ASSERT_FALSE(s_wifi.deep);
+    runMs(200);
+    TEST_ASSERT_TRUE(s_wifi.deep);
+    TEST_ASSERT_EQUAL_INT(2, s_wifi.deepSleeps);
+    TEST_ASSERT_EQUAL_INT(1, s_wifi.radioOns);
+}
+
+/* 切换策略：关射频后改回常开，下一帧重新打开；关着时 touch 不打开射频 */
+static void test_policy_switch_restores_radio(void) {
+    boot(NET_POLICY_RADIO_OFF);
+    runMs(TAIL_MS + 100);
+    TEST_ASSERT_FALSE(s_wifi.on);
+    netLeaseTouch(&s_core, s_now);
+    runMs(1000);
+    TEST_ASSERT_FALSE(s_wifi.on);
+    netLeaseSetPolicy(&s_core, NET_POLICY_ALWAYS_ON);
+    runMs(2000);
+    TEST_ASSERT_TRUE(s_wifi.on);
+    TEST_ASSERT_TRUE(s_core.connected);
+    runMs(TAIL_MS * 3);
+    TEST_ASSERT_TRUE(s_wifi.on);
+    TEST_ASSERT_FALSE(s_wifi.deep);
+    /* 深度睡眠中改成常开：恢复默认省电等级 */
+    netLeaseSetPolicy(&s_core, NET_POLICY_MODEM_SLEEP);
+    runMs(100);
+    TEST_ASSERT_TRUE(s_wifi.deep);
+    netLeaseSetPolicy(&s_core, NET_POLICY_ALWAYS_ON);
+    runMs(100);
+    TEST_ASSERT_FALSE(s_wifi.deep);
+}
+
+/* 回放随机的一天：射频开启时间与假驱动自己记的一致，持有时间不超过总时长 */
+static void test_random_day_accounting(void) {
+    srand(41);
+    boot(NET_POLICY_RADIO_OFF);
+    int64_t day = 24LL * 3600 * 1000000;
+    while (s_now < day) {
+        int r = rand() % 100;
+        NetJob job = (NetJob)(1 + rand() % (NET_JOB_COUNT - 1));
+        if (r < 20) acquire(job, (uint32_t)(rand() % 2) * 45000);
+        else if (r < 50) netLeaseRelease(&s_core, job, s_now);
+        else if (r < 60) netLeaseTouch(&s_core, s_now);
+        else if (r < 65) s_wifi.apUp = !s_wifi.apUp;
+        else if (r < 67) netLeaseSetPolicy(&s_core, (NetPolicy)(rand() % NET_POLICY_COUNT));
+        runMs(1 + rand() % 40000);
+        TEST_ASSERT_EQUAL_UINT64(fakeRadioOnUs(), netLeaseRadioOnUs(&s_core, s_now));
+        TEST_ASSERT_EQUAL_UINT32((uint32_t)s_wifi.radioOns, s_core.radioOnCount);
+        TEST_ASSERT_EQUAL(s_wifi.on, s_core.radio != NET_RADIO_OFF);
+    }
+    for (int j = 0; j < NET_JOB_COUNT; j++) {
+        TEST_ASSERT_TRUE(netLeaseHeldUs(&s_core, (NetJob)j, s_now) <= (uint64_t)s_now);
+        const NetJobStats* s = &s_core.jobs[j];
+        if (s->waits > 0) TEST_ASSERT_TRUE(s->lastConnectMs <= s->maxConnectMs && s->sumConnectMs >= s->maxConnectMs);
+    }
+    TEST_ASSERT_TRUE(s_wifi.radioOns > 10);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_radio_off_after_last_release_and_tail);
+    RUN_TEST(test_lease_expiry_reclaims);
+    RUN_TEST(test_unreachable_ap_falls_back_to_off);
+    RUN_TEST(test_link_drop_while_held);
+    RUN_TEST(test_modem_sleep_policy);
+    RUN_TEST(test_policy_switch_restores_radio);
+    RUN_TEST(test_random_day_accounting);
+    return UNITY_END();
+}
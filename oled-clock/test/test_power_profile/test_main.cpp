@@ -0,0 +1,222 @@
+/**
+ * @file test_main.cpp
+ * @brief power_profile 主机测试：回放放电 / 充电曲线（含 ADC 噪声与发射跌落），检查电量滞回的切换点、
+ *        不来回跳，以及按键升档、联网下限与固定档位
+ */
+#include <unity.h>
+#include <string.h>
+#include "power_profile.h"
+
+#define SAMPLE_S     10         /* 与 GOVERNOR_SAMPLE_MS 相同的采样间隔 */
+#define NOISE_PCT    2          /* ADC 读数噪声，小于滞回宽度（5%） */
+
+/* 曲线上的点：时刻（分钟）与真实电量（%），之间线性插值 */
+struct CurvePoint {
+    int minute;
+    int pct;
+};
+
+/* 典型锂电放电：满电后快速降到平台，平台缓降，末端陡降 */
+static const CurvePoint DISCHARGE[] = {
+    { 0, 100 }, { 30, 92 }, { 120, 80 }, { 600, 40 }, { 780, 30 }, { 900, 22 }, { 1000, 10 }, { 1060, 0 },
+};
+/* 在低电量阈值附近停留几个小时（平台很平） */
+static const CurvePoint PLATEAU[] = {
+    { 0, 40 }, { 60, 31 }, { 300, 29 }, { 360, 27 }, { 420, 20 },
+};
+/* 从极低电量充满 */
+static const CurvePoint CHARGE[] = {
+    { 0, 4 }, { 20, 12 }, { 60, 30 }, { 120, 60 }, { 180, 90 }, { 240, 100 },
+};
+#define CURVE_LEN(c)  (int)(sizeof(c) / sizeof(c[0]))
+
+static uint32_t s_rng;
+
+static int curveAt(const CurvePoint* c, int n, int sec) {
+    for (int i = 1; i < n; i++) {
+        if (sec <= c[i].minute * 60) {
+            int t0 = c[i - 1].minute * 60, t1 = c[i].minute * 60;
+            return c[i - 1].pct + (c[i].pct - c[i - 1].pct) * (sec - t0) / (t1 - t0);
+        }
+    }
+    return c[n - 1].pct;
+}
+
+static int noisy(int pct) {
+    s_rng = s_rng * 1664525u + 1013904223u;
+    int p = pct + (int)(s_rng >> 16) % (2 * NOISE_PCT + 1) - NOISE_PCT;
+    return p < 0 ? 0 : p > 100 ? 100 : p;
+}
+
+/* 一次回放的结果：各级别的进入时刻（真实电量），级别变化次数 */
+struct Replay {
+    int levelChanges;
+    int enterPct[3];            /* 进入该级别时的真实电量，-1 表示没进入 */
+    uint32_t switches;
+    PowerProfile last;
+};
+
+static Replay replay(const CurvePoint* c, int n, int startPct) {
+    Replay r;
+    memset(&r, 0, sizeof(r));
+    for (int i = 0; i < 3; i++) r.enterPct[i] = -1;
+    PowerGovernorCore g;
+    powerGovernorInit(&g, startPct);
+    uint8_t level = g.level;
+    r.enterPct[level] = startPct;
+    int end = c[n - 1].minute * 60;
+    for (int sec = 0; sec <= end; sec += SAMPLE_S) {
+        int truth = curveAt(c, n, sec);
+        r.last = powerGovernorSelect(&g, noisy(truth), 600000);     /* 一直没人按键 */
+        if (g.level != level) {
+            level = g.level;
+            r.levelChanges++;
+            r.enterPct[level] = truth;
+        }
+    }
+    r.switches = g.switches;
+    return r;
+}
+
+void setUp(void) {
+    s_rng = 43;
+}
+
+void tearDown(void) {}
+
+/* 放电一次：高 → 低 → 极低各一次，切换点在阈值 ± 噪声内 */
+static void test_discharge_switch_points(void) {
+    for (uint32_t seed = 1; seed <= 50; seed++) {
+        s_rng = seed;
+        Replay r = replay(DISCHARGE, CURVE_LEN(DISCHARGE), 100);
+        TEST_ASSERT_EQUAL_INT(2, r.levelChanges);
+        TEST_ASSERT_TRUE(r.enterPct[BATTERY_LEVEL_LOW] >= GOVERNOR_LOW_ENTER_PCT - 1 - NOISE_PCT &&
+                         r.enterPct[BATTERY_LEVEL_LOW] <= GOVERNOR_LOW_ENTER_PCT - 1 + NOISE_PCT);
+        TEST_ASSERT_TRUE(r.enterPct[BATTERY_LEVEL_CRITICAL] >= GOVERNOR_CRIT_ENTER_PCT - 1 - NOISE_PCT &&
+                         r.enterPct[BATTERY_LEVEL_CRITICAL] <= GOVERNOR_CRIT_ENTER_PCT - 1 + NOISE_PCT);
+        /* 开机在用档 → 空闲 balanced → saver → critical */
+        TEST_ASSERT_EQUAL_UINT32(3, r.switches);
+        TEST_ASSERT_EQUAL_INT(POWER_PROFILE_CRITICAL, r.last);
+    }
+}
+
+/* 在阈值附近停留几个小时：噪声不让级别来回跳 */
+static void test_plateau_no_chatter(void) {
+    for (uint32_t seed = 1; seed <= 50; seed++) {
+        s_rng = seed;
+        Replay r = replay(PLATEAU, CURVE_LEN(PLATEAU), 40);
+        TEST_ASSERT_EQUAL_INT(1, r.levelChanges);
+        TEST_ASSERT_EQUAL_INT(POWER_PROFILE_SAVER, r.last);
+    }
+}
+
+/* 没有滞回（进入与退出同一阈值）时同一条曲线会来回跳，说明曲线确实压在阈值上 */
+static void test_plateau_chatters_without_hysteresis(void) {
+    int flips = 0;
+    bool low = false;
+    for (int sec = 0; sec <= PLATEAU[CURVE_LEN(PLATEAU) - 1].minute * 60; sec += SAMPLE_S) {
+        bool now = noisy(curveAt(PLATEAU, CURVE_LEN(PLATEAU), sec)) < GOVERNOR_LOW_ENTER_PCT;
+        if (now != low) flips++;
+        low = now;
+    }
+    TEST_ASSERT_TRUE(flips > 20);
+}
+
+/* 充电：在退出阈值（而不是进入阈值）处回到上一级 */
+static void test_charge_exits_at_exit_thresholds(void) {
+    for (uint32_t seed = 1; seed <= 50; seed++) {
+        s_rng = seed;
+        Replay r = replay(CHARGE, CURVE_LEN(CHARGE), 4);
+        TEST_ASSERT_EQUAL_INT(2, r.levelChanges);
+        TEST_ASSERT_TRUE(r.enterPct[BATTERY_LEVEL_LOW] >= GOVERNOR_CRIT_EXIT_PCT - NOISE_PCT &&
+                         r.enterPct[BATTERY_LEVEL_LOW] <= GOVERNOR_CRIT_EXIT_PCT + NOISE_PCT);
+        TEST_ASSERT_TRUE(r.enterPct[BATTERY_LEVEL_HIGH] >= GOVERNOR_LOW_EXIT_PCT - NOISE_PCT &&
+                         r.enterPct[BATTERY_LEVEL_HIGH] <= GOVERNOR_LOW_EXIT_PCT + NOISE_PCT);
+        TEST_ASSERT_EQUAL_INT(POWER_PROFILE_BALANCED, r.last);
+    }
+}
+
+/*
+ * WiFi 发射时电压跌落：每 10 分钟有一个采样低 8%。设备上 power_governor 对采样做 ×16 定点、
+ * 收敛 1/4 的指数平均（此处照抄），跌落只让平均值下降 2%，停在滞回带内不降级
+ */
+static void test_tx_sag_is_absorbed_by_smoothing(void) {
+    PowerGovernorCore raw, smooth;
+    powerGovernorInit(&raw, 40);
+    powerGovernorInit(&smooth, 40);
+    int32_t fix = 34 << 4;
+    int rawChanges = 0;
+    uint8_t rawLevel = raw.level;
+    for (int sec = 0; sec < 6 * 3600; sec += SAMPLE_S) {
+        int pct = sec % 600 == 0 ? 34 - 8 : 34;
+        fix += ((pct << 4) - fix) >> 2;
+        powerGovernorSelect(&raw, pct, 600000);
+        powerGovernorSelect(&smooth, (int)((fix + 8) >> 4), 600000);
+        if (raw.level != rawLevel) rawChanges++;
+        rawLevel = raw.level;
+        TEST_ASSERT_EQUAL_INT(BATTERY_LEVEL_HIGH, smooth.level);
+    }
+    TEST_ASSERT_TRUE(rawChanges > 0);       /* 不平滑时第一个跌落就会降级 */
+}
+
+/* 按键升一档，空闲 GOVERNOR_ACTIVE_MS 后回落；联网下限不随按键放宽 */
+static void test_activity_boost_and_net_floor(void) {
+    PowerGovernorCore g;
+    powerGovernorInit(&g, 25);
+    TEST_ASSERT_EQUAL_INT(BATTERY_LEVEL_LOW, g.level);
+    TEST_ASSERT_EQUAL_INT(POWER_PROFILE_BALANCED, powerGovernorSelect(&g, 25, 0));
+    TEST_ASSERT_EQUAL_INT(POWER_PROFILE_BALANCED, powerGovernorSelect(&g, 25, GOVERNOR_ACTIVE_MS - 1));
+    TEST_ASSERT_EQUAL_INT(1, powerGovernorNetFloor(&g));
+    TEST_ASSERT_EQUAL_INT(POWER_PROFILE_SAVER, powerGovernorSelect(&g, 25, GOVERNOR_ACTIVE_MS));
+    TEST_ASSERT_EQUAL_INT(1, powerGovernorNetFloor(&g));
+    TEST_ASSERT_EQUAL_INT(POWER_PROFILE_SAVER, powerGovernorSelect(&g, 5, 0));
+    TEST_ASSERT_EQUAL_INT(2, powerGovernorNetFloor(&g));
+    TEST_ASSERT_EQUAL_INT(POWER_PROFILE_PERFORMANCE, powerGovernorSelect(&g, 80, 0));
+    TEST_ASSERT_EQUAL_INT(-1, powerGovernorNetFloor(&g));
+}
+
+/* 电量未知保持原级别；固定档位不受电量与按键影响 */
+static void test_unknown_battery_and_forced(void) {
+    PowerGovernorCore g;
+    powerGovernorInit(&g, -1);
+    TEST_ASSERT_EQUAL_INT(BATTERY_LEVEL_HIGH, g.level);
+    powerGovernorSelect(&g, 5, 600000);
+    TEST_ASSERT_EQUAL_INT(BATTERY_LEVEL_CRITICAL, g.level);
+    powerGovernorSelect(&g, -1, 600000);
+    TEST_ASSERT_EQUAL_INT(BATTERY_LEVEL_CRITICAL, g.level);
+    g.forced = POWER_PROFILE_PERFORMANCE;
+    TEST_ASSERT_EQUAL_INT(POWER_PROFILE_PERFORMANCE, powerGovernorSelect(&g, 5, 600000));
+    TEST_ASSERT_EQUAL_INT(-1, powerGovernorNetFloor(&g));
+    uint32_t switches = g.switches;
+    for (int i = 0; i < 100; i++) powerGovernorSelect(&g, i % 2 ? 5 : 90, (uint32_t)i * 1000);
+    TEST_ASSERT_EQUAL_UINT32(switches, g.switches);
+}
+
+static void test_spec_lookup(void) {
+    for (int i = 0; i < POWER_PROFILE_COUNT; i++)
+        TEST_ASSERT_EQUAL_INT(i, powerProfileFind(powerProfileSpec((PowerProfile)i)->name));
+    TEST_ASSERT_EQUAL_INT(-1, powerProfileFind("turbo"));
+    TEST_ASSERT_EQUAL_STRING("performance", powerProfileSpec((PowerProfile)99)->name);
+    /* 越省电的档位帧间隔越长、亮度越低、天气刷新越慢 */
+    for (int i = 1; i < POWER_PROFILE_COUNT; i++) {
+        const PowerProfileSpec* a = powerProfileSpec((PowerProfile)(i - 1));
+        const PowerProfileSpec* b = powerProfileSpec((PowerProfile)i);
+        TEST_ASSERT_TRUE(b->frameMinMs > a->frameMinMs);
+        TEST_ASSERT_TRUE(b->contrast < a->contrast);
+        TEST_ASSERT_TRUE(b->weatherRefreshMs > a->weatherRefreshMs);
+        TEST_ASSERT_TRUE(b->netPolicyFloor >= a->netPolicyFloor);
+    }
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_discharge_switch_points);
+    RUN_TEST(test_plateau_no_chatter);
+    RUN_TEST(test_plateau_chatters_without_hysteresis);
+    RUN_TEST(test_charge_exits_at_exit_thresholds);
+    RUN_TEST(test_tx_sag_is_absorbed_by_smoothing);
+    RUN_TEST(test_activity_boost_and_net_floor);
+    RUN_TEST(test_unknown_battery_and_forced);
+    RUN_TEST(test_spec_lookup);
+    return UNITY_END();
+}
@@ -0,0 +1,166 @@
+/**
+ * @file test_main.cpp
+ * @brief seqlock 主机压力测试：写者线程发布自校验图样，读者线程逐个校验快照（撕裂读检测）
+ */
+#include <unity.h>
+#include <stdint.h>
+#include <thread>
+#include <vector>
+#include "seqlock.h"
+
+#define STRESS_READERS   3
+#define STRESS_WRITES    200000
+#define PATTERN_WORDS    30          /* 比实际状态块（几十字节）大，拷贝窗口更长 */
+
+/* 每个字都由序号推出，末尾再带一个整体校验：任何两次写入拼在一起都能发现 */
+struct Pattern {
+    uint32_t seq;
+    uint32_t words[PATTERN_WORDS];
+    uint32_t check;
+};
+
+static uint32_t wordAt(uint32_t seq, int i) {
+    return seq * 2654435761u ^ (uint32_t)(i * 40503);
+}
+
+static uint32_t patternCheck(const Pattern& p) {
+    uint32_t h = 2166136261u ^ p.seq;
+    for (int i = 0; i < PATTERN_WORDS; i++) h = (h ^ p.words[i]) * 16777619u;
+    return h;
+}
+
+static void makePattern(uint32_t seq, Pattern* p) {
+    p->seq = seq;
+    for (int i = 0; i < PATTERN_WORDS; i++) p->words[i] = wordAt(seq, i);
+    p->check = patternCheck(*p);
+}
+
+static bool patternOk(const Pattern& p) {
+    for (int i = 0; i < PATTERN_WORDS; i++)
+        if (p.words[i] != wordAt(p.seq, i)) return false;
+    return p.check == patternCheck(p);
+}
+
+static volatile bool s_done;
+
+void setUp(void) {
+    s_done = false;
+}
+
+void tearDown(void) {}
+
+struct ReaderResult {
+    uint32_t reads;
+    uint32_t torn;
+    uint32_t backwards;     /* 读到比上一次更旧的序号 */
+    uint32_t lastSeq;
+};
+
+static void readerLoop(const SeqBlock<Pattern>* block, ReaderResult* r) {
+    Pattern p;
+    uint32_t prev = 0;
+    bool last;
+    do {
+        last = __atomic_load_n(&s_done, __ATOMIC_ACQUIRE);     /* 写者结束后再读最后一次 */
+        block->read(&p);
+        r->reads++;
+        if (!patternOk(p)) r->torn++;
+        if (p.seq < prev) r->backwards++;
+        prev = p.seq;
+    } while (!last);
+    r->lastSeq = prev;
+}
+
+/* 单写者整块发布 */
+static void test_publish_no_torn_reads(void) {
+    Pattern init;
+    makePattern(0, &init);
+    static SeqBlock<Pattern> block(init);
+    ReaderResult res[STRESS_READERS] = {};
+    std::vector<std::thread> readers;
+    for (int i = 0; i < STRESS_READERS; i++) readers.push_back(std::thread(readerLoop, &block, &res[i]));
+    Pattern p;
+    for (uint32_t seq = 1; seq <= STRESS_WRITES; seq++) {
+        makePattern(seq, &p);
+        block.publish(p);
+    }
+    __atomic_store_n(&s_done, true, __ATOMIC_RELEASE);
+    for (size_t i = 0; i < readers.size(); i++) readers[i].join();
+    for (int i = 0; i < STRESS_READERS; i++) {
+        TEST_ASSERT_TRUE(res[i].reads > 0);
+        TEST_ASSERT_EQUAL_UINT32(0, res[i].torn);
+        TEST_ASSERT_EQUAL_UINT32(0, res[i].backwards);
+        TEST_ASSERT_EQUAL_UINT32(STRESS_WRITES, res[i].lastSeq);
+    }
+    TEST_ASSERT_EQUAL_UINT32(STRESS_WRITES, block.version());
+    TEST_ASSERT_TRUE(patternOk(block.get()));
+}
+
+/* 两个写者用 SeqWrite 原地改（读改写）：互斥使每次写入都基于上一次，总数不丢 */
+static void writerLoop(SeqBlock<Pattern>* block, int writes) {
+    for (int n = 0; n < writes; n++) {
+        SeqWrite<Pattern> w(*block);
+        makePattern(w->seq + 1, &*w);
+    }
+}
+
+static void test_concurrent_writers_in_place(void) {
+    static SeqBlock<Pattern> block;
+    {
+        SeqWrite<Pattern> w(block);
+        makePattern(0, &*w);
+    }
+    ReaderResult res[STRESS_READERS] = {};
+    std::vector<std::thread> readers;
+    for (int i = 0; i < STRESS_READERS; i++) readers.push_back(std::thread(readerLoop, &block, &res[i]));
+    std::thread w1(writerLoop, &block, STRESS_WRITES / 2);
+    std::thread w2(writerLoop, &block, STRESS_WRITES / 2);
+    w1.join();
+    w2.join();
+    __atomic_store_n(&s_done, true, __ATOMIC_RELEASE);
+    for (size_t i = 0; i < readers.size(); i++) readers[i].join();
+    for (int i = 0; i < STRESS_READERS; i++) {
+        TEST_ASSERT_EQUAL_UINT32(0, res[i].torn);
+        TEST_ASSERT_EQUAL_UINT32(0, res[i].backwards);
+    }
+    Pattern last = block.get();
+    TEST_ASSERT_TRUE(patternOk(last));
+    TEST_ASSERT_EQUAL_UINT32(STRESS_WRITES, last.seq);
+    TEST_ASSERT_EQUAL_UINT32(STRESS_WRITES + 1, block.version());
+}
+
+/* view 只取两个字段：两者来自同一次写入 */
+static void viewLoop(const SeqBlock<Pattern>* block, ReaderResult* r) {
+    do {
+        uint64_t pair = block->view<uint64_t>([](const Pattern& p) {
+            return ((uint64_t)p.seq << 32) | p.words[PATTERN_WORDS - 1];
+        });
+        uint32_t seq = (uint32_t)(pair >> 32);
+        r->reads++;
+        if ((uint32_t)pair != wordAt(seq, PATTERN_WORDS - 1)) r->torn++;
+    } while (!__atomic_load_n(&s_done, __ATOMIC_ACQUIRE));
+}
+
+static void test_view_no_torn_fields(void) {
+    Pattern init;
+    makePattern(0, &init);
+    static SeqBlock<Pattern> block(init);
+    ReaderResult res[STRESS_READERS] = {};
+    std::vector<std::thread> readers;
+    for (int i = 0; i < STRESS_READERS; i++) readers.push_back(std::thread(viewLoop, &block, &res[i]));
+    writerLoop(&block, STRESS_WRITES);
+    __atomic_store_n(&s_done, true, __ATOMIC_RELEASE);
+    for (size_t i = 0; i < readers.size(); i++) readers[i].join();
+    for (int i = 0; i < STRESS_READERS; i++) {
+        TEST_ASSERT_TRUE(res[i].reads > 0);
+        TEST_ASSERT_EQUAL_UINT32(0, res[i].torn);
+    }
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_publish_no_torn_reads);
+    RUN_TEST(test_concurrent_writers_in_place);
+    RUN_TEST(test_view_no_torn_fields);
+    return UNITY_END();
+}
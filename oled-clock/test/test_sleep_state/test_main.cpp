@@ -0,0 +1,180 @@
+/**
+ * @file test_main.cpp
+ * @brief sleep_state 主机测试：魔数与校验、旧布局 / 随机 RTC 内容拒绝、重画掩码、到整分的睡眠时长
+ */
+#include <unity.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include "sleep_state.h"
+
+static SleepState s;
+
+void setUp(void) {
+    sleepStateBegin(&s, 3, 1700000000LL * 1000000, 1700003600, 2);
+}
+
+void tearDown(void) {}
+
+static void test_begin_is_valid(void) {
+    TEST_ASSERT_TRUE(sleepStateValid(&s));
+    TEST_ASSERT_EQUAL_UINT32(SLEEP_STATE_MAGIC, s.magic);
+    TEST_ASSERT_EQUAL_UINT8(1, s.active);
+    TEST_ASSERT_EQUAL_UINT8(3, s.zone);
+    TEST_ASSERT_EQUAL_INT(2, s.alarmIndex);
+    for (int i = 0; i < 4; i++) TEST_ASSERT_EQUAL_UINT8(SLEEP_DIGIT_UNKNOWN, s.shown[i]);
+}
+
+/* 校验覆盖 check 之前的每个字节：任意一位翻转都失效，重新 Seal 后恢复 */
+static void test_any_bit_flip_invalidates(void) {
+    uint8_t* p = (uint8_t*)&s;
+    for (size_t i = 0; i < offsetof(SleepState, check); i++) {
+        for (int bit = 0; bit < 8; bit++) {
+            p[i] ^= (uint8_t)(1u << bit);
+            TEST_ASSERT_FALSE(sleepStateValid(&s));
+            p[i] ^= (uint8_t)(1u << bit);
+        }
+    }
+    TEST_ASSERT_TRUE(sleepStateValid(&s));
+    s.check ^= 1;
+    TEST_ASSERT_FALSE(sleepStateValid(&s));
+    sleepStateSeal(&s);
+    TEST_ASSERT_TRUE(sleepStateValid(&s));
+}
+
+/* 魔数不对即使校验自洽也无效 */
+static void test_wrong_magic(void) {
+    s.magic = 0x534C4551u;
+    sleepStateSeal(&s);
+    TEST_ASSERT_FALSE(sleepStateValid(&s));
+}
+
+/* 上电后的随机 RTC 内容 */
+static void test_random_rtc_content(void) {
+    srand(11);
+    for (int round = 0; round < 10000; round++) {
+        uint8_t* p = (uint8_t*)&s;
+        for (size_t i = 0; i < sizeof(s); i++) p[i] = (uint8_t)rand();
+        if (round % 2) s.magic = SLEEP_STATE_MAGIC;     /* 魔数碰巧对上 */
+        TEST_ASSERT_FALSE(sleepStateValid(&s));
+    }
+}
+
+/*
+ * 旧固件的布局：魔数相同，字段更少、校验在更靠前的位置（按同样的 FNV-1a 计算）。
+ * 新固件在它的 check 位置读到的是旧记录的其他字节，不会误认为有效
+ */
+struct OldSleepState {
+    uint32_t magic;
+    uint8_t active;
+    uint8_t zone;
+    uint8_t shown[4];
+    int64_t enteredUs;
+    uint32_t wakes;
+    uint32_t check;
+};
+
+static void test_stale_layout_rejected(void) {
+    OldSleepState old;
+    memset(&old, 0, sizeof(old));
+    old.magic = SLEEP_STATE_MAGIC;
+    old.active = 1;
+    old.zone = 3;
+    memset(old.shown, 1, sizeof(old.shown));
+    old.enteredUs = 1700000000LL * 1000000;
+    old.wakes = 42;
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < offsetof(OldSleepState, check); i++) {
+        h ^= ((const uint8_t*)&old)[i];
+        h *= 16777619u;
+    }
+    old.check = h;
+    memset(&s, 0, sizeof(s));
+    memcpy(&s, &old, sizeof(old));
+    TEST_ASSERT_FALSE(sleepStateValid(&s));
+    /* 旧记录之后残留的 RTC 内容也不影响结论 */
+    memset((uint8_t*)&s + sizeof(old), 0xA5, sizeof(s) - sizeof(old));
+    TEST_ASSERT_FALSE(sleepStateValid(&s));
+}
+
+static void test_updates_keep_valid(void) {
+    uint8_t d[4];
+    sleepStateDigits(7, 5, d);
+    sleepStateCommit(&s, d);
+    TEST_ASSERT_TRUE(sleepStateValid(&s));
+    sleepStateRecordWake(&s, 3000, 5000);
+    sleepStateRecordWake(&s, 8000, 5000);
+    TEST_ASSERT_TRUE(sleepStateValid(&s));
+    TEST_ASSERT_EQUAL_UINT32(2, s.wakes);
+    TEST_ASSERT_EQUAL_UINT32(8000, s.maxAwakeUs);
+    TEST_ASSERT_EQUAL_UINT32(8000, s.lastAwakeUs);
+    TEST_ASSERT_EQUAL_UINT32(1, s.overBudget);
+    TEST_ASSERT_EQUAL_UINT64(11000, s.totalAwakeUs);
+    sleepStateEnd(&s, SLEEP_EXIT_BUTTON);
+    TEST_ASSERT_TRUE(sleepStateValid(&s));
+    TEST_ASSERT_EQUAL_UINT8(0, s.active);
+    TEST_ASSERT_EQUAL_UINT8(SLEEP_EXIT_BUTTON, s.wakeReason);
+}
+
+static void test_dirty_mask(void) {
+    uint8_t d[4];
+    sleepStateDigits(12, 59, d);
+    TEST_ASSERT_EQUAL_UINT8(1, d[0]);
+    TEST_ASSERT_EQUAL_UINT8(2, d[1]);
+    TEST_ASSERT_EQUAL_UINT8(5, d[2]);
+    TEST_ASSERT_EQUAL_UINT8(9, d[3]);
+    TEST_ASSERT_EQUAL_HEX8(0x0F, sleepStateDirtyMask(&s, d));      /* 刚进入：全部未知 */
+    sleepStateCommit(&s, d);
+    TEST_ASSERT_EQUAL_HEX8(0x00, sleepStateDirtyMask(&s, d));
+    sleepStateDigits(13, 0, d);
+    TEST_ASSERT_EQUAL_HEX8(0x0E, sleepStateDirtyMask(&s, d));      /* 12:59 → 13:00 */
+    sleepStateCommit(&s, d);
+    sleepStateDigits(13, 1, d);
+    TEST_ASSERT_EQUAL_HEX8(0x08, sleepStateDirtyMask(&s, d));      /* 只变个位 */
+    sleepStateCommit(&s, d);
+    sleepStateDigits(23, 59, d);
+    sleepStateCommit(&s, d);
+    sleepStateDigits(0, 0, d);
+    TEST_ASSERT_EQUAL_HEX8(0x0F, sleepStateDirtyMask(&s, d));      /* 跨日 */
+}
+
+static void test_us_to_next_minute(void) {
+    const int64_t minute = 60000000;
+    int64_t base = 1700000000LL / 60 * 60 * 1000000;                /* 整分 */
+    TEST_ASSERT_EQUAL_UINT64(minute, sleepUsToNextMinute(base, 0));  /* 恰在整分：睡满一分钟 */
+    TEST_ASSERT_EQUAL_UINT64(minute - 1, sleepUsToNextMinute(base + 1, 0));
+    TEST_ASSERT_EQUAL_UINT64(1, sleepUsToNextMinute(base + minute - 1, 0));
+    TEST_ASSERT_EQUAL_UINT64(30000000 + 2000, sleepUsToNextMinute(base + 30000000, 2000));
+    /* 1970 年之前（时间无效时的负值）也落在下一个整分 */
+    TEST_ASSERT_EQUAL_UINT64(10000000, sleepUsToNextMinute(-10000000, 0));
+    TEST_ASSERT_EQUAL_UINT64(minute, sleepUsToNextMinute(-minute, 0));
+    for (int64_t w = base - 3 * minute; w < base + 3 * minute; w += 999983) {
+        uint64_t d = sleepUsToNextMinute(w, 500);
+        TEST_ASSERT_TRUE(d >= 500 + 1 && d <= (uint64_t)minute + 500);
+        TEST_ASSERT_EQUAL_INT64(0, (w + (int64_t)d - 500) % minute);
+    }
+}
+
+static void test_power_model(void) {
+    SleepPowerModel m = { 1000.0f, 10.0f, 20.0f, 40.0f, 100000.0f };
+    /* 不唤醒：只有深睡与屏幕 */
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 30.0f, sleepAverageCurrentUa(&m, 0, 0));
+    /* 每分钟一次、每次 100ms 启动 + 20ms 应用：占空比 0.2% */
+    float ua = sleepAverageCurrentUa(&m, 20000.0f, 60.0f);
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, 10.0f * 0.998f + 40000.0f * 0.002f + 20.0f, ua);
+    TEST_ASSERT_FLOAT_WITHIN(1.0f, 1000.0f * 1000.0f / ua, sleepProjectedHours(&m, 20000.0f, 60.0f));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_begin_is_valid);
+    RUN_TEST(test_any_bit_flip_invalidates);
+    RUN_TEST(test_wrong_magic);
+    RUN_TEST(test_random_rtc_content);
+    RUN_TEST(test_stale_layout_rejected);
+    RUN_TEST(test_updates_keep_valid);
+    RUN_TEST(test_dirty_mask);
+    RUN_TEST(test_us_to_next_minute);
+    RUN_TEST(test_power_model);
+    return UNITY_END();
+}
@@ -0,0 +1,194 @@
+/**
+ * @file test_main.cpp
+ * @brief stopwatch_core 主机测试：注入时刻驱动计时与暂停、圈速环形缓冲覆盖、乱序时刻、随机序列对照
+ */
+#include <unity.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "stopwatch_core.h"
+
+static StopwatchCore s_sw;
+
+void setUp(void) {
+    memset(&s_sw, 0xA5, sizeof(s_sw));     /* 复位必须把用到的字段都写好 */
+    stopwatchCoreReset(&s_sw);
+}
+
+void tearDown(void) {}
+
+static void test_start_stop_accumulates(void) {
+    TEST_ASSERT_EQUAL_INT64(0, stopwatchCoreElapsedUs(&s_sw, 123456));
+    TEST_ASSERT_FALSE(stopwatchCoreStop(&s_sw, 1000));
+    TEST_ASSERT_TRUE(stopwatchCoreStart(&s_sw, 1000000));
+    TEST_ASSERT_FALSE(stopwatchCoreStart(&s_sw, 1500000));      /* 已在运行，开始时刻不变 */
+    TEST_ASSERT_EQUAL_INT64(750000, stopwatchCoreElapsedUs(&s_sw, 1750000));
+    TEST_ASSERT_TRUE(stopwatchCoreStop(&s_sw, 3000000));
+    TEST_ASSERT_EQUAL_INT64(2000000, stopwatchCoreElapsedUs(&s_sw, 9000000));  /* 暂停中不走 */
+    TEST_ASSERT_TRUE(stopwatchCoreStart(&s_sw, 10000000));
+    TEST_ASSERT_EQUAL_INT64(2500000, stopwatchCoreElapsedUs(&s_sw, 10500000));
+    TEST_ASSERT_TRUE(stopwatchCoreStop(&s_sw, 11000000));
+    TEST_ASSERT_EQUAL_INT64(3000000, stopwatchCoreElapsedUs(&s_sw, 0));
+}
+
+/* 读时刻早于开始时刻（另一核上刚读的时钟）按开始时刻计 */
+static void test_now_before_start(void) {
+    stopwatchCoreStart(&s_sw, 5000000);
+    TEST_ASSERT_EQUAL_INT64(0, stopwatchCoreElapsedUs(&s_sw, 4999000));
+    stopwatchCoreStop(&s_sw, 4999000);
+    TEST_ASSERT_EQUAL_INT64(0, stopwatchCoreElapsedUs(&s_sw, 6000000));
+}
+
+/* 超过 2^32 微秒（约 71 分钟）与几天的用时不截断 */
+static void test_long_runs(void) {
+    int64_t t0 = 1LL << 40;
+    stopwatchCoreStart(&s_sw, t0);
+    const StopwatchLap* lap = stopwatchCoreLap(&s_sw, t0 + 5000000000LL);
+    TEST_ASSERT_EQUAL_INT64(5000000000LL, lap->lapUs);
+    lap = stopwatchCoreLap(&s_sw, t0 + 3LL * 86400 * 1000000);
+    TEST_ASSERT_EQUAL_INT64(3LL * 86400 * 1000000 - 5000000000LL, lap->lapUs);
+    TEST_ASSERT_EQUAL_INT64(3LL * 86400 * 1000000, lap->splitUs);
+}
+
+static void test_lap_only_while_running(void) {
+    TEST_ASSERT_NULL(stopwatchCoreLap(&s_sw, 1000));
+    stopwatchCoreStart(&s_sw, 0);
+    const StopwatchLap* lap = stopwatchCoreLap(&s_sw, 1200000);
+    TEST_ASSERT_NOT_NULL(lap);
+    TEST_ASSERT_EQUAL_UINT32(1, lap->number);
+    TEST_ASSERT_EQUAL_INT64(1200000, lap->lapUs);
+    stopwatchCoreStop(&s_sw, 2000000);
+    TEST_ASSERT_NULL(stopwatchCoreLap(&s_sw, 2500000));
+    TEST_ASSERT_EQUAL_UINT32(1, stopwatchCoreLapsStored(&s_sw));
+    /* 暂停的时间不算进下一圈 */
+    stopwatchCoreStart(&s_sw, 10000000);
+    lap = stopwatchCoreLap(&s_sw, 10300000);
+    TEST_ASSERT_EQUAL_UINT32(2, lap->number);
+    TEST_ASSERT_EQUAL_INT64(800000 + 300000, lap->lapUs);
+    TEST_ASSERT_EQUAL_INT64(2300000, lap->splitUs);
+}
+
+/* 按键中断里记的时刻可能早于上一圈的读数：圈时记 0，不为负，累计不倒退 */
+static void test_out_of_order_lap_clamped(void) {
+    stopwatchCoreStart(&s_sw, 0);
+    stopwatchCoreLap(&s_sw, 5000000);
+    const StopwatchLap* lap = stopwatchCoreLap(&s_sw, 4990000);
+    TEST_ASSERT_EQUAL_INT64(0, lap->lapUs);
+    TEST_ASSERT_EQUAL_INT64(5000000, lap->splitUs);
+    lap = stopwatchCoreLap(&s_sw, 6000000);
+    TEST_ASSERT_EQUAL_INT64(1000000, lap->lapUs);
+    TEST_ASSERT_EQUAL_INT64(6000000, lap->splitUs);
+}
+
+/* 环形缓冲：第 N 圈（N > 容量）覆盖最早的一圈，保留最近 STOPWATCH_LAP_CAPACITY 圈，圈号连续 */
+static void test_ring_overwrites_oldest(void) {
+    stopwatchCoreStart(&s_sw, 0);
+    const uint32_t total = STOPWATCH_LAP_CAPACITY * 3 + 7;
+    for (uint32_t n = 1; n <= total; n++) {
+        stopwatchCoreLap(&s_sw, (int64_t)n * (n + 1) / 2 * 1000);   /* 第 n 圈用时 n 毫秒 */
+        uint32_t stored = stopwatchCoreLapsStored(&s_sw);
+        TEST_ASSERT_EQUAL_UINT32(n < STOPWATCH_LAP_CAPACITY ? n : STOPWATCH_LAP_CAPACITY, stored);
+        TEST_ASSERT_EQUAL_UINT32(n - stored + 1, stopwatchCoreLapAt(&s_sw, 0)->number);
+        TEST_ASSERT_EQUAL_UINT32(n, stopwatchCoreLapAt(&s_sw, stored - 1)->number);
+    }
+    for (uint32_t i = 0; i < STOPWATCH_LAP_CAPACITY; i++) {
+        const StopwatchLap* lap = stopwatchCoreLapAt(&s_sw, i);
+        uint32_t n = total - STOPWATCH_LAP_CAPACITY + 1 + i;
+        TEST_ASSERT_EQUAL_UINT32(n, lap->number);
+        TEST_ASSERT_EQUAL_INT64((int64_t)n * 1000, lap->lapUs);
+        TEST_ASSERT_EQUAL_INT64((int64_t)n * (n + 1) / 2 * 1000, lap->splitUs);
+    }
+    stopwatchCoreReset(&s_sw);
+    TEST_ASSERT_EQUAL_UINT32(0, stopwatchCoreLapsStored(&s_sw));
+    stopwatchCoreStart(&s_sw, 0);
+    TEST_ASSERT_EQUAL_UINT32(1, stopwatchCoreLap(&s_sw, 1000)->number);
+}
+
+/* 随机的开始 / 暂停 / 记圈序列（含略微乱序的时刻），与直接记账的参照模型对照 */
+static void test_random_sequence_matches_model(void) {
+    srand(2024);
+    std::vector<StopwatchLap> model;
+    bool running = false;
+    int64_t now = 1000, elapsed = 0, lastSplit = 0;
+    for (int step = 0; step < 100000; step++) {
+        int64_t dt = rand() % 50000;
+        now += dt;
+        if (running) elapsed += dt;
+        int64_t stamp = now, stampElapsed = elapsed;
+        if (running && rand() % 8 == 0) {       /* 中断时刻比当前读数早一点 */
+            int64_t back = rand() % 3000;
+            if (back > dt) back = dt;
+            stamp -= back;
+            stampElapsed -= back;
+        }
+        switch (rand() % 4) {
+        case 0:
+            TEST_ASSERT_EQUAL(!running, stopwatchCoreStart(&s_sw, now));
+            running = true;
+            break;
+        case 1:
+            TEST_ASSERT_EQUAL(running, stopwatchCoreStop(&s_sw, now));
+            running = false;
+            break;
+        default: {
+            const StopwatchLap* lap = stopwatchCoreLap(&s_sw, stamp);
+            if (!running) {
+                TEST_ASSERT_NULL(lap);
+                break;
+            }
+            int64_t split = stampElapsed > lastSplit ? stampElapsed : lastSplit;
+            StopwatchLap m = { (uint32_t)model.size() + 1, split - lastSplit, split };
+            model.push_back(m);
+            lastSplit = split;
+            TEST_ASSERT_EQUAL_UINT32(m.number, lap->number);
+            TEST_ASSERT_EQUAL_INT64(m.lapUs, lap->lapUs);
+            TEST_ASSERT_EQUAL_INT64(m.splitUs, lap->splitUs);
+            break;
+        }
+        }
+        TEST_ASSERT_EQUAL_INT64(elapsed, stopwatchCoreElapsedUs(&s_sw, now));
+    }
+    uint32_t stored = stopwatchCoreLapsStored(&s_sw);
+    TEST_ASSERT_EQUAL_UINT32(STOPWATCH_LAP_CAPACITY, stored);
+    for (uint32_t i = 0; i < stored; i++) {
+        const StopwatchLap& m = model[model.size() - stored + i];
+        const StopwatchLap* lap = stopwatchCoreLapAt(&s_sw, i);
+        TEST_ASSERT_EQUAL_UINT32(m.number, lap->number);
+        TEST_ASSERT_EQUAL_INT64(m.lapUs, lap->lapUs);
+        TEST_ASSERT_EQUAL_INT64(m.splitUs, lap->splitUs);
+    }
+}
+
+static void test_format(void) {
+    char buf[24];
+    TEST_ASSERT_EQUAL_INT(8, stopwatchFormat(0, buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_STRING("0:00.000", buf);
+    stopwatchFormat(-5, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_STRING("0:00.000", buf);
+    stopwatchFormat(999, buf, sizeof(buf));                 /* 不足 1 毫秒舍去 */
+    TEST_ASSERT_EQUAL_STRING("0:00.000", buf);
+    stopwatchFormat(61234567, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_STRING("1:01.234", buf);
+    stopwatchFormat(3599999999LL, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_STRING("59:59.999", buf);
+    stopwatchFormat(3600000000LL, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_STRING("1:00:00.000", buf);
+    stopwatchFormat(100LL * 3600 * 1000000 + 5001000, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_STRING("100:00:05.001", buf);
+    char small[5];
+    TEST_ASSERT_EQUAL_INT(8, stopwatchFormat(61234567, small, sizeof(small)));  /* 截断时返回完整长度 */
+    TEST_ASSERT_EQUAL_STRING("1:01", small);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_start_stop_accumulates);
+    RUN_TEST(test_now_before_start);
+    RUN_TEST(test_long_runs);
+    RUN_TEST(test_lap_only_while_running);
+    RUN_TEST(test_out_of_order_lap_clamped);
+    RUN_TEST(test_ring_overwrites_oldest);
+    RUN_TEST(test_random_sequence_matches_model);
+    RUN_TEST(test_format);
+    return UNITY_END();
+}
@@ -0,0 +1,157 @@
+/**
+ * @file test_main.cpp
+ * @brief timer_core 主机测试：虚拟时钟下的截止时刻堆、状态机与计数回绕
+ */
+#include <unity.h>
+#include <stdlib.h>
+#include "timer_core.h"
+
+static TimerCore c;
+
+void setUp(void) {
+    timerCoreInit(&c);
+}
+
+void tearDown(void) {}
+
+static void startAt(int slot, uint32_t seconds, uint64_t nowUs) {
+    TEST_ASSERT_TRUE(timerCoreSetDuration(&c, slot, seconds));
+    TEST_ASSERT_TRUE(timerCoreStart(&c, slot, nowUs));
+}
+
+static void test_pop_in_deadline_order(void) {
+    startAt(0, 30, 0);
+    startAt(1, 10, 0);
+    startAt(2, 20, 0);
+    startAt(3, 10, 5000000);
+    uint64_t next = 0;
+    TEST_ASSERT_TRUE(timerCoreNextDeadline(&c, &next));
+    TEST_ASSERT_EQUAL_UINT64(10000000, next);
+    TEST_ASSERT_EQUAL_INT(-1, timerCorePopExpired(&c, 9999999));
+    TEST_ASSERT_EQUAL_INT(1, timerCorePopExpired(&c, 10000000));
+    TEST_ASSERT_EQUAL_INT(-1, timerCorePopExpired(&c, 10000000));
+    TEST_ASSERT_EQUAL_INT(3, timerCorePopExpired(&c, 15000000));
+    /* 同时到时的依次取出 */
+    TEST_ASSERT_EQUAL_INT(2, timerCorePopExpired(&c, 40000000));
+    TEST_ASSERT_EQUAL_INT(0, timerCorePopExpired(&c, 40000000));
+    TEST_ASSERT_EQUAL_INT(-1, timerCorePopExpired(&c, 40000000));
+    TEST_ASSERT_FALSE(timerCoreNextDeadline(&c, &next));
+    TEST_ASSERT_EQUAL_UINT8(TIMER_RINGING, c.slots[1].state);
+}
+
+static void test_pause_resume_keeps_remaining(void) {
+    startAt(0, 60, 1000000);
+    startAt(1, 90, 1000000);
+    TEST_ASSERT_TRUE(timerCorePause(&c, 0, 21000000));
+    TEST_ASSERT_EQUAL_UINT64(40000000, timerCoreRemainingUs(&c, 0, 50000000));
+    uint64_t next = 0;
+    TEST_ASSERT_TRUE(timerCoreNextDeadline(&c, &next));
+    TEST_ASSERT_EQUAL_UINT64(91000000, next);
+    TEST_ASSERT_FALSE(timerCorePause(&c, 0, 22000000));
+    TEST_ASSERT_TRUE(timerCoreResume(&c, 0, 100000000));
+    TEST_ASSERT_TRUE(timerCoreNextDeadline(&c, &next));
+    TEST_ASSERT_EQUAL_UINT64(91000000, next);
+    TEST_ASSERT_EQUAL_INT(1, timerCorePopExpired(&c, 100000000));
+    TEST_ASSERT_EQUAL_INT(-1, timerCorePopExpired(&c, 139999999));
+    TEST_ASSERT_EQUAL_INT(0, timerCorePopExpired(&c, 140000000));
+}
+
+static void test_cancel_removes_from_heap(void) {
+    startAt(0, 10, 0);
+    startAt(1, 20, 0);
+    startAt(2, 30, 0);
+    timerCoreCancel(&c, 0);
+    timerCoreCancel(&c, 2);
+    TEST_ASSERT_EQUAL_UINT8(1, c.heapLen);
+    TEST_ASSERT_EQUAL_INT(1, timerCorePopExpired(&c, 100000000));
+    TEST_ASSERT_EQUAL_UINT8(TIMER_IDLE, c.slots[0].state);
+    /* 响铃中确认后可重新开始 */
+    timerCoreCancel(&c, 1);
+    TEST_ASSERT_TRUE(timerCoreStart(&c, 1, 200000000));
+}
+
+static void test_state_rules(void) {
+    TEST_ASSERT_FALSE(timerCoreStart(&c, 0, 0));                /* 时长为 0 */
+    TEST_ASSERT_TRUE(timerCoreSetDuration(&c, 0, 200 * 60));
+    TEST_ASSERT_EQUAL_UINT32(TIMER_MAX_SECONDS, c.slots[0].durationS);
+    TEST_ASSERT_TRUE(timerCoreStart(&c, 0, 0));
+    TEST_ASSERT_FALSE(timerCoreStart(&c, 0, 0));
+    TEST_ASSERT_FALSE(timerCoreSetDuration(&c, 0, 5));
+    TEST_ASSERT_FALSE(timerCoreResume(&c, 0, 0));
+    TEST_ASSERT_EQUAL_UINT64(0, timerCoreRemainingUs(&c, 1, 0));   /* 空闲槽位按设定时长 */
+    TEST_ASSERT_EQUAL_UINT64(0, timerCoreRemainingUs(&c, 0, (uint64_t)TIMER_MAX_SECONDS * 1000000 + 1));
+}
+
+/* 计数在截止时刻之间回绕：有符号差值比较仍按先后取出 */
+static void test_wraparound(void) {
+    uint64_t base = UINT64_MAX - 15000000ull;      /* 回绕前 15 秒 */
+    startAt(0, 20, base);                           /* 回绕后才到时 */
+    startAt(1, 10, base);                           /* 回绕前到时 */
+    startAt(2, 30, base + 2000000);
+    TEST_ASSERT_TRUE(timerDeadlineBefore(c.slots[1].deadlineUs, c.slots[0].deadlineUs));
+    TEST_ASSERT_TRUE(c.slots[0].deadlineUs < c.slots[1].deadlineUs);   /* 无符号比较会颠倒 */
+    uint64_t next = 0;
+    TEST_ASSERT_TRUE(timerCoreNextDeadline(&c, &next));
+    TEST_ASSERT_EQUAL_UINT64(base + 10000000, next);
+    TEST_ASSERT_EQUAL_INT(-1, timerCorePopExpired(&c, base + 9999999));
+    TEST_ASSERT_EQUAL_INT(1, timerCorePopExpired(&c, base + 10000000));
+    uint64_t afterWrap = base + 19000000;           /* 已回绕到小数值 */
+    TEST_ASSERT_TRUE(afterWrap < base);
+    TEST_ASSERT_EQUAL_UINT64(1000000, timerCoreRemainingUs(&c, 0, afterWrap));
+    TEST_ASSERT_EQUAL_INT(-1, timerCorePopExpired(&c, afterWrap));
+    TEST_ASSERT_EQUAL_INT(0, timerCorePopExpired(&c, base + 20000000));
+    TEST_ASSERT_TRUE(timerCorePause(&c, 2, base + 22000000));
+    TEST_ASSERT_EQUAL_UINT64(10000000, timerCoreRemainingUs(&c, 2, 0));
+}
+
+/* 随机操作序列与逐槽暴力求最早截止时刻对照，检查堆不变式 */
+static void test_random_against_brute_force(void) {
+    srand(12345);
+    uint64_t now = UINT64_MAX - 500ull * 1000000;  /* 跑过回绕点 */
+    for (int step = 0; step < 20000; step++) {
+        int slot = rand() % TIMER_SLOTS;
+        switch (rand() % 5) {
+            case 0:
+                timerCoreCancel(&c, slot);
+                timerCoreSetDuration(&c, slot, 1 + rand() % 120);
+                timerCoreStart(&c, slot, now);
+                break;
+            case 1: timerCorePause(&c, slot, now); break;
+            case 2: timerCoreResume(&c, slot, now); break;
+            case 3: if (rand() % 4 == 0) timerCoreCancel(&c, slot); break;
+            default: now += (uint64_t)(rand() % 5000) * 1000; break;
+        }
+        int expect = -1;
+        for (int i = 0; i < TIMER_SLOTS; i++) {
+            if (c.slots[i].state != TIMER_RUNNING) continue;
+            if (expect < 0 || timerDeadlineBefore(c.slots[i].deadlineUs, c.slots[expect].deadlineUs)) expect = i;
+        }
+        uint64_t next = 0;
+        if (expect < 0) {
+            TEST_ASSERT_FALSE(timerCoreNextDeadline(&c, &next));
+        } else {
+            TEST_ASSERT_TRUE(timerCoreNextDeadline(&c, &next));
+            TEST_ASSERT_EQUAL_UINT64(c.slots[expect].deadlineUs, next);
+        }
+        for (int i = 0; i < c.heapLen; i++) {
+            TEST_ASSERT_EQUAL_INT(i, c.heapPos[c.heap[i].slot]);
+            if (i > 0) TEST_ASSERT_FALSE(timerDeadlineBefore(c.heap[i].deadlineUs, c.heap[(i - 1) / 2].deadlineUs));
+        }
+        int popped;
+        while ((popped = timerCorePopExpired(&c, now)) >= 0) {
+            TEST_ASSERT_FALSE(timerDeadlineBefore(now, c.slots[popped].deadlineUs));
+            timerCoreCancel(&c, popped);
+        }
+    }
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_pop_in_deadline_order);
+    RUN_TEST(test_pause_resume_keeps_remaining);
+    RUN_TEST(test_cancel_removes_from_heap);
+    RUN_TEST(test_state_rules);
+    RUN_TEST(test_wraparound);
+    RUN_TEST(test_random_against_brute_force);
+    return UNITY_END();
+}
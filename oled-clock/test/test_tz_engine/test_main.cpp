@@ -0,0 +1,173 @@
+/**
+ * @file test_main.cpp
+ * @brief tz_engine 主机测试：2020–2080 各时区偏移、夏令时标志与变化时刻对照系统 tz 数据库（glibc localtime_r）
+ */
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "tz_engine.h"
+
+#define SWEEP_FIRST  1577836800LL   /* 2020-01-01 00:00 UTC */
+#define SWEEP_END    3534364800LL   /* 2082-01-01 00:00 UTC */
+#define TABLE_END    3502828800LL   /* 2081-01-01 00:00 UTC，表只覆盖到 2080 年 */
+#define SWEEP_STEP   3600
+
+void setUp(void) {}
+
+void tearDown(void) {
+    tzSelect(TZ_DEFAULT_ZONE);
+}
+
+static void useSystemZone(const char* name) {
+    setenv("TZ", name, 1);
+    tzset();
+}
+
+static long systemOffset(int64_t utc) {
+    time_t t = (time_t)utc;
+    struct tm tm;
+    localtime_r(&t, &tm);
+    return tm.tm_gmtoff;
+}
+
+static void failAt(const char* zone, int64_t utc, const char* what, long got, long expect) {
+    char msg[128];
+    snprintf(msg, sizeof(msg), "%s @%lld: %s %ld, tzdb %ld", zone, (long long)utc, what, got, expect);
+    TEST_FAIL_MESSAGE(msg);
+}
+
+/* 每小时一个采样点：偏移、夏令时标志、拆出的本地时间都与 glibc 一致；变化点个数一致 */
+static void test_hourly_sweep_matches_tzdb(void) {
+    for (int zone = 0; zone < tzZoneCount(); zone++) {
+        const char* name = tzZoneName(zone);
+        useSystemZone(name);
+        tzSelect(zone);
+        int changes = 0;
+        long prev = systemOffset(SWEEP_FIRST);
+        for (int64_t t = SWEEP_FIRST; t < TABLE_END; t += SWEEP_STEP) {
+            struct tm ours, sys;
+            time_t tt = (time_t)t;
+            localtime_r(&tt, &sys);
+            long off = sys.tm_gmtoff;
+            if (off != prev) changes++;
+            prev = off;
+            if (tzOffsetAt(zone, t) != off) failAt(name, t, "offset", tzOffsetAt(zone, t), off);
+            tzLocalTime(t, &ours, NULL);
+            if (ours.tm_isdst != sys.tm_isdst) failAt(name, t, "isdst", ours.tm_isdst, sys.tm_isdst);
+            if (ours.tm_year != sys.tm_year || ours.tm_yday != sys.tm_yday || ours.tm_mon != sys.tm_mon ||
+                ours.tm_mday != sys.tm_mday || ours.tm_hour != sys.tm_hour || ours.tm_min != sys.tm_min ||
+                ours.tm_wday != sys.tm_wday)
+                failAt(name, t, "local hour", ours.tm_hour, sys.tm_hour);
+        }
+        /* 沿 nextChange 数出本表的变化点 */
+        int ours = 0;
+        struct tm tm;
+        int64_t next;
+        tzLocalTime(SWEEP_FIRST, &tm, &next);
+        while (next < TABLE_END) {
+            ours++;
+            tzLocalTime(next, &tm, &next);
+        }
+        if (ours != changes) failAt(name, SWEEP_FIRST, "transitions", ours, changes);
+    }
+}
+
+/* 每个变化点精确到秒：前一秒是旧偏移，当秒是新偏移 */
+static void test_transition_instants(void) {
+    int total = 0;
+    for (int zone = 0; zone < tzZoneCount(); zone++) {
+        const char* name = tzZoneName(zone);
+        useSystemZone(name);
+        tzSelect(zone);
+        struct tm tm;
+        int64_t next;
+        tzLocalTime(SWEEP_FIRST, &tm, &next);
+        while (next < TABLE_END) {
+            long before = systemOffset(next - 1);
+            long after = systemOffset(next);
+            if (before == after) failAt(name, next, "no tzdb change", after, before);
+            if (tzOffsetAt(zone, next - 1) != before) failAt(name, next - 1, "offset", tzOffsetAt(zone, next - 1), before);
+            if (tzOffsetAt(zone, next) != after) failAt(name, next, "offset", tzOffsetAt(zone, next), after);
+            total++;
+            tzLocalTime(next, &tm, &next);
+        }
+    }
+    TEST_ASSERT_TRUE(total > 1000);
+}
+
+/* 表尾之后沿用最后一个偏移，不再报告变化点 */
+static void test_after_table_end(void) {
+    int zone = tzFindZone("America/New_York");
+    TEST_ASSERT_TRUE(zone >= 0);
+    tzSelect(zone);
+    struct tm tm;
+    int64_t next;
+    tzLocalTime(SWEEP_END, &tm, &next);
+    TEST_ASSERT_TRUE(next == INT64_MAX);
+    TEST_ASSERT_EQUAL_INT32(-5 * 3600, tzOffsetAt(zone, SWEEP_END));
+    TEST_ASSERT_EQUAL_INT(0, tm.tm_isdst);
+    zone = tzFindZone("Asia/Shanghai");
+    TEST_ASSERT_EQUAL_INT(TZ_DEFAULT_ZONE, zone);
+    TEST_ASSERT_EQUAL_INT32(8 * 3600, tzOffsetAt(zone, 0));
+    TEST_ASSERT_EQUAL_INT32(8 * 3600, tzOffsetAt(zone, SWEEP_END));
+}
+
+/* 来回跳动的时刻（缓存区间外）与顺序前进结果相同 */
+static void test_cache_random_access(void) {
+    int zone = tzFindZone("Europe/London");
+    tzSelect(zone);
+    uint32_t x = 12345;
+    for (int i = 0; i < 200000; i++) {
+        x = x * 1664525u + 1013904223u;
+        int64_t t = SWEEP_FIRST + (int64_t)(x % (uint32_t)(TABLE_END - SWEEP_FIRST));
+        struct tm tm;
+        int64_t next;
+        tzLocalTime(t, &tm, &next);
+        int32_t off = tzOffsetAt(zone, t);
+        TEST_ASSERT_EQUAL_INT(off != 0 ? 1 : 0, tm.tm_isdst);
+        TEST_ASSERT_TRUE(next > t);
+        if (next == INT64_MAX) continue;                   /* 2080 年最后一次变化之后 */
+        TEST_ASSERT_EQUAL_INT32(off, tzOffsetAt(zone, next - 1));
+        TEST_ASSERT_TRUE(off != tzOffsetAt(zone, next));
+    }
+}
+
+/* 拆分本地秒数与 gmtime_r 对照，含 1970 年前的负数 */
+static void test_civil_from_seconds(void) {
+    for (int64_t s = -2208988800LL; s < 4133980800LL; s += 86400 * 3 + 3671) {
+        struct tm ours, sys;
+        time_t t = (time_t)s;
+        gmtime_r(&t, &sys);
+        tzCivilFromSeconds(s, &ours);
+        TEST_ASSERT_EQUAL_INT(sys.tm_year, ours.tm_year);
+        TEST_ASSERT_EQUAL_INT(sys.tm_mon, ours.tm_mon);
+        TEST_ASSERT_EQUAL_INT(sys.tm_mday, ours.tm_mday);
+        TEST_ASSERT_EQUAL_INT(sys.tm_hour, ours.tm_hour);
+        TEST_ASSERT_EQUAL_INT(sys.tm_min, ours.tm_min);
+        TEST_ASSERT_EQUAL_INT(sys.tm_sec, ours.tm_sec);
+        TEST_ASSERT_EQUAL_INT(sys.tm_wday, ours.tm_wday);
+        TEST_ASSERT_EQUAL_INT(sys.tm_yday, ours.tm_yday);
+    }
+}
+
+static void test_zone_lookup(void) {
+    TEST_ASSERT_EQUAL_INT(-1, tzFindZone("Mars/Olympus"));
+    for (int i = 0; i < tzZoneCount(); i++) TEST_ASSERT_EQUAL_INT(i, tzFindZone(tzZoneName(i)));
+    tzSelect(tzZoneCount());
+    TEST_ASSERT_EQUAL_INT(TZ_DEFAULT_ZONE, tzSelected());
+    tzSelect(-1);
+    TEST_ASSERT_EQUAL_INT(TZ_DEFAULT_ZONE, tzSelected());
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_hourly_sweep_matches_tzdb);
+    RUN_TEST(test_transition_instants);
+    RUN_TEST(test_after_table_end);
+    RUN_TEST(test_cache_random_access);
+    RUN_TEST(test_civil_from_seconds);
+    RUN_TEST(test_zone_lookup);
+    return UNITY_END();
+}
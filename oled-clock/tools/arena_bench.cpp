@@ -0,0 +1,396 @@
+/**
+ * @file arena_bench.cpp
+ * @brief 主机上比较天气拉取与 Web 响应的临时内存：改动前的 Arduino String 拼接与现在的临时区域（arena），
+ *        统计堆分配次数与占用峰值（不计时）
+ *
+ * 编译运行（在 oled-clock/ 下）：
+ *   g++ -std=gnu++11 -O2 -Iinclude tools/arena_bench.cpp src/arena.cpp src/fixed_string.cpp \
+ *       src/tz_engine.cpp -o /tmp/arena_bench
+ *   /tmp/arena_bench
+ *
+ * 本程序接管 malloc / realloc / free，统计两次标记之间的堆分配次数与占用峰值（按 glibc 的实际块大小）；String 按
+ * ESP32 Arduino 2.x 的 WString 行为模拟（10 字节以内存在对象里，增长时按 16 字节取整 realloc）。
+ * 只比较本项目自己的代码：HTTPClient、WiFiClientSecure、mbedTLS 在框架内部分配，两边相同，不计入。
+ */
+#include "arena.h"
+#include "fixed_string.h"
+#include "tz_engine.h"
+#include <malloc.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+extern "C" void* __libc_malloc(size_t);
+extern "C" void* __libc_realloc(void*, size_t);
+extern "C" void* __libc_calloc(size_t, size_t);
+extern "C" void __libc_free(void*);
+
+/* ---- 堆计数 ---- */
+
+static volatile size_t s_sink;     /* 防止拼好的内容被优化掉 */
+
+static bool s_counting;
+static uint32_t s_allocs;
+static size_t s_live;
+static size_t s_peak;
+
+static void noteAlloc(void* p) {
+    if (!s_counting || !p) return;
+    s_allocs++;
+    s_live += malloc_usable_size(p);
+    if (s_live > s_peak) s_peak = s_live;
+}
+
+static void noteFree(void* p) {
+    if (s_counting && p) s_live -= malloc_usable_size(p);
+}
+
+extern "C" void* malloc(size_t n) {
+    void* p = __libc_malloc(n);
+    noteAlloc(p);
+    return p;
+}
+
+extern "C" void* calloc(size_t n, size_t size) {
+    void* p = __libc_calloc(n, size);
+    noteAlloc(p);
+    return p;
+}
+
+extern "C" void* realloc(void* old, size_t n) {
+    noteFree(old);
+    void* p = __libc_realloc(old, n);
+    noteAlloc(p);
+    return p;
+}
+
+extern "C" void free(void* p) {
+    noteFree(p);
+    __libc_free(p);
+}
+
+struct HeapUse {
+    uint32_t allocs;
+    size_t peak;
+    size_t leftover;
+};
+
+static void heapBegin(void) {
+    s_allocs = 0;
+    s_live = 0;
+    s_peak = 0;
+    s_counting = true;
+}
+
+static HeapUse heapEnd(void) {
+    s_counting = false;
+    HeapUse u = { s_allocs, s_peak, s_live };
+    return u;
+}
+
+/* ---- Arduino String 的主机模拟（只实现用到的接口） ---- */
+
+class String {
+public:
+    String() { init(); }
+    String(const char* s) {
+        init();
+        concat(s, strlen(s));
+    }
+    String(const String& o) {
+        init();
+        concat(o.c_str(), o.m_len);
+    }
+    ~String() {
+        if (m_heap) free(m_heap);
+    }
+    String& operator+=(const char* s) {
+        concat(s, strlen(s));
+        return *this;
+    }
+    String& operator+=(const String& s) {
+        concat(s.c_str(), s.m_len);
+        return *this;
+    }
+    friend String operator+(const char* a, const String& b) {
+        String r(a);
+        r += b;
+        return r;
+    }
+    friend String operator+(const String& a, const char* b) {
+        String r(a);
+        r += b;
+        return r;
+    }
+    bool reserve(size_t size) {
+        if (size <= capacity()) return true;
+        if (size < SSO_SIZE) return true;
+        size_t newSize = (size + 16) & ~(size_t)0xf;
+        char* p = (char*)realloc(m_heap, newSize);
+        if (!p) return false;
+        if (!m_heap) memcpy(p, m_sso, m_len + 1);
+        m_heap = p;
+        m_cap = newSize - 1;
+        return true;
+    }
+    void concat(const char* s, size_t n) {
+        if (!reserve(m_len + n)) return;
+        memcpy(buf() + m_len, s, n);
+        m_len += n;
+        buf()[m_len] = '\0';
+    }
+    int indexOf(const char* s, int from = 0) const {
+        const char* p = strstr(c_str() + from, s);
+        return p ? (int)(p - c_str()) : -1;
+    }
+    int indexOf(char c, int from) const {
+        const char* p = strchr(c_str() + from, c);
+        return p ? (int)(p - c_str()) : -1;
+    }
+    String substring(int left, int right) const {
+        String r;
+        r.concat(c_str() + left, (size_t)(right - left));
+        return r;
+    }
+    void toCharArray(char* out, size_t cap) const {
+        size_t n = m_len < cap - 1 ? m_len : cap - 1;
+        memcpy(out, c_str(), n);
+        out[n] = '\0';
+    }
+    const char* c_str() const { return m_heap ? m_heap : m_sso; }
+    size_t length() const { return m_len; }
+
+private:
+    enum { SSO_SIZE = 11 };     /* 32 位下 sizeof(指针 + 两个 uint16) + 4 - 1 */
+    void init() {
+        m_heap = NULL;
+        m_len = 0;
+        m_cap = SSO_SIZE - 1;
+        m_sso[0] = '\0';
+    }
+    char* buf() { return m_heap ? m_heap : m_sso; }
+    size_t capacity() const { return m_cap; }
+    char* m_heap;
+    size_t m_len;
+    size_t m_cap;
+    char m_sso[SSO_SIZE];
+};
+
+/* ---- 天气拉取 ---- */
+
+#define API_KEY        "SAMPLE_PRIVATE_KEY"
+#define LOCATION       "kunming"
+#define URL_MAX        160
+#define BODY_MAX       1024
+#define CHUNK_BYTES    512
+#define SCRATCH_BYTES  2560
+
+/* 心知天气 now.json 的一个真实形状的响应（约 280 字节），按 TCP 读取分两段到达 */
+static const char SAMPLE_BODY[] =
+    "{\"results\":[{\"location\":{\"id\":\"WWYMRT0VRMUG\",\"name\":\"昆明\",\"country\":\"CN\","
+    "\"path\":\"昆明,昆明,云南,中国\",\"timezone\":\"Asia/Shanghai\",\"timezone_offset\":\"+08:00\"},"
+    "\"now\":{\"text\":\"多云\",\"code\":\"4\",\"temperature\":\"21\"},\"last_update\":\"2026-10-19T10:20:00+08:00\"}]}";
+#define SAMPLE_SPLIT   128
+
+static char g_city[32];
+static char g_temp[7];
+static char g_text[16];
+
+static uint8_t s_scratchBuf[SCRATCH_BYTES];
+static Arena s_scratch;
+
+/* 改动前的 fetchWeather：String 拼 URL，http.getString()（StreamString：按 Content-Length 预留后逐段追加） */
+static int weatherBefore(void) {
+    String url = "https://api.seniverse.com/v3/weather/now.json?key=";
+    url += API_KEY;
+    url += "&location=";
+    url += LOCATION;
+    url += "&language=zh-Hans&unit=c";
+    s_sink += url.length();
+    String body;
+    body.reserve(sizeof(SAMPLE_BODY));
+    body.concat(SAMPLE_BODY, SAMPLE_SPLIT);
+    body.concat(SAMPLE_BODY + SAMPLE_SPLIT, sizeof(SAMPLE_BODY) - 1 - SAMPLE_SPLIT);
+    int ti = body.indexOf("\"temperature\":\"");
+    int tei = body.indexOf("\"text\":\"");
+    int locIdx = body.indexOf("\"location\"");
+    if (locIdx >= 0) {
+        int nameKey = body.indexOf("\"name\":\"", locIdx);
+        int start = nameKey + 8;
+        int end = body.indexOf('"', start);
+        if (nameKey >= 0 && end > start && end - start < (int)sizeof(g_city)) body.substring(start, end).toCharArray(g_city, sizeof(g_city));
+    }
+    if (ti >= 0) {
+        int start = ti + 15;
+        int end = body.indexOf('"', start);
+        if (end > start && end - start < 7) body.substring(start, end).toCharArray(g_temp, sizeof(g_temp));
+    }
+    if (tei >= 0) {
+        int start = tei + 8;
+        int end = body.indexOf('"', start);
+        if (end > start) {
+            String text = body.substring(start, end);
+            text.toCharArray(g_text, sizeof(g_text));
+        }
+    }
+    return (int)strlen(g_city);
+}
+
+static bool jsonStringField(const char* from, const char* key, char* out, size_t cap) {
+    char pat[24];
+    snprintf(pat, sizeof(pat), "\"%s\":\"", key);
+    const char* p = strstr(from, pat);
+    if (!p) return false;
+    p += strlen(pat);
+    const char* end = strchr(p, '"');
+    if (!end || (size_t)(end - p) >= cap) return false;
+    memcpy(out, p, (size_t)(end - p));
+    out[end - p] = '\0';
+    return true;
+}
+
+/* 现在的 fetchWeather：URL 与响应体都取自临时区域，作用域结束一次归还 */
+static int weatherAfter(void) {
+    ARENA_SCOPE(&s_scratch);
+    char* urlBuf = (char*)arenaAlloc(&s_scratch, URL_MAX);
+    char* bodyBuf = (char*)arenaAlloc(&s_scratch, BODY_MAX);
+    if (!urlBuf || !bodyBuf) return -1;
+    StrBuilder url(urlBuf, URL_MAX);
+    url.appendf("https://api.seniverse.com/v3/weather/now.json?key=%s&location=%s&language=zh-Hans&unit=c",
+                API_KEY, LOCATION);
+    s_sink += url.length();
+    StrBuilder body(bodyBuf, BODY_MAX);
+    body.append(SAMPLE_BODY, SAMPLE_SPLIT);
+    body.append(SAMPLE_BODY + SAMPLE_SPLIT, sizeof(SAMPLE_BODY) - 1 - SAMPLE_SPLIT);
+    if (body.truncated()) return -1;
+    const char* loc = strstr(body.c_str(), "\"location\"");
+    if (loc) jsonStringField(loc, "name", g_city, sizeof(g_city));
+    jsonStringField(body.c_str(), "temperature", g_temp, sizeof(g_temp));
+    jsonStringField(body.c_str(), "text", g_text, sizeof(g_text));
+    return (int)strlen(g_city);
+}
+
+/* ---- Web 响应 ---- */
+
+static size_t s_sent;
+static uint32_t s_chunks;
+
+static void sendContent(const char* data, size_t n) {
+    s_sent += n;
+    s_chunks++;
+    s_sink += (uint8_t)data[n - 1];
+}
+
+/* 改动前的配置页：整页 String 拼好再 send */
+static size_t webBefore(void) {
+    String html = "<!DOCTYPE html><html><head><meta charset=\"UTF-8\"><meta name=\"viewport\" content=\"width=device-width,initial-scale=1\"><title>OLED 时钟配置</title></head><body style=\"font-family:sans-serif;padding:1em;\">";
+    html += "<h2>天气城市设置</h2><p>心知天气城市 ID（如 kunming、beijing、shanghai）</p>";
+    html += "<form method=\"post\" action=\"/\">";
+    html += "<input type=\"text\" name=\"location\" value=\"" + String(LOCATION) + "\" maxlength=\"31\" size=\"20\"> ";
+    html += "<button type=\"submit\">保存</button></form>";
+    html += "<p><small>保存后进入设备「天气」页将自动拉取新城市数据。</small></p>";
+    html += "<hr><h3>WiFi 配网</h3><p>若更换路由器或需重新配网，点击下方按钮。设备将重启并开放热点 <strong>OLEDClock</strong>，用手机连接后选择新 WiFi 并输入密码。</p>";
+    html += "<form method=\"post\" action=\"/resetwifi\" onsubmit=\"return confirm('确定清除当前 WiFi 并重新配网？');\">";
+    html += "<button type=\"submit\">清除 WiFi 并重新配网</button></form></body></html>";
+    sendContent(html.c_str(), html.length());
+    return html.length();
+}
+
+/* 现在的动态接口（/api/config）：ChunkedPrint 把输出攒进临时区域里的 512 字节缓冲区，满了发一个 chunk */
+class ChunkSink {
+public:
+    ChunkSink() : m_buf((char*)arenaAlloc(&s_scratch, CHUNK_BYTES)), m_len(0) {}
+    void printf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+        char line[96];
+        va_list ap;
+        va_start(ap, fmt);
+        int n = vsnprintf(line, sizeof(line), fmt, ap);
+        va_end(ap);
+        write(line, (size_t)n);
+    }
+    void write(const char* data, size_t size) {
+        if (!m_buf) {
+            sendContent(data, size);
+            return;
+        }
+        for (size_t i = 0; i < size; i++) {
+            if (m_len == CHUNK_BYTES) flush();
+            m_buf[m_len++] = data[i];
+        }
+    }
+    void flush() {
+        if (m_len == 0) return;
+        sendContent(m_buf, m_len);
+        m_len = 0;
+    }
+private:
+    char* m_buf;
+    size_t m_len;
+};
+
+static size_t webAfter(void) {
+    ARENA_SCOPE(&s_scratch);
+    size_t before = s_sent;
+    ChunkSink out;
+    out.printf("{\"location\":\"%s\",\"tz\":\"%s\",\"zones\":[", LOCATION, tzZoneName(tzSelected()));
+    for (int i = 0; i < tzZoneCount(); i++) out.printf(i ? ",\"%s\"" : "\"%s\"", tzZoneName(i));
+    out.printf("],\"net_policy\":\"%s\"", "modem_sleep");
+    out.printf(",\"power_profile\":\"%s\",\"power_active\":\"%s\",\"battery\":%d,\"config_writes\":%lu}", "auto",
+               "balanced", 87, 3ul);
+    out.flush();
+    return s_sent - before;
+}
+
+static void reportUse(const char* name, const HeapUse& h, const Arena* a, size_t arenaAllocs) {
+    printf("  %-30s heap: %2u allocs, peak %5zu B, left %zu B", name, (unsigned)h.allocs, h.peak, h.leftover);
+    if (a) printf(" | arena: %zu allocs, peak %zu B, in use after %zu B", arenaAllocs, a->highWater, a->used);
+    printf("\n");
+}
+
+int main(void) {
+    arenaInit(&s_scratch, s_scratchBuf, sizeof(s_scratchBuf));
+
+    printf("weather fetch (our code only; HTTPClient / TLS excluded)\n");
+    heapBegin();
+    weatherBefore();
+    HeapUse h = heapEnd();
+    reportUse("before: String", h, NULL, 0);
+    char city[32];
+    strcpy(city, g_city);
+    memset(g_city, 0, sizeof(g_city));
+    heapBegin();
+    weatherAfter();
+    h = heapEnd();
+    reportUse("after: arena", h, &s_scratch, s_scratch.allocs);
+    printf("  parsed: %s %s %s (%s)\n", g_city, g_temp, g_text, strcmp(city, g_city) == 0 ? "same" : "DIFFERENT");
+
+    /* 预算不够时确定地失败，不向堆借 */
+    Arena small;
+    static uint8_t smallBuf[1000];
+    arenaInit(&small, smallBuf, sizeof(smallBuf));
+    Arena saved = s_scratch;
+    s_scratch = small;
+    int r = weatherAfter();
+    printf("  1000 B budget: result %d, failures %u\n", r, (unsigned)s_scratch.failures);
+    s_scratch = saved;
+
+    printf("web response\n");
+    size_t sent = s_sent;
+    uint32_t chunks = s_chunks;
+    heapBegin();
+    webBefore();
+    h = heapEnd();
+    reportUse("before: String page", h, NULL, 0);
+    printf("    %zu B in %u send\n", s_sent - sent, (unsigned)(s_chunks - chunks));
+    arenaInit(&s_scratch, s_scratchBuf, sizeof(s_scratchBuf));
+    sent = s_sent;
+    chunks = s_chunks;
+    heapBegin();
+    webAfter();
+    h = heapEnd();
+    reportUse("after: /api/config chunked", h, &s_scratch, s_scratch.allocs);
+    printf("    %zu B in %u chunks\n", s_sent - sent, (unsigned)(s_chunks - chunks));
+    return 0;
+}
@@ -0,0 +1,42 @@
+/**
+ * @file bench.h
+ * @brief 主机基准程序的公共部分：单调时钟、按调用计的耗时、防止结果被优化掉
+ *
+ * 只给 tools/ 下的主机程序用，不进固件。每个程序自己重复足够多次（总时长百毫秒级），
+ * 取三轮中最快的一轮，减少调度与频率变化的干扰。
+ */
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#define BENCH_ROUNDS  3
+
+static volatile uint64_t g_benchSink;
+
+static inline uint64_t benchNowNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+/* 运行 fn(iters) 三轮，返回最快一轮的每次调用纳秒数；fn 返回值累加进 g_benchSink */
+template <typename Fn>
+static double benchNsPerCall(Fn fn, uint64_t iters) {
+    double best = 0;
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        uint64_t t0 = benchNowNs();
+        g_benchSink += fn(iters);
+        double ns = (double)(benchNowNs() - t0) / (double)iters;
+        if (r == 0 || ns < best) best = ns;
+    }
+    return best;
+}
+
+static inline void benchReport(const char* name, double nsPerCall) {
+    printf("  %-36s %9.1f ns\n", name, nsPerCall);
+}
+
+#endif
@@ -0,0 +1,112 @@
+# -*- coding: utf-8 -*-
+"""
+构建前脚本：把 web/ 下的静态页面 gzip 压缩后生成 src/web_assets.h（Flash 常量数组）。
+
+- 作为 PlatformIO extra_scripts（pre:）在每次编译前运行；
+- 也可单独执行：python tools/embed_web.py
+- ETag 取压缩后内容的 SHA-1 前 16 位，内容不变则 ETag 不变（强校验）。
+- 同时保留一份原文（带自己的 ETag），供不接受 gzip 的客户端（如不加 --compressed 的 curl）使用。
+- 内容未变化时不重写头文件，避免触发无谓的重新编译。
+"""
+import gzip
+import hashlib
+import os
+import sys
+
+try:
+    Import("env")  # noqa: F821  (PlatformIO/SCons 注入)
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(sys.argv[0])))
+
+WEB_DIR = os.path.join(PROJECT_DIR, "web")
+OUT_FILE = os.path.join(PROJECT_DIR, "src", "web_assets.h")
+
+# (文件名, URL 路径, MIME)
+ASSETS = [
+    ("index.html", "/", "text/html; charset=utf-8"),
+    ("style.css", "/style.css", "text/css; charset=utf-8"),
+    ("app.js", "/app.js", "application/javascript; charset=utf-8"),
+    ("live.html", "/live", "text/html; charset=utf-8"),
+    ("live.js", "/live.js", "application/javascript; charset=utf-8"),
+]
+
+
+def symbol_for(name, suffix):
+    return "WEB_" + "".join(c if c.isalnum() else "_" for c in name).upper() + suffix
+
+
+def emit_array(lines, sym, data):
+    lines.append("static const uint8_t %s[] PROGMEM = {" % sym)
+    for i in range(0, len(data), 16):
+        chunk = ", ".join("0x%02x" % b for b in data[i:i + 16])
+        lines.append("    %s," % chunk)
+    lines.append("};")
+    lines.append("")
+
+
+def gzip_bytes(raw):
+    # mtime=0 保证同样的输入得到同样的输出（ETag 稳定）
+    return gzip.compress(raw, compresslevel=9, mtime=0)
+
+
+def render():
+    lines = [
+        "/**",
+        " * @file web_assets.h",
+        " * @brief 由 tools/embed_web.py 自动生成，请勿手工修改（源文件见 web/）",
+        " */",
+        "#ifndef WEB_ASSETS_H",
+        "#define WEB_ASSETS_H",
+        "",
+        "#include <Arduino.h>",
+        "",
+        "struct WebAsset {",
+        "    const char* path;",
+        "    const char* mime;",
+        "    const char* etag;",
+        "    const char* rawEtag;",
+        "    const uint8_t* data;     /* gzip */",
+        "    size_t len;",
+        "    const uint8_t* raw;      /* 原文 */",
+        "    size_t rawLen;",
+        "};",
+        "",
+    ]
+    table = []
+    for name, path, mime in ASSETS:
+        with open(os.path.join(WEB_DIR, name), "rb") as f:
+            raw = f.read()
+        gz = gzip_bytes(raw)
+        etag = '\\"%s\\"' % hashlib.sha1(gz).hexdigest()[:16]
+        raw_etag = '\\"%s\\"' % hashlib.sha1(raw).hexdigest()[:16]
+        gz_sym = symbol_for(name, "_GZ")
+        raw_sym = symbol_for(name, "_RAW")
+        lines.append("// %s: %d B -> %d B gzip" % (name, len(raw), len(gz)))
+        emit_array(lines, gz_sym, gz)
+        emit_array(lines, raw_sym, raw)
+        table.append('    { "%s", "%s", "%s", "%s", %s, sizeof(%s), %s, sizeof(%s) },'
+                     % (path, mime, etag, raw_etag, gz_sym, gz_sym, raw_sym, raw_sym))
+    lines.append("static const WebAsset WEB_ASSETS[] = {")
+    lines.extend(table)
+    lines.append("};")
+    lines.append("#define WEB_ASSET_COUNT  (sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]))")
+    lines.append("")
+    lines.append("#endif")
+    lines.append("")
+    return "\n".join(lines)
+
+
+def main():
+    text = render()
+    old = None
+    if os.path.exists(OUT_FILE):
+        with open(OUT_FILE, "r", encoding="utf-8") as f:
+            old = f.read()
+    if text != old:
+        with open(OUT_FILE, "w", encoding="utf-8") as f:
+            f.write(text)
+        print("embed_web: generated %s" % os.path.relpath(OUT_FILE, PROJECT_DIR))
+
+
+main()
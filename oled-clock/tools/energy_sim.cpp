@@ -0,0 +1,197 @@
+/**
+ * @file energy_sim.cpp
+ * @brief 主机上模拟一天的能耗：用固件的选档（power_profile）、联网租约（net_lease）与能耗核算（energy_model）
+ *
+ * 编译运行（在 oled-clock/ 下）：
+ *   g++ -std=gnu++11 -O2 -Iinclude tools/energy_sim.cpp src/energy_model.cpp src/power_profile.cpp \
+ *       src/net_lease.cpp -o /tmp/energy_sim
+ *   /tmp/energy_sim [always_on|modem_sleep|radio_off] [auto|performance|balanced|saver|critical] [起始电量%]
+ *
+ * 场景：00:00 开机，时钟页（100ms 一帧）；07:00 闹钟响 8 秒后按键停止，之后 10 分钟内每 15 秒按一次键、
+ * 07:05 看一眼天气；12:30 起 10 分钟每 20 秒按键；19:00–21:00 每分钟按键、19:30 看天气。SNTP 每 4 小时对时。
+ * 帧工作时间、连接耗时等取下面的常数，改动固件中的档位表、租约策略或能耗常数后重新运行即可比较。
+ */
+#include "energy_model.h"
+#include "net_lease.h"
+#include "power_profile.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SIM_DAY_US            (24LL * 3600 * 1000000)
+#define SIM_CLOCK_FRAME_MS    100       /* 时钟页自己的帧节奏（main.cpp） */
+#define SIM_WEATHER_FRAME_MS  200
+#define SIM_DRAW_US           2500      /* 一帧除 sendBuffer 外的工作 */
+#define SIM_CONNECT_US        1500000   /* 射频打开到连上（快速重连） */
+#define SIM_SNTP_PERIOD_US    (4LL * 3600 * 1000000)
+#define SIM_SNTP_HOLD_US      1000000   /* 连上后对时用时 */
+#define SIM_WEATHER_HOLD_US   2000000   /* 连上后拉取用时 */
+#define SIM_SAMPLE_US         10000000  /* 电量采样间隔（GOVERNOR_SAMPLE_MS） */
+#define SIM_NET_TAIL_MS       60000     /* NET_IDLE_TAIL_MS */
+#define SIM_BUZZER_DUTY       (360.0 / 960.0)
+
+struct SimWindow {
+    int startS;        /* 一天中的秒 */
+    int endS;
+    int pressEveryS;   /* 0 表示不按键 */
+    bool weather;      /* 期间停在天气页 */
+};
+
+static const SimWindow WINDOWS[] = {
+    { 7 * 3600 + 8,       7 * 3600 + 600,      15, false },
+    { 7 * 3600 + 300,     7 * 3600 + 360,      0,  true },
+    { 12 * 3600 + 1800,   12 * 3600 + 2400,    20, false },
+    { 19 * 3600,          21 * 3600,           60, false },
+    { 19 * 3600 + 1800,   19 * 3600 + 1860,    0,  true },
+};
+#define SIM_WINDOW_COUNT  (int)(sizeof(WINDOWS) / sizeof(WINDOWS[0]))
+#define SIM_ALARM_S       (7 * 3600)
+#define SIM_ALARM_RING_S  8
+
+static bool inWindow(int daySec, bool weather) {
+    for (int i = 0; i < SIM_WINDOW_COUNT; i++) {
+        const SimWindow* w = &WINDOWS[i];
+        if (w->weather == weather && daySec >= w->startS && daySec < w->endS) return true;
+    }
+    return false;
+}
+
+static bool pressedAt(int daySec) {
+    if (daySec == SIM_ALARM_S + SIM_ALARM_RING_S) return true;
+    for (int i = 0; i < SIM_WINDOW_COUNT; i++) {
+        const SimWindow* w = &WINDOWS[i];
+        if (w->pressEveryS > 0 && daySec >= w->startS && daySec < w->endS &&
+            (daySec - w->startS) % w->pressEveryS == 0)
+            return true;
+    }
+    return false;
+}
+
+static int findPolicy(const char* name) {
+    static const char* const NAMES[NET_POLICY_COUNT] = { "always_on", "modem_sleep", "radio_off" };
+    for (int i = 0; i < NET_POLICY_COUNT; i++)
+        if (strcmp(name, NAMES[i]) == 0) return i;
+    return -1;
+}
+
+int main(int argc, char** argv) {
+    int policy = argc > 1 ? findPolicy(argv[1]) : NET_POLICY_MODEM_SLEEP;
+    int forced = argc > 2 && strcmp(argv[2], "auto") != 0 ? powerProfileFind(argv[2]) : -1;
+    float startPct = argc > 3 ? (float)atof(argv[3]) : 100.0f;
+    if (policy < 0 || (argc > 2 && strcmp(argv[2], "auto") != 0 && forced < 0)) {
+        fprintf(stderr, "usage: %s [always_on|modem_sleep|radio_off] [auto|<profile>] [start%%]\n", argv[0]);
+        return 2;
+    }
+
+    EnergyModel model;
+    energyModelDefaults(&model);
+    EnergyCounters c;
+    memset(&c, 0, sizeof(c));
+    EnergyReport r;
+
+    PowerGovernorCore gov;
+    powerGovernorInit(&gov, (int)startPct);
+    gov.forced = (int8_t)forced;
+    uint64_t profileUs[POWER_PROFILE_COUNT] = { 0 };
+
+    NetLeaseCore net;
+    netLeaseInit(&net, (NetPolicy)policy, SIM_NET_TAIL_MS, true, 0);
+    netLeaseAcquire(&net, NET_JOB_SETUP, 0, 0);
+    bool setupHeld = true;
+    int64_t connectAtUs = SIM_CONNECT_US;
+    int64_t sntpDueUs = 0, sntpDoneUs = -1;
+    int64_t weatherFetchedUs = -1, weatherDoneUs = -1;
+    int64_t lastInputUs = 0, nextSampleUs = 0;
+    int batteryPct = (int)startPct;
+    int lastPressSec = -1;
+
+    int64_t now = 0;
+    while (now < SIM_DAY_US) {
+        int daySec = (int)(now / 1000000);
+        if (daySec != lastPressSec && pressedAt(daySec)) {
+            lastPressSec = daySec;
+            lastInputUs = now;
+        }
+        if (now >= nextSampleUs) {
+            energyModelCompute(&model, &c, &r);
+            batteryPct = (int)(startPct - r.totalMah * 100.0f / ENERGY_BATTERY_MAH + 0.5f);
+            if (batteryPct < 0) batteryPct = 0;
+            c.adcSamples += ENERGY_ADC_SAMPLES_PER_READ;
+            nextSampleUs = now + SIM_SAMPLE_US;
+        }
+        PowerProfile profile = powerGovernorSelect(&gov, batteryPct, (uint32_t)((now - lastInputUs) / 1000));
+        const PowerProfileSpec* spec = powerProfileSpec(profile);
+        /* 与 net_service 一致：生效策略取配置与档位下限中更省电的一档 */
+        int floor = powerGovernorNetFloor(&gov);
+        netLeaseSetPolicy(&net, (NetPolicy)(floor > policy ? floor : policy));
+
+        /* 联网任务 */
+        if (now >= sntpDueUs) {
+            if (netLeaseAcquire(&net, NET_JOB_SNTP, 30000, now) == NET_ACT_RADIO_ON) connectAtUs = now + SIM_CONNECT_US;
+            sntpDueUs = now + SIM_SNTP_PERIOD_US;
+            sntpDoneUs = -1;
+        }
+        bool weatherScreen = inWindow(daySec, true);
+        if (weatherScreen && weatherDoneUs < 0 &&
+            (weatherFetchedUs < 0 || now - weatherFetchedUs > (int64_t)spec->weatherRefreshMs * 1000) &&
+            net.held[NET_JOB_WEATHER] == 0) {
+            if (netLeaseAcquire(&net, NET_JOB_WEATHER, 45000, now) == NET_ACT_RADIO_ON) connectAtUs = now + SIM_CONNECT_US;
+        }
+        bool connected = net.radio != NET_RADIO_OFF && now >= connectAtUs;
+        if (connected && setupHeld) {
+            netLeaseRelease(&net, NET_JOB_SETUP, now);
+            setupHeld = false;
+        }
+        if (connected && net.held[NET_JOB_SNTP] > 0) {
+            if (sntpDoneUs < 0) sntpDoneUs = now + SIM_SNTP_HOLD_US;
+            else if (now >= sntpDoneUs) netLeaseRelease(&net, NET_JOB_SNTP, now);
+        }
+        if (connected && net.held[NET_JOB_WEATHER] > 0) {
+            if (weatherDoneUs < 0) {
+                weatherDoneUs = now + SIM_WEATHER_HOLD_US;
+                c.tlsHandshakes++;
+            } else if (now >= weatherDoneUs) {
+                netLeaseRelease(&net, NET_JOB_WEATHER, now);
+                weatherFetchedUs = now;
+                weatherDoneUs = -1;
+            }
+        }
+        NetAction action = netLeaseTick(&net, connected, now);
+        if (action == NET_ACT_RADIO_ON) connectAtUs = now + SIM_CONNECT_US;
+
+        /* 一帧：绘制 + sendBuffer，然后等到下一帧 */
+        int64_t workUs = SIM_DRAW_US + (int64_t)(ENERGY_SH1106_FRAME_BYTES * model.i2cUsPerByte);
+        uint32_t screenMs = weatherScreen ? SIM_WEATHER_FRAME_MS : SIM_CLOCK_FRAME_MS;
+        uint32_t frameMs = screenMs > spec->frameMinMs ? screenMs : spec->frameMinMs;
+        int64_t waitUs = (int64_t)frameMs * 1000;
+        c.activeUs += (uint64_t)workUs;
+        c.i2cBytes += ENERGY_SH1106_FRAME_BYTES;
+        /* 与 power_service 一致：射频关着才能手动浅睡 */
+        if (net.radio == NET_RADIO_OFF) c.lightSleepUs += (uint64_t)waitUs;
+        else c.idleUs += (uint64_t)waitUs;
+        int64_t frameUs = workUs + waitUs;
+        c.panelUs += (uint64_t)frameUs * spec->contrast / 255;
+        if (daySec >= SIM_ALARM_S && daySec < SIM_ALARM_S + SIM_ALARM_RING_S)
+            c.buzzerOnUs += (uint64_t)(frameUs * SIM_BUZZER_DUTY);
+        profileUs[profile] += (uint64_t)frameUs;
+        now += frameUs;
+        c.elapsedUs = (uint64_t)now;
+        c.radioOnUs = netLeaseRadioOnUs(&net, now);
+    }
+
+    energyModelCompute(&model, &c, &r);
+    printf("simulated day: policy=%s profile=%s start=%.0f%%\n", argc > 1 ? argv[1] : "modem_sleep",
+           forced < 0 ? "auto" : powerProfileSpec((PowerProfile)forced)->name, startPct);
+    printf("  %-16s %9s %8s\n", "item", "mAh/day", "avg mA");
+    for (int i = 0; i < ENERGY_ITEM_COUNT; i++)
+        printf("  %-16s %9.2f %8.3f\n", energyItemName((EnergyItem)i), r.mah[i], energyReportMa(&r, i));
+    printf("  %-16s %9.2f %8.3f\n", "total", r.totalMah, energyReportMa(&r, -1));
+    printf("  radio on %.2fh, %lu radio-ons, %.0fmAh battery lasts ~%.1fh, end battery %d%%\n",
+           c.radioOnUs / 3600e6, (unsigned long)net.radioOnCount, ENERGY_BATTERY_MAH,
+           energyReportHours(&r, ENERGY_BATTERY_MAH), batteryPct);
+    printf("  profile hours:");
+    for (int i = 0; i < POWER_PROFILE_COUNT; i++)
+        printf(" %s=%.2f", powerProfileSpec((PowerProfile)i)->name, profileUs[i] / 3600e6);
+    printf(" (switches %lu)\n", (unsigned long)gov.switches);
+    return 0;
+}
@@ -0,0 +1,175 @@
+/**
+ * @file frame_codec_sim.cpp
+ * @brief 主机上统计画面镜像的压缩率：按 live_view 的方式对帧序列编码（首帧整帧，之后差分），并逐帧解码校验
+ *
+ * 编译运行（在 oled-clock/ 下）：
+ *   g++ -std=gnu++11 -O2 -Iinclude tools/frame_codec_sim.cpp src/frame_codec.cpp -o /tmp/frame_codec_sim
+ *   /tmp/frame_codec_sim [录制文件.bin ...]
+ *
+ * 录制文件由 /live 页面的“录制”按钮下载：依次拼接的 1024 字节原始帧，即设备实际发出的帧序列。
+ * 不给文件时统计内置的合成序列：时钟页走秒、一行文字滚动、全屏噪声（最坏情况）。
+ */
+#include "frame_codec.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SIM_FPS            5          /* LIVE_MIN_INTERVAL_MS 对应的最高帧率 */
+#define SIM_SECONDS        600
+
+struct SeqStats {
+    unsigned long frames;
+    unsigned long sent;               /* 有变化、实际要发送的帧 */
+    unsigned long keyBytes;
+    unsigned long deltaBytes;
+    unsigned long maxDelta;
+    bool ok;
+};
+
+static uint8_t s_prev[FRAME_BYTES];
+static uint8_t s_fb[FRAME_BYTES];
+static uint8_t s_msg[FRAME_CODEC_MAX_OUT];
+
+static void seqBegin(SeqStats* st) {
+    memset(st, 0, sizeof(*st));
+    st->ok = true;
+}
+
+static void seqFrame(SeqStats* st, const uint8_t* cur) {
+    size_t n = frameEncode(cur, st->frames ? s_prev : NULL, s_msg, sizeof(s_msg));
+    if (n > 0) {
+        if (!frameDecode(s_msg, n, s_fb) || memcmp(s_fb, cur, FRAME_BYTES) != 0) st->ok = false;
+        st->sent++;
+        if (st->frames == 0) {
+            st->keyBytes = n;
+        } else {
+            st->deltaBytes += n;
+            if (n > st->maxDelta) st->maxDelta = n;
+        }
+    } else if (st->frames == 0) {
+        st->ok = false;
+    }
+    memcpy(s_prev, cur, FRAME_BYTES);
+    st->frames++;
+}
+
+static void seqReport(const char* name, const SeqStats* st) {
+    unsigned long raw = st->frames * FRAME_BYTES;
+    unsigned long total = st->keyBytes + st->deltaBytes;
+    unsigned long deltas = st->sent > 0 ? st->sent - 1 : 0;
+    printf("%-14s %6lu %6lu %7lu %8.1f %6lu %9lu %7.1f%%  %s\n", name, st->frames, st->sent, st->keyBytes,
+           deltas ? (double)st->deltaBytes / deltas : 0.0, st->maxDelta, total,
+           raw ? 100.0 * total / raw : 0.0, st->ok ? "ok" : "MISMATCH");
+}
+
+static void setPixel(uint8_t* fb, int x, int y) {
+    if (x < 0 || x >= FRAME_W || y < 0 || y >= FRAME_PAGES * 8) return;
+    fb[(y / 8) * FRAME_W + x] |= (uint8_t)(1u << (y % 8));
+}
+
+static void fillRect(uint8_t* fb, int x, int y, int w, int h) {
+    for (int j = 0; j < h; j++)
+        for (int i = 0; i < w; i++) setPixel(fb, x + i, y + j);
+}
+
+/* 七段数码管数字，宽 12 高 22，笔画 3 像素 */
+static void drawDigit(uint8_t* fb, int x, int y, int d) {
+    static const uint8_t SEG[10] = { 0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F };
+    uint8_t s = SEG[d % 10];
+    if (s & 0x01) fillRect(fb, x, y, 12, 3);
+    if (s & 0x02) fillRect(fb, x + 9, y, 3, 11);
+    if (s & 0x04) fillRect(fb, x + 9, y + 11, 3, 11);
+    if (s & 0x08) fillRect(fb, x, y + 19, 12, 3);
+    if (s & 0x10) fillRect(fb, x, y + 11, 3, 11);
+    if (s & 0x20) fillRect(fb, x, y, 3, 11);
+    if (s & 0x40) fillRect(fb, x, y + 10, 12, 3);
+}
+
+/* 时钟页：顶栏图标、时:分:秒大字、底部秒进度条；画面每秒变一次 */
+static void simClock(SeqStats* st) {
+    uint8_t cur[FRAME_BYTES];
+    for (int f = 0; f < SIM_SECONDS * SIM_FPS; f++) {
+        int t = 7 * 3600 + 59 * 60 + 30 + f / SIM_FPS;
+        memset(cur, 0, sizeof(cur));
+        fillRect(cur, 0, 0, 128, 1);
+        fillRect(cur, 2, 2, 10, 6);
+        fillRect(cur, 110, 2, 16, 6);
+        int digits[6] = { t / 36000 % 3, t / 3600 % 10, t / 600 % 6, t / 60 % 10, t / 10 % 6, t % 10 };
+        for (int i = 0; i < 6; i++) drawDigit(cur, 4 + i * 20 + (i / 2) * 2, 20, digits[i]);
+        fillRect(cur, 0, 60, (t % 60) * 128 / 60, 3);
+        seqFrame(st, cur);
+    }
+}
+
+/* 一行文字从右向左滚动，每帧移动 2 像素：每帧两页都在变 */
+static void simScroll(SeqStats* st) {
+    uint8_t text[512];
+    srand(7);
+    for (int i = 0; i < (int)sizeof(text); i++) text[i] = (i % 6 == 5) ? 0 : (uint8_t)(rand() & 0x7E);
+    uint8_t cur[FRAME_BYTES];
+    for (int f = 0; f < SIM_SECONDS * SIM_FPS; f++) {
+        memset(cur, 0, sizeof(cur));
+        fillRect(cur, 0, 0, 128, 1);
+        for (int x = 0; x < FRAME_W; x++) {
+            cur[3 * FRAME_W + x] = text[(x + f * 2) % sizeof(text)];
+            cur[4 * FRAME_W + x] = text[(x + f * 2 + 97) % sizeof(text)];
+        }
+        seqFrame(st, cur);
+    }
+}
+
+static void simNoise(SeqStats* st) {
+    uint8_t cur[FRAME_BYTES];
+    srand(9);
+    for (int f = 0; f < 200; f++) {
+        for (int i = 0; i < FRAME_BYTES; i++) cur[i] = (uint8_t)rand();
+        seqFrame(st, cur);
+    }
+}
+
+static bool runFile(const char* path, SeqStats* st) {
+    FILE* fp = fopen(path, "rb");
+    if (!fp) {
+        fprintf(stderr, "无法打开 %s\n", path);
+        return false;
+    }
+    uint8_t cur[FRAME_BYTES];
+    size_t n;
+    while ((n = fread(cur, 1, FRAME_BYTES, fp)) == FRAME_BYTES) seqFrame(st, cur);
+    fclose(fp);
+    if (n != 0) fprintf(stderr, "%s: 末尾 %zu 字节不足一帧，已忽略\n", path, n);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    printf("%-14s %6s %6s %7s %8s %6s %9s %8s\n", "sequence", "frames", "sent", "key_B", "delta_B",
+           "max_B", "total_B", "of_raw");
+    bool ok = true;
+    SeqStats st;
+    if (argc > 1) {
+        for (int i = 1; i < argc; i++) {
+            seqBegin(&st);
+            if (!runFile(argv[i], &st)) {
+                ok = false;
+                continue;
+            }
+            const char* base = strrchr(argv[i], '/');
+            seqReport(base ? base + 1 : argv[i], &st);
+            ok = ok && st.ok;
+        }
+        return ok ? 0 : 1;
+    }
+    seqBegin(&st);
+    simClock(&st);
+    seqReport("clock", &st);
+    ok = ok && st.ok;
+    seqBegin(&st);
+    simScroll(&st);
+    seqReport("scroll", &st);
+    ok = ok && st.ok;
+    seqBegin(&st);
+    simNoise(&st);
+    seqReport("noise", &st);
+    ok = ok && st.ok;
+    return ok ? 0 : 1;
+}
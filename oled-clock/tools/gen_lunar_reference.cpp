@@ -0,0 +1,64 @@
+/**
+ * @file gen_lunar_reference.cpp
+ * @brief 离线生成 test/test_lunar_calendar/lunar_reference.h：ICU ChineseCalendar 给出的 1900–2100 农历月首
+ *
+ * 与 tools/gen_lunar_table.py（astropy 历表）相互独立，供主机测试对照 lunar_calendar。
+ * 只在更新参考数据时运行，需要 ICU 开发包（libicu-dev）：
+ *   g++ -std=gnu++11 -O2 tools/gen_lunar_reference.cpp -licui18n -licuuc -licudata -o /tmp/gen_lunar_reference
+ *   /tmp/gen_lunar_reference > test/test_lunar_calendar/lunar_reference.h
+ */
+#include <unicode/calendar.h>
+#include <unicode/gregocal.h>
+#include <unicode/timezone.h>
+#include <stdio.h>
+
+using namespace icu;
+
+#define REF_FIRST_YEAR  1900
+#define REF_LAST_YEAR   2100
+#define ICU_YEAR_BASE   2637    /* ICU 扩展年 - 2637 = 正月初一所在的公历年 */
+
+int main(void) {
+    UErrorCode st = U_ZERO_ERROR;
+    TimeZone* tz = TimeZone::createTimeZone("Asia/Shanghai");
+    Calendar* cc = Calendar::createInstance(tz->clone(), Locale("zh_CN@calendar=chinese"), st);
+    GregorianCalendar g(tz->clone(), st);
+    if (U_FAILURE(st)) {
+        fprintf(stderr, "ICU: %s\n", u_errorName(st));
+        return 1;
+    }
+    g.clear();
+    g.set(REF_FIRST_YEAR, UCAL_JANUARY, 1, 12, 0, 0);
+
+    printf("/*\n"
+           " * 由 tools/gen_lunar_reference.cpp 生成（%s），勿手工修改。\n"
+           " * 公历 %d..%d 年内每个农历月的月首：公历日期 YYYYMMDD、农历年、月、是否闰月。\n"
+           " */\n"
+           "#ifndef LUNAR_REFERENCE_H\n#define LUNAR_REFERENCE_H\n\n#include <stdint.h>\n\n"
+           "struct LunarRefMonth {\n    int32_t start;\n    int16_t year;\n    int8_t month;\n    int8_t leap;\n};\n\n"
+           "static const LunarRefMonth LUNAR_REF_MONTHS[] = {\n",
+           "ICU " U_ICU_VERSION " ChineseCalendar，Asia/Shanghai", REF_FIRST_YEAR, REF_LAST_YEAR);
+    int n = 0;
+    for (;;) {
+        int gy = g.get(UCAL_YEAR, st);
+        if (gy > REF_LAST_YEAR) break;
+        cc->setTime(g.getTime(st), st);
+        /* 第一天之前已开始的那个月也记下，测试从它推出 1900-01-01 起的日期 */
+        if (cc->get(UCAL_DATE, st) == 1 || n == 0) {
+            int start = gy * 10000 + (g.get(UCAL_MONTH, st) + 1) * 100 + g.get(UCAL_DATE, st);
+            if (n == 0 && cc->get(UCAL_DATE, st) != 1) {
+                GregorianCalendar back(g);
+                back.add(UCAL_DATE, 1 - cc->get(UCAL_DATE, st), st);
+                start = back.get(UCAL_YEAR, st) * 10000 + (back.get(UCAL_MONTH, st) + 1) * 100 + back.get(UCAL_DATE, st);
+            }
+            printf("%s{ %d, %d, %d, %d },", n % 4 == 0 ? "    " : " ", start,
+                   cc->get(UCAL_EXTENDED_YEAR, st) - ICU_YEAR_BASE, cc->get(UCAL_MONTH, st) + 1,
+                   cc->get(UCAL_IS_LEAP_MONTH, st));
+            if (++n % 4 == 0) printf("\n");
+        }
+        g.add(UCAL_DATE, 1, st);
+    }
+    if (n % 4 != 0) printf("\n");
+    printf("};\n\n#define LUNAR_REF_COUNT %d\n\n#endif\n", n);
+    return U_FAILURE(st) ? 1 : 0;
+}
@@ -0,0 +1,314 @@
+# -*- coding: utf-8 -*-
+"""
+离线生成 src/lunar_table.h：农历年表（位压缩）与 1900–2100 节气日期表。
+
+依赖 astropy（内置 ERFA 太阳 / 月球位置），只在更新表时运行，不参与固件构建：
+    pip install astropy
+    python tools/gen_lunar_table.py [--dump reference.csv]
+
+历法规则（现行农历，时刻一律按东八区）：
+- 朔日为月首；冬至所在的月为十一月；
+- 两个十一月之间有 13 个月时置闰，闰月为其中第一个不含中气的月；
+- 节气日期取交节时刻的东八区日期。
+
+--dump 输出每天的 公历,农历年,月,日,是否闰月 参考数据，供主机上校验 C++ 实现。
+"""
+import argparse
+import datetime
+import os
+import sys
+import warnings
+
+import numpy as np
+
+warnings.filterwarnings("ignore")
+from astropy.coordinates import GeocentricTrueEcliptic, get_body  # noqa: E402
+from astropy.time import Time  # noqa: E402
+
+PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(sys.argv[0])))
+OUT_FILE = os.path.join(PROJECT_DIR, "src", "lunar_table.h")
+
+FIRST_YEAR = 1900
+LAST_YEAR = 2100
+LUNAR_FIRST_YEAR = FIRST_YEAR - 1      # 1900 年 1 月仍属农历 1899 年
+CHINA_OFFSET_DAYS = 8 / 24.0
+SYNODIC = 29.530588861
+TROPICAL = 365.2422
+
+# 节气按公历顺序：小寒、大寒、立春……冬至，对应太阳视黄经
+TERM_LONGITUDES = [(285 + 15 * k) % 360 for k in range(24)]
+
+
+def delta_t_seconds(year):
+    """TT - UT（Espenak & Meeus 多项式），year 可为小数"""
+    y = year
+    if y < 1900:
+        t = y - 1860
+        return (7.62 + 0.5737 * t - 0.251754 * t**2 + 0.01680668 * t**3
+                - 0.0004473624 * t**4 + t**5 / 233174)
+    if y < 1920:
+        t = y - 1900
+        return -2.79 + 1.494119 * t - 0.0598939 * t**2 + 0.0061966 * t**3 - 0.000197 * t**4
+    if y < 1941:
+        t = y - 1920
+        return 21.20 + 0.84493 * t - 0.076100 * t**2 + 0.0020936 * t**3
+    if y < 1961:
+        t = y - 1950
+        return 29.07 + 0.407 * t - t**2 / 233 + t**3 / 2547
+    if y < 1986:
+        t = y - 1975
+        return 45.45 + 1.067 * t - t**2 / 260 - t**3 / 718
+    if y < 2005:
+        t = y - 2000
+        return (63.86 + 0.3345 * t - 0.060374 * t**2 + 0.0017275 * t**3
+                + 0.000651814 * t**4 + 0.00002373599 * t**5)
+    if y < 2050:
+        t = y - 2000
+        return 62.92 + 0.32217 * t + 0.005589 * t**2
+    if y < 2150:
+        return -20 + 32 * ((y - 1820) / 100) ** 2 - 0.5628 * (2150 - y)
+    u = (y - 1820) / 100
+    return -20 + 32 * u * u
+
+
+def ecliptic_lon(body, jd_tt):
+    t = Time(jd_tt, format="jd", scale="tt")
+    c = get_body(body, t).transform_to(GeocentricTrueEcliptic(equinox=t))
+    return c.lon.deg
+
+
+def wrap180(x):
+    return (x + 180.0) % 360.0 - 180.0
+
+
+def solve_terms(jd_guess, targets):
+    jd = np.array(jd_guess, dtype=float)
+    for _ in range(8):
+        err = wrap180(np.asarray(targets) - ecliptic_lon("sun", jd))
+        jd += err / 360.0 * TROPICAL
+        if np.max(np.abs(err)) < 1e-6:
+            break
+    return jd
+
+
+def solve_new_moons(jd_guess):
+    jd = np.array(jd_guess, dtype=float)
+    for _ in range(10):
+        elong = wrap180(ecliptic_lon("moon", jd) - ecliptic_lon("sun", jd))
+        jd -= elong / 360.0 * SYNODIC
+        if np.max(np.abs(elong)) < 1e-6:
+            break
+    return jd
+
+
+def tt_to_china_day(jd_tt):
+    """TT 儒略日 → 东八区民用日的儒略日数（整数，当日中午对应的 JDN）"""
+    out = []
+    for jd in jd_tt:
+        year = 2000 + (jd - 2451545.0) / 365.25
+        ut = jd - delta_t_seconds(year) / 86400.0
+        out.append(int(np.floor(ut + 0.5 + CHINA_OFFSET_DAYS)))
+    return np.array(out)
+
+
+def jdn_to_date(jdn):
+    return datetime.date.fromordinal(jdn - 1721425)
+
+
+def date_to_jdn(d):
+    return d.toordinal() + 1721425
+
+
+def compute():
+    # 节气：覆盖 LUNAR_FIRST_YEAR-1 .. LAST_YEAR+1
+    years = list(range(LUNAR_FIRST_YEAR - 1, LAST_YEAR + 2))
+    guess, targets, keys = [], [], []
+    for y in years:
+        jd0 = date_to_jdn(datetime.date(y, 1, 1)) - 0.5
+        for k, lon in enumerate(TERM_LONGITUDES):
+            guess.append(jd0 + 5.5 + k * 15.2)
+            targets.append(lon)
+            keys.append((y, k))
+    term_jd = solve_terms(guess, targets)
+    term_day = dict(zip(keys, tt_to_china_day(term_jd)))
+    term_jd_by_key = dict(zip(keys, term_jd))
+
+    # 朔：从最早冬至前两个月到最后一年之后
+    start = date_to_jdn(datetime.date(LUNAR_FIRST_YEAR - 1, 9, 1))
+    end = date_to_jdn(datetime.date(LAST_YEAR + 2, 4, 1))
+    k0 = int(np.floor((start - 2451550.1) / SYNODIC))
+    k1 = int(np.ceil((end - 2451550.1) / SYNODIC))
+    nm_jd = solve_new_moons([2451550.09766 + SYNODIC * k for k in range(k0, k1 + 1)])
+    nm_day = tt_to_china_day(nm_jd)
+
+    major = sorted(d for (y, k), d in term_day.items() if k % 2 == 1)   # 中气：大寒、雨水……冬至
+
+    def month11_index(y):
+        ws = term_day[(y, 23)]
+        return max(i for i, d in enumerate(nm_day) if d <= ws)
+
+    months = []     # (起始 JDN, 月序号 1..12, 是否闰月)
+    for y in range(LUNAR_FIRST_YEAR - 1, LAST_YEAR + 1):
+        a, b = month11_index(y), month11_index(y + 1)
+        leap_at = -1
+        if b - a == 13:
+            for i in range(a, b):
+                if not any(nm_day[i] <= d < nm_day[i + 1] for d in major):
+                    leap_at = i
+                    break
+        num = 11
+        for i in range(a, b):
+            if i == leap_at:
+                months.append((int(nm_day[i]), months[-1][1], True))
+                continue
+            if i != a:
+                num = num % 12 + 1
+            months.append((int(nm_day[i]), num, False))
+    months.append((int(nm_day[month11_index(LAST_YEAR + 1)]), 11, False))
+
+    # 按农历年归组：从（非闰）正月开始
+    lunar_years = {}
+    cur = None
+    for i in range(len(months) - 1):
+        startd, num, leap = months[i]
+        if num == 1 and not leap:
+            cur = jdn_to_date(startd).year
+            lunar_years[cur] = {"ny": startd, "sizes": [], "leap": 0}
+        if cur is None:
+            continue
+        ly = lunar_years[cur]
+        ly["sizes"].append(months[i + 1][0] - startd)
+        if leap:
+            ly["leap"] = num
+    return lunar_years, term_day, term_jd_by_key, nm_jd
+
+
+def pack_year(y, info):
+    sizes = info["sizes"]
+    assert len(sizes) == (13 if info["leap"] else 12), (y, sizes)
+    assert all(s in (29, 30) for s in sizes), (y, sizes)
+    bits = 0
+    for i, s in enumerate(sizes):
+        if s == 30:
+            bits |= 1 << i
+    ny_off = info["ny"] - date_to_jdn(datetime.date(y, 1, 1))
+    assert 0 <= ny_off < 64, (y, ny_off)
+    v = bits | (info["leap"] << 13) | (ny_off << 17)
+    return [v & 0xFF, (v >> 8) & 0xFF, (v >> 16) & 0xFF]
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument("--dump", help="输出逐日参考 CSV")
+    args = ap.parse_args()
+
+    lunar_years, term_day, term_jd, nm_jd = compute()
+
+    rows = []
+    for y in range(LUNAR_FIRST_YEAR, LAST_YEAR + 1):
+        rows.append(pack_year(y, lunar_years[y]))
+
+    base, deltas = [], []
+    for k in range(24):
+        days = [jdn_to_date(term_day[(y, k)]) for y in range(FIRST_YEAR, LAST_YEAR + 1)]
+        assert all(d.month == k // 2 + 1 for d in days), k
+        base.append(min(d.day for d in days))
+    for y in range(FIRST_YEAR, LAST_YEAR + 1):
+        v = 0
+        for k in range(24):
+            d = jdn_to_date(term_day[(y, k)]).day - base[k]
+            assert 0 <= d <= 3, (y, k, d)
+            v |= d << (2 * k)
+        deltas.append([(v >> (8 * i)) & 0xFF for i in range(6)])
+
+    # 交节 / 朔时刻离东八区零点不足 2 分钟的，历表误差可能影响日期，列出供人工核对
+    def near_midnight(jd):
+        year = 2000 + (jd - 2451545.0) / 365.25
+        ut = jd - delta_t_seconds(year) / 86400.0 + 0.5 + CHINA_OFFSET_DAYS
+        frac = ut - np.floor(ut)
+        return FIRST_YEAR <= year < LAST_YEAR + 1 and min(frac, 1 - frac) * 1440 < 2, ut
+
+    close = []
+    for (y, k), jd in sorted(term_jd.items()):
+        near, _ = near_midnight(jd)
+        if near:
+            close.append("节气 %d/%d" % (y, k))
+    for jd in nm_jd:
+        near, ut = near_midnight(jd)
+        if near:
+            close.append("朔 %s" % jdn_to_date(int(round(ut))).isoformat())
+
+    lines = []
+    lines.append("/*")
+    lines.append(" * 由 tools/gen_lunar_table.py 生成，勿手工修改。")
+    lines.append(" *")
+    lines.append(" * LUNAR_YEAR_INFO：农历 %d..%d 年，每年 3 字节（小端 24 位）：" % (LUNAR_FIRST_YEAR, LAST_YEAR))
+    lines.append(" *   bit 0..12  按顺序各月是否大月（30 天），闰月紧跟在同名月之后")
+    lines.append(" *   bit 13..16 闰月月份，0 表示无闰月")
+    lines.append(" *   bit 17..22 正月初一距公历同年 1 月 1 日的天数")
+    lines.append(" * SOLAR_TERM_DELTA：公历 %d..%d 年，每年 24 个节气 × 2 位（小端），" % (FIRST_YEAR, LAST_YEAR))
+    lines.append(" *   节气 k 在 k/2+1 月的 SOLAR_TERM_BASE[k] + delta 日")
+    if close:
+        lines.append(" * 交节 / 合朔时刻距零点不足 2 分钟（日期依赖历表精度，可能与其他历书不同）：")
+        for i in range(0, len(close), 6):
+            lines.append(" *   " + ", ".join(close[i:i + 6]))
+    lines.append(" */")
+    lines.append("#ifndef LUNAR_TABLE_H")
+    lines.append("#define LUNAR_TABLE_H")
+    lines.append("")
+    lines.append("#include <stdint.h>")
+    lines.append("")
+    lines.append("#define LUNAR_TABLE_FIRST_YEAR %d" % LUNAR_FIRST_YEAR)
+    lines.append("#define LUNAR_TABLE_LAST_YEAR  %d" % LAST_YEAR)
+    lines.append("#define SOLAR_TERM_FIRST_YEAR  %d" % FIRST_YEAR)
+    lines.append("#define SOLAR_TERM_LAST_YEAR   %d" % LAST_YEAR)
+    lines.append("")
+    lines.append("static const uint8_t LUNAR_YEAR_INFO[%d][3] = {" % len(rows))
+    for i in range(0, len(rows), 6):
+        chunk = rows[i:i + 6]
+        lines.append("    " + " ".join("{0x%02x,0x%02x,0x%02x}," % tuple(r) for r in chunk)
+                     + "  /* %d */" % (LUNAR_FIRST_YEAR + i))
+    lines.append("};")
+    lines.append("")
+    lines.append("static const uint8_t SOLAR_TERM_BASE[24] = {")
+    lines.append("    " + ", ".join(str(b) for b in base))
+    lines.append("};")
+    lines.append("")
+    lines.append("static const uint8_t SOLAR_TERM_DELTA[%d][6] = {" % len(deltas))
+    for i in range(0, len(deltas), 4):
+        chunk = deltas[i:i + 4]
+        lines.append("    " + " ".join("{" + ",".join("0x%02x" % b for b in r) + "}," for r in chunk)
+                     + "  /* %d */" % (FIRST_YEAR + i))
+    lines.append("};")
+    lines.append("")
+    lines.append("#endif")
+    with open(OUT_FILE, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(lines) + "\n")
+    print("lunar_table.h: %d lunar years, %d term years, %d bytes"
+          % (len(rows), len(deltas), len(rows) * 3 + 24 + len(deltas) * 6))
+
+    if args.dump:
+        with open(args.dump, "w") as f:
+            for y in range(LUNAR_FIRST_YEAR, LAST_YEAR + 1):
+                info = lunar_years[y]
+                d = info["ny"]
+                seq = 0
+                for size in info["sizes"]:
+                    if info["leap"] and seq == info["leap"]:
+                        m, leap = info["leap"], 1
+                    else:
+                        m = seq + 1 - (1 if info["leap"] and seq > info["leap"] else 0)
+                        leap = 0
+                    for day in range(1, size + 1):
+                        g = jdn_to_date(d)
+                        if FIRST_YEAR <= g.year <= LAST_YEAR:
+                            f.write("%s,%d,%d,%d,%d\n" % (g.isoformat(), y, m, day, leap))
+                        d += 1
+                    seq += 1
+            for y in range(FIRST_YEAR, LAST_YEAR + 1):
+                for k in range(24):
+                    f.write("T,%s,%d\n" % (jdn_to_date(term_day[(y, k)]).isoformat(), k))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,142 @@
+# -*- coding: utf-8 -*-
+"""
+离线生成 src/tz_table.h：常用时区在 FIRST_YEAR..LAST_YEAR 之间的 UTC 偏移变化表。
+
+数据来自系统 tz 数据库（Python zoneinfo），只在增删时区或 tzdata 更新时运行：
+    python tools/gen_tz_table.py
+
+每个时区给出表首偏移与按 UTC 时刻排序的变化点（时刻 + 新偏移），设备上二分查找，
+并缓存「当前偏移的有效区间」，绝大多数换算只需一次比较。
+偏移以 15 分钟为单位存成 int8；LAST_YEAR 之后沿用最后一个偏移。
+"""
+import datetime
+import os
+import sys
+from zoneinfo import ZoneInfo
+
+PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(sys.argv[0])))
+OUT_FILE = os.path.join(PROJECT_DIR, "src", "tz_table.h")
+
+FIRST_YEAR = 2020
+LAST_YEAR = 2080
+
+# 第一项为默认时区
+ZONES = [
+    "Asia/Shanghai", "Asia/Hong_Kong", "Asia/Taipei", "Asia/Tokyo", "Asia/Seoul",
+    "Asia/Singapore", "Asia/Bangkok", "Asia/Kolkata", "Asia/Dubai",
+    "Europe/London", "Europe/Berlin", "Europe/Paris", "Europe/Moscow",
+    "America/New_York", "America/Chicago", "America/Denver", "America/Los_Angeles",
+    "America/Sao_Paulo", "Australia/Sydney", "Pacific/Auckland", "UTC",
+]
+
+UTC = datetime.timezone.utc
+
+
+def offset_at(zone, ts):
+    dt = datetime.datetime.fromtimestamp(ts, UTC).astimezone(zone)
+    return int(dt.utcoffset().total_seconds()), bool(dt.dst())
+
+
+def transitions(name):
+    zone = ZoneInfo(name)
+    start = int(datetime.datetime(FIRST_YEAR, 1, 1, tzinfo=UTC).timestamp())
+    end = int(datetime.datetime(LAST_YEAR + 1, 1, 1, tzinfo=UTC).timestamp())
+    first = offset_at(zone, start)
+    out = []
+    prev = first
+    t = start
+    step = 6 * 3600
+    while t < end:
+        nxt = min(t + step, end)
+        cur = offset_at(zone, nxt)
+        if cur != prev:
+            lo, hi = t, nxt          # 偏移在 (lo, hi] 内变化，二分到秒
+            while hi - lo > 1:
+                mid = (lo + hi) // 2
+                if offset_at(zone, mid) == prev:
+                    lo = mid
+                else:
+                    hi = mid
+            out.append((hi, cur))
+            prev = cur
+        t = nxt
+    return first, out
+
+
+def quarters(sec):
+    assert sec % 900 == 0, sec
+    return sec // 900
+
+
+def main():
+    zones = []
+    trans_utc, trans_off = [], []
+    for name in ZONES:
+        (first_off, first_dst), tr = transitions(name)
+        std = min([first_off] + [o for _, (o, _) in tr]) if tr else first_off
+        zones.append((name, quarters(first_off), quarters(std), len(trans_utc), len(tr)))
+        for ts, (off, _) in tr:
+            trans_utc.append(ts)
+            trans_off.append(quarters(off))
+
+    size = len(zones) * 8 + len(trans_utc) * 5
+    lines = [
+        "/*",
+        " * 由 tools/gen_tz_table.py 生成，勿手工修改。",
+        " * 时区 %d 个，变化点 %d 个（%d..%d 年），偏移单位 15 分钟。" % (len(zones), len(trans_utc), FIRST_YEAR, LAST_YEAR),
+        " */",
+        "#ifndef TZ_TABLE_H",
+        "#define TZ_TABLE_H",
+        "",
+        "#include <stdint.h>",
+        "",
+        "#define TZ_TABLE_FIRST_UTC %du" % int(datetime.datetime(FIRST_YEAR, 1, 1, tzinfo=UTC).timestamp()),
+        "#define TZ_ZONE_COUNT %d" % len(zones),
+        "",
+        "struct TzZoneEntry {",
+        "    const char* name;",
+        "    int8_t firstQuarters;   /* 表首（%d-01-01）的偏移 */" % FIRST_YEAR,
+        "    int8_t stdQuarters;     /* 标准时偏移（非夏令时） */",
+        "    uint16_t first;         /* 在变化点数组中的起始下标 */",
+        "    uint16_t count;",
+        "};",
+        "",
+        "static const uint32_t TZ_TRANS_UTC[%d] = {" % max(1, len(trans_utc)),
+    ]
+    for z in zones:
+        name, _, _, first, count = z
+        if count == 0:
+            continue
+        lines.append("    /* %s */" % name)
+        vals = trans_utc[first:first + count]
+        for i in range(0, len(vals), 6):
+            lines.append("    " + " ".join("%du," % v for v in vals[i:i + 6]))
+    if not trans_utc:
+        lines.append("    0")
+    lines.append("};")
+    lines.append("")
+    lines.append("static const int8_t TZ_TRANS_OFFSET[%d] = {" % max(1, len(trans_off)))
+    for z in zones:
+        name, _, _, first, count = z
+        if count == 0:
+            continue
+        vals = trans_off[first:first + count]
+        for i in range(0, len(vals), 20):
+            lines.append("    " + " ".join("%d," % v for v in vals[i:i + 20]) + ("  /* %s */" % name if i == 0 else ""))
+    if not trans_off:
+        lines.append("    0")
+    lines.append("};")
+    lines.append("")
+    lines.append("static const TzZoneEntry TZ_ZONES[TZ_ZONE_COUNT] = {")
+    for name, fq, sq, first, count in zones:
+        lines.append('    { "%s", %d, %d, %d, %d },' % (name, fq, sq, first, count))
+    lines.append("};")
+    lines.append("")
+    lines.append("#endif")
+    with open(OUT_FILE, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(lines) + "\n")
+    print("tz_table.h: %d zones, %d transitions, ~%d bytes" % (len(zones), len(trans_utc), size))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,107 @@
+/**
+ * @file log_ring_bench.cpp
+ * @brief 主机上比较一次日志调用的开销：LOG_I（参数装槽 + logRingPush，格式化推迟）与
+ *        Serial.printf（调用处格式化，再交给串口）
+ *
+ * 编译运行（在 oled-clock/ 下）：
+ *   g++ -std=gnu++11 -O2 -Iinclude -Itools tools/log_ring_bench.cpp src/log_ring.cpp -o /tmp/log_ring_bench
+ *   /tmp/log_ring_bench
+ *
+ * 与设备上的串口命令 'l'（logServiceBenchmark）同一条日志、同样每批 16 条后取空。
+ * 主机上没有 UART：Serial.printf 只计格式化部分（调用处的最低开销），串口发送另按
+ * 115200 波特、无软件发送缓冲（只有 128 字节硬件 FIFO）估算调用处要等的时间。
+ */
+#include "bench.h"
+#include "log_ring.h"
+#include <stdarg.h>
+#include <string.h>
+
+#define BATCH         16
+#define UART_BAUD     115200
+#define UART_FIFO     128
+#define LINE_MAX      96
+
+static LogRing s_ring;
+
+/* 与 log_service.h 的 logServiceWrite 相同的装槽方式 */
+template <typename... A>
+static inline bool logWrite(LogLevel level, const char* fmt, A... args) {
+    const uint64_t slots[sizeof...(A) + 1] = { logArg(args)... };
+    return logRingPush(&s_ring, level, (int64_t)benchNowNs(), fmt, slots, (int)sizeof...(A), NULL);
+}
+
+static void drainRing(void) {
+    LogEntry e;
+    while (logRingPop(&s_ring, &e)) {
+    }
+}
+
+static uint64_t runLogI(uint64_t iters) {
+    uint64_t ok = 0;
+    for (uint64_t i = 0; i < iters; i++) {
+        if (i % BATCH == 0) drainRing();
+        ok += logWrite(LOG_INFO, "Log bench: round %d call %d value %lu", (int)(i / BATCH), (int)(i % BATCH),
+                       (unsigned long)i);
+    }
+    return ok;
+}
+
+/* Serial.printf 的格式化部分：Print::printf 先 vsnprintf 到栈上的 64 字节缓冲区，不够再分配 */
+static char s_uart[LINE_MAX];
+
+static size_t serialPrintf(const char* fmt, ...) __attribute__((format(printf, 1, 2)));
+static size_t serialPrintf(const char* fmt, ...) {
+    char loc[64];
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(loc, sizeof(loc), fmt, ap);
+    va_end(ap);
+    memcpy(s_uart, loc, (size_t)n < sizeof(loc) ? (size_t)n : sizeof(loc) - 1);
+    return (size_t)n;
+}
+
+static uint64_t runPrintf(uint64_t iters) {
+    uint64_t bytes = 0;
+    for (uint64_t i = 0; i < iters; i++)
+        bytes += serialPrintf("Log bench: printf call %d value %lu\n", (int)(i % BATCH), (unsigned long)i);
+    return bytes;
+}
+
+/* 取日志任务那一侧：把一条记录格式化成正文 */
+static LogEntry s_sample;
+
+static uint64_t runFormat(uint64_t iters) {
+    char line[LINE_MAX];
+    uint64_t n = 0;
+    for (uint64_t i = 0; i < iters; i++) {
+        s_sample.args[2] = i;
+        n += logFormat(&s_sample, line, sizeof(line));
+    }
+    return n;
+}
+
+int main(void) {
+    logRingInit(&s_ring);
+    logWrite(LOG_INFO, "Log bench: round %d call %d value %lu", 3, 7, 1234567ul);
+    logRingPop(&s_ring, &s_sample);
+    char line[LINE_MAX], ref[LINE_MAX];
+    logFormat(&s_sample, line, sizeof(line));
+    snprintf(ref, sizeof(ref), "Log bench: round %d call %d value %lu", 3, 7, 1234567ul);
+    printf("deferred text \"%s\" %s printf\n", line, strcmp(line, ref) == 0 ? "matches" : "DIFFERS from");
+
+    double logNs = benchNsPerCall(runLogI, 20000000);
+    double printfNs = benchNsPerCall(runPrintf, 5000000);
+    benchReport("LOG_I (pack + logRingPush)", logNs);
+    benchReport("Serial.printf, formatting only", printfNs);
+    benchReport("logFormat later, in the log task", benchNsPerCall(runFormat, 5000000));
+    printf("dropped while benchmarking: %lu\n", (unsigned long)s_ring.dropped);
+
+    /* 串口：每字节 10 位；一批 16 行超过 FIFO 后，调用处要等前面的字节发出去 */
+    size_t lineBytes = strlen("Log bench: printf call 15 value 4294967295\n");
+    double byteUs = 10.0 * 1e6 / UART_BAUD;
+    double batchBytes = (double)lineBytes * BATCH;
+    double waitUs = batchBytes > UART_FIFO ? (batchBytes - UART_FIFO) * byteUs / BATCH : 0;
+    printf("UART estimate at %d baud, %d B FIFO: ~%.0f us blocked per Serial.printf in a %d-line burst "
+           "(%zu B lines)\n", UART_BAUD, UART_FIFO, waitUs, BATCH, lineBytes);
+    return strcmp(line, ref) == 0 ? 0 : 1;
+}
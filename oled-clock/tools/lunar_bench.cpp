@@ -0,0 +1,118 @@
+/**
+ * @file lunar_bench.cpp
+ * @brief 主机上比较公历转农历的开销：lunarFromSolar（查表 + 位计数，常数时间）与
+ *        常见的逐年、逐月累减做法（同一张表），以及 solarTermDay
+ *
+ * 编译运行（在 oled-clock/ 下）：
+ *   g++ -std=gnu++11 -O2 -Iinclude -Isrc -Itools tools/lunar_bench.cpp src/lunar_calendar.cpp \
+ *       -o /tmp/lunar_bench
+ *   /tmp/lunar_bench
+ *
+ * 两种做法都对 1900–2100 年的每一天换算；先逐日核对结果一致再计时。
+ */
+#include "bench.h"
+#include "lunar_calendar.h"
+#include "lunar_table.h"
+#include "time_service.h"
+
+#define FIRST_YEAR  1900
+#define DAYS        73414           /* 1900-01-01 .. 2100-12-31 */
+
+struct Ymd {
+    int16_t y;
+    int8_t m;
+    int8_t d;
+};
+
+static Ymd s_days[DAYS];
+
+static uint32_t yearInfo(int ly) {
+    const uint8_t* p = LUNAR_YEAR_INFO[ly - LUNAR_TABLE_FIRST_YEAR];
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16);
+}
+
+static int lunarYearDays(uint32_t info) {
+    int n = ((info >> 13) & 0xF) ? 13 : 12;
+    int days = 0;
+    for (int i = 0; i < n; i++) days += (info >> i) & 1 ? 30 : 29;
+    return days;
+}
+
+/* 常见写法：从表首的正月初一起数天数，先逐年、再逐月减去 */
+static bool walkFromSolar(int year, int month, int day, LunarDate* out) {
+    if (year < LUNAR_TABLE_FIRST_YEAR + 1 || year > LUNAR_TABLE_LAST_YEAR) return false;
+    int64_t days = 0;
+    for (int y = FIRST_YEAR; y < year; y++) days += timeIsLeapYear(y) ? 366 : 365;
+    for (int m = 1; m < month; m++) days += timeDaysInMonth(year, m);
+    days += day - 1;
+    int ly = LUNAR_TABLE_FIRST_YEAR;
+    uint32_t info = yearInfo(ly);
+    days += (timeIsLeapYear(ly) ? 366 : 365) - (int)(info >> 17);   /* 表首农历年正月初一 → 1900-01-01 */
+    int len;
+    while (days >= (len = lunarYearDays(info))) {
+        days -= len;
+        info = yearInfo(++ly);
+    }
+    int leapMonth = (info >> 13) & 0xF;
+    int i = 0;
+    while (days >= (len = (info >> i) & 1 ? 30 : 29)) {
+        days -= len;
+        i++;
+    }
+    out->year = (int16_t)ly;
+    out->day = (int8_t)(days + 1);
+    out->leap = leapMonth != 0 && i == leapMonth;
+    out->month = (int8_t)((leapMonth != 0 && i >= leapMonth) ? i : i + 1);
+    return true;
+}
+
+static uint64_t runTable(uint64_t iters) {
+    uint64_t sum = 0;
+    LunarDate l;
+    for (uint64_t i = 0; i < iters; i++) {
+        const Ymd* p = &s_days[i % DAYS];
+        lunarFromSolar(p->y, p->m, p->d, &l);
+        sum += l.day + l.month;
+    }
+    return sum;
+}
+
+static uint64_t runWalk(uint64_t iters) {
+    uint64_t sum = 0;
+    LunarDate l;
+    for (uint64_t i = 0; i < iters; i++) {
+        const Ymd* p = &s_days[i % DAYS];
+        walkFromSolar(p->y, p->m, p->d, &l);
+        sum += l.day + l.month;
+    }
+    return sum;
+}
+
+static uint64_t runTerms(uint64_t iters) {
+    uint64_t sum = 0;
+    for (uint64_t i = 0; i < iters; i++)
+        sum += solarTermDay(FIRST_YEAR + (int)(i / SOLAR_TERM_COUNT % 201), (int)(i % SOLAR_TERM_COUNT));
+    return sum;
+}
+
+int main(void) {
+    int n = 0;
+    for (int y = FIRST_YEAR; y <= 2100; y++)
+        for (int m = 1; m <= 12; m++)
+            for (int d = 1; d <= timeDaysInMonth(y, m); d++) {
+                Ymd v = { (int16_t)y, (int8_t)m, (int8_t)d };
+                s_days[n++] = v;
+            }
+    int mismatches = 0;
+    for (int i = 0; i < DAYS; i++) {
+        LunarDate a, b;
+        lunarFromSolar(s_days[i].y, s_days[i].m, s_days[i].d, &a);
+        walkFromSolar(s_days[i].y, s_days[i].m, s_days[i].d, &b);
+        if (a.year != b.year || a.month != b.month || a.day != b.day || a.leap != b.leap) mismatches++;
+    }
+    printf("lunar conversion, %d days (1900..2100), mismatches between methods: %d\n", DAYS, mismatches);
+    benchReport("walk years + months", benchNsPerCall(runWalk, 1000000));
+    benchReport("lunarFromSolar", benchNsPerCall(runTable, 20000000));
+    benchReport("solarTermDay", benchNsPerCall(runTerms, 50000000));
+    return mismatches ? 1 : 0;
+}
@@ -0,0 +1,76 @@
+/**
+ * @file month_layout_bench.cpp
+ * @brief 主机上比较月历排版的开销：month_layout（Sakamoto 公式）与改动前的 mktime + localtime_r
+ *
+ * 编译运行（在 oled-clock/ 下）：
+ *   g++ -std=gnu++11 -O2 -Iinclude -Itools tools/month_layout_bench.cpp src/month_layout.cpp \
+ *       -o /tmp/month_layout_bench
+ *   /tmp/month_layout_bench
+ *
+ * 两种做法都对 1900–2100 年的 2412 个月依次求首日星期、天数与行数。
+ */
+#include "bench.h"
+#include "month_layout.h"
+#include <stdlib.h>
+
+#define FIRST_YEAR  1900
+#define MONTHS      (201 * 12)
+
+/* 改动前日历页的做法：mktime 得到 1 日的时间戳，localtime_r 取星期 */
+static int libcRows(int year, int month) {
+    struct tm t = {};
+    t.tm_year = year - 1900;
+    t.tm_mon = month - 1;
+    t.tm_mday = 1;
+    t.tm_hour = 12;
+    t.tm_isdst = -1;
+    time_t ts = mktime(&t);
+    struct tm lt;
+    localtime_r(&ts, &lt);
+    return (lt.tm_wday + timeDaysInMonth(year, month) + 6) / 7;
+}
+
+static uint64_t runLibc(uint64_t iters) {
+    uint64_t sum = 0;
+    for (uint64_t i = 0; i < iters; i++) {
+        int k = (int)(i % MONTHS);
+        sum += libcRows(FIRST_YEAR + k / 12, k % 12 + 1);
+    }
+    return sum;
+}
+
+static uint64_t runLayout(uint64_t iters) {
+    uint64_t sum = 0;
+    for (uint64_t i = 0; i < iters; i++) {
+        int k = (int)(i % MONTHS);
+        MonthLayout l = monthLayoutCompute(FIRST_YEAR + k / 12, k % 12 + 1);
+        sum += l.rows + l.firstWday;
+    }
+    return sum;
+}
+
+static uint64_t runCell(uint64_t iters) {
+    MonthLayout l = monthLayoutCompute(2026, 8);
+    uint64_t sum = 0;
+    for (uint64_t i = 0; i < iters; i++) {
+        int row, col;
+        monthLayoutCell(&l, (int)(i % 31) + 1, &row, &col);
+        sum += row * 7 + col;
+    }
+    return sum;
+}
+
+int main(void) {
+    setenv("TZ", "CST-8", 1);
+    tzset();
+    uint64_t mismatches = 0;
+    for (int k = 0; k < MONTHS; k++)
+        if (libcRows(FIRST_YEAR + k / 12, k % 12 + 1) != monthLayoutCompute(FIRST_YEAR + k / 12, k % 12 + 1).rows)
+            mismatches++;
+    printf("month layout, %d months (%d..%d), mismatches vs libc: %llu\n", MONTHS, FIRST_YEAR,
+           FIRST_YEAR + MONTHS / 12 - 1, (unsigned long long)mismatches);
+    benchReport("mktime + localtime_r", benchNsPerCall(runLibc, 2000000));
+    benchReport("monthLayoutCompute", benchNsPerCall(runLayout, 20000000));
+    benchReport("monthLayoutCell", benchNsPerCall(runCell, 20000000));
+    return mismatches ? 1 : 0;
+}
@@ -0,0 +1,106 @@
+/**
+ * @file time_service_bench.cpp
+ * @brief 主机上比较每帧取时间的开销：time_service（每帧一次 tick、增量推进）与改动前日历页
+ *        一帧里的 3 次 getLocalTime + firstWday（mktime + localtime_r，经 newlib / libc 的 TZ 处理）
+ *
+ * 编译运行（在 oled-clock/ 下）：
+ *   g++ -std=gnu++11 -O2 -Iinclude -Itools tools/time_service_bench.cpp src/time_service.cpp \
+ *       src/tz_engine.cpp -o /tmp/time_service_bench
+ *   /tmp/time_service_bench
+ *
+ * 墙钟由本程序提供的 time() 代替（覆盖 libc 的同名函数），按 30 帧 / 秒推进，两边看到同一个时钟。
+ * 计时前先按帧走完两天（含两次本地零点），逐帧核对两边的本地时间一致。
+ */
+#include "bench.h"
+#include "time_service.h"
+#include "tz_engine.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define FRAMES_PER_S  30
+#define START_EPOCH   1767196800LL     /* 2025-12-31 16:00 UTC = 2026-01-01 00:00 北京时间 */
+#define POSIX_TZ      "CST-8"          /* 改动前 sntp_service 设置的 TZ */
+
+static uint64_t s_frame;
+
+extern "C" time_t time(time_t* out) {
+    time_t t = (time_t)(START_EPOCH - 3600 + (int64_t)(s_frame / FRAMES_PER_S));
+    if (out) *out = t;
+    return t;
+}
+
+/* Arduino 的 getLocalTime：time + localtime_r，年份有效即返回（不含等待重试） */
+static bool getLocalTime(struct tm* info) {
+    time_t now;
+    time(&now);
+    localtime_r(&now, info);
+    return info->tm_year > (2016 - 1900);
+}
+
+/* 改动前 calendar_screen 的 firstWday：mktime 得到 1 日的时间戳，再 localtime_r 取星期 */
+static int firstWday(int year, int month) {
+    struct tm t = {};
+    t.tm_year = year - 1900;
+    t.tm_mon = month - 1;
+    t.tm_mday = 1;
+    t.tm_hour = 12;
+    t.tm_isdst = -1;
+    time_t ts = mktime(&t);
+    struct tm lt;
+    localtime_r(&ts, &lt);
+    return lt.tm_wday;
+}
+
+/* 改动前日历页的一帧：loop 的 STATE_CALENDAR 分支两次、clockScreenDraw 一次、firstWday 一次 */
+static uint64_t runBefore(uint64_t frames) {
+    uint64_t sum = 0;
+    struct tm a, b, c;
+    for (uint64_t i = 0; i < frames; i++) {
+        s_frame++;
+        getLocalTime(&a);
+        getLocalTime(&b);
+        getLocalTime(&c);
+        sum += a.tm_sec + b.tm_min + c.tm_hour + firstWday(c.tm_year + 1900, c.tm_mon + 1);
+    }
+    return sum;
+}
+
+/* 现在的一帧：tick 一次，三处读取同一份快照，1 日星期用 Sakamoto 公式 */
+static uint64_t runAfter(uint64_t frames) {
+    uint64_t sum = 0;
+    struct tm a, b, c;
+    for (uint64_t i = 0; i < frames; i++) {
+        s_frame++;
+        timeServiceTick();
+        timeServiceNow(&a);
+        timeServiceNow(&b);
+        timeServiceNow(&c);
+        sum += a.tm_sec + b.tm_min + c.tm_hour + timeDayOfWeek(c.tm_year + 1900, c.tm_mon + 1, 1);
+    }
+    return sum;
+}
+
+int main(void) {
+    setenv("TZ", POSIX_TZ, 1);
+    tzset();
+    tzSelect(TZ_DEFAULT_ZONE);
+    timeServiceInvalidate();
+
+    int mismatches = 0;
+    const uint64_t checkFrames = 2ull * 86400 * FRAMES_PER_S;
+    for (s_frame = 0; s_frame < checkFrames; s_frame++) {
+        struct tm ours, libc;
+        timeServiceTick();
+        timeServiceNow(&ours);
+        getLocalTime(&libc);
+        if (ours.tm_sec != libc.tm_sec || ours.tm_min != libc.tm_min || ours.tm_hour != libc.tm_hour ||
+            ours.tm_mday != libc.tm_mday || ours.tm_mon != libc.tm_mon || ours.tm_year != libc.tm_year ||
+            ours.tm_wday != libc.tm_wday || ours.tm_yday != libc.tm_yday)
+            mismatches++;
+    }
+    printf("calendar frame at %d fps, %s: mismatches over %llu frames: %d\n", FRAMES_PER_S, POSIX_TZ,
+           (unsigned long long)checkFrames, mismatches);
+    benchReport("before: 3x getLocalTime + firstWday", benchNsPerCall(runBefore, 2000000));
+    benchReport("after: timeServiceTick + 3x Now", benchNsPerCall(runAfter, 20000000));
+    return mismatches ? 1 : 0;
+}
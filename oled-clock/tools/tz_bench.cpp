@@ -0,0 +1,93 @@
+/**
+ * @file tz_bench.cpp
+ * @brief 主机上比较 UTC → 本地时间的开销：tz_engine（偏移表 + 区间缓存）与改动前的
+ *        setenv("TZ") + localtime_r（POSIX 规则串，以及系统 tz 数据库）
+ *
+ * 编译运行（在 oled-clock/ 下）：
+ *   g++ -std=gnu++11 -O2 -Iinclude -Itools tools/tz_bench.cpp src/tz_engine.cpp -o /tmp/tz_bench
+ *   /tmp/tz_bench
+ *
+ * 时区为 America/New_York。「顺序」每次前进 1 秒（设备每秒换算一次），缓存总是命中；
+ * 「随机」在 2020–2080 年内乱跳，每次都要二分查找。计时前先核对两边结果一致。
+ */
+#include "bench.h"
+#include "tz_engine.h"
+#include <stdlib.h>
+
+#define ZONE_NAME    "America/New_York"
+#define POSIX_RULE   "EST5EDT,M3.2.0,M11.1.0"
+#define RANGE_FIRST  1577836800LL   /* 2020-01-01 00:00 UTC */
+#define RANGE_SPAN   1924992000LL   /* 到 2081-01-01 */
+
+static int64_t seqAt(uint64_t i) {
+    return 1750000000LL + (int64_t)i;
+}
+
+static int64_t randAt(uint64_t i) {
+    uint32_t x = (uint32_t)i * 2654435761u;
+    return RANGE_FIRST + (int64_t)((uint64_t)x * (uint64_t)RANGE_SPAN >> 32);
+}
+
+template <int64_t (*At)(uint64_t)>
+static uint64_t runEngine(uint64_t iters) {
+    uint64_t sum = 0;
+    struct tm tm;
+    for (uint64_t i = 0; i < iters; i++) {
+        tzLocalTime(At(i), &tm, NULL);
+        sum += tm.tm_hour + tm.tm_mday;
+    }
+    return sum;
+}
+
+template <int64_t (*At)(uint64_t)>
+static uint64_t runLibc(uint64_t iters) {
+    uint64_t sum = 0;
+    struct tm tm;
+    for (uint64_t i = 0; i < iters; i++) {
+        time_t t = (time_t)At(i);
+        localtime_r(&t, &tm);
+        sum += tm.tm_hour + tm.tm_mday;
+    }
+    return sum;
+}
+
+static int mismatches(const char* tz) {
+    setenv("TZ", tz, 1);
+    tzset();
+    int bad = 0;
+    for (uint64_t i = 0; i < 2000000; i++) {
+        int64_t t = randAt(i);
+        struct tm a, b;
+        tzLocalTime(t, &a, NULL);
+        time_t tt = (time_t)t;
+        localtime_r(&tt, &b);
+        if (a.tm_hour != b.tm_hour || a.tm_mday != b.tm_mday || a.tm_isdst != b.tm_isdst) bad++;
+    }
+    return bad;
+}
+
+int main(void) {
+    tzSelect(tzFindZone(ZONE_NAME));
+    int badDb = mismatches(ZONE_NAME);
+    int badRule = mismatches(POSIX_RULE);
+    printf("%s, 2020..2080, mismatches in 2e6 random instants: tzdb %d, POSIX rule %d\n", ZONE_NAME, badDb, badRule);
+
+    printf("sequential (1 s steps)\n");
+    setenv("TZ", POSIX_RULE, 1);
+    tzset();
+    benchReport("localtime_r, POSIX rule", benchNsPerCall(runLibc<seqAt>, 5000000));
+    setenv("TZ", ZONE_NAME, 1);
+    tzset();
+    benchReport("localtime_r, tzdb", benchNsPerCall(runLibc<seqAt>, 5000000));
+    benchReport("tzLocalTime (cache hit)", benchNsPerCall(runEngine<seqAt>, 50000000));
+
+    printf("random instants\n");
+    setenv("TZ", POSIX_RULE, 1);
+    tzset();
+    benchReport("localtime_r, POSIX rule", benchNsPerCall(runLibc<randAt>, 5000000));
+    setenv("TZ", ZONE_NAME, 1);
+    tzset();
+    benchReport("localtime_r, tzdb", benchNsPerCall(runLibc<randAt>, 5000000));
+    benchReport("tzLocalTime (binary search)", benchNsPerCall(runEngine<randAt>, 20000000));
+    return badDb || badRule ? 1 : 0;
+}
@@ -0,0 +1,122 @@
+// 配置页客户端：页面本身是静态资源，动态值从 /api/config 读取
+(function () {
+  var loc = document.getElementById('location');
+  fetch('/api/config', { cache: 'no-store' })
+    .then(function (r) { return r.json(); })
+    .then(function (c) {
+      loc.value = c.location || '';
+      var tz = document.getElementById('tz');
+      (c.zones || []).forEach(function (z) {
+        var o = document.createElement('option');
+        o.value = o.textContent = z;
+        o.selected = (z === c.tz);
+        tz.appendChild(o);
+      });
+      if (c.net_policy) document.getElementById('netpol').value = c.net_policy;
+      if (c.power_profile) document.getElementById('pprof').value = c.power_profile;
+      var PROFILE_NAMES = { performance: '性能', balanced: '均衡', saver: '省电', critical: '极省' };
+      if (c.power_active)
+        document.getElementById('power-now').textContent =
+          '当前：' + (PROFILE_NAMES[c.power_active] || c.power_active) + '，电量 ' + c.battery + '%';
+    })
+    .catch(function () {});
+
+  // 闹钟：列表来自 /api/alarms，增改删都提交到 POST /alarms（d0..d6 = 周日..周六）
+  var DAY_NAMES = ['日', '一', '二', '三', '四', '五', '六'];
+  var daysSpan = document.getElementById('alarm-days');
+  var dayOrder = [1, 2, 3, 4, 5, 6, 0];
+  dayOrder.forEach(function (d) {
+    var l = document.createElement('label');
+    l.innerHTML = '<input type="checkbox" name="d' + d + '" value="1">' + DAY_NAMES[d];
+    daysSpan.appendChild(l);
+  });
+  function pad(n) { return (n < 10 ? '0' : '') + n; }
+  function daysText(mask) {
+    if (mask === 0) return '单次';
+    if (mask === 127) return '每天';
+    return dayOrder.filter(function (d) { return mask & (1 << d); })
+      .map(function (d) { return DAY_NAMES[d]; }).join('');
+  }
+  function postAlarm(fields) {
+    var f = document.createElement('form');
+    f.method = 'post';
+    f.action = '/alarms';
+    Object.keys(fields).forEach(function (k) {
+      var i = document.createElement('input');
+      i.type = 'hidden';
+      i.name = k;
+      i.value = fields[k];
+      f.appendChild(i);
+    });
+    document.body.appendChild(f);
+    f.submit();
+  }
+  function editAlarm(i, a) {
+    var idx = document.getElementById('alarm-i');
+    idx.value = i;
+    idx.disabled = false;
+    document.getElementById('alarm-time').value = pad(a.hour) + ':' + pad(a.minute);
+    document.getElementById('alarm-enabled').checked = a.enabled;
+    for (var d = 0; d < 7; d++)
+      document.querySelector('[name=d' + d + ']').checked = !!(a.days & (1 << d));
+    document.getElementById('alarm-submit').textContent = '保存';
+  }
+  fetch('/api/alarms', { cache: 'no-store' })
+    .then(function (r) { return r.json(); })
+    .then(function (c) {
+      var table = document.getElementById('alarms');
+      c.alarms.forEach(function (a, i) {
+        var tr = table.insertRow();
+        tr.insertCell().textContent = pad(a.hour) + ':' + pad(a.minute);
+        tr.insertCell().textContent = daysText(a.days);
+        tr.insertCell().textContent = a.enabled ? '开' : '关';
+        var ops = tr.insertCell();
+        [['编辑', function () { editAlarm(i, a); }],
+         ['删除', function () { postAlarm({ i: i, delete: 1 }); }]].forEach(function (b) {
+          var btn = document.createElement('button');
+          btn.type = 'button';
+          btn.textContent = b[0];
+          btn.onclick = b[1];
+          ops.appendChild(btn);
+        });
+      });
+      if (c.alarms.length >= c.max) document.getElementById('alarm-submit').disabled = true;
+      if (c.next)
+        document.getElementById('alarm-next').textContent =
+          '下次响铃：' + new Date(c.next.utc * 1000).toLocaleString();
+    })
+    .catch(function () {});
+
+  // 能耗估算：各子系统开机以来 mAh、平均电流与上一窗口的平均电流
+  var ENERGY_NAMES = {
+    cpu_active: 'CPU 工作', cpu_idle: 'CPU 等待', cpu_light_sleep: 'CPU 浅睡', radio: 'WiFi 射频',
+    tls: 'TLS 握手', i2c: '屏幕 I2C', display: '屏幕面板', adc: '电量 ADC', buzzer: '蜂鸣器'
+  };
+  fetch('/api/energy', { cache: 'no-store' })
+    .then(function (r) { return r.json(); })
+    .then(function (e) {
+      var table = document.getElementById('energy');
+      var head = table.insertRow();
+      ['子系统', 'mAh', '平均 mA', '近期 mA'].forEach(function (t) { head.insertCell().textContent = t; });
+      function row(name, boot, win) {
+        var tr = table.insertRow();
+        tr.insertCell().textContent = name;
+        tr.insertCell().textContent = boot.mah.toFixed(3);
+        tr.insertCell().textContent = boot.ma.toFixed(2);
+        tr.insertCell().textContent = win ? win.ma.toFixed(2) : '-';
+      }
+      Object.keys(e.boot.items).forEach(function (k) {
+        row(ENERGY_NAMES[k] || k, e.boot.items[k], e.window && e.window.items[k]);
+      });
+      row('合计', { mah: e.boot.total_mah, ma: e.boot.total_ma },
+          e.window && { ma: e.window.total_ma });
+      document.getElementById('energy-note').textContent =
+        '统计 ' + e.boot.hours.toFixed(2) + ' 小时；按此电流 ' + e.battery_mah + 'mAh 电池约可用 ' +
+        e.projected_hours.toFixed(1) + ' 小时';
+    })
+    .catch(function () {});
+
+  document.getElementById('resetwifi').onsubmit = function () {
+    return confirm('确定清除当前 WiFi 并重新配网？');
+  };
+})();
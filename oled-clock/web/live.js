@@ -0,0 +1,102 @@
+// 画面镜像客户端：解码 frame_codec 格式（整帧 / 按页 XOR 差分 + 游程）并绘制到 canvas
+(function () {
+  var W = 128, PAGES = 8, SCALE = 4;
+  var fb = new Uint8Array(W * PAGES);
+  var canvas = document.getElementById('screen');
+  var ctx = canvas.getContext('2d');
+  var stats = document.getElementById('stats');
+  var rxBytes = 0, rxFrames = 0, haveKey = false;
+  // 录制：保存解码后的整帧，停止时下载为依次拼接的 1024 字节原始帧（tools/frame_codec_sim.cpp 的输入）
+  var REC_MAX = 3000;
+  var recBtn = document.getElementById('rec');
+  var recInfo = document.getElementById('recInfo');
+  var recording = null;
+
+  function saveRecording() {
+    var blob = new Blob(recording, { type: 'application/octet-stream' });
+    var a = document.createElement('a');
+    a.href = URL.createObjectURL(blob);
+    a.download = 'oled-frames-' + recording.length + '.bin';
+    a.click();
+    URL.revokeObjectURL(a.href);
+    recInfo.textContent = '已保存 ' + recording.length + ' 帧';
+    recording = null;
+    recBtn.textContent = '录制';
+  }
+
+  recBtn.onclick = function () {
+    if (recording) { saveRecording(); return; }
+    recording = [];
+    recBtn.textContent = '停止并下载';
+    recInfo.textContent = '录制中…';
+  };
+
+  function record() {
+    if (!recording) return;
+    recording.push(fb.slice());
+    recInfo.textContent = '录制中… ' + recording.length + ' 帧';
+    if (recording.length >= REC_MAX) saveRecording();
+  }
+
+  function decode(msg) {
+    if (msg.length < 2) return false;
+    if (msg[0] === 1) { fb.fill(0); haveKey = true; }
+    else if (msg[0] !== 2 || !haveKey) return false;
+    var mask = msg[1], i = 2;
+    for (var p = 0; p < PAGES; p++) {
+      if (!(mask & (1 << p))) continue;
+      var base = p * W, k = 0;
+      while (k < W) {
+        if (i >= msg.length) return false;
+        var c = msg[i++], j;
+        if (c & 0x80) {
+          var r = (c & 0x7f) + 2, v = msg[i++];
+          for (j = 0; j < r; j++) fb[base + k++] ^= v;
+        } else {
+          for (j = 0; j <= c; j++) fb[base + k++] ^= msg[i++];
+        }
+      }
+    }
+    return true;
+  }
+
+  function draw() {
+    ctx.fillStyle = '#000';
+    ctx.fillRect(0, 0, canvas.width, canvas.height);
+    ctx.fillStyle = '#8cf';
+    for (var p = 0; p < PAGES; p++) {
+      for (var x = 0; x < W; x++) {
+        var b = fb[p * W + x];
+        if (!b) continue;
+        for (var bit = 0; bit < 8; bit++) {
+          if (b & (1 << bit)) ctx.fillRect(x * SCALE, (p * 8 + bit) * SCALE, SCALE, SCALE);
+        }
+      }
+    }
+  }
+
+  function connect() {
+    var ws = new WebSocket('ws://' + location.hostname + ':81/');
+    ws.binaryType = 'arraybuffer';
+    ws.onmessage = function (ev) {
+      if (typeof ev.data === 'string') {
+        var s = JSON.parse(ev.data);
+        stats.textContent = '设备：' + s.fps + ' 帧/秒，' + s.bps + ' B/s，CPU ' + s.cpu +
+          '%，拥塞丢帧 ' + s.drop + '，间隔 ' + s.interval + ' ms ｜ 已收 ' + rxFrames +
+          ' 帧 / ' + rxBytes + ' B';
+        return;
+      }
+      var msg = new Uint8Array(ev.data);
+      rxBytes += msg.length;
+      rxFrames++;
+      if (decode(msg)) { draw(); record(); }
+    };
+    ws.onclose = function () {
+      haveKey = false;
+      stats.textContent = '连接断开，重连中…';
+      setTimeout(connect, 2000);
+    };
+  }
+
+  connect();
+})();